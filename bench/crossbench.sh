@@ -0,0 +1,152 @@
+#!/bin/bash
+# Cross-implementation benchmark: the C++ simulator (cpp/) against the
+# Rust port (rs/). Both binaries are driven through the same external
+# scenario — a PTY sink read by this harness — and measured from the
+# consumer's side, so neither implementation grades its own homework:
+# cycles/sec and p99 inter-cycle jitter come from arrival timestamps at
+# the reader, RSS from the kernel (VmHWM), startup time from spawn to
+# first byte.
+#
+# Honest-comparison notes, measured against what the ports actually
+# support today:
+#   - The Rust port has no seed, no cycle count, no --calibrate and
+#     only the linked-PTY sink at a fixed 1 Hz; scenarios it cannot run
+#     (seeded runs, null-sink ceiling, pipe sink) are reported for C++
+#     and marked n/a for Rust rather than approximated.
+#   - The C++ null-sink ceiling uses --calibrate --calibrate-json, the
+#     machine-readable form of the calibration report.
+#
+# Usage: bench/crossbench.sh [seconds-per-scenario]   (default 10)
+# Binaries are built if missing; CPP_BIN / RS_BIN override the paths.
+
+set -u
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+DURATION=${1:-10}
+TMP=$(mktemp -d /tmp/crossbench.XXXXXX)
+trap 'rm -rf "$TMP"' EXIT
+
+CPP_BIN=${CPP_BIN:-$ROOT/cpp/build/nmea_simulator}
+RS_BIN=${RS_BIN:-$ROOT/rs/target/release/nmea_simulator}
+
+if [ ! -x "$CPP_BIN" ]; then
+    echo "Building C++ simulator..."
+    cmake -S "$ROOT/cpp" -B "$ROOT/cpp/build" >/dev/null && \
+        cmake --build "$ROOT/cpp/build" -j"$(nproc)" --target nmea_simulator >/dev/null
+fi
+if [ ! -x "$CPP_BIN" ]; then
+    echo "Error: C++ simulator not found at $CPP_BIN" >&2
+    exit 1
+fi
+
+RS_OK=1
+if [ ! -x "$RS_BIN" ]; then
+    echo "Building Rust port..."
+    (cd "$ROOT/rs" && cargo build --release >/dev/null 2>&1) || RS_OK=0
+fi
+[ -x "$RS_BIN" ] || RS_OK=0
+[ "$RS_OK" = 1 ] || echo "Warning: Rust port unavailable; its rows will be n/a" >&2
+
+# Read cycle starts (RMC lines) from a tty/pipe for a fixed window and
+# emit one JSON line: first-byte latency, cycles/sec over the window
+# and p99 inter-cycle jitter (absolute deviation from the median gap).
+read_metrics() { # $1 = path, $2 = seconds, $3 = spawn epoch (s.ns)
+    python3 - "$1" "$2" "$3" <<'EOF'
+import json, sys, time
+path, secs, spawn = sys.argv[1], float(sys.argv[2]), float(sys.argv[3])
+deadline = time.monotonic() + secs + 20
+while time.monotonic() < deadline:
+    try:
+        # Unbuffered: a buffered reader would block filling 4 KB and
+        # burst several cycles at once, wrecking the jitter numbers
+        f = open(path, 'rb', buffering=0)
+        break
+    except OSError:
+        time.sleep(0.02)
+else:
+    print(json.dumps({"error": "sink never appeared"})); sys.exit(0)
+first = None
+stamps = []
+end = None
+buf = b''
+while end is None or time.time() < end:
+    chunk = f.read(4096)
+    if not chunk:
+        time.sleep(0.005)
+        continue
+    if first is None:
+        first = time.time() - spawn
+        end = time.time() + secs
+    buf += chunk
+    while b'\n' in buf:
+        line, buf = buf.split(b'\n', 1)
+        if line.startswith(b'$') and line[3:6] == b'RMC':
+            stamps.append(time.time())
+out = {"first_byte_s": round(first, 3) if first is not None else None,
+       "cycles": len(stamps)}
+if len(stamps) >= 3:
+    gaps = sorted(b - a for a, b in zip(stamps, stamps[1:]))
+    median = gaps[len(gaps) // 2]
+    jitter = sorted(abs(g - median) for g in gaps)
+    out["cycles_per_sec"] = round(len(stamps) / (stamps[-1] - stamps[0]), 2)
+    out["p99_jitter_ms"] = round(jitter[min(len(jitter) - 1,
+                                            int(len(jitter) * 0.99))] * 1e3, 3)
+print(json.dumps(out))
+EOF
+}
+
+peak_rss_kb() { # $1 = pid
+    awk '/VmHWM/ { print $2 }' "/proc/$1/status" 2>/dev/null
+}
+
+json_get() { # $1 = json, $2 = key
+    python3 -c 'import json,sys; v=json.loads(sys.argv[1]).get(sys.argv[2]); print("n/a" if v is None else v)' "$1" "$2"
+}
+
+echo "== C++ null-sink ceiling (--calibrate $DURATION, seeded) =="
+CPP_CAL=$("$CPP_BIN" --calibrate "$DURATION" --calibrate-json --seed 1 2>/dev/null | grep '^{')
+echo "$CPP_CAL"
+echo
+
+echo "== PTY sink, ${DURATION}s window, measured at the reader =="
+CPP_TTY="$TMP/cpp.tty"
+SPAWN=$(date +%s.%N)
+"$CPP_BIN" --link "$CPP_TTY" --seed 1 --quiet >/dev/null 2>&1 &
+CPP_PID=$!
+CPP_PTY=$(read_metrics "$CPP_TTY" "$DURATION" "$SPAWN")
+CPP_RSS=$(peak_rss_kb "$CPP_PID")
+kill -INT "$CPP_PID" 2>/dev/null; wait "$CPP_PID" 2>/dev/null
+
+RS_PTY='{}'
+RS_RSS=""
+if [ "$RS_OK" = 1 ]; then
+    SPAWN=$(date +%s.%N)
+    "$RS_BIN" "$TMP/rs.in.tty" "$TMP/rs.out.tty" >/dev/null 2>&1 &
+    RS_PID=$!
+    RS_PTY=$(read_metrics "$TMP/rs.out.tty" "$DURATION" "$SPAWN")
+    RS_RSS=$(peak_rss_kb "$RS_PID")
+    kill -INT "$RS_PID" 2>/dev/null; wait "$RS_PID" 2>/dev/null
+fi
+
+echo "== C++ pipe sink, ${DURATION}s window (rust: n/a, PTY sink only) =="
+CPP_FIFO="$TMP/cpp.fifo"
+mkfifo "$CPP_FIFO"
+SPAWN=$(date +%s.%N)
+"$CPP_BIN" --pipe "$CPP_FIFO" --seed 1 --quiet >/dev/null 2>&1 &
+CPP_PID=$!
+CPP_PIPE=$(read_metrics "$CPP_FIFO" "$DURATION" "$SPAWN")
+kill -INT "$CPP_PID" 2>/dev/null; wait "$CPP_PID" 2>/dev/null
+
+echo
+printf '%-22s %14s %14s\n' "metric" "cpp" "rust"
+printf '%-22s %14s %14s\n' "startup to 1st byte s" \
+    "$(json_get "$CPP_PTY" first_byte_s)" "$(json_get "$RS_PTY" first_byte_s)"
+printf '%-22s %14s %14s\n' "cycles/sec (PTY)" \
+    "$(json_get "$CPP_PTY" cycles_per_sec)" "$(json_get "$RS_PTY" cycles_per_sec)"
+printf '%-22s %14s %14s\n' "p99 jitter ms (PTY)" \
+    "$(json_get "$CPP_PTY" p99_jitter_ms)" "$(json_get "$RS_PTY" p99_jitter_ms)"
+printf '%-22s %14s %14s\n' "cycles/sec (pipe)" \
+    "$(json_get "$CPP_PIPE" cycles_per_sec)" "n/a"
+printf '%-22s %14s %14s\n' "cycles/sec (null)" \
+    "$(json_get "$CPP_CAL" cycles_per_sec)" "n/a"
+printf '%-22s %14s %14s\n' "peak RSS KB" "${CPP_RSS:-n/a}" "${RS_RSS:-n/a}"
@@ -0,0 +1,54 @@
+#!/bin/bash
+# Consumer-observed latency benchmark: the simulator on a linked PTY,
+# read back by latency_probe, which stamps every $PSIMT trailer on
+# arrival against its embedded monotonic transmit stamp. The report is
+# the one-way generation-to-read latency distribution plus loss, per
+# cycle rate — the number the platform side signs off on, since it
+# includes scheduler, tty-layer and read-side effects the generator
+# microbenchmarks cannot see. Both stamps come from the same machine's
+# CLOCK_MONOTONIC, so no clock alignment is involved.
+#
+# Usage: bench/latency_bench.sh [seconds-per-rate]   (default 10)
+# CPP_BIN / PROBE_BIN override the binary paths; RATES_HZ overrides
+# the swept cycle rates (default "1 10 50 100").
+
+set -u
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+DURATION=${1:-10}
+RATES_HZ=${RATES_HZ:-"1 10 50 100"}
+TMP=$(mktemp -d /tmp/latency_bench.XXXXXX)
+trap 'rm -rf "$TMP"' EXIT
+
+CPP_BIN=${CPP_BIN:-$ROOT/cpp/build/nmea_simulator}
+PROBE_BIN=${PROBE_BIN:-$ROOT/cpp/build/latency_probe}
+
+if [ ! -x "$CPP_BIN" ] || [ ! -x "$PROBE_BIN" ]; then
+    echo "Building simulator and probe..."
+    cmake -S "$ROOT/cpp" -B "$ROOT/cpp/build" >/dev/null && \
+        cmake --build "$ROOT/cpp/build" -j"$(nproc)" \
+            --target nmea_simulator latency_probe >/dev/null
+fi
+for bin in "$CPP_BIN" "$PROBE_BIN"; do
+    if [ ! -x "$bin" ]; then
+        echo "Error: $bin not found" >&2
+        exit 1
+    fi
+done
+
+# Default sentence set plus the PSIMT trailer the probe keys on
+SENTENCES="RMC,GGA,GSA,GSV,GLL,VTG,PSIMT"
+
+echo "== Consumer-observed latency, ${DURATION}s per rate, PTY sink =="
+for HZ in $RATES_HZ; do
+    TTY="$TMP/lat.tty"
+    INTERVAL=$(python3 -c "print(1.0 / $HZ)")
+    "$CPP_BIN" --link "$TTY" --interval "$INTERVAL" \
+        --sentences "$SENTENCES" --seed 1 --quiet >/dev/null 2>&1 &
+    SIM_PID=$!
+    printf '%6s Hz: ' "$HZ"
+    "$PROBE_BIN" "$TTY" "$DURATION" || true
+    kill -INT "$SIM_PID" 2>/dev/null
+    wait "$SIM_PID" 2>/dev/null
+    rm -f "$TTY"
+done
@@ -0,0 +1,55 @@
+#!/bin/bash
+# Metrics gate: a standalone --tcp run with an attached consumer must
+# publish live sink counters through --metrics. Guards the regression
+# where the network writer loops skipped recordCycle and a remote
+# scraper saw {"sinks":{}} while the sink was demonstrably emitting —
+# an empty snapshot in exactly the modes a scraper would monitor.
+#
+# Usage: bench/metrics_check.sh   (CPP_BIN overrides the binary path)
+
+set -u
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+CPP_BIN=${CPP_BIN:-$ROOT/cpp/build/nmea_simulator}
+PORT=${PORT:-29573}
+NAME=nmea-metrics-check-$$
+
+if [ ! -x "$CPP_BIN" ]; then
+    echo "Error: simulator not found at $CPP_BIN" >&2
+    exit 1
+fi
+
+"$CPP_BIN" --tcp 127.0.0.1:"$PORT" --metrics "$NAME" --interval 0.1 \
+    --duration 8 --quiet >/dev/null 2>&1 &
+SIM=$!
+trap 'kill $SIM 2>/dev/null; wait $SIM 2>/dev/null' EXIT
+sleep 1
+
+python3 - "$PORT" "$NAME" <<'EOF'
+import json, socket, sys, time
+port, name = int(sys.argv[1]), sys.argv[2]
+
+# Attach a TCP consumer and draw a few cycles so the counters move
+c = socket.create_connection(('127.0.0.1', port), timeout=5)
+got = 0
+t = time.time()
+while got < 2048 and time.time() - t < 5:
+    got += len(c.recv(4096))
+
+# Scrape the metrics endpoint (abstract unix socket, one snapshot per
+# connection)
+m = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+m.connect('\0' + name)
+raw = b''
+while True:
+    chunk = m.recv(4096)
+    if not chunk:
+        break
+    raw += chunk
+snap = json.loads(raw)
+tcp = snap.get('sinks', {}).get('tcp')
+if not tcp or tcp.get('cycles', 0) == 0:
+    print('FAIL: metrics snapshot has no live tcp counters:', json.dumps(snap))
+    sys.exit(1)
+print('PASS: tcp sink metrics live:', json.dumps(tcp))
+EOF
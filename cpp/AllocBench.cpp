@@ -0,0 +1,76 @@
+// AllocBench.cpp
+//
+// Allocation-regression guard for the generation hot path. Interposes a
+// counting global allocator, warms the generator up (buffer growth,
+// arena sizing, satellite table population), then requires that
+// steady-state cycles perform zero heap allocations. Exits non-zero on
+// regression so the `bench_alloc` target can gate refactors.
+#include "NmeaGenerator.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<size_t> g_alloc_count { 0 };
+
+void* operator new(std::size_t size)
+{
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+int main()
+{
+    constexpr size_t warmup_cycles = 256;
+    constexpr size_t bench_cycles  = 10000;
+
+    NmeaGenerator generator;
+    std::string cycle_data;
+    cycle_data.reserve(4096);
+
+    // Warm-up: let the cycle buffer, arena and satellite table reach
+    // their steady-state sizes
+    for (size_t i = 0; i < warmup_cycles; ++i) {
+        cycle_data.clear();
+        generator.generateAllSentences(cycle_data);
+    }
+
+    size_t allocs_before = g_alloc_count.load();
+    auto start           = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < bench_cycles; ++i) {
+        cycle_data.clear();
+        generator.generateAllSentences(cycle_data);
+    }
+
+    auto elapsed       = std::chrono::steady_clock::now() - start;
+    size_t allocs      = g_alloc_count.load() - allocs_before;
+    double seconds     = std::chrono::duration<double>(elapsed).count();
+    double cycles_sec  = bench_cycles / seconds;
+
+    std::printf("cycles: %zu, elapsed: %.3f s, throughput: %.0f cycles/s\n",
+                bench_cycles, seconds, cycles_sec);
+    std::printf("steady-state allocations: %zu\n", allocs);
+
+    if (allocs != 0) {
+        std::fprintf(stderr, "FAIL: steady-state cycles performed %zu heap allocations\n", allocs);
+        return 1;
+    }
+    std::printf("PASS: zero allocations in steady state\n");
+    return 0;
+}
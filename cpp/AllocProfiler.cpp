@@ -0,0 +1,163 @@
+// AllocProfiler.cpp
+#include "AllocProfiler.hpp"
+
+#ifdef NMEA_ALLOC_PROFILE
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+constexpr int kMaxSites = 64;
+
+struct Site {
+    const char* name = nullptr;
+    std::atomic<uint64_t> allocs { 0 };
+    std::atomic<uint64_t> frees { 0 };
+    std::atomic<uint64_t> bytes { 0 };
+    std::atomic<uint64_t> live_bytes { 0 };
+};
+
+// Slot 0 catches everything outside a tagged scope. Plain statics so
+// the table is usable before main() and after other destructors run.
+Site sites[kMaxSites];
+std::atomic<int> site_count { 1 };
+thread_local int current_site = 0;
+
+// Prefix header so the free is charged to the allocating site. 16
+// bytes keeps the returned pointer aligned for max_align_t.
+struct Header {
+    uint32_t site;
+    uint32_t pad;
+    uint64_t size;
+};
+
+void* profiledAlloc(std::size_t size)
+{
+    auto* h = static_cast<Header*>(std::malloc(sizeof(Header) + size));
+    if (h == nullptr) {
+        return nullptr;
+    }
+    int s = current_site;
+    h->site = static_cast<uint32_t>(s);
+    h->size = size;
+    sites[s].allocs.fetch_add(1, std::memory_order_relaxed);
+    sites[s].bytes.fetch_add(size, std::memory_order_relaxed);
+    sites[s].live_bytes.fetch_add(size, std::memory_order_relaxed);
+    return h + 1;
+}
+
+void profiledFree(void* ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    Header* h = static_cast<Header*>(ptr) - 1;
+    Site& site = sites[h->site];
+    site.frees.fetch_add(1, std::memory_order_relaxed);
+    site.live_bytes.fetch_sub(h->size, std::memory_order_relaxed);
+    std::free(h);
+}
+
+// Dumps the table from a static destructor; counters are plain atomics
+// so this is safe however late in shutdown it runs.
+struct Reporter {
+    ~Reporter()
+    {
+        if (sites[0].name == nullptr) {
+            sites[0].name = "(untagged)";
+        }
+        std::fprintf(stderr, "\n[alloc] %-40s %10s %10s %14s %12s\n",
+                     "site", "allocs", "frees", "bytes", "live");
+        int n = site_count.load(std::memory_order_relaxed);
+        if (n > kMaxSites) {
+            n = kMaxSites;
+        }
+        for (int i = 0; i < n; ++i) {
+            const Site& s = sites[i];
+            uint64_t allocs = s.allocs.load(std::memory_order_relaxed);
+            if (allocs == 0) {
+                continue;
+            }
+            std::fprintf(stderr, "[alloc] %-40s %10llu %10llu %14llu %12llu\n",
+                         s.name != nullptr ? s.name : "(overflow)",
+                         static_cast<unsigned long long>(allocs),
+                         static_cast<unsigned long long>(s.frees.load(std::memory_order_relaxed)),
+                         static_cast<unsigned long long>(s.bytes.load(std::memory_order_relaxed)),
+                         static_cast<unsigned long long>(s.live_bytes.load(std::memory_order_relaxed)));
+        }
+    }
+};
+Reporter reporter;
+
+} // namespace
+
+namespace alloc_profile {
+
+int registerSite(const char* name)
+{
+    int slot = site_count.fetch_add(1, std::memory_order_relaxed);
+    if (slot >= kMaxSites) {
+        // Table full: fold the extra site into the untagged slot
+        // rather than corrupt memory.
+        return 0;
+    }
+    sites[slot].name = name;
+    return slot;
+}
+
+Scope::Scope(int site)
+    : prev_(current_site)
+{
+    current_site = site;
+}
+
+Scope::~Scope()
+{
+    current_site = prev_;
+}
+
+} // namespace alloc_profile
+
+// Global replacements. The over-aligned (align_val_t) overloads are
+// left alone; they pair with their own delete so the books stay
+// consistent either way.
+void* operator new(std::size_t size)
+{
+    void* p = profiledAlloc(size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new[](std::size_t size)
+{
+    void* p = profiledAlloc(size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return profiledAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return profiledAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept { profiledFree(ptr); }
+void operator delete[](void* ptr) noexcept { profiledFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { profiledFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { profiledFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { profiledFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { profiledFree(ptr); }
+
+#endif // NMEA_ALLOC_PROFILE
@@ -0,0 +1,57 @@
+// AllocProfiler.hpp
+//
+// Opt-in allocation profiler (-DNMEA_ALLOC_PROFILE=ON). Interposes the
+// global operator new/delete and attributes every heap allocation to
+// the innermost NMEA_ALLOC_SCOPE("name") on the calling thread, with a
+// per-site table (allocs, frees, total bytes, live bytes) dumped to
+// stderr at exit. Each allocation carries a small header so the free
+// is charged back to the allocating site, which makes a slowly growing
+// "live" column point straight at the leaking generate*/writer* scope.
+// Overhead is one thread-local read and a few relaxed counter bumps per
+// allocation, cheap enough to leave on for multi-day staging soaks.
+//
+// In normal builds the macro expands to nothing and AllocProfiler.cpp
+// is not compiled, so the hot paths are untouched.
+
+#ifndef ALLOC_PROFILER_HPP
+#define ALLOC_PROFILER_HPP
+
+#ifdef NMEA_ALLOC_PROFILE
+
+namespace alloc_profile {
+
+// Registers a call-site name once and returns its table slot. Names
+// must be string literals (the table stores the pointer).
+int registerSite(const char* name);
+
+// RAII scope: allocations on this thread are charged to `site` until
+// the scope ends, then to whatever enclosed it (slot 0 = untagged).
+class Scope {
+public:
+    explicit Scope(int site);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    int prev_;
+};
+
+} // namespace alloc_profile
+
+#define NMEA_ALLOC_CONCAT2(a, b) a##b
+#define NMEA_ALLOC_CONCAT(a, b) NMEA_ALLOC_CONCAT2(a, b)
+#define NMEA_ALLOC_SCOPE(name)                                                  \
+    static const int NMEA_ALLOC_CONCAT(nmea_alloc_site_, __LINE__) =            \
+        ::alloc_profile::registerSite(name);                                    \
+    ::alloc_profile::Scope NMEA_ALLOC_CONCAT(nmea_alloc_scope_, __LINE__)(      \
+        NMEA_ALLOC_CONCAT(nmea_alloc_site_, __LINE__))
+
+#else
+
+#define NMEA_ALLOC_SCOPE(name)
+
+#endif // NMEA_ALLOC_PROFILE
+
+#endif // ALLOC_PROFILER_HPP
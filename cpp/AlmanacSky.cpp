@@ -0,0 +1,203 @@
+// AlmanacSky.cpp
+#include "AlmanacSky.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+
+// WGS84 / GPS constants
+constexpr double kMu        = 3.986005e14; // earth gravitational parameter
+constexpr double kOmegaEDot = 7.2921151467e-5; // earth rotation rate, rad/s
+constexpr double kWgsA      = 6378137.0; // semi-major axis
+constexpr double kWgsE2     = 6.69437999014e-3; // first eccentricity squared
+constexpr double kPi        = 3.14159265358979323846;
+
+// The YUMA fields that matter for geometry (clock terms are ignored)
+struct YumaEntry {
+    int prn          = 0;
+    double ecc       = 0; // eccentricity
+    double toa       = 0; // time of applicability, s of GPS week
+    double incl      = 0; // inclination, rad
+    double omega_dot = 0; // rate of right ascension, rad/s
+    double sqrt_a    = 0; // sqrt of semi-major axis, m^1/2
+    double omega0    = 0; // right ascension at week epoch, rad
+    double aop       = 0; // argument of perigee, rad
+    double m0        = 0; // mean anomaly, rad
+};
+
+// Solve Kepler's equation M = E - e sinE by fixed-point iteration;
+// converges in a handful of rounds at almanac eccentricities (< 0.03)
+double eccentricAnomaly(double mean, double ecc)
+{
+    double e_anom = mean;
+    for (int i = 0; i < 8; ++i) {
+        e_anom = mean + ecc * std::sin(e_anom);
+    }
+    return e_anom;
+}
+
+} // namespace
+
+bool AlmanacSky::load(const std::string& path, double obs_lat_deg, double obs_lon_deg)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Error opening almanac file: " << path << std::endl;
+        return false;
+    }
+
+    // YUMA is "Label: value" lines grouped per satellite, each group
+    // opened by an ID line; labels are matched on their stable prefix
+    // so the week/"Time of Applicability(s)" unit suffixes don't matter
+    std::vector<YumaEntry> entries;
+    YumaEntry cur;
+    bool have_cur = false;
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue; // banner/blank line between blocks
+        }
+        std::string label = line.substr(0, colon);
+        double value      = 0;
+        try {
+            value = std::stod(line.substr(colon + 1));
+        } catch (const std::exception&) {
+            continue;
+        }
+        if (label.rfind("ID", 0) == 0) {
+            if (have_cur && cur.sqrt_a > 0) {
+                entries.push_back(cur);
+            }
+            cur      = YumaEntry {};
+            cur.prn  = static_cast<int>(value);
+            have_cur = true;
+        } else if (label.rfind("Eccentricity", 0) == 0) {
+            cur.ecc = value;
+        } else if (label.rfind("Time of Applicability", 0) == 0) {
+            cur.toa = value;
+        } else if (label.rfind("Orbital Inclination", 0) == 0) {
+            cur.incl = value;
+        } else if (label.rfind("Rate of Right Ascen", 0) == 0) {
+            cur.omega_dot = value;
+        } else if (label.rfind("SQRT(A)", 0) == 0) {
+            cur.sqrt_a = value;
+        } else if (label.rfind("Right Ascen at Week", 0) == 0) {
+            cur.omega0 = value;
+        } else if (label.rfind("Argument of Perigee", 0) == 0) {
+            cur.aop = value;
+        } else if (label.rfind("Mean Anom", 0) == 0) {
+            cur.m0 = value;
+        }
+    }
+    if (have_cur && cur.sqrt_a > 0) {
+        entries.push_back(cur);
+    }
+    if (entries.empty()) {
+        std::cerr << "Error in almanac " << path
+                  << ": no satellite records found (YUMA format expected)" << std::endl;
+        return false;
+    }
+
+    // Observer ECEF and the ENU rotation rows, computed once
+    double lat    = obs_lat_deg * kPi / 180.0;
+    double lon    = obs_lon_deg * kPi / 180.0;
+    double sin_la = std::sin(lat), cos_la = std::cos(lat);
+    double sin_lo = std::sin(lon), cos_lo = std::cos(lon);
+    double n_rad  = kWgsA / std::sqrt(1.0 - kWgsE2 * sin_la * sin_la);
+    double obs_x  = n_rad * cos_la * cos_lo;
+    double obs_y  = n_rad * cos_la * sin_lo;
+    double obs_z  = n_rad * (1.0 - kWgsE2) * sin_la;
+
+    sats_.clear();
+    sats_.reserve(entries.size());
+    for (const YumaEntry& alm : entries) {
+        SatTable table;
+        table.prn = alm.prn;
+        table.samples.resize(kTableMinutes + 1);
+
+        double a = alm.sqrt_a * alm.sqrt_a;
+        double n = std::sqrt(kMu / (a * a * a)); // mean motion
+
+        for (int m = 0; m <= kTableMinutes; ++m) {
+            // Propagate from the time of applicability; simulated time
+            // zero shows the toa sky and the table wraps at the
+            // sidereal repeat
+            double tk     = m * 60.0;
+            double e_anom = eccentricAnomaly(alm.m0 + n * tk, alm.ecc);
+            double nu     = std::atan2(std::sqrt(1.0 - alm.ecc * alm.ecc) * std::sin(e_anom),
+                                       std::cos(e_anom) - alm.ecc);
+            double phi    = nu + alm.aop; // argument of latitude
+            double r      = a * (1.0 - alm.ecc * std::cos(e_anom));
+            double xp     = r * std::cos(phi);
+            double yp     = r * std::sin(phi);
+
+            // Longitude of the ascending node in ECEF: the node
+            // regresses while the earth rotates under the orbit
+            double node = alm.omega0 + (alm.omega_dot - kOmegaEDot) * tk
+                - kOmegaEDot * alm.toa;
+            double sin_node = std::sin(node), cos_node = std::cos(node);
+            double sin_i = std::sin(alm.incl), cos_i = std::cos(alm.incl);
+            double sx = xp * cos_node - yp * cos_i * sin_node;
+            double sy = xp * sin_node + yp * cos_i * cos_node;
+            double sz = yp * sin_i;
+
+            // ECEF line of sight to ENU, then az/el
+            double dx = sx - obs_x, dy = sy - obs_y, dz = sz - obs_z;
+            double east  = -sin_lo * dx + cos_lo * dy;
+            double north = -sin_la * cos_lo * dx - sin_la * sin_lo * dy + cos_la * dz;
+            double up    = cos_la * cos_lo * dx + cos_la * sin_lo * dy + sin_la * dz;
+            double range = std::sqrt(dx * dx + dy * dy + dz * dz);
+            double el    = std::asin(up / range) * 180.0 / kPi;
+            double az    = std::atan2(east, north) * 180.0 / kPi;
+            if (az < 0) {
+                az += 360.0;
+            }
+
+            Sample& s = table.samples[m];
+            s.el16    = static_cast<int16_t>(std::lround(el * 16.0));
+            s.az16    = static_cast<uint16_t>(std::lround(az * 16.0) % (360 * 16));
+        }
+        sats_.push_back(std::move(table));
+    }
+
+    return true;
+}
+
+bool AlmanacSky::sampleAt(size_t i, double t_seconds, int& el16, int& az16) const
+{
+    const SatTable& table = sats_[i];
+    double minutes        = std::fmod(t_seconds / 60.0, double(kTableMinutes));
+    if (minutes < 0) {
+        minutes = 0;
+    }
+    int m         = static_cast<int>(minutes);
+    double frac   = minutes - m;
+    const Sample& lo = table.samples[m];
+    const Sample& hi = table.samples[m + 1];
+
+    int el = lo.el16 + static_cast<int>((hi.el16 - lo.el16) * frac);
+    if (el < kMaskEl16) {
+        return false;
+    }
+    // Azimuth interpolates on the shorter arc across the 360 wrap
+    int delta = hi.az16 - lo.az16;
+    if (delta > 180 * 16) {
+        delta -= 360 * 16;
+    } else if (delta < -180 * 16) {
+        delta += 360 * 16;
+    }
+    int az = lo.az16 + static_cast<int>(delta * frac);
+    if (az < 0) {
+        az += 360 * 16;
+    } else if (az >= 360 * 16) {
+        az -= 360 * 16;
+    }
+    el16 = el;
+    az16 = az;
+    return true;
+}
@@ -0,0 +1,59 @@
+// AlmanacSky.hpp
+#ifndef ALMANAC_SKY_HPP
+#define ALMANAC_SKY_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Almanac-driven GPS sky for --almanac. A YUMA almanac is parsed once
+// at startup and each satellite's orbit is propagated at a
+// one-simulated-minute pitch into a fixed-point az/el table covering
+// one ground-track repeat (the sky as seen from a fixed observer
+// repeats every sidereal day, so the table wraps cleanly). All the
+// orbital mechanics — Kepler's equation, the plane rotations, the
+// ECEF-to-ENU transform — runs here at load; per-cycle geometry is a
+// table index plus one linear interpolation, a few integer/FP ops, so
+// consumers that sanity-check GSV against real almanac data see
+// correct rise/set tracks at essentially the cost of the random
+// drift it replaces.
+class AlmanacSky {
+public:
+    // Satellites below this elevation are not reported; the standard
+    // receiver mask
+    static constexpr int kMaskEl16 = 5 * 16;
+
+    // Parse the YUMA file and precompute the tables for an observer at
+    // the given position; reports the problem on stderr and returns
+    // false on malformed input or an empty almanac
+    bool load(const std::string& path, double obs_lat_deg, double obs_lon_deg);
+
+    bool loaded() const { return !sats_.empty(); }
+    size_t satCount() const { return sats_.size(); }
+    int prn(size_t i) const { return sats_[i].prn; }
+
+    // Interpolated geometry at t simulated seconds since load, in the
+    // generator's 1/16-degree fixed point. Returns false when the
+    // satellite is below the elevation mask at t.
+    bool sampleAt(size_t i, double t_seconds, int& el16, int& az16) const;
+
+private:
+    // One table sample; el16 may be negative (below the horizon)
+    struct Sample {
+        int16_t el16;
+        uint16_t az16;
+    };
+
+    struct SatTable {
+        int prn;
+        std::vector<Sample> samples; // kTableMinutes + 1, last = first
+    };
+
+    // One sidereal day at one-minute pitch: the GPS constellation's
+    // repeat period over a fixed observer
+    static constexpr int kTableMinutes = 1436;
+
+    std::vector<SatTable> sats_;
+};
+
+#endif // ALMANAC_SKY_HPP
@@ -0,0 +1,251 @@
+// AsyncLogger.cpp
+#include "AsyncLogger.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <unistd.h>
+#include <vector>
+
+AsyncLogger::AsyncLogger()
+{
+    drain_thread_ = std::thread(&AsyncLogger::drainLoop, this);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    stop_.store(true, std::memory_order_release);
+    if (drain_thread_.joinable()) {
+        drain_thread_.join();
+    }
+    uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped > 0) {
+        std::cout << "Logger dropped " << dropped << " cycle record(s)." << std::endl;
+    }
+    uint64_t err_dropped = err_dropped_.load(std::memory_order_relaxed);
+    if (err_dropped > 0) {
+        std::cerr << "Logger dropped " << err_dropped << " error record(s)." << std::endl;
+    }
+}
+
+AsyncLogger::Record* AsyncLogger::claimSlot()
+{
+    size_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) >= kRingSize) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    return &ring_[head & (kRingSize - 1)];
+}
+
+void AsyncLogger::publishSlot()
+{
+    head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void AsyncLogger::publishPreview(const std::string& payload)
+{
+    preview_.seq.fetch_add(1, std::memory_order_acq_rel); // odd: writer in the slot
+    preview_.cycle = cycle_count_;
+    size_t copy    = std::min(payload.size(), sizeof(preview_.text));
+    std::memcpy(preview_.text, payload.data(), copy);
+    preview_.len = static_cast<uint16_t>(copy);
+    preview_.seq.fetch_add(1, std::memory_order_release); // even: snapshot stable
+}
+
+void AsyncLogger::publishPreview(const std::vector<std::string_view>& cycle)
+{
+    preview_.seq.fetch_add(1, std::memory_order_acq_rel);
+    preview_.cycle = cycle_count_;
+    size_t len     = 0;
+    for (const auto& sentence : cycle) {
+        if (len + sentence.size() + 1 > sizeof(preview_.text)) {
+            break;
+        }
+        std::memcpy(preview_.text + len, sentence.data(), sentence.size());
+        len += sentence.size();
+        preview_.text[len++] = '\n';
+    }
+    preview_.len = static_cast<uint16_t>(len);
+    preview_.seq.fetch_add(1, std::memory_order_release);
+}
+
+void AsyncLogger::renderPreview(uint32_t& last_seq)
+{
+    char text[sizeof(preview_.text)];
+    uint32_t seq = preview_.seq.load(std::memory_order_acquire);
+    if (seq == last_seq || (seq & 1) != 0) {
+        return; // nothing new, or the writer is mid-overwrite
+    }
+    uint64_t cycle = preview_.cycle;
+    uint16_t len   = std::min<uint16_t>(preview_.len, sizeof(text));
+    std::memcpy(text, preview_.text, len);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (preview_.seq.load(std::memory_order_relaxed) != seq) {
+        return; // torn copy; the next tick picks up the newer snapshot
+    }
+    last_seq = seq;
+    std::cout << "Live view (cycle " << cycle << "):\n";
+    std::cout.write(text, len);
+    std::cout.flush();
+}
+
+void AsyncLogger::logCycle(const char* heading, const std::string& payload)
+{
+    if (quiet_ || ++cycle_count_ % sample_every_ != 0) {
+        return;
+    }
+    if (preview_interval_ > 0.0) {
+        publishPreview(payload);
+        return;
+    }
+    Record* record = claimSlot();
+    if (record == nullptr) {
+        return;
+    }
+    size_t len = std::strlen(heading);
+    len        = std::min(len, sizeof(record->text) - 1);
+    std::memcpy(record->text, heading, len);
+    record->text[len++] = '\n';
+    size_t room         = sizeof(record->text) - len;
+    size_t copy         = std::min(payload.size(), room);
+    std::memcpy(record->text + len, payload.data(), copy);
+    record->len = static_cast<uint16_t>(len + copy);
+    publishSlot();
+}
+
+void AsyncLogger::logCycle(const char* heading, const std::vector<std::string_view>& cycle)
+{
+    if (quiet_ || ++cycle_count_ % sample_every_ != 0) {
+        return;
+    }
+    if (preview_interval_ > 0.0) {
+        publishPreview(cycle);
+        return;
+    }
+    Record* record = claimSlot();
+    if (record == nullptr) {
+        return;
+    }
+    size_t len = std::strlen(heading);
+    len        = std::min(len, sizeof(record->text) - 1);
+    std::memcpy(record->text, heading, len);
+    record->text[len++] = '\n';
+    for (const auto& sentence : cycle) {
+        if (len + sentence.size() + 1 > sizeof(record->text)) {
+            break;
+        }
+        std::memcpy(record->text + len, sentence.data(), sentence.size());
+        len += sentence.size();
+        record->text[len++] = '\n';
+    }
+    record->len = static_cast<uint16_t>(len);
+    publishSlot();
+}
+
+void AsyncLogger::logError(const char* label, int err)
+{
+    size_t head = err_head_.load(std::memory_order_relaxed);
+    if (head - err_tail_.load(std::memory_order_acquire) >= kErrRingSize) {
+        err_dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    ErrorRecord& record = err_ring_[head & (kErrRingSize - 1)];
+    record.label        = label;
+    record.err          = err;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    record.ns = static_cast<uint64_t>(ts.tv_sec) * 1000000000ull
+        + static_cast<uint64_t>(ts.tv_nsec);
+    err_head_.store(head + 1, std::memory_order_release);
+}
+
+void AsyncLogger::drainErrors()
+{
+    size_t tail = err_tail_.load(std::memory_order_relaxed);
+    size_t head = err_head_.load(std::memory_order_acquire);
+    while (tail != head) {
+        const ErrorRecord& first = err_ring_[tail & (kErrRingSize - 1)];
+        const char* label        = first.label;
+        int err                  = first.err;
+        uint64_t window_end      = first.ns + 1000000000ull;
+        uint64_t repeats         = 1;
+        ++tail;
+        while (tail != head) {
+            const ErrorRecord& next = err_ring_[tail & (kErrRingSize - 1)];
+            if (next.label != label || next.err != err || next.ns > window_end) {
+                break;
+            }
+            ++repeats;
+            ++tail;
+        }
+        char line[256];
+        int len = err != 0
+            ? std::snprintf(line, sizeof(line), "%s: %s", label, strerror(err))
+            : std::snprintf(line, sizeof(line), "%s", label);
+        if (len < 0) {
+            len = 0;
+        }
+        len = std::min(len, static_cast<int>(sizeof(line)) - 32);
+        if (repeats > 1) {
+            len += std::snprintf(line + len, sizeof(line) - static_cast<size_t>(len),
+                                 " (x%llu)", static_cast<unsigned long long>(repeats));
+        }
+        line[len++] = '\n';
+        ssize_t n = ::write(STDERR_FILENO, line, static_cast<size_t>(len));
+        (void)n; // console gone: nothing useful left to do about it
+        err_tail_.store(tail, std::memory_order_release);
+    }
+}
+
+void AsyncLogger::drainLoop()
+{
+    // Records are packed into one large application-side buffer and
+    // pushed with a single write(2) when the ring drains or the buffer
+    // fills, so firehose-verbose runs cost a handful of syscalls per
+    // flush window instead of one iostream chain per cycle.
+    std::vector<char> out(64 * 1024);
+    size_t fill   = 0;
+    auto flushOut = [&] {
+        size_t off = 0;
+        while (off < fill) {
+            ssize_t n = ::write(STDOUT_FILENO, out.data() + off, fill - off);
+            if (n <= 0) {
+                break;
+            }
+            off += static_cast<size_t>(n);
+        }
+        fill = 0;
+    };
+    using clock       = std::chrono::steady_clock;
+    auto next_preview = clock::now();
+    uint32_t last_seq = 0;
+    for (;;) {
+        if (preview_interval_ > 0.0 && clock::now() >= next_preview) {
+            renderPreview(last_seq);
+            next_preview = clock::now() + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(preview_interval_));
+        }
+        drainErrors();
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) {
+            flushOut();
+            if (stop_.load(std::memory_order_acquire)) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            continue;
+        }
+        const Record& record = ring_[tail & (kRingSize - 1)];
+        if (fill + record.len > out.size()) {
+            flushOut();
+        }
+        std::memcpy(out.data() + fill, record.text, record.len);
+        fill += record.len;
+        tail_.store(tail + 1, std::memory_order_release);
+    }
+    flushOut();
+    drainErrors();
+    std::cout.flush();
+}
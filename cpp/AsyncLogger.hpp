@@ -0,0 +1,120 @@
+// AsyncLogger.hpp
+#ifndef ASYNC_LOGGER_HPP
+#define ASYNC_LOGGER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Asynchronous logger for the writer hot paths. The writer thread copies
+// a fixed-size record into a single-producer/single-consumer ring and
+// returns immediately; a background thread drains the ring to stdout.
+// Console I/O therefore never blocks an emission deadline: if the ring
+// is full the record is dropped and counted instead. Sampling (log one
+// cycle in N) and a quiet mode cut the volume at high cycle rates.
+// Write errors ride a second ring the same way, as fixed-size records
+// formatted only on the drain side.
+class AsyncLogger {
+public:
+    AsyncLogger();
+    ~AsyncLogger();
+
+    // Suppress per-cycle records entirely (--quiet)
+    void setQuiet(bool quiet) { quiet_ = quiet; }
+
+    // Log only every n-th cycle record; n = 1 logs every cycle
+    void setSampleEvery(unsigned n) { sample_every_ = n > 0 ? n : 1; }
+
+    // Sampled live mirror (--preview): instead of queueing a record per
+    // cycle, the writer overwrites a single seqlock-protected slot and
+    // the drain thread renders the latest snapshot every seconds
+    // seconds. Operators keep a live view of the stream while the hot
+    // path does one bounded copy per sampled cycle and no console I/O.
+    void setPreview(double seconds) { preview_interval_ = seconds; }
+
+    // Hot-path entry points: enqueue one cycle's payload under the given
+    // heading. Truncates to the record size, never blocks, never
+    // allocates. Must be called from a single producer thread.
+    void logCycle(const char* heading, const std::string& payload);
+    void logCycle(const char* heading, const std::vector<std::string_view>& cycle);
+
+    // Hot-path error reporting for the writer loops: the producer
+    // stores a label pointer, the errno and a timestamp — three stores,
+    // no formatting, no allocation — and the drain thread renders the
+    // line to stderr. Repeats of the same label/errno pair landing
+    // within a second collapse into one line with a count, so an EPIPE
+    // storm across a fan-out costs the emission path a few stores per
+    // failure and the console one line per second. `label` must have
+    // static storage duration (string literals in practice); pass 0 for
+    // errors that carry no errno. Single producer, like logCycle.
+    void logError(const char* label, int err);
+
+private:
+    // Fixed-size ring record; one full default cycle fits comfortably
+    struct Record {
+        uint16_t len;
+        char text[510];
+    };
+    static constexpr size_t kRingSize = 64; // power of two
+
+    // Claim the next ring slot, or nullptr if the ring is full
+    Record* claimSlot();
+    void publishSlot();
+
+    // Seqlock slot for the live mirror. The writer bumps the sequence
+    // to odd, overwrites the snapshot in place and bumps it back to
+    // even; the reader copies the slot out and discards the copy if the
+    // sequence moved under it. No reader ever stalls the writer.
+    struct Preview {
+        std::atomic<uint32_t> seq { 0 };
+        uint64_t cycle = 0;
+        uint16_t len   = 0;
+        char text[1006];
+    };
+
+    void publishPreview(const std::string& payload);
+    void publishPreview(const std::vector<std::string_view>& cycle);
+    void renderPreview(uint32_t& last_seq);
+
+    // Pre-formatted error record: strerror and the message text are the
+    // drain thread's problem, never the writer's
+    struct ErrorRecord {
+        const char* label;
+        int err;
+        uint64_t ns; // CLOCK_MONOTONIC; bounds the drain's collapse window
+    };
+    static constexpr size_t kErrRingSize = 256; // power of two
+
+    // Background drain: pops records and writes them to stdout
+    void drainLoop();
+
+    // Pops pending error records, collapsing same-second repeats
+    void drainErrors();
+
+    std::array<Record, kRingSize> ring_;
+    std::atomic<size_t> head_ { 0 };
+    std::atomic<size_t> tail_ { 0 };
+    std::atomic<bool> stop_ { false };
+    std::atomic<uint64_t> dropped_ { 0 };
+
+    std::array<ErrorRecord, kErrRingSize> err_ring_;
+    std::atomic<size_t> err_head_ { 0 };
+    std::atomic<size_t> err_tail_ { 0 };
+    std::atomic<uint64_t> err_dropped_ { 0 };
+
+    // Producer-side state; single writer thread, no synchronization
+    uint64_t cycle_count_  = 0;
+    unsigned sample_every_ = 1;
+    bool quiet_            = false;
+    double preview_interval_ = 0.0; // 0 = classic per-cycle records
+
+    Preview preview_;
+
+    std::thread drain_thread_;
+};
+
+#endif // ASYNC_LOGGER_HPP
@@ -0,0 +1,284 @@
+// CaptureLog.cpp
+#include "CaptureLog.hpp"
+#include "MemBudget.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+CaptureLog::~CaptureLog()
+{
+    if (!enabled()) {
+        return;
+    }
+    stop_.store(true, std::memory_order_release);
+    if (drain_thread_.joinable()) {
+        drain_thread_.join();
+    }
+    if (out_ != nullptr) {
+        std::fclose(out_);
+    }
+    if (fd_ != -1) {
+        close(fd_);
+        free(stage_[0]);
+        free(stage_[1]);
+    }
+    uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped > 0) {
+        std::cout << "Capture dropped " << dropped << " cycle record(s)." << std::endl;
+    }
+}
+
+bool CaptureLog::open(const std::string& path)
+{
+    // The slot buffers below grow to cycle size and keep their
+    // capacity for the process lifetime; charge the full ring before
+    // touching the file
+    if (!MemBudget::reserve("capture ring", kRingSize * 4096ull)) {
+        return false;
+    }
+    if (direct_ && !openDirect(path)) {
+        // openDirect said why; the buffered stream below still records
+        // everything, just through the page cache
+        direct_ = false;
+    }
+    if (!direct_) {
+        out_ = std::fopen(path.c_str(), "ab");
+        if (out_ == nullptr) {
+            std::cerr << "Error opening capture file: " << path << std::endl;
+            return false;
+        }
+
+        // Stamp the magic on a fresh file; appending to an existing
+        // capture extends its record stream
+        struct stat st;
+        if (fstat(fileno(out_), &st) == 0 && st.st_size == 0) {
+            CaptureHeader hdr { kCaptureMagic, 0 };
+            std::fwrite(&hdr, sizeof(hdr), 1, out_);
+        }
+    }
+
+    // Pre-grow the slot buffers so steady-state enqueues reuse capacity
+    for (auto& record : ring_) {
+        record.data.reserve(4096);
+    }
+    drain_thread_ = std::thread(&CaptureLog::drainLoop, this);
+    return true;
+}
+
+bool CaptureLog::openDirect(const std::string& path)
+{
+    if (!MemBudget::reserve("capture staging", 2 * kStageBytes)) {
+        return false;
+    }
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_DIRECT | O_CLOEXEC, 0644);
+    if (fd_ == -1) {
+        // tmpfs and some network filesystems reject O_DIRECT outright
+        std::cerr << "Capture O_DIRECT unavailable for " << path << " ("
+                  << strerror(errno) << "); using the buffered writer" << std::endl;
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd_, &st) != 0 || st.st_size != 0) {
+        // Appending would need a read-modify-write of the unaligned
+        // tail; direct mode starts on a fresh file only
+        std::cerr << "Capture file " << path
+                  << " already has records; --capture-direct needs a fresh file, "
+                     "using the buffered writer" << std::endl;
+        close(fd_);
+        fd_ = -1;
+        return false;
+    }
+    for (char*& buf : stage_) {
+        void* mem = nullptr;
+        if (posix_memalign(&mem, kDirectAlign, kStageBytes) != 0) {
+            std::cerr << "Error allocating capture staging buffers" << std::endl;
+            close(fd_);
+            fd_ = -1;
+            free(stage_[0]);
+            stage_[0] = nullptr;
+            return false;
+        }
+        buf = static_cast<char*>(mem);
+    }
+    // The header is the first staged bytes; it reaches disk with the
+    // first buffer flip
+    CaptureHeader hdr { kCaptureMagic, 0 };
+    memcpy(stage_[0], &hdr, sizeof(hdr));
+    fill_len_     = sizeof(hdr);
+    logical_size_ = sizeof(hdr);
+    flush_thread_ = std::thread(&CaptureLog::flushLoop, this);
+    return true;
+}
+
+void CaptureLog::append(const std::string& cycle)
+{
+    size_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) >= kRingSize) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    Record& record = ring_[head & (kRingSize - 1)];
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    record.t_ns = static_cast<uint64_t>(ts.tv_sec) * 1000000000ull
+        + static_cast<uint64_t>(ts.tv_nsec);
+    record.data.assign(cycle);
+
+    head_.store(head + 1, std::memory_order_release);
+}
+
+void CaptureLog::writeRecord(const Record& record)
+{
+    CaptureRecordHeader hdr;
+    hdr.t_ns = record.t_ns;
+    hdr.len  = static_cast<uint32_t>(record.data.size());
+    std::fwrite(&hdr, sizeof(hdr), 1, out_);
+    std::fwrite(record.data.data(), 1, record.data.size(), out_);
+}
+
+void CaptureLog::drainLoop()
+{
+    for (;;) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) {
+            if (stop_.load(std::memory_order_acquire)) {
+                break;
+            }
+            // Ring drained: push the stdio buffer out so the on-disk
+            // capture trails the stream by at most one idle period.
+            // Direct mode keeps its partial staging buffer in memory
+            // instead — a partial O_DIRECT write would need a padded
+            // block rewritten on the next record.
+            if (!direct_) {
+                std::fflush(out_);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            continue;
+        }
+        const Record& record = ring_[tail & (kRingSize - 1)];
+        if (direct_) {
+            stageRecord(record);
+        } else {
+            writeRecord(record);
+        }
+        tail_.store(tail + 1, std::memory_order_release);
+    }
+    if (direct_) {
+        finishDirect();
+    } else {
+        std::fflush(out_);
+    }
+}
+
+// Frame one record into the fill buffer; a full buffer flips to the
+// flush thread mid-record, so records larger than a buffer just span
+// several flips
+void CaptureLog::stageRecord(const Record& record)
+{
+    CaptureRecordHeader hdr;
+    hdr.t_ns = record.t_ns;
+    hdr.len  = static_cast<uint32_t>(record.data.size());
+    stageBytes(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+    stageBytes(record.data.data(), record.data.size());
+}
+
+void CaptureLog::stageBytes(const char* p, size_t n)
+{
+    logical_size_ += n;
+    while (n > 0) {
+        size_t room = kStageBytes - fill_len_;
+        if (room == 0) {
+            submitStage();
+            continue;
+        }
+        size_t take = std::min(n, room);
+        memcpy(stage_[fill_idx_] + fill_len_, p, take);
+        fill_len_ += take;
+        p += take;
+        n -= take;
+    }
+}
+
+// Flip the filled buffer to the flush thread and keep filling the
+// other one. The wait only triggers when the disk cannot keep up with
+// a full staging buffer per flip — at which point the ring above
+// starts dropping, which is the configured backpressure contract.
+void CaptureLog::submitStage()
+{
+    std::unique_lock<std::mutex> lock(flush_mtx_);
+    flush_cv_.wait(lock, [this] { return !flush_busy_; });
+    flush_idx_  = fill_idx_;
+    flush_len_  = fill_len_;
+    flush_busy_ = true;
+    flush_cv_.notify_all();
+    fill_idx_ ^= 1;
+    fill_len_ = 0;
+}
+
+// Drain-thread epilogue: push out the final partial buffer, retire
+// the flush thread, and trim the zero padding of the last block so
+// the record stream ends exactly where the data does — ReplayLog's
+// capture loader walks records to the byte.
+void CaptureLog::finishDirect()
+{
+    if (fill_len_ > 0) {
+        submitStage();
+    }
+    {
+        std::unique_lock<std::mutex> lock(flush_mtx_);
+        flush_cv_.wait(lock, [this] { return !flush_busy_; });
+        flush_exit_ = true;
+        flush_cv_.notify_all();
+    }
+    if (flush_thread_.joinable()) {
+        flush_thread_.join();
+    }
+    if (!write_failed_
+        && ftruncate(fd_, static_cast<off_t>(logical_size_)) != 0) {
+        std::cerr << "Error trimming capture file: " << strerror(errno) << std::endl;
+    }
+}
+
+// Flush thread: one pwrite per handed-off buffer, padded up to the
+// block multiple O_DIRECT demands (only the final partial buffer ever
+// needs it). Writing from a second thread is what makes the staging
+// double-buffered — the drain thread is already filling the other
+// buffer while this write is in flight.
+void CaptureLog::flushLoop()
+{
+    std::unique_lock<std::mutex> lock(flush_mtx_);
+    for (;;) {
+        flush_cv_.wait(lock, [this] { return flush_busy_ || flush_exit_; });
+        if (!flush_busy_) {
+            break;
+        }
+        int idx    = flush_idx_;
+        size_t len = flush_len_;
+        off_t off  = file_off_;
+        lock.unlock();
+
+        size_t padded = (len + kDirectAlign - 1) & ~(kDirectAlign - 1);
+        if (padded > len) {
+            memset(stage_[idx] + len, 0, padded - len);
+        }
+        if (!write_failed_ && pwrite(fd_, stage_[idx], padded, off) == -1) {
+            // Report once and stop writing; the ring keeps counting
+            // what the capture loses
+            std::cerr << "Error writing capture file: " << strerror(errno) << std::endl;
+            write_failed_ = true;
+        }
+
+        lock.lock();
+        file_off_ += static_cast<off_t>(padded);
+        flush_busy_ = false;
+        flush_cv_.notify_all();
+    }
+}
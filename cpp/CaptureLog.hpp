@@ -0,0 +1,130 @@
+// CaptureLog.hpp
+#ifndef CAPTURE_LOG_HPP
+#define CAPTURE_LOG_HPP
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Binary capture of the emitted stream (--capture): every cycle is
+// recorded as (monotonic timestamp, length, raw bytes), so consumer
+// discrepancies can be debugged against exactly what was written and
+// exactly when — the stdout dump loses timing and truncates payloads.
+// The writer thread only stamps the clock and copies the cycle into a
+// ring slot; a dedicated drain thread appends records through a
+// buffered O_APPEND stream, so capture I/O never blocks an emission
+// deadline. When the ring is full the record is dropped and counted,
+// the same contract as AsyncLogger. ReplayLog recognizes the container
+// by its magic, so a capture feeds straight back into --file replay
+// with the recorded inter-cycle timing (record -> replay loop).
+
+// On-disk framing, shared with ReplayLog's capture loader. Native-
+// endian like the compiled replay container — captures live next to
+// the logs, not on the wire.
+struct CaptureHeader {
+    uint32_t magic; // kCaptureMagic
+    uint32_t reserved;
+};
+
+struct CaptureRecordHeader {
+    uint64_t t_ns; // CLOCK_MONOTONIC at enqueue
+    uint32_t len; // payload bytes following
+} __attribute__((packed));
+
+constexpr uint32_t kCaptureMagic = 0x31504143; // "CAP1"
+
+class CaptureLog {
+public:
+    CaptureLog() = default;
+    ~CaptureLog();
+
+    CaptureLog(const CaptureLog&)            = delete;
+    CaptureLog& operator=(const CaptureLog&) = delete;
+
+    // O_DIRECT capture writing (--capture-direct): records are staged
+    // into two block-aligned buffers that flip between the drain
+    // thread (filling) and a flush thread (writing), so capture bytes
+    // bypass the page cache entirely. With --capture on every device
+    // of a large rig, the buffered path's writeback competes with the
+    // consumers' own I/O and showed up as periodic rig-wide jitter;
+    // direct writes make capture disk-limited without perturbing the
+    // emission latency profile. The on-disk capture trails the stream
+    // by up to one staging buffer, and the final block's padding is
+    // trimmed at close so the record stream stays byte-exact for
+    // --file replay. Falls back to the buffered writer (with a
+    // message) where O_DIRECT is unsupported or the file already has
+    // records. Call before open().
+    void setDirect(bool direct) { direct_ = direct; }
+
+    // Open (appending) and start the drain thread; stamps the header
+    // on a fresh file. Returns false if the file cannot be opened.
+    bool open(const std::string& path);
+
+    bool enabled() const { return out_ != nullptr || fd_ != -1; }
+
+    // Hot-path entry: timestamp and enqueue one emitted cycle. Never
+    // blocks; slot buffers retain their capacity, so the steady state
+    // is a clock read and a memcpy. Single producer thread.
+    void append(const std::string& cycle);
+
+private:
+    struct Record {
+        uint64_t t_ns;
+        std::string data;
+    };
+    static constexpr size_t kRingSize = 64; // power of two
+
+    // O_DIRECT geometry: writes land on logical-block multiples, and
+    // the staging buffers are a few dozen blocks so a flip costs one
+    // syscall per 128 KB instead of one per record
+    static constexpr size_t kDirectAlign = 4096;
+    static constexpr size_t kStageBytes  = 128 * 1024;
+
+    void drainLoop();
+    void writeRecord(const Record& record);
+
+    // Direct-mode path: open the descriptor and buffers (false falls
+    // back to the buffered writer), stage one record, hand a filled
+    // buffer to the flush thread, and the flush thread body itself
+    bool openDirect(const std::string& path);
+    void stageRecord(const Record& record);
+    void stageBytes(const char* p, size_t n);
+    void submitStage();
+    void finishDirect();
+    void flushLoop();
+
+    std::array<Record, kRingSize> ring_;
+    std::atomic<size_t> head_ { 0 };
+    std::atomic<size_t> tail_ { 0 };
+    std::atomic<bool> stop_ { false };
+    std::atomic<uint64_t> dropped_ { 0 };
+
+    std::FILE* out_ = nullptr;
+    std::thread drain_thread_;
+
+    // Direct-mode state. The fill side (fill_idx_/fill_len_ and
+    // logical_size_) belongs to the drain thread; the handoff fields
+    // behind flush_mtx_ are the only shared state.
+    bool direct_ = false;
+    int fd_      = -1;
+    char* stage_[2] = { nullptr, nullptr };
+    int fill_idx_         = 0;
+    size_t fill_len_      = 0;
+    uint64_t logical_size_ = 0; // true byte length; the final trim target
+    std::thread flush_thread_;
+    std::mutex flush_mtx_;
+    std::condition_variable flush_cv_;
+    bool flush_busy_  = false;
+    bool flush_exit_  = false;
+    int flush_idx_    = 0;
+    size_t flush_len_ = 0;
+    off_t file_off_   = 0;
+    bool write_failed_ = false;
+};
+
+#endif // CAPTURE_LOG_HPP
@@ -0,0 +1,91 @@
+// CoroReactor.cpp
+#include "CoroReactor.hpp"
+
+#include <algorithm>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+CoroReactor::CoroReactor()
+{
+    epoll_fd_ = epoll_create1(0);
+}
+
+CoroReactor::~CoroReactor()
+{
+    if (epoll_fd_ != -1) {
+        close(epoll_fd_);
+    }
+}
+
+void CoroReactor::enqueue(Awaiter* awaiter)
+{
+    awaiter->seq = next_seq_++;
+    pending_.emplace(awaiter->seq, awaiter);
+    heap_.push_back(TimerEntry { awaiter->deadline, awaiter->seq });
+    std::push_heap(heap_.begin(), heap_.end(), std::greater<TimerEntry>());
+
+    if (awaiter->fd != -1) {
+        // One-shot registration: the fd leaves epoll on the first
+        // event, and settle() removes it explicitly when the timer
+        // wins instead
+        struct epoll_event ev {};
+        ev.events   = EPOLLOUT | EPOLLONESHOT;
+        ev.data.u64 = awaiter->seq;
+        epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, awaiter->fd, &ev);
+    }
+}
+
+void CoroReactor::settle(uint64_t seq, bool writable)
+{
+    auto it = pending_.find(seq);
+    if (it == pending_.end()) {
+        return; // already resumed through the other path
+    }
+    Awaiter* awaiter = it->second;
+    pending_.erase(it);
+    if (awaiter->fd != -1) {
+        epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, awaiter->fd, nullptr);
+    }
+    awaiter->writable = writable;
+    // resume() may destroy or reuse the awaiter's frame; touch nothing
+    // of it afterwards
+    awaiter->handle.resume();
+}
+
+void CoroReactor::run(const std::atomic<bool>& shutdown)
+{
+    struct epoll_event events[64];
+
+    while (!shutdown.load()) {
+        // Sleep until the nearest deadline, capped so shutdown is
+        // noticed promptly even when every device is far from due
+        int timeout_ms = 50;
+        if (!heap_.empty()) {
+            auto until = heap_.front().deadline - std::chrono::steady_clock::now();
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(until).count();
+            timeout_ms = static_cast<int>(std::clamp<long long>(ms, 0, 50));
+        }
+
+        int n = epoll_wait(epoll_fd_, events, 64, timeout_ms);
+        for (int i = 0; i < n; ++i) {
+            settle(events[i].data.u64, true);
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        while (!heap_.empty() && heap_.front().deadline <= now) {
+            uint64_t seq = heap_.front().seq;
+            std::pop_heap(heap_.begin(), heap_.end(), std::greater<TimerEntry>());
+            heap_.pop_back();
+            settle(seq, false);
+        }
+    }
+
+    // Shutdown drain: resume every outstanding wait once so each
+    // coroutine observes shutdown, runs off the end and frees its frame
+    while (!heap_.empty()) {
+        uint64_t seq = heap_.front().seq;
+        std::pop_heap(heap_.begin(), heap_.end(), std::greater<TimerEntry>());
+        heap_.pop_back();
+        settle(seq, false);
+    }
+}
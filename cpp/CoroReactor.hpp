@@ -0,0 +1,113 @@
+// CoroReactor.hpp
+#ifndef CORO_REACTOR_HPP
+#define CORO_REACTOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Single-threaded coroutine reactor (--fleet-backend coro). The
+// thread-pool fleet pays a kernel context switch whenever a worker
+// blocks; with one coroutine per device suspended on a shared epoll +
+// deadline-heap loop, a device's emit-wait-emit cycle reads as
+// sequential code but costs a ~200-byte frame instead of a stack, and
+// switching devices is a resume, not a context switch — thousands of
+// devices fit on one thread.
+//
+// Two awaitables cover the fleet's needs: sleepUntil (timer) suspends
+// until a deadline, writableBefore (sink) suspends until the fd is
+// writable or the deadline passes, resuming with which one happened.
+// Everything runs on the thread inside run(), so no state needs locks.
+class CoroReactor {
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    // Detached fire-and-forget coroutine: starts eagerly, owns its
+    // frame, and finishes by running off the end. The reactor resumes
+    // it; nobody joins it, so the fleet launcher just calls and forgets.
+    struct DeviceTask {
+        struct promise_type {
+            DeviceTask get_return_object() { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() { }
+            void unhandled_exception() { std::terminate(); }
+        };
+    };
+
+    CoroReactor();
+    ~CoroReactor();
+
+    CoroReactor(const CoroReactor&)            = delete;
+    CoroReactor& operator=(const CoroReactor&) = delete;
+
+    // False when epoll could not be created; callers fall back to the
+    // thread-pool fleet
+    bool valid() const { return epoll_fd_ != -1; }
+
+    // One suspended wait, parked in the reactor's deadline heap and
+    // (for sink waits) in epoll. Lives in the awaiting coroutine's
+    // frame; the reactor refers to it only through the pending table,
+    // keyed by a sequence number, so a resumed-and-reused frame can
+    // never be confused with the wait it replaced.
+    struct Awaiter {
+        CoroReactor* reactor;
+        TimePoint deadline;
+        int fd; // -1 for pure timer waits
+        bool writable = false;
+        uint64_t seq  = 0;
+        std::coroutine_handle<> handle;
+
+        bool await_ready() const { return false; }
+        void await_suspend(std::coroutine_handle<> h)
+        {
+            handle = h;
+            reactor->enqueue(this);
+        }
+        // True when the fd became writable before the deadline; pure
+        // timer waits always resume false
+        bool await_resume() const { return writable; }
+    };
+
+    // Timer awaitable: suspend until the deadline
+    Awaiter sleepUntil(TimePoint deadline) { return Awaiter { this, deadline, -1 }; }
+
+    // Sink awaitable: suspend until fd is writable, giving up at the
+    // deadline; resumes true only if the fd came ready in time
+    Awaiter writableBefore(int fd, TimePoint deadline)
+    {
+        return Awaiter { this, deadline, fd };
+    }
+
+    // Dispatch until shutdown, then resume every still-suspended
+    // coroutine once (their loops observe shutdown and finish) so no
+    // frames leak. Run after all device coroutines are launched.
+    void run(const std::atomic<bool>& shutdown);
+
+private:
+    friend struct Awaiter;
+
+    // Deadline-heap entry; the awaiter itself is found through
+    // pending_, so entries for already-resumed waits are simply stale
+    struct TimerEntry {
+        TimePoint deadline;
+        uint64_t seq;
+        bool operator>(const TimerEntry& other) const { return deadline > other.deadline; }
+    };
+
+    void enqueue(Awaiter* awaiter);
+
+    // Resume the pending wait with the given sequence number, if it is
+    // still outstanding; writable reports why it fired
+    void settle(uint64_t seq, bool writable);
+
+    int epoll_fd_ = -1;
+    uint64_t next_seq_ = 1;
+    std::vector<TimerEntry> heap_;
+    std::unordered_map<uint64_t, Awaiter*> pending_;
+};
+
+#endif // CORO_REACTOR_HPP
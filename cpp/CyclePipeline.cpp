@@ -0,0 +1,240 @@
+// CyclePipeline.cpp
+#include "CyclePipeline.hpp"
+#include "AllocProfiler.hpp"
+#include "HugePages.hpp"
+#include "NmeaGenerator.hpp"
+#include "ThreadTuning.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+CyclePipeline::CyclePipeline(NmeaGenerator* generator)
+    : generator_(generator)
+{
+    for (std::string& slot : slots_) {
+        slot.reserve(4096);
+    }
+    inline_buf_.reserve(4096);
+}
+
+CyclePipeline::~CyclePipeline()
+{
+    stop_.store(true);
+    if (producer_.joinable()) {
+        producer_.join();
+    }
+    if (kick_fd_ != -1)
+        close(kick_fd_);
+    if (done_fd_ != -1)
+        close(done_fd_);
+}
+
+void CyclePipeline::setTuning(int cpu, int rt_prio)
+{
+    cpu_     = cpu;
+    rt_prio_ = rt_prio;
+}
+
+void CyclePipeline::setBatch(unsigned n)
+{
+    batch_ = n > 0 ? n : 1;
+}
+
+void CyclePipeline::setLateStamp(bool enable)
+{
+    late_stamp_ = enable;
+}
+
+void CyclePipeline::stamp(std::string& buf)
+{
+    stamp_patches_.clear();
+    scanTimePatches(buf, stamp_patches_);
+    patchTimes(buf, stamp_patches_);
+}
+
+// Bake n buffers up front and record where their UTC time fields live.
+// Done once at startup, so the allocations here never touch steady
+// state; after this next() serves the corpus and the generator is idle.
+void CyclePipeline::prebake(size_t n, bool patch_time)
+{
+    if (n == 0) {
+        return;
+    }
+    patch_time_ = patch_time;
+    corpus_.resize(n);
+    corpus_patches_.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        std::string& buf = corpus_[i];
+        buf.reserve(4096);
+        generator_->generateCycles(batch_, buf);
+        if (!patch_time) {
+            continue;
+        }
+        scanTimePatches(buf, corpus_patches_[i]);
+    }
+    // A large corpus is re-read every cycle forever; flag each baked
+    // buffer's heap pages for hugepage collapse so the round-robin walk
+    // stops cycling the dTLB
+    for (std::string& buf : corpus_) {
+        adviseHugePages(&buf[0], buf.size());
+    }
+}
+
+void CyclePipeline::start(std::atomic<bool>* shutdown)
+{
+    if (!corpus_.empty()) {
+        shutdown_ = shutdown;
+        return; // corpus mode: every buffer is already baked
+    }
+    shutdown_ = shutdown;
+    running_  = true;
+    producer_ = std::thread(&CyclePipeline::producerLoop, this);
+    applyThreadTuning(producer_.native_handle(), cpu_, rt_prio_, "generator thread");
+}
+
+// Generator thread: fill free slots as fast as the writer drains them.
+// A full ring means the generator is a full kDepth cycles ahead; at
+// that point it naps rather than spinning, since the writer frees a
+// slot at most once per cycle interval.
+void CyclePipeline::producerLoop()
+{
+    NMEA_ALLOC_SCOPE("CyclePipeline::producerLoop");
+    while (!stop_.load() && !shutdown_->load()) {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == kDepth) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            continue;
+        }
+        std::string& slot = slots_[head % kDepth];
+        slot.clear();
+        generator_->generateCycles(batch_, slot);
+        head_.store(head + 1, std::memory_order_release);
+    }
+}
+
+void CyclePipeline::startOverlap(std::atomic<bool>* shutdown)
+{
+    if (!corpus_.empty()) {
+        shutdown_ = shutdown;
+        return; // corpus mode: every buffer is already baked
+    }
+    kick_fd_ = eventfd(0, EFD_CLOEXEC);
+    done_fd_ = eventfd(0, EFD_CLOEXEC);
+    if (kick_fd_ == -1 || done_fd_ == -1) {
+        std::cerr << "eventfd unavailable, generating inline" << std::endl;
+        return;
+    }
+    shutdown_ = shutdown;
+    overlap_  = true;
+    running_  = true;
+    producer_ = std::thread(&CyclePipeline::overlapLoop, this);
+    applyThreadTuning(producer_.native_handle(), cpu_, rt_prio_, "generator thread");
+
+    // Prime the handshake: the first next() finds buffer 0 ready
+    uint64_t one = 1;
+    (void)!write(kick_fd_, &one, sizeof(one));
+}
+
+// Helper thread for lockstep mode: each kick generates one buffer,
+// alternating between the two, and acknowledges on the done eventfd.
+// The poll timeout keeps shutdown responsive when no kick arrives.
+void CyclePipeline::overlapLoop()
+{
+    uint32_t idx = 0;
+    while (!stop_.load() && !shutdown_->load()) {
+        struct pollfd pfd = { kick_fd_, POLLIN, 0 };
+        if (poll(&pfd, 1, 100) <= 0) {
+            continue;
+        }
+        uint64_t value;
+        (void)!read(kick_fd_, &value, sizeof(value));
+        std::string& slot = slots_[idx & 1];
+        slot.clear();
+        generator_->generateCycles(batch_, slot);
+        ++idx;
+        uint64_t one = 1;
+        (void)!write(done_fd_, &one, sizeof(one));
+    }
+}
+
+const std::string* CyclePipeline::next()
+{
+    if (!corpus_.empty()) {
+        size_t idx       = corpus_idx_;
+        corpus_idx_      = (idx + 1) % corpus_.size();
+        std::string& buf = corpus_[idx];
+        if (patch_time_) {
+            patchTimes(buf, corpus_patches_[idx]);
+        } else if (late_stamp_) {
+            stamp(buf);
+        }
+        return &buf;
+    }
+    if (!running_) {
+        inline_buf_.clear();
+        generator_->generateCycles(batch_, inline_buf_);
+        if (late_stamp_) {
+            stamp(inline_buf_);
+        }
+        return &inline_buf_;
+    }
+    if (overlap_) {
+        // Collect the buffer generated during the previous write, then
+        // immediately kick generation of the other one so it proceeds
+        // while the caller writes this one
+        for (;;) {
+            struct pollfd pfd = { done_fd_, POLLIN, 0 };
+            if (poll(&pfd, 1, 100) > 0) {
+                uint64_t value;
+                (void)!read(done_fd_, &value, sizeof(value));
+                break;
+            }
+            if (stop_.load() || shutdown_->load()) {
+                return nullptr;
+            }
+        }
+        uint64_t one = 1;
+        (void)!write(kick_fd_, &one, sizeof(one));
+        std::string& slot = slots_[cur_ & 1];
+        if (late_stamp_) {
+            stamp(slot);
+        }
+        return &slot;
+    }
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    while (head_.load(std::memory_order_acquire) == tail) {
+        if (stop_.load() || shutdown_->load()) {
+            return nullptr;
+        }
+        // Empty ring only happens at startup or after a generator
+        // stall; the wait is off the common path
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    std::string& slot = slots_[tail % kDepth];
+    if (late_stamp_) {
+        stamp(slot);
+    }
+    return &slot;
+}
+
+void CyclePipeline::release()
+{
+    if (!corpus_.empty()) {
+        return; // corpus buffers are permanent; nothing to recycle
+    }
+    if (!running_) {
+        return;
+    }
+    if (overlap_) {
+        ++cur_;
+        return;
+    }
+    tail_.store(tail_.load(std::memory_order_relaxed) + 1,
+                std::memory_order_release);
+}
@@ -0,0 +1,141 @@
+// CyclePipeline.hpp
+#ifndef CYCLE_PIPELINE_HPP
+#define CYCLE_PIPELINE_HPP
+
+#include "TimePatch.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+class NmeaGenerator;
+
+// Decouples sentence generation from output (--pipeline). A dedicated
+// generator thread produces cycle buffers into a lock-free single-
+// producer/single-consumer ring and the writer thread consumes them, so
+// generation of cycle N+1 overlaps the write of cycle N instead of the
+// two running back to back in one thread — a stalled write no longer
+// delays the next cycle's generation and vice versa. The ring slots are
+// reusable strings (buffer recycling), so steady state allocates
+// nothing; a full ring simply stalls the generator, bounding how far
+// ahead of the writer it can run.
+//
+// When not started, next() generates inline and the pipeline degrades
+// to the historical single-thread behavior, so writer loops use one
+// code path either way.
+class CyclePipeline {
+public:
+    explicit CyclePipeline(NmeaGenerator* generator);
+    ~CyclePipeline();
+
+    CyclePipeline(const CyclePipeline&)            = delete;
+    CyclePipeline& operator=(const CyclePipeline&) = delete;
+
+    // Scheduling for the generator thread (--gen-cpu, --rt-prio);
+    // applied when the thread is started
+    void setTuning(int cpu, int rt_prio);
+
+    // Cycles per buffer (--burst): every next() returns n cycles
+    // back to back in one contiguous buffer, so the writer emits the
+    // whole burst with its usual single write before sleeping
+    void setBatch(unsigned n);
+
+    // Late time stamping (--late-stamp): buffers are assembled ahead of
+    // the write with whatever clock generation saw, then next() patches
+    // the fixed-width hhmmss.ss fields and repairs the checksums just
+    // before handing the buffer over. The wire-visible timestamp error
+    // collapses from generation cost — buffered modes hand out cycles
+    // generated up to a full interval earlier — to the patch-plus-write
+    // cost of a few microseconds.
+    void setLateStamp(bool enable);
+
+    // The stamp pass behind --late-stamp, public for the vmsplice
+    // backend, whose buffers never flow through next()
+    void stamp(std::string& buf);
+
+    // Launch the generator thread. The shutdown flag is the writer's;
+    // the generator also stops when the pipeline is destroyed.
+    void start(std::atomic<bool>* shutdown);
+
+    // Lighter-weight alternative (--overlap): the same helper thread,
+    // but in lockstep double buffering — next() hands the writer the
+    // buffer generated during the previous write and immediately kicks
+    // generation of the other one, so exactly one cycle is in flight
+    // and the data is at most one cycle stale (the free-running ring
+    // can be up to kDepth cycles ahead). The handshake runs over a
+    // pair of eventfds; if they cannot be created the pipeline stays
+    // in inline mode.
+    void startOverlap(std::atomic<bool>* shutdown);
+
+    bool running() const { return running_; }
+
+    // Prebaked corpus mode (--prebake): generate n cycles into memory up
+    // front, then hand them out round-robin — emission becomes pure
+    // writes from static buffers, so the simulator's CPU footprint while
+    // a consumer is profiled is negligible and perfectly constant. When
+    // patch_time is set, each emission overwrites the fixed-width
+    // hhmmss.ss fields in place with the current wall clock and repairs
+    // the NMEA checksums incrementally (XOR is self-inverse, so the new
+    // checksum is old ^ old_field ^ new_field — no rescan of the line).
+    void prebake(size_t n, bool patch_time);
+
+    // Fetch the next cycle buffer: the oldest queued buffer when the
+    // pipeline is running (waiting for the generator if the ring is
+    // momentarily empty), an inline generation pass otherwise. Returns
+    // nullptr only when shutdown was signalled while waiting. The
+    // buffer stays valid until release().
+    const std::string* next();
+
+    // Return the buffer from the last next() to the ring for reuse
+    void release();
+
+    static constexpr uint32_t kDepth = 4; // ring slots; power of two
+
+private:
+    void producerLoop();
+    void overlapLoop();
+
+    NmeaGenerator* generator_;
+    std::atomic<bool>* shutdown_ = nullptr;
+    std::atomic<bool> stop_ { false };
+
+    // Generator-thread scheduling; -1 / 0 leave the defaults alone
+    int cpu_     = -1;
+    int rt_prio_ = 0;
+
+    unsigned batch_ = 1; // cycles generated per buffer
+
+    // SPSC ring of recycled cycle buffers; head counts published
+    // cycles, tail released ones, both monotonic
+    std::string slots_[kDepth];
+    std::atomic<uint32_t> head_ { 0 };
+    std::atomic<uint32_t> tail_ { 0 };
+
+    bool running_ = false;
+    std::string inline_buf_; // next() target when not running
+    std::thread producer_;
+
+    // Prebaked corpus: fixed cycle buffers served round-robin, with
+    // their time-field patch points (TimePatch.hpp) recorded once at
+    // bake time
+    std::vector<std::string> corpus_;
+    std::vector<std::vector<TimePatch>> corpus_patches_;
+    size_t corpus_idx_ = 0;
+    bool patch_time_   = false;
+
+    // --late-stamp state: the scratch patch table is reused across
+    // buffers (layouts shift with field widths, so it is rescanned per
+    // buffer, but its capacity settles after the first cycle)
+    bool late_stamp_ = false;
+    std::vector<TimePatch> stamp_patches_;
+
+    // Lockstep double-buffer mode: eventfd handshake with the helper
+    bool overlap_ = false;
+    int kick_fd_  = -1; // writer -> helper: generate the next buffer
+    int done_fd_  = -1; // helper -> writer: a buffer is ready
+    uint32_t cur_ = 0; // buffer the writer consumes this cycle
+};
+
+#endif // CYCLE_PIPELINE_HPP
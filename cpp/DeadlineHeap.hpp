@@ -0,0 +1,52 @@
+// DeadlineHeap.hpp
+#ifndef DEADLINE_HEAP_HPP
+#define DEADLINE_HEAP_HPP
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+// Min-heap deadline scheduler for mixed-rate periodic work. Every
+// activity that used to own a thread with its own sleep loop — a stats
+// tick, a checkpoint flush poll, a timed shutdown — registers a
+// callback plus a period instead, and one loop waits on a single
+// timerfd armed to the earliest deadline in the heap. Another activity
+// is an O(log n) heap push, not another sleeping mechanism, so mixed
+// rates compose without the activities interfering with each other's
+// timing and without a thread per rate.
+//
+// A periodic task that falls behind skips to its next future slot
+// rather than bursting catch-up ticks, the same policy CycleScheduler
+// applies to emission overruns.
+//
+// run() owns the calling thread until shutdown (or until every task
+// has retired). Callbacks execute on that thread one at a time, so
+// tasks never need locking against each other — only against the
+// threads whose state they observe.
+class DeadlineHeap {
+public:
+    using TaskFn = std::function<void()>;
+
+    // Register a periodic task; first due one period after run()
+    void add(double period_seconds, TaskFn fn);
+
+    // Register a one-shot task, due once after the given delay
+    void addOnce(double delay_seconds, TaskFn fn);
+
+    // Drive the heap until shutdown is set or no tasks remain. wake_fd
+    // (-1 = none) is a level-readable fd that cuts the wait short, so
+    // shutdown latency is poll latency, not time-to-next-deadline.
+    void run(const std::atomic<bool>& shutdown, int wake_fd);
+
+private:
+    struct Task {
+        std::chrono::steady_clock::duration first; // delay to first due
+        std::chrono::steady_clock::duration period; // zero = one-shot
+        TaskFn fn;
+    };
+
+    std::vector<Task> tasks_;
+};
+
+#endif // DEADLINE_HEAP_HPP
@@ -0,0 +1,172 @@
+// FleetScheduler.cpp
+#include "FleetScheduler.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <pthread.h>
+#include <sched.h>
+#include <thread>
+
+FleetScheduler::FleetScheduler(uint32_t device_count, double interval_seconds, unsigned workers)
+    : device_count_(device_count)
+    , tick_seconds_(interval_seconds / kWheelSlots)
+    , worker_count_(workers > 0 ? workers : 1)
+    , epoch_(std::chrono::steady_clock::now())
+    , workers_(worker_count_)
+{
+    // Seed the wheels: devices round-robin across workers, first
+    // deadlines spread evenly over one rotation so the fleet never
+    // synchronizes into a once-per-interval burst
+    for (uint32_t i = 0; i < device_count_; ++i) {
+        uint64_t due = static_cast<uint64_t>(i) * kWheelSlots / device_count_ + 1;
+        workers_[workerOf(i, worker_count_)].wheel[due & (kWheelSlots - 1)].push_back(
+            Task { i, due });
+    }
+}
+
+void FleetScheduler::setPlacement(std::vector<WorkerPlacement> placement)
+{
+    placement_ = std::move(placement);
+}
+
+void FleetScheduler::run(const DeviceFn& fn, const std::atomic<bool>& shutdown)
+{
+    std::vector<std::thread> pool;
+    pool.reserve(worker_count_ - 1);
+    for (unsigned w = 1; w < worker_count_; ++w) {
+        pool.emplace_back(&FleetScheduler::workerLoop, this, w, std::cref(fn),
+                          std::cref(shutdown));
+    }
+    workerLoop(0, fn, shutdown);
+    for (auto& t : pool) {
+        t.join();
+    }
+}
+
+bool FleetScheduler::stealInto(unsigned self, std::deque<Task>& out)
+{
+    int self_node = self < placement_.size() ? placement_[self].node : -1;
+    for (unsigned i = 1; i < worker_count_; ++i) {
+        unsigned v = (self + i) % worker_count_;
+        // NUMA placement constrains stealing to the node: a stolen
+        // device re-arms into the thief's wheel permanently, and a
+        // cross-node thief would drag its state over the interconnect
+        // for the rest of the run
+        if (self_node >= 0 && v < placement_.size() && placement_[v].node != self_node) {
+            continue;
+        }
+        Worker& victim = workers_[v];
+        std::lock_guard<std::mutex> lock(victim.ready_mutex);
+        size_t half = victim.ready.size() / 2;
+        if (half == 0) {
+            continue;
+        }
+        // Take the back half: the front entries are the oldest and the
+        // victim is about to run them anyway
+        for (size_t n = 0; n < half; ++n) {
+            out.push_back(victim.ready.back());
+            victim.ready.pop_back();
+        }
+        return true;
+    }
+    return false;
+}
+
+void FleetScheduler::workerLoop(unsigned self, const DeviceFn& fn,
+                                const std::atomic<bool>& shutdown)
+{
+    Worker& w = workers_[self];
+    if (self < placement_.size() && !placement_[self].cpus.empty()) {
+        // Pin to the assigned node's CPU set; like --cpu, a failed
+        // request warns and keeps default scheduling
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : placement_[self].cpus) {
+            CPU_SET(cpu, &set);
+        }
+        int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        if (rc != 0) {
+            std::cerr << "Warning: could not pin fleet worker " << self << " to node "
+                      << placement_[self].node << ": " << strerror(rc) << std::endl;
+        }
+    }
+    std::deque<Task> stolen;
+
+    while (!shutdown.load()) {
+        auto now     = std::chrono::steady_clock::now();
+        uint64_t cur = static_cast<uint64_t>(
+            std::chrono::duration<double>(now - epoch_).count() / tick_seconds_);
+
+        // Advance the wheel: move every task due by now onto the ready
+        // queue. Slots also hold tasks from future rotations, which the
+        // due_tick comparison leaves in place.
+        while (w.next_tick <= cur) {
+            auto& slot = w.wheel[w.next_tick & (kWheelSlots - 1)];
+            for (size_t i = 0; i < slot.size();) {
+                if (slot[i].due_tick <= w.next_tick) {
+                    {
+                        std::lock_guard<std::mutex> lock(w.ready_mutex);
+                        w.ready.push_back(slot[i]);
+                    }
+                    slot[i] = slot.back();
+                    slot.pop_back();
+                } else {
+                    ++i;
+                }
+            }
+            ++w.next_tick;
+        }
+
+        // Adopt stolen work: stolen devices re-arm into this wheel
+        // below, so a steal permanently shifts load to this worker
+        if (!stolen.empty()) {
+            std::lock_guard<std::mutex> lock(w.ready_mutex);
+            while (!stolen.empty()) {
+                w.ready.push_back(stolen.front());
+                stolen.pop_front();
+            }
+        }
+
+        // Execute due tasks one at a time so a thief can still take the
+        // remainder mid-batch
+        bool ran = false;
+        for (;;) {
+            Task task;
+            {
+                std::lock_guard<std::mutex> lock(w.ready_mutex);
+                if (w.ready.empty()) {
+                    break;
+                }
+                task = w.ready.front();
+                w.ready.pop_front();
+            }
+            fn(task.device);
+            ran = true;
+            if (cur >= task.due_tick + kWheelSlots) {
+                // A full interval behind: the device missed at least
+                // one cycle outright
+                late_cycles_.fetch_add(1, std::memory_order_relaxed);
+            }
+            task.due_tick += kWheelSlots; // one rotation = one interval
+            w.wheel[task.due_tick & (kWheelSlots - 1)].push_back(task);
+            if (shutdown.load()) {
+                return;
+            }
+        }
+        if (ran) {
+            continue; // deadlines may have passed while executing
+        }
+
+        if (stealInto(self, stolen)) {
+            continue;
+        }
+
+        // Idle until the next wheel tick, capped so shutdown (and newly
+        // stealable work) is noticed promptly even at long intervals
+        auto next_deadline = epoch_
+            + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(w.next_tick * tick_seconds_));
+        auto cap = std::chrono::steady_clock::now() + std::chrono::milliseconds(50);
+        std::this_thread::sleep_until(next_deadline < cap ? next_deadline : cap);
+    }
+}
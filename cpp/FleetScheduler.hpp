@@ -0,0 +1,104 @@
+// FleetScheduler.hpp
+#ifndef FLEET_SCHEDULER_HPP
+#define FLEET_SCHEDULER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+// Deadline scheduler for the --count fleet. The static range-per-thread
+// model stops scaling around a few hundred devices: every device in a
+// range fires at the same instant, so each tick is a burst of work
+// followed by idle sleep, and one slow device (a blocked PTY, a long
+// generation) delays every device behind it in the range.
+//
+// Here every device is a small task — an index plus its next deadline —
+// parked in a hashed timing wheel. Deadlines are staggered across the
+// interval at startup, so 5,000 loosely-synchronized 1 Hz devices
+// become a smooth ~5 kHz trickle instead of a once-a-second stampede.
+// A fixed worker pool advances per-worker wheels; a worker that runs
+// dry steals half of a busy neighbour's due queue, and stolen devices
+// re-arm into the thief's wheel, so load migrates permanently toward
+// idle workers instead of being rebalanced every tick.
+class FleetScheduler {
+public:
+    // Executes one cycle for the given device. Called concurrently for
+    // different devices, never concurrently for the same device.
+    using DeviceFn = std::function<void(uint32_t device)>;
+
+    FleetScheduler(uint32_t device_count, double interval_seconds, unsigned workers);
+
+    // NUMA placement for one worker: the CPU set it is pinned to and
+    // the node that set belongs to. Workers with a node assigned steal
+    // only from same-node neighbours, so a device's state never
+    // migrates across the socket interconnect behind the first-touch
+    // placement's back.
+    struct WorkerPlacement {
+        std::vector<int> cpus; // affinity set; empty = unpinned
+        int node = -1; // -1 = no node constraint on stealing
+    };
+
+    // Install per-worker placement; must be called before run()
+    void setPlacement(std::vector<WorkerPlacement> placement);
+
+    // The worker a device is permanently seeded onto; exposed so
+    // first-touch setup can initialize device state from a thread on
+    // that worker's node
+    static unsigned workerOf(uint32_t device, unsigned workers)
+    {
+        return device % (workers > 0 ? workers : 1);
+    }
+
+    // Drive the fleet until shutdown is set. Blocks; spawns workers - 1
+    // extra threads and runs the last worker on the calling thread.
+    void run(const DeviceFn& fn, const std::atomic<bool>& shutdown);
+
+    // Device-cycles that ran a full interval or more behind schedule
+    uint64_t lateCycles() const { return late_cycles_.load(); }
+
+private:
+    // Wheel geometry: one rotation spans exactly one device interval,
+    // so a device re-armed at +interval lands in the slot it came from.
+    // 256 slots put the scheduling granularity at interval/256 (~4 ms
+    // at 1 Hz) — coarse enough that a slot batches neighbouring
+    // deadlines into one wake-up, fine enough that the stagger holds.
+    static constexpr uint32_t kWheelSlots = 256;
+
+    // One parked task: which device, and the absolute tick it is due.
+    // The tick disambiguates wheel rotations, so a slot can hold tasks
+    // from different rotations without extra structure.
+    struct Task {
+        uint32_t device;
+        uint64_t due_tick;
+    };
+
+    struct Worker {
+        std::vector<Task> wheel[kWheelSlots];
+        // Due tasks awaiting execution; the only cross-thread state.
+        // Steals are rare (an empty local queue), so a plain mutex
+        // costs nothing on the common path.
+        std::deque<Task> ready;
+        std::mutex ready_mutex;
+        uint64_t next_tick = 0; // next wheel tick to advance past
+    };
+
+    void workerLoop(unsigned self, const DeviceFn& fn, const std::atomic<bool>& shutdown);
+
+    // Move half of the busiest neighbour's due queue into out; returns
+    // false when nobody has surplus work
+    bool stealInto(unsigned self, std::deque<Task>& out);
+
+    uint32_t device_count_;
+    double tick_seconds_;
+    unsigned worker_count_;
+    std::chrono::steady_clock::time_point epoch_;
+    std::vector<Worker> workers_;
+    std::vector<WorkerPlacement> placement_; // empty = no NUMA placement
+    std::atomic<uint64_t> late_cycles_ { 0 };
+};
+
+#endif // FLEET_SCHEDULER_HPP
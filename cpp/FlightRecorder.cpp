@@ -0,0 +1,128 @@
+// FlightRecorder.cpp
+#include "FlightRecorder.hpp"
+
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace {
+
+// Saturating narrow of a nanosecond count into a 32-bit microsecond
+// field
+int32_t toUsSat(int64_t ns)
+{
+    int64_t us = ns / 1000;
+    if (us > INT32_MAX) {
+        return INT32_MAX;
+    }
+    if (us < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return static_cast<int32_t>(us);
+}
+
+// Signal-safe decimal formatter; returns the number of characters
+// written. snprintf is off the table in a handler, so digits go in by
+// hand.
+size_t putDec(char* out, int64_t value)
+{
+    char tmp[24];
+    size_t n      = 0;
+    bool negative = value < 0;
+    uint64_t v    = negative ? 0 - static_cast<uint64_t>(value)
+                             : static_cast<uint64_t>(value);
+    do {
+        tmp[n++] = static_cast<char>('0' + v % 10);
+        v /= 10;
+    } while (v != 0);
+    size_t len = 0;
+    if (negative) {
+        out[len++] = '-';
+    }
+    while (n > 0) {
+        out[len++] = tmp[--n];
+    }
+    return len;
+}
+
+size_t putStr(char* out, const char* s)
+{
+    size_t len = 0;
+    while (s[len] != '\0') {
+        out[len] = s[len];
+        ++len;
+    }
+    return len;
+}
+
+} // namespace
+
+void FlightRecorder::record(uint8_t sink, uint64_t seq, int64_t deadline_err_ns,
+                            int64_t write_ns, size_t bytes)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t slot = head_.fetch_add(1, std::memory_order_relaxed);
+    Record& r     = ring_[slot & (kSlots - 1)];
+    r.t_ns        = static_cast<uint64_t>(ts.tv_sec) * 1000000000ull
+        + static_cast<uint64_t>(ts.tv_nsec);
+    r.seq             = seq;
+    r.deadline_err_us = toUsSat(deadline_err_ns);
+    r.write_us        = static_cast<uint32_t>(toUsSat(write_ns));
+    r.bytes           = static_cast<uint32_t>(bytes);
+    r.sink            = sink;
+}
+
+void FlightRecorder::preparePath()
+{
+    size_t len = putStr(path_, "/tmp/nmea_simulator-flight.");
+    len += putDec(path_ + len, static_cast<int64_t>(getpid()));
+    len += putStr(path_ + len, ".log");
+    path_[len] = '\0';
+}
+
+void FlightRecorder::dumpSignalSafe()
+{
+    if (path_[0] == '\0') {
+        return;
+    }
+    int fd = open(path_, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd == -1) {
+        return;
+    }
+    char line[128];
+    size_t len = putStr(line, "# t_us seq sink bytes deadline_err_us write_us\n");
+    [[maybe_unused]] ssize_t n = write(fd, line, len);
+
+    // Oldest first: the slot head_ points at is the next overwrite,
+    // i.e. the oldest record once the ring has wrapped
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    for (uint64_t i = 0; i < kSlots; ++i) {
+        const Record& r = ring_[(head + i) & (kSlots - 1)];
+        if (r.t_ns == 0) {
+            continue; // never filled
+        }
+        len = putDec(line, static_cast<int64_t>(r.t_ns / 1000));
+        line[len++] = ' ';
+        len += putDec(line + len, static_cast<int64_t>(r.seq));
+        line[len++] = ' ';
+        len += putDec(line + len, r.sink);
+        line[len++] = ' ';
+        len += putDec(line + len, r.bytes);
+        line[len++] = ' ';
+        len += putDec(line + len, r.deadline_err_us);
+        line[len++] = ' ';
+        len += putDec(line + len, r.write_us);
+        line[len++] = '\n';
+        n           = write(fd, line, len);
+    }
+    close(fd);
+}
+
+FlightRecorder& flightRecorder()
+{
+    // Constructed well before any signal can ask for a dump — the
+    // first caller is PtyHandler::setupSignalHandler
+    static FlightRecorder recorder;
+    return recorder;
+}
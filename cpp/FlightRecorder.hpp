@@ -0,0 +1,59 @@
+// FlightRecorder.hpp
+#ifndef FLIGHT_RECORDER_HPP
+#define FLIGHT_RECORDER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Always-on in-memory flight recorder: when a rig misbehaves at 3 AM,
+// stdout scrollback is gone and capture files were off, so the writer
+// stores per-cycle metadata — sequence, deadline error, write
+// duration, bytes, sink — in a fixed 256 KB ring (no payloads). The
+// steady-state cost is filling one 32-byte slot per cycle; at 10 Hz
+// the ring holds the last ~13 minutes. SIGUSR2 dumps it to
+// /tmp/nmea_simulator-flight.<pid>.log without disturbing the run, and
+// the fatal-signal path dumps it before re-raising, so the minutes
+// before an incident survive the process. The dump path is
+// async-signal-safe throughout: open/write/close and hand-rolled
+// decimal formatting, no stdio, no allocation.
+class FlightRecorder {
+public:
+    struct Record {
+        uint64_t t_ns; // CLOCK_MONOTONIC at emission
+        uint64_t seq; // writer cycle sequence
+        int32_t deadline_err_us; // emission time minus cycle deadline
+        uint32_t write_us; // sink write duration
+        uint32_t bytes; // cycle payload bytes
+        uint8_t sink; // SinkId ordinal
+        uint8_t pad[3];
+    };
+    static_assert(sizeof(Record) == 32, "one cache-line-half per cycle");
+
+    // 256 KB fixed footprint; power of two so the slot index is a mask
+    static constexpr size_t kSlots = 8192;
+
+    // Hot-path entry: fill the next slot. Values are saturated into
+    // the compact fields; lost precision past ~35 minutes of deadline
+    // error is not what post-mortems hinge on.
+    void record(uint8_t sink, uint64_t seq, int64_t deadline_err_ns,
+                int64_t write_ns, size_t bytes);
+
+    // Compute the dump path once, off the signal path
+    void preparePath();
+
+    // Write the ring oldest-first as text; callable from a signal
+    // handler
+    void dumpSignalSafe();
+
+private:
+    Record ring_[kSlots] = {};
+    std::atomic<uint64_t> head_ { 0 };
+    char path_[64] = {};
+};
+
+// Process-wide recorder shared by the writer hot paths and the signal
+// handler
+FlightRecorder& flightRecorder();
+
+#endif // FLIGHT_RECORDER_HPP
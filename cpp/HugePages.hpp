@@ -0,0 +1,69 @@
+// HugePages.hpp
+#ifndef HUGE_PAGES_HPP
+#define HUGE_PAGES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <sys/mman.h>
+
+// 2 MB page backing for the multi-megabyte pools touched every cycle —
+// the shm ring, the prebaked corpus, the replay window. At 4 KB pages
+// a region that size is hundreds of dTLB entries wide, and on dense
+// --count rigs the misses show up in perf. mapHugeBuffer tries an
+// explicit MAP_HUGETLB mapping first (hosts with a preallocated
+// hugepage pool), then falls back to a normal mapping flagged
+// MADV_HUGEPAGE so khugepaged collapses it once transparent hugepages
+// are enabled. adviseHugePages applies the same hint to mappings made
+// elsewhere (file- and shm-backed rings, heap-allocated corpus
+// buffers) where the explicit flag is not an option. Everything is
+// best-effort: a host without hugepages runs exactly as before.
+
+inline constexpr size_t kHugePageBytes = 2u << 20;
+
+// Flag an existing region for transparent hugepage collapse. The range
+// is rounded inward to page boundaries — madvise wants aligned
+// addresses, and the hint is per-VMA so trimming the edges loses
+// nothing. Failure (old kernel, THP disabled, file-backed mapping) is
+// ignored.
+inline void adviseHugePages(void* addr, size_t len)
+{
+#if defined(MADV_HUGEPAGE)
+    constexpr uintptr_t kPageMask = 4096 - 1;
+    uintptr_t base                = reinterpret_cast<uintptr_t>(addr);
+    uintptr_t first               = (base + kPageMask) & ~kPageMask;
+    uintptr_t last                = (base + len) & ~kPageMask;
+    if (last > first) {
+        madvise(reinterpret_cast<void*>(first), last - first, MADV_HUGEPAGE);
+    }
+#else
+    (void)addr;
+    (void)len;
+#endif
+}
+
+// Map an anonymous pool of at least bytes, hugepage-backed when the
+// host allows it; bytes is updated to the mapped length, which the
+// caller must pass back to munmap. Returns nullptr only when even a
+// plain mapping fails.
+inline void* mapHugeBuffer(size_t& bytes, bool shared)
+{
+    size_t rounded = (bytes + kHugePageBytes - 1) & ~(kHugePageBytes - 1);
+    int flags      = MAP_ANONYMOUS | (shared ? MAP_SHARED : MAP_PRIVATE);
+    void* map      = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+    map = mmap(nullptr, rounded, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+    if (map != MAP_FAILED) {
+        bytes = rounded;
+        return map;
+    }
+#endif
+    map = mmap(nullptr, rounded, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (map == MAP_FAILED) {
+        return nullptr;
+    }
+    adviseHugePages(map, rounded);
+    bytes = rounded;
+    return map;
+}
+
+#endif // HUGE_PAGES_HPP
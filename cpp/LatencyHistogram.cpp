@@ -0,0 +1,64 @@
+// LatencyHistogram.cpp
+#include "LatencyHistogram.hpp"
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+namespace {
+
+// Human-scaled duration: picks ns/us/ms/s so the summary line stays
+// readable across six orders of magnitude
+void appendDuration(std::string& out, int64_t nanos)
+{
+    char buf[32];
+    if (nanos < 10000) {
+        snprintf(buf, sizeof(buf), "%lldns", static_cast<long long>(nanos));
+    } else if (nanos < 10000000) {
+        snprintf(buf, sizeof(buf), "%.1fus", nanos / 1e3);
+    } else if (nanos < 10000000000LL) {
+        snprintf(buf, sizeof(buf), "%.1fms", nanos / 1e6);
+    } else {
+        snprintf(buf, sizeof(buf), "%.1fs", nanos / 1e9);
+    }
+    out += buf;
+}
+
+} // namespace
+
+int64_t LatencyHistogram::percentileBound(double q) const
+{
+    uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(total_));
+    uint64_t seen = 0;
+    for (unsigned b = 0; b < kBuckets; ++b) {
+        seen += counts_[b];
+        if (seen > rank) {
+            // The bucket's upper bound, clamped so a sparse tail never
+            // reports a percentile beyond the observed maximum
+            int64_t bound = b == 0 ? 0 : (int64_t(1) << b) - 1;
+            return bound < max_ ? bound : max_;
+        }
+    }
+    return max_;
+}
+
+void LatencyHistogram::dump(const char* label) const
+{
+    if (total_ == 0) {
+        return;
+    }
+    std::string line = label;
+    line += ": n=" + std::to_string(total_);
+    line += " p50<";
+    appendDuration(line, percentileBound(0.50));
+    line += " p99<";
+    appendDuration(line, percentileBound(0.99));
+    line += " p99.9<";
+    appendDuration(line, percentileBound(0.999));
+    line += " max=";
+    appendDuration(line, max_);
+    if (early_ > 0) {
+        line += " (early: " + std::to_string(early_) + ")";
+    }
+    std::cout << line << std::endl;
+}
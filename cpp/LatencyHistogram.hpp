@@ -0,0 +1,55 @@
+// LatencyHistogram.hpp
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+
+#include <cstdint>
+
+// Log2-bucketed latency histogram for the writer hot loops: fixed
+// memory (64 counters), and record() is a subtract, a bit scan and an
+// increment — cheap enough to run on every cycle without perturbing
+// the timing it measures. Bucket n covers [2^(n-1), 2^n) nanoseconds,
+// so percentile reads are exact to within a factor of two, which is
+// plenty for "is p99.9 jitter one microsecond or one millisecond".
+class LatencyHistogram {
+public:
+    void record(int64_t nanos)
+    {
+        if (nanos < 0) {
+            // Early against the deadline; magnitude still counted so
+            // the distribution covers both directions
+            ++early_;
+            nanos = -nanos;
+        }
+        unsigned bucket = nanos == 0
+            ? 0
+            : 64 - static_cast<unsigned>(__builtin_clzll(static_cast<uint64_t>(nanos)));
+        if (bucket >= kBuckets) {
+            bucket = kBuckets - 1;
+        }
+        ++counts_[bucket];
+        ++total_;
+        if (nanos > max_) {
+            max_ = nanos;
+        }
+    }
+
+    bool empty() const { return total_ == 0; }
+
+    // One-line p50/p99/p99.9/max summary, printed as the writer winds
+    // down (the SIGINT shutdown path)
+    void dump(const char* label) const;
+
+    // Upper bound of the bucket holding the q-quantile sample, clamped
+    // to the observed max; 0 while empty
+    int64_t percentileBound(double q) const;
+
+private:
+    static constexpr unsigned kBuckets = 64;
+
+    uint64_t counts_[kBuckets] = {};
+    uint64_t total_ = 0;
+    uint64_t early_ = 0;
+    int64_t max_    = 0;
+};
+
+#endif // LATENCY_HISTOGRAM_HPP
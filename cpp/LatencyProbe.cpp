@@ -0,0 +1,157 @@
+// LatencyProbe.cpp
+//
+// Minimal measuring consumer for the latency_bench target: reads a
+// simulator port, timestamps every $PSIMT trailer on arrival and diffs
+// it against the embedded CLOCK_MONOTONIC transmit stamp — the
+// consumer-observed one-way latency, including scheduler, PTY layer
+// and read-side effects that no generation microbenchmark sees.
+// Sequence gaps in the trailer count lost cycles. Prints one summary
+// line on stdout when the window closes; the generator microbenchmarks
+// grade the producer, this grades the path.
+//
+// Usage: latency_probe <port> <seconds>
+// The simulator must be emitting PSIMT (--sentences ...,PSIMT).
+#include "LatencyHistogram.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace {
+
+// Raw mode: the default cooked slave would translate line endings and
+// buffer by line, charging tty-discipline time to the stream under
+// measurement
+void makeRaw(int fd)
+{
+    struct termios tio;
+    if (tcgetattr(fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+}
+
+int64_t nowNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+// Parse "$PSIMT,<seq>,<tx_ns>,<bytes>" (checksum and padding
+// tolerated); returns false for any other line
+bool parsePsimt(const char* line, size_t len, long& seq, int64_t& tx_ns)
+{
+    static constexpr char kLead[] = "$PSIMT,";
+    if (len < sizeof(kLead) || std::memcmp(line, kLead, sizeof(kLead) - 1) != 0) {
+        return false;
+    }
+    char* end = nullptr;
+    seq       = std::strtol(line + sizeof(kLead) - 1, &end, 10);
+    if (end == nullptr || *end != ',') {
+        return false;
+    }
+    tx_ns = std::strtoll(end + 1, &end, 10);
+    return end != nullptr && *end == ',';
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3) {
+        std::fprintf(stderr, "Usage: %s <port> <seconds>\n", argv[0]);
+        return 1;
+    }
+    double seconds = std::atof(argv[2]);
+
+    // The simulator creates the port after startup; retry the open
+    // briefly instead of making every caller order the launch
+    int fd = -1;
+    for (int attempt = 0; attempt < 250 && fd == -1; ++attempt) {
+        fd = open(argv[1], O_RDONLY | O_NOCTTY);
+        if (fd == -1) {
+            usleep(20000);
+        }
+    }
+    if (fd == -1) {
+        std::fprintf(stderr, "Error: could not open %s\n", argv[1]);
+        return 1;
+    }
+    makeRaw(fd);
+
+    LatencyHistogram hist;
+    long cycles       = 0;
+    long lost         = 0;
+    long last_seq     = -1;
+    int64_t min_ns    = 0;
+    int64_t window_end = 0; // armed by the first trailer
+
+    char buf[4096];
+    char line[512];
+    size_t line_len = 0;
+    for (;;) {
+        ssize_t n = read(fd, buf, sizeof(buf));
+        if (n <= 0) {
+            if (n == -1 && errno == EINTR) {
+                continue;
+            }
+            break; // producer gone
+        }
+        int64_t rx_ns = nowNs();
+        if (window_end != 0 && rx_ns >= window_end) {
+            break;
+        }
+        for (ssize_t i = 0; i < n; ++i) {
+            char c = buf[i];
+            if (c != '\n' && c != '\r') {
+                if (line_len < sizeof(line) - 1) {
+                    line[line_len++] = c;
+                }
+                continue;
+            }
+            line[line_len] = '\0';
+            long seq;
+            int64_t tx_ns;
+            if (line_len > 0 && parsePsimt(line, line_len, seq, tx_ns)) {
+                if (window_end == 0) {
+                    // Clock starts at the first trailer so open/attach
+                    // time is not charged to the distribution
+                    window_end = rx_ns + static_cast<int64_t>(seconds * 1e9);
+                } else {
+                    int64_t delta = rx_ns - tx_ns;
+                    hist.record(delta);
+                    if (cycles == 0 || delta < min_ns) {
+                        min_ns = delta;
+                    }
+                    ++cycles;
+                    if (last_seq >= 0 && seq > last_seq + 1) {
+                        lost += seq - last_seq - 1;
+                    }
+                }
+                last_seq = seq;
+            }
+            line_len = 0;
+        }
+    }
+    close(fd);
+
+    if (cycles == 0) {
+        std::fprintf(stderr, "Error: no PSIMT trailers seen on %s "
+                             "(is PSIMT in the sentence set?)\n",
+                     argv[1]);
+        return 1;
+    }
+    std::printf("cycles=%ld lost=%ld loss=%.3f%% min=%.1fus ", cycles, lost,
+                100.0 * static_cast<double>(lost)
+                    / static_cast<double>(cycles + lost),
+                static_cast<double>(min_ns) / 1e3);
+    std::fflush(stdout);
+    hist.dump("latency");
+    return 0;
+}
@@ -0,0 +1,98 @@
+// MemBudget.hpp
+#ifndef MEM_BUDGET_HPP
+#define MEM_BUDGET_HPP
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// Process-wide memory ledger (--mem-budget <MB>): on shared hosts each
+// simulator runs under a container limit, and the pools that scale
+// with configuration — replay cache, prebaked corpus, capture ring —
+// can quietly push a --count soak past it and get the run OOM-killed
+// hours in, losing it. Each pool reserves its resident footprint here
+// before allocating; a reservation that would not fit is refused with
+// a clear error at startup, because a run that never starts is
+// recoverable and one killed mid-soak is not. Reservations are
+// deliberately conservative upper bounds — predictability is the
+// point, not byte-exact accounting — and teardown reports the
+// kernel's own peak (VmHWM) against the budget so drifting estimates
+// get noticed. Without --mem-budget every reserve succeeds and costs
+// one relaxed atomic add.
+class MemBudget {
+public:
+    static void setBudget(size_t bytes)
+    {
+        budget_.store(bytes, std::memory_order_relaxed);
+    }
+
+    static bool enabled()
+    {
+        return budget_.load(std::memory_order_relaxed) != 0;
+    }
+
+    // Charge a pool's footprint against the budget. Prints the refusal
+    // and returns false when the reservation does not fit; callers
+    // treat that as a fatal configuration error.
+    static bool reserve(const char* what, size_t bytes)
+    {
+        size_t prior = reserved_.fetch_add(bytes, std::memory_order_relaxed);
+        size_t budget = budget_.load(std::memory_order_relaxed);
+        if (budget == 0 || prior + bytes <= budget) {
+            return true;
+        }
+        std::ios_base::fmtflags saved = std::cerr.flags();
+        std::cerr << "Error: --mem-budget " << budget / kMiB
+                  << " MB exceeded: " << what << " needs " << std::fixed
+                  << std::setprecision(1) << toMiB(bytes) << " MB with "
+                  << toMiB(prior) << " MB already reserved.\n";
+        std::cerr.flags(saved);
+        return false;
+    }
+
+    // Print peak RSS against the budget, once, at teardown
+    static void reportPeak()
+    {
+        if (!enabled() || reported_.exchange(true, std::memory_order_relaxed)) {
+            return;
+        }
+        long hwm_kb = -1;
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.rfind("VmHWM:", 0) == 0) {
+                hwm_kb = std::strtol(line.c_str() + 6, nullptr, 10);
+                break;
+            }
+        }
+        std::ios_base::fmtflags saved = std::cout.flags();
+        std::cout << "Memory budget: ";
+        if (hwm_kb >= 0) {
+            std::cout << "peak RSS " << std::fixed << std::setprecision(1)
+                      << hwm_kb / 1024.0 << " MB of ";
+        }
+        std::cout << budget_.load(std::memory_order_relaxed) / kMiB
+                  << " MB, pools reserved " << std::fixed
+                  << std::setprecision(1)
+                  << toMiB(reserved_.load(std::memory_order_relaxed)) << " MB."
+                  << std::endl;
+        std::cout.flags(saved);
+    }
+
+private:
+    static constexpr size_t kMiB = 1024 * 1024;
+
+    static double toMiB(size_t bytes)
+    {
+        return static_cast<double>(bytes) / kMiB;
+    }
+
+    inline static std::atomic<size_t> budget_ { 0 };
+    inline static std::atomic<size_t> reserved_ { 0 };
+    inline static std::atomic<bool> reported_ { false };
+};
+
+#endif // MEM_BUDGET_HPP
@@ -0,0 +1,51 @@
+// NmeaGen.cpp
+#include "NmeaGen.hpp"
+
+#include "NmeaGenerator.hpp"
+
+NmeaGen::NmeaGen()
+    : impl_(std::make_unique<NmeaGenerator>())
+{
+}
+
+NmeaGen::~NmeaGen()                              = default;
+NmeaGen::NmeaGen(NmeaGen&&) noexcept             = default;
+NmeaGen& NmeaGen::operator=(NmeaGen&&) noexcept  = default;
+
+void NmeaGen::seed(uint64_t seed)
+{
+    impl_->reseed(seed);
+}
+
+void NmeaGen::configureMotion(double start_lat, double start_lon, double speed_knots,
+                              double course_deg)
+{
+    impl_->configureMotion(start_lat, start_lon, speed_knots, course_deg);
+}
+
+void NmeaGen::setCycleSeconds(double seconds)
+{
+    impl_->setCycleSeconds(seconds);
+}
+
+void NmeaGen::setSentences(const std::string& csv)
+{
+    impl_->setSentenceMask(csv.empty() ? ~0u : NmeaGenerator::sentenceMaskFromList(csv));
+}
+
+void NmeaGen::setSatelliteTarget(unsigned total)
+{
+    impl_->setSatelliteTarget(total);
+}
+
+void NmeaGen::setVesselCount(unsigned count)
+{
+    impl_->setVesselCount(count);
+}
+
+size_t NmeaGen::nextCycle(std::string& out)
+{
+    out.clear(); // keeps capacity; steady-state cycles never reallocate
+    impl_->generateAllSentences(out);
+    return out.size();
+}
@@ -0,0 +1,53 @@
+// NmeaGen.hpp
+#ifndef NMEA_GEN_HPP
+#define NMEA_GEN_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class NmeaGenerator;
+
+// Narrow embedding facade over NmeaGenerator (libnmeagen). Harnesses
+// that can link us generate cycles in-process — no simulator process,
+// no pipe round-trip. The surface is deliberately small and
+// pimpl-backed, so embedders neither see nor recompile against the
+// generator's internals: create, configure, pull cycles into a
+// caller-owned buffer. The buffer reaches steady-state capacity after
+// the first few cycles, after which nextCycle performs no allocation
+// (the same property alloc_bench enforces on the generator itself).
+class NmeaGen {
+public:
+    NmeaGen();
+    ~NmeaGen();
+    NmeaGen(NmeaGen&&) noexcept;
+    NmeaGen& operator=(NmeaGen&&) noexcept;
+
+    // Pin the RNG stream for reproducible output
+    void seed(uint64_t seed);
+
+    // Motion model start point and dynamics; NaN keeps the randomized
+    // default for that parameter
+    void configureMotion(double start_lat, double start_lon, double speed_knots,
+                         double course_deg);
+
+    // Simulated seconds between cycles (default 1.0); drives timestamp
+    // advance and position integration
+    void setCycleSeconds(double seconds);
+
+    // Comma-separated sentence list, e.g. "RMC,GGA,GSV"; empty enables
+    // everything
+    void setSentences(const std::string& csv);
+
+    // Dense-sky / AIS-traffic shaping
+    void setSatelliteTarget(unsigned total);
+    void setVesselCount(unsigned count);
+
+    // Overwrite out with the next cycle's sentences; returns its size
+    size_t nextCycle(std::string& out);
+
+private:
+    std::unique_ptr<NmeaGenerator> impl_;
+};
+
+#endif // NMEA_GEN_HPP
@@ -1,355 +1,2622 @@
 // NmeaGenerator.cpp
 #include "NmeaGenerator.hpp"
+#include "AllocProfiler.hpp"
+#include "StartupReport.hpp"
+#include "TimePatch.hpp"
+#include "Tracepoints.hpp"
 
-#include <iomanip>
-#include <sstream>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <dlfcn.h>
+#include <iostream>
+#include <numeric>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 // Constructor
 NmeaGenerator::NmeaGenerator()
     : rng_(std::random_device {}())
 {
+    sentence_divisor_.fill(1);
+    sentence_cycle_.fill(0);
+    rebuildSchedule();
+}
+
+namespace {
+
+// 256-entry table mapping a byte to its two uppercase hex digits, so
+// checksum formatting is two table reads instead of a stream round trip.
+struct HexTable {
+    char digits[256][2];
+    constexpr HexTable()
+        : digits {}
+    {
+        constexpr char hex[] = "0123456789ABCDEF";
+        for (int i = 0; i < 256; ++i) {
+            digits[i][0] = hex[i >> 4];
+            digits[i][1] = hex[i & 0x0F];
+        }
+    }
+};
+
+constexpr HexTable hex_table;
+
+// Vectorized XOR reduction over a byte span. SSE2 is baseline on x86-64
+// and NEON on arm64, so the dispatch resolves at compile time; other
+// targets fall back to 64-bit-wide folding with a scalar tail.
+uint8_t xorReduce(const char* data, size_t len)
+{
+#if defined(__SSE2__)
+    __m128i acc = _mm_setzero_si128();
+    while (len >= 16) {
+        acc = _mm_xor_si128(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+        data += 16;
+        len -= 16;
+    }
+    uint64_t lanes[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    uint64_t x = lanes[0] ^ lanes[1];
+#elif defined(__ARM_NEON)
+    uint8x16_t acc = vdupq_n_u8(0);
+    while (len >= 16) {
+        acc = veorq_u8(acc, vld1q_u8(reinterpret_cast<const uint8_t*>(data)));
+        data += 16;
+        len -= 16;
+    }
+    uint8x8_t folded = veor_u8(vget_low_u8(acc), vget_high_u8(acc));
+    uint64_t x       = vget_lane_u64(vreinterpret_u64_u8(folded), 0);
+#else
+    uint64_t x = 0;
+    while (len >= 8) {
+        uint64_t v;
+        std::memcpy(&v, data, 8);
+        x ^= v;
+        data += 8;
+        len -= 8;
+    }
+#endif
+    x ^= x >> 32;
+    x ^= x >> 16;
+    x ^= x >> 8;
+    uint8_t result = static_cast<uint8_t>(x);
+    while (len > 0) {
+        result ^= static_cast<uint8_t>(*data++);
+        --len;
+    }
+    return result;
+}
+
+// --- Compile-time sentence skeleton support ---------------------------------
+//
+// The fixed parts of a sentence ("GPGGA," ... ",M," ... ",M,,,") never
+// change, so their contribution to the XOR checksum is known at compile
+// time. A Fragment carries a literal and its precomputed XOR; generators
+// maintain a running checksum, fold fragments in one table-free XOR each,
+// and only the variable fields are scanned byte-by-byte.
+
+struct Fragment {
+    std::string_view text;
+    uint8_t xored;
+};
+
+constexpr uint8_t xorOf(std::string_view s)
+{
+    uint8_t x = 0;
+    for (char c : s) {
+        x ^= static_cast<uint8_t>(c);
+    }
+    return x;
+}
+
+constexpr Fragment frag(std::string_view s)
+{
+    return Fragment { s, xorOf(s) };
+}
+
+// Fixed skeleton fragments of the template-driven sentences, packed
+// into one read-only array grouped by sentence in emission order, so
+// a sentence's skeleton sits on the same cache line(s) as it is
+// assembled. The named references keep the emitters readable.
+constexpr Fragment sentence_fragments[] = {
+    // RMC
+    frag("GPRMC,"), frag(",A,"), frag(",,,"),
+    // GGA
+    frag("GPGGA,"), frag(",M,"), frag(",M,,,"),
+    // VTG
+    frag("GPVTG,"), frag(",T,,M,"), frag(",N,"), frag(",K"),
+    // ZDA
+    frag("GPZDA,"), frag(",20"), frag(",00,00"),
+    // GST
+    frag("GPGST,"),
+    // GSA
+    frag("GPGSA,"),
+    // GLL
+    frag("GPGLL,"), frag(",A"),
+    // NFIMU
+    frag("NFIMU,"), frag(",,,,,"),
+    // GNS / multi-system GSA (NMEA 4.1 GN-talker summaries)
+    frag("GNGNS,"), frag(",,,"), frag("GNGSA,A,"),
+    // AIVDM (single-fragment Type 1 reports, channel A / channel B)
+    frag("AIVDM,1,1,,A,"), frag("AIVDM,1,1,,B,"), frag(",0"),
+    // PSIMT throughput trailer
+    frag("PSIMT,"),
+};
+
+constexpr const Fragment& frag_gprmc   = sentence_fragments[0];
+constexpr const Fragment& frag_a_mid   = sentence_fragments[1];
+constexpr const Fragment& frag_rmc_end = sentence_fragments[2];
+constexpr const Fragment& frag_gpgga   = sentence_fragments[3];
+constexpr const Fragment& frag_m_mid   = sentence_fragments[4];
+constexpr const Fragment& frag_m_tail  = sentence_fragments[5];
+constexpr const Fragment& frag_gpvtg   = sentence_fragments[6];
+constexpr const Fragment& frag_t_mid   = sentence_fragments[7];
+constexpr const Fragment& frag_n_mid   = sentence_fragments[8];
+constexpr const Fragment& frag_k_tail  = sentence_fragments[9];
+constexpr const Fragment& frag_gpzda   = sentence_fragments[10];
+constexpr const Fragment& frag_century = sentence_fragments[11];
+constexpr const Fragment& frag_zda_end = sentence_fragments[12];
+constexpr const Fragment& frag_gpgst   = sentence_fragments[13];
+constexpr const Fragment& frag_gpgsa   = sentence_fragments[14];
+constexpr const Fragment& frag_gpgll   = sentence_fragments[15];
+constexpr const Fragment& frag_a_tail  = sentence_fragments[16];
+constexpr const Fragment& frag_nfimu    = sentence_fragments[17];
+constexpr const Fragment& frag_imu_pad  = sentence_fragments[18];
+constexpr const Fragment& frag_gngns    = sentence_fragments[19];
+constexpr const Fragment& frag_gns_tail = sentence_fragments[20];
+constexpr const Fragment& frag_gngsa    = sentence_fragments[21];
+constexpr const Fragment& frag_aivdm_a  = sentence_fragments[22];
+constexpr const Fragment& frag_aivdm_b  = sentence_fragments[23];
+constexpr const Fragment& frag_ais_fill = sentence_fragments[24];
+constexpr const Fragment& frag_psimt    = sentence_fragments[25];
+// GSV padding, shared by every GSV message
+constexpr Fragment frag_gsv_pad = frag(",,,");
+
+// Stack-based sentence assembly with a small-buffer guarantee: fields
+// append into a fixed 224-byte frame (standard sentences stay under
+// the 82-character NMEA limit; the proprietary NFIMU with calibrated
+// fields is the widest at ~150) while the running checksum
+// accumulates, and finalize()
+// completes the "*hh\r\n" framing in place and hands the cycle buffer
+// one contiguous append. Zero heap traffic per sentence, and the cycle
+// buffer sees a single capacity check instead of one per field.
+class SentenceBuilder {
+public:
+    SentenceBuilder()
+    {
+        buf_[0] = '$';
+        len_    = 1;
+    }
+
+    // Optional NMEA 4.10 TAG block prefix (--tag): copied verbatim
+    // ahead of the lead byte. The tag carries its own checksum between
+    // its backslashes and stays outside this sentence's running XOR.
+    // pad arms fixed-width emission (--fixed-width): numeric fields
+    // carrying a width are space-padded to it, so field offsets within
+    // a sentence type are constant and consumers index instead of scan.
+    explicit SentenceBuilder(std::string_view tag, bool pad = false)
+        : pad_(pad)
+    {
+        if (!tag.empty()) {
+            std::memcpy(buf_, tag.data(), tag.size());
+            len_ = tag.size();
+        }
+        lead_        = len_;
+        buf_[len_++] = '$';
+    }
+
+    // AIVDM frames open with '!' instead of '$'; the lead byte is
+    // outside the checksum either way
+    void lead(char c) { buf_[lead_] = c; }
+
+    void add(const Fragment& f)
+    {
+        copy(f.text);
+        checksum_ ^= f.xored;
+    }
+
+    void field(std::string_view s)
+    {
+        for (char c : s) {
+            checksum_ ^= static_cast<uint8_t>(c);
+        }
+        copy(s);
+    }
+
+    void ch(char c)
+    {
+        checksum_ ^= static_cast<uint8_t>(c);
+        buf_[len_++] = c;
+    }
+
+    // width is the field's fixed-width target; ignored unless padding
+    // is armed, and a value that outgrows it keeps its natural width
+    void intField(long value, int width = 0)
+    {
+        auto result = std::to_chars(buf_ + len_, buf_ + sizeof(buf_), value);
+        size_t end  = padLeft(result.ptr - buf_, width);
+        fold(len_, end);
+        len_ = end;
+    }
+
+    void fixedField(double value, int precision, int width = 0)
+    {
+        auto result = std::to_chars(buf_ + len_, buf_ + sizeof(buf_), value,
+                                    std::chars_format::fixed, precision);
+        size_t end  = padLeft(result.ptr - buf_, width);
+        fold(len_, end);
+        len_ = end;
+    }
+
+    // Bytes written so far; the emit caches record field offsets with it
+    size_t size() const { return len_; }
+
+    void finalize(std::string& out)
+    {
+        buf_[len_++] = '*';
+        buf_[len_++] = hex_table.digits[checksum_][0];
+        buf_[len_++] = hex_table.digits[checksum_][1];
+        buf_[len_++] = '\r';
+        buf_[len_++] = '\n';
+        out.append(buf_, len_);
+    }
+
+private:
+    void copy(std::string_view s)
+    {
+        std::memcpy(buf_ + len_, s.data(), s.size());
+        len_ += s.size();
+    }
+
+    void fold(size_t from, size_t to)
+    {
+        for (size_t i = from; i < to; ++i) {
+            checksum_ ^= static_cast<uint8_t>(buf_[i]);
+        }
+    }
+
+    // Shift the just-written digits right and fill the gap with spaces;
+    // the caller folds the checksum over the padded span afterwards
+    size_t padLeft(size_t end, int width)
+    {
+        size_t n = end - len_;
+        if (!pad_ || width <= 0 || n >= static_cast<size_t>(width)) {
+            return end;
+        }
+        size_t shift = static_cast<size_t>(width) - n;
+        std::memmove(buf_ + len_ + shift, buf_ + len_, n);
+        std::memset(buf_ + len_, ' ', shift);
+        return len_ + static_cast<size_t>(width);
+    }
+
+    // Widest sentence is the calibrated NFIMU at ~150 bytes; the TAG
+    // prefix adds at most ~35 more
+    char buf_[224];
+    size_t len_   = 0;
+    size_t lead_  = 0; // offset of the '$'/'!' byte, after any tag
+    uint8_t checksum_ = 0;
+    bool pad_         = false; // fixed-width emission armed
+};
+
+// --- AIS payload armoring ---------------------------------------------------
+//
+// AIVDM payloads are 6-bit groups armored into a printable alphabet.
+// Fields accumulate MSB-first in a 64-bit register; whenever four
+// complete groups are pending they armor together through a SWAR
+// kernel that spreads 24 bits across the byte lanes of one 32-bit word
+// and applies the alphabet offsets branchlessly — the table's single
+// discontinuity (+48 below 40, +56 from 40 up) folds into an add plus
+// a carry test per lane. That is a handful of register ops per four
+// output characters, against a shift, mask and table load for each one.
+// Trailing groups drain through the table as before; at 28-character
+// payloads a shuffle-based vector version would spend its advantage on
+// setup, so word-wide SWAR is the right width here (same reasoning as
+// the replay scanner's checksum fold).
+
+struct AisArmorTable {
+    char chars[64];
+};
+
+constexpr AisArmorTable makeAisArmor()
+{
+    AisArmorTable t {};
+    for (int v = 0; v < 64; ++v) {
+        t.chars[v] = static_cast<char>(v < 40 ? v + 48 : v + 56);
+    }
+    return t;
+}
+
+constexpr AisArmorTable ais_armor = makeAisArmor();
+
+class AisPayload {
+public:
+    // Append the low `bits` bits of value, MSB first. Callers keep
+    // individual fields at 30 bits or fewer (the MMSI is the widest),
+    // so with at most 23 bits deferred the register never holds more
+    // than 53 pending bits.
+    void put(uint32_t value, int bits)
+    {
+        acc_ = (acc_ << bits) | (value & ((uint64_t(1) << bits) - 1));
+        nbits_ += bits;
+        while (nbits_ >= 24) {
+            nbits_ -= 24;
+            armor4(static_cast<uint32_t>((acc_ >> nbits_) & 0xFFFFFF));
+        }
+    }
+
+    // Drains any trailing one to three groups through the table before
+    // handing out the text — a no-op for layouts whose width divides
+    // by 24, like the 168-bit Type 1
+    std::string_view view()
+    {
+        while (nbits_ >= 6) {
+            nbits_ -= 6;
+            buf_[len_++] = ais_armor.chars[(acc_ >> nbits_) & 0x3F];
+        }
+        return std::string_view(buf_, len_);
+    }
+
+private:
+    // Armor four groups at once: spread them into byte lanes (first
+    // group lowest, so the word store lands in wire order on little
+    // endian like the UBX structs), then +48 in every lane and +8 in
+    // lanes holding 40..63 — those are exactly the lanes where adding
+    // 88 carries into bit 7, and no lane result exceeds 0x6F, so the
+    // adds never carry across lanes.
+    void armor4(uint32_t g)
+    {
+        uint32_t lanes = (g >> 18) | ((g >> 4) & 0x3F00)
+            | ((g << 10) & 0x3F0000) | ((g << 24) & 0x3F000000);
+        uint32_t high = ((lanes + 0x58585858u) & 0x80808080u) >> 4;
+        lanes += 0x30303030u + high;
+        std::memcpy(buf_ + len_, &lanes, 4);
+        len_ += 4;
+    }
+
+    uint64_t acc_ = 0;
+    int nbits_    = 0;
+    size_t len_   = 0;
+    char buf_[32]; // Type 1 is 168 bits = 28 armored characters
+};
+
+// --- UBX binary framing -----------------------------------------------------
+//
+// u-blox frames are fixed binary layouts, so emission is a struct fill
+// and one memcpy behind the 0xB5 0x62 header — no field formatting at
+// all, which makes a binary message cheaper than any text sentence.
+// The Fletcher-8 checksum folds incrementally over the bytes as they
+// are appended, the binary analogue of SentenceBuilder's running XOR.
+
+struct UbxNavPvt {
+    uint32_t itow; // GPS time of week, ms
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t min;
+    uint8_t sec;
+    uint8_t valid;
+    uint32_t t_acc;
+    int32_t nano;
+    uint8_t fix_type;
+    uint8_t flags;
+    uint8_t flags2;
+    uint8_t num_sv;
+    int32_t lon; // degrees * 1e-7
+    int32_t lat;
+    int32_t height; // mm above ellipsoid
+    int32_t h_msl;
+    uint32_t h_acc;
+    uint32_t v_acc;
+    int32_t vel_n; // mm/s
+    int32_t vel_e;
+    int32_t vel_d;
+    int32_t g_speed; // ground speed, mm/s
+    int32_t head_mot; // heading of motion, degrees * 1e-5
+    uint32_t s_acc;
+    uint32_t head_acc;
+    uint16_t p_dop; // * 0.01
+    uint8_t flags3;
+    uint8_t reserved[5];
+    int32_t head_veh;
+    int16_t mag_dec;
+    uint16_t mag_acc;
+} __attribute__((packed));
+static_assert(sizeof(UbxNavPvt) == 92, "NAV-PVT payload is 92 bytes");
+
+struct UbxNavSatHeader {
+    uint32_t itow;
+    uint8_t version;
+    uint8_t num_svs;
+    uint8_t reserved[2];
+} __attribute__((packed));
+
+struct UbxNavSatSv {
+    uint8_t gnss_id;
+    uint8_t sv_id;
+    uint8_t cno; // dB-Hz
+    int8_t elev; // degrees
+    int16_t azim;
+    int16_t pr_res;
+    uint32_t flags;
+} __attribute__((packed));
+static_assert(sizeof(UbxNavSatHeader) == 8 && sizeof(UbxNavSatSv) == 12,
+              "NAV-SAT wire layout");
+
+// u-blox gnssId per Constellation table row (GPS, GLONASS, Galileo,
+// BeiDou, QZSS)
+constexpr uint8_t ubx_gnss_id[] = { 0, 6, 2, 3, 5 };
+
+class UbxFrame {
+public:
+    UbxFrame(uint8_t cls, uint8_t id)
+    {
+        buf_[0] = 0xB5;
+        buf_[1] = 0x62;
+        buf_[2] = cls;
+        buf_[3] = id;
+        len_    = 6; // length field back-patched in finalize()
+    }
+
+    // Append payload bytes, folding them into the running Fletcher-8
+    void payload(const void* data, size_t n)
+    {
+        std::memcpy(buf_ + len_, data, n);
+        for (size_t i = len_; i < len_ + n; ++i) {
+            ck_a_ += static_cast<uint8_t>(buf_[i]);
+            ck_b_ += ck_a_;
+        }
+        len_ += n;
+    }
+
+    void finalize(std::string& out)
+    {
+        // Checksum covers class, id, length and payload, but the length
+        // is only known now. Fletcher's sums are linear, so the header
+        // contribution composes with the already-folded payload sums:
+        // prefixing a header with sums (a, b) shifts the total to
+        // (a + ck_a, b + ck_b + a * payload_len).
+        uint16_t payload_len = static_cast<uint16_t>(len_ - 6);
+        buf_[4]              = static_cast<char>(payload_len & 0xFF);
+        buf_[5]              = static_cast<char>(payload_len >> 8);
+        uint8_t a = 0, b = 0;
+        for (size_t i = 2; i < 6; ++i) {
+            a += static_cast<uint8_t>(buf_[i]);
+            b += a;
+        }
+        uint8_t ck_a = static_cast<uint8_t>(a + ck_a_);
+        uint8_t ck_b = static_cast<uint8_t>(b + ck_b_
+                                            + static_cast<uint8_t>(a * payload_len));
+        buf_[len_++] = static_cast<char>(ck_a);
+        buf_[len_++] = static_cast<char>(ck_b);
+        out.append(buf_, len_);
+    }
+
+private:
+    char buf_[3200]; // NAV-SAT with a 255-satellite dense sky tops out near 3 KB
+    size_t len_;
+    uint8_t ck_a_ = 0;
+    uint8_t ck_b_ = 0;
+};
+
+// Render zero-padded degrees plus fixed-point minutes as "d..dmm.mmmm";
+// returns the number of bytes written
+size_t formatDegMin(char* dst, int deg, int min_e4, int deg_width)
+{
+    char* p = dst;
+    char tmp[8];
+    auto result = std::to_chars(tmp, tmp + sizeof(tmp), deg);
+    int len     = static_cast<int>(result.ptr - tmp);
+    for (int i = len; i < deg_width; ++i) {
+        *p++ = '0';
+    }
+    std::memcpy(p, tmp, len);
+    p += len;
+
+    int min_whole = min_e4 / 10000;
+    *p++          = static_cast<char>('0' + min_whole / 10);
+    *p++          = static_cast<char>('0' + min_whole % 10);
+    *p++          = '.';
+
+    int frac = min_e4 % 10000;
+    for (int div = 1000; div >= 1; div /= 10) {
+        *p++ = static_cast<char>('0' + (frac / div) % 10);
+    }
+    return p - dst;
+}
+
+} // namespace
+
+// Format "ddmm.mmmm" into the attached cache on first use
+std::string_view LocationData::latitude() const
+{
+    if (lat_len_ == 0) {
+        lat_len_ = static_cast<unsigned char>(
+            formatDegMin(lat_text_, lat_deg, lat_min_e4, 2));
+    }
+    return std::string_view(lat_text_, lat_len_);
 }
 
-// Checksum calculation
-std::string NmeaGenerator::calculateChecksum(const std::string& nmea_sentence) const
+// Format "dddmm.mmmm" into the attached cache on first use
+std::string_view LocationData::longitude() const
 {
-    uint8_t checksum = 0;
-    for (char ch : nmea_sentence) {
-        checksum ^= static_cast<uint8_t>(ch);
+    if (lon_len_ == 0) {
+        lon_len_ = static_cast<unsigned char>(
+            formatDegMin(lon_text_, lon_deg, lon_min_e4, 3));
     }
-    std::stringstream ss;
-    ss << std::uppercase << std::hex << std::setw(2) << std::setfill('0') << int(checksum);
-    return ss.str();
+    return std::string_view(lon_text_, lon_len_);
+}
+
+// Checksum calculation; the returned view aliases the static hex
+// digit-pair table, so no allocation and no lifetime to manage
+std::string_view NmeaGenerator::calculateChecksum(std::string_view nmea_sentence) const
+{
+    uint8_t checksum = xorReduce(nmea_sentence.data(), nmea_sentence.size());
+    return std::string_view(hex_table.digits[checksum], 2);
 }
 
-// Random uniform double
+// Random uniform double: one engine advance and a fused
+// multiply-add, the same top-53-bits mapping fillUniform uses. No
+// distribution object — uniform_real_distribution rebuilt its
+// parameters on every call for ranges that are compile-time constants
+// here.
 double NmeaGenerator::randomUniform(double min, double max)
 {
-    std::uniform_real_distribution<double> dist(min, max);
-    return dist(rng_);
+    // Top 53 bits of the draw give a uniform double in [0, 1)
+    constexpr double kInv53 = 1.0 / 9007199254740992.0; // 2^-53
+    return min + static_cast<double>(rng_() >> 11) * ((max - min) * kInv53);
 }
 
-// Random integer
+// Random integer in [min, max] via Lemire's multiply-shift bounded
+// rejection: the common case is one 64x64->128 multiply with no
+// division, where uniform_int_distribution pays a modulo per draw.
+// Rejection only triggers in the (range % 2^64)-sized sliver, which
+// for our widest range (PRN spans) is a ~2^-57 probability.
 int NmeaGenerator::randomInt(int min, int max)
 {
-    std::uniform_int_distribution<int> dist(min, max);
-    return dist(rng_);
+    uint64_t range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min) + 1;
+    uint64_t x     = rng_();
+    __uint128_t m  = static_cast<__uint128_t>(x) * range;
+    uint64_t low   = static_cast<uint64_t>(m);
+    if (low < range) {
+        uint64_t threshold = (0 - range) % range;
+        while (low < threshold) {
+            x   = rng_();
+            m   = static_cast<__uint128_t>(x) * range;
+            low = static_cast<uint64_t>(m);
+        }
+    }
+    return min + static_cast<int>(m >> 64);
 }
 
-// Generate current UTC time string in HHMMSS format
-std::string NmeaGenerator::getUTCTime() const
+// Fill a block with uniform doubles in [min, max)
+void NmeaGenerator::fillUniform(double* dst, size_t n, double min, double max)
 {
-    auto now        = std::chrono::system_clock::now();
-    std::time_t t_c = std::chrono::system_clock::to_time_t(now);
-    std::tm tm      = *std::gmtime(&t_c);
-    char utc_time[16];
-    std::strftime(utc_time, sizeof(utc_time), "%H%M%S", &tm);
-    return std::string(utc_time);
+    // Top 53 bits of each draw give a uniform double in [0, 1)
+    const double scale = (max - min) * (1.0 / 9007199254740992.0); // 2^-53
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = min + static_cast<double>(rng_() >> 11) * scale;
+    }
+}
+
+// Fill a block with uniform ints in [min, max]
+void NmeaGenerator::fillInt(int* dst, size_t n, int min, int max)
+{
+    // Lemire multiply-shift maps each 64-bit draw onto the range without
+    // a division or a per-call distribution object
+    const uint64_t range = static_cast<uint64_t>(max - min) + 1;
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t scaled = static_cast<uint64_t>(
+            (static_cast<unsigned __int128>(rng_()) * range) >> 64);
+        dst[i] = min + static_cast<int>(scaled);
+    }
 }
 
-// Generate current UTC date string in DDMMYY format
-std::string NmeaGenerator::getUTCDate() const
+namespace {
+
+// Two zero-padded digits; the whole time field is six of these
+inline void write2(char* p, int v)
 {
-    auto now        = std::chrono::system_clock::now();
-    std::time_t t_c = std::chrono::system_clock::to_time_t(now);
-    std::tm tm      = *std::gmtime(&t_c);
-    char date_str[16];
-    std::strftime(date_str, sizeof(date_str), "%d%m%y", &tm);
-    return std::string(date_str);
+    p[0] = static_cast<char>('0' + v / 10);
+    p[1] = static_cast<char>('0' + v % 10);
 }
 
-// Generate shared location data
-LocationData NmeaGenerator::generateLocation()
+} // namespace
+
+// Refresh the cached time/date fields from one clock_gettime. No
+// strftime (format parsing, locale) and no gmtime (global lock on
+// glibc): HHMMSS is digit arithmetic on seconds-of-day, redone only on
+// second rollover; the civil-date conversion (Hinnant's
+// days-from-civil inverse) runs only when the day rolls over. The
+// fractional ".ss" is rewritten from tv_nsec on every call, since at
+// 10 Hz it changes every cycle and cannot be cached.
+void NmeaGenerator::refreshClock()
 {
-    LocationData loc;
+    struct timespec ts;
+    if (time_scale_ == 1.0) {
+        clock_gettime(CLOCK_REALTIME, &ts);
+    } else {
+        // Accelerated clock (--time-scale): scale the monotonic
+        // elapsed and rebase it onto the real epoch captured at
+        // setTimeScale. The cached layers below key off the resulting
+        // seconds value, so a 60x clock rolls the digits 60x as often
+        // but each refresh is still one clock read plus arithmetic.
+        struct timespec mono;
+        clock_gettime(CLOCK_MONOTONIC, &mono);
+        int64_t mono_ns = mono.tv_sec * 1000000000LL + mono.tv_nsec;
+        int64_t sim_ns  = sim_epoch_real_ns_
+            + static_cast<int64_t>(
+                static_cast<double>(mono_ns - sim_epoch_mono_ns_) * time_scale_);
+        ts.tv_sec  = sim_ns / 1000000000LL;
+        ts.tv_nsec = sim_ns % 1000000000LL;
+    }
+
+    if (ts.tv_sec != cached_second_) {
+        cached_second_ = ts.tv_sec;
+
+        int64_t days   = ts.tv_sec / 86400;
+        int secs_of_day = static_cast<int>(ts.tv_sec % 86400);
+        write2(utc_time_, secs_of_day / 3600);
+        write2(utc_time_ + 2, (secs_of_day / 60) % 60);
+        write2(utc_time_ + 4, secs_of_day % 60);
+        utc_time_[6] = '.';
+
+        if (days != cached_day_) {
+            cached_day_ = days;
+            // civil_from_days: proleptic Gregorian date from the day
+            // count, branch-free save the era adjustment
+            int64_t z    = days + 719468;
+            int64_t era  = (z >= 0 ? z : z - 146096) / 146097;
+            uint64_t doe = static_cast<uint64_t>(z - era * 146097);
+            uint64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+            int64_t y    = static_cast<int64_t>(yoe) + era * 400;
+            uint64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+            uint64_t mp  = (5 * doy + 2) / 153;
+            uint64_t d   = doy - (153 * mp + 2) / 5 + 1;
+            uint64_t m   = mp < 10 ? mp + 3 : mp - 9;
+            y += (m <= 2);
+            write2(utc_date_, static_cast<int>(d));
+            write2(utc_date_ + 2, static_cast<int>(m));
+            write2(utc_date_ + 4, static_cast<int>(y % 100));
+        }
+    }
 
-    // Latitude: -90 to 90
-    double latitude = randomUniform(-90.0, 90.0);
-    loc.ns          = (latitude >= 0) ? 'N' : 'S';
-    latitude        = std::abs(latitude);
-    int lat_deg     = static_cast<int>(latitude);
-    double lat_min  = (latitude - lat_deg) * 60.0;
-    std::ostringstream lat_ss;
-    lat_ss << std::setw(2) << std::setfill('0') << lat_deg << std::fixed << std::setprecision(4)
-           << lat_min;
-    loc.latitude = lat_ss.str();
+    // Centiseconds for the HHMMSS.ss field
+    write2(utc_time_ + 7, static_cast<int>(ts.tv_nsec / 10000000));
 
-    // Longitude: -180 to 180
-    double longitude = randomUniform(-180.0, 180.0);
-    loc.ew           = (longitude >= 0) ? 'E' : 'W';
-    longitude        = std::abs(longitude);
-    int lon_deg      = static_cast<int>(longitude);
-    double lon_min   = (longitude - lon_deg) * 60.0;
-    std::ostringstream lon_ss;
-    lon_ss << std::setw(3) << std::setfill('0') << lon_deg << std::fixed << std::setprecision(4)
-           << lon_min;
-    loc.longitude = lon_ss.str();
+    // The TAG block's c: field is whole seconds, so it shares the
+    // rollover cadence and costs no additional clock read
+    if (tag_enabled_ && ts.tv_sec != tag_second_) {
+        tag_second_ = ts.tv_sec;
+        rebuildTag(static_cast<int64_t>(ts.tv_sec));
+    }
+}
+
+// Rebuild "\s:SRC,c:UNIXTIME*hh\". The checksum covers the characters
+// between the backslashes; the constant head's contribution was folded
+// once in setTagSource, so only the epoch digits are XORed here.
+void NmeaGenerator::rebuildTag(int64_t unix_sec)
+{
+    char* p = tag_block_;
+    *p++    = '\\';
+    std::memcpy(p, tag_head_, tag_head_len_);
+    p += tag_head_len_;
+    auto r       = std::to_chars(p, tag_block_ + sizeof(tag_block_) - 4, unix_sec);
+    uint8_t csum = tag_base_csum_;
+    for (char* q = p; q < r.ptr; ++q) {
+        csum ^= static_cast<uint8_t>(*q);
+    }
+    p    = r.ptr;
+    *p++ = '*';
+    *p++ = hex_table.digits[csum][0];
+    *p++ = hex_table.digits[csum][1];
+    *p++ = '\\';
+    tag_len_ = static_cast<size_t>(p - tag_block_);
+}
 
-    return loc;
+// Current UTC time string in HHMMSS.ss format (fractional part keeps
+// 10 Hz cycles distinguishable; digits cached per second)
+std::string_view NmeaGenerator::getUTCTime()
+{
+    refreshClock();
+    return std::string_view(utc_time_, 9);
 }
 
-// Generate satellites with different constellations
-std::vector<SatelliteInfo> NmeaGenerator::generateSatellites()
+// Current UTC date string in DDMMYY format (cached per second)
+std::string_view NmeaGenerator::getUTCDate()
 {
-    std::vector<SatelliteInfo> satellites;
+    refreshClock();
+    return std::string_view(utc_date_, 6);
+}
 
-    // GPS: PRN 1-32
-    for (int i = 0; i < randomInt(4, 12); ++i) {
-        satellites.push_back(SatelliteInfo { randomInt(1, 32), Constellation::GPS });
-    }
+// Deterministic reseed for reproducible benchmarking
+void NmeaGenerator::reseed(uint64_t seed)
+{
+    rng_ = RngEngine(seed);
+    satellites_.clear();
+    constellation_offsets_ = {};
+    vessels_.clear();
+    motion_initialized_    = false;
+}
 
-    // GLONASS: PRN 65-96
-    for (int i = 0; i < randomInt(4, 12); ++i) {
-        satellites.push_back(SatelliteInfo { randomInt(65, 96), Constellation::GLONASS });
+// Snapshot the resumable state (--checkpoint). Satellite text caches
+// are deliberately not carried: they reformat on the first emission
+// after resume, which costs one cycle of formatting and nothing else.
+void NmeaGenerator::saveState(GeneratorCheckpoint& out) const
+{
+    out.magic           = kCheckpointMagic;
+    out.noise_spawn_seq = noise_spawn_seq_;
+    rng_.saveState(out.rng_state);
+    out.lat_me4            = lat_me4_;
+    out.lon_me4            = lon_me4_;
+    out.speed_knots        = speed_knots_;
+    out.course_deg         = course_deg_;
+    out.cycle              = trace_seq_;
+    out.route_cycle        = route_cycle_;
+    out.route_index        = static_cast<uint32_t>(route_index_);
+    out.ubx_pvt_count      = ubx_pvt_count_;
+    out.ubx_sat_count      = ubx_sat_count_;
+    out.ais_channel_b      = ais_channel_b_ ? 1 : 0;
+    out.motion_initialized = motion_initialized_ ? 1 : 0;
+    for (size_t i = 0; i < sentence_cycle_.size(); ++i) {
+        // In schedule mode the per-row counters are implied by the
+        // schedule position; project them out so the checkpoint layout
+        // stays divisor-agnostic
+        out.sentence_cycle[i] = schedule_.empty()
+            ? sentence_cycle_[i]
+            : schedule_pos_ % sentence_divisor_[i];
     }
 
-    // Galileo: PRN 201-237
-    for (int i = 0; i < randomInt(4, 12); ++i) {
-        satellites.push_back(SatelliteInfo { randomInt(201, 237), Constellation::Galileo });
+    // A sky or fleet denser than the fixed caps is left out and
+    // respawns through the normal churn after resume
+    out.sat_count = 0;
+    if (satellites_.size() <= kCheckpointMaxSats) {
+        out.sat_count = static_cast<uint32_t>(satellites_.size());
+        for (size_t i = 0; i < satellites_.size(); ++i) {
+            const SatelliteInfo& sat = satellites_[i];
+            out.sats[i] = CheckpointSat { sat.prn, static_cast<int32_t>(sat.constellation),
+                                          sat.el16, sat.az16, sat.snr16,
+                                          sat.el_rate, sat.az_rate, sat.noise_state };
+        }
+        for (size_t c = 0; c < constellation_offsets_.size(); ++c) {
+            out.sat_offsets[c] = static_cast<uint32_t>(constellation_offsets_[c]);
+        }
+    }
+    out.vessel_count = 0;
+    if (vessels_.size() <= kCheckpointMaxVessels) {
+        out.vessel_count = static_cast<uint32_t>(vessels_.size());
+        for (size_t i = 0; i < vessels_.size(); ++i) {
+            out.vessels[i] = vessels_[i];
+        }
     }
+}
 
-    // Beidou: PRN 301-336
-    for (int i = 0; i < randomInt(4, 12); ++i) {
-        satellites.push_back(SatelliteInfo { randomInt(301, 336), Constellation::Beidou });
+// Restore a snapshot (--resume): the next generated cycle continues
+// the saved run — same trajectory step, same RNG draw, same emission
+// counters — as if the process had never stopped.
+bool NmeaGenerator::restoreState(const GeneratorCheckpoint& in)
+{
+    if (in.magic != kCheckpointMagic || in.sat_count > kCheckpointMaxSats
+        || in.vessel_count > kCheckpointMaxVessels) {
+        return false;
+    }
+    noise_spawn_seq_ = in.noise_spawn_seq;
+    rng_.restoreState(in.rng_state);
+    lat_me4_            = in.lat_me4;
+    lon_me4_            = in.lon_me4;
+    speed_knots_        = in.speed_knots;
+    course_deg_         = in.course_deg;
+    trace_seq_          = in.cycle;
+    route_cycle_        = in.route_cycle;
+    route_index_        = in.route_index;
+    ubx_pvt_count_      = in.ubx_pvt_count;
+    ubx_sat_count_      = in.ubx_sat_count;
+    ais_channel_b_      = in.ais_channel_b != 0;
+    motion_initialized_ = in.motion_initialized != 0;
+    for (size_t i = 0; i < sentence_cycle_.size(); ++i) {
+        sentence_cycle_[i] = in.sentence_cycle[i];
+    }
+    // Re-derive the schedule position: every counter advanced from the
+    // same tick, so it is the unique slot in the hyperperiod matching
+    // all of them
+    for (size_t t = 0; t < schedule_.size(); ++t) {
+        bool match = true;
+        for (size_t i = 0; i < sentence_divisor_.size() && match; ++i) {
+            match = t % sentence_divisor_[i] == sentence_cycle_[i];
+        }
+        if (match) {
+            schedule_pos_ = static_cast<uint32_t>(t);
+            break;
+        }
     }
 
-    // QZSS: PRN 193-200
-    for (int i = 0; i < randomInt(1, 4); ++i) {
-        satellites.push_back(SatelliteInfo { randomInt(193, 200), Constellation::QZSS });
+    satellites_.clear();
+    constellation_offsets_ = {};
+    if (in.sat_count > 0) {
+        satellites_.resize(in.sat_count);
+        for (uint32_t i = 0; i < in.sat_count; ++i) {
+            const CheckpointSat& src = in.sats[i];
+            SatelliteInfo& sat       = satellites_[i];
+            sat.prn           = src.prn;
+            sat.constellation = static_cast<Constellation>(src.constellation);
+            sat.el16          = src.el16;
+            sat.az16          = src.az16;
+            sat.snr16         = src.snr16;
+            sat.el_rate       = src.el_rate;
+            sat.az_rate       = src.az_rate;
+            sat.noise_state   = src.noise_state;
+        }
+        for (size_t c = 0; c < constellation_offsets_.size(); ++c) {
+            constellation_offsets_[c] = in.sat_offsets[c];
+        }
     }
+    vessels_.assign(in.vessels, in.vessels + in.vessel_count);
 
-    return satellites;
+    sky_dirty_             = true; // restored table invalidates the GSV cache
+    sky_structural_        = true;
+    predicted_cycle_bytes_ = 0;
+    syncPosition();
+    return true;
 }
 
-// Generate GPGGA sentence
-std::string NmeaGenerator::generateGPGGA(const LocationData& loc, int numSatellites)
+// Per-thread clone on a disjoint RNG stream
+NmeaGenerator NmeaGenerator::cloneForThread()
+{
+    NmeaGenerator copy(*this);
+    // Advance this instance past the clone's 2^128-draw subsequence so
+    // parent and clone never produce overlapping sequences
+    rng_.jump();
+    return copy;
+}
+
+// Configure the motion model; NaN keeps the randomized default
+void NmeaGenerator::configureMotion(double start_lat, double start_lon, double speed_knots, double course_deg)
 {
-    std::string utc_time    = getUTCTime();
-    std::string fix_quality = std::to_string(randomInt(0, 5));
-    double horizontal_dil   = randomUniform(0.5, 2.5);
-    double altitude         = randomUniform(10.0, 100.0);
-    double geoid_sep        = randomUniform(-50.0, 50.0);
+    start_lat_          = start_lat;
+    start_lon_          = start_lon;
+    speed_knots_        = speed_knots;
+    course_deg_         = course_deg;
+    motion_initialized_ = false;
+}
 
-    std::ostringstream gpgga_body;
-    gpgga_body << "GPGGA," << utc_time << "," << loc.latitude << "," << loc.ns << ","
-               << loc.longitude << "," << loc.ew << "," << fix_quality << "," << numSatellites
-               << "," << std::fixed << std::setprecision(1) << horizontal_dil << "," << altitude
-               << ",M," << geoid_sep << ",M,,,";
-    std::string checksum = calculateChecksum(gpgga_body.str());
-    return "$" + gpgga_body.str() + "*" + checksum + "\r\n";
+// Seconds the position advances per generated cycle
+void NmeaGenerator::setCycleSeconds(double seconds)
+{
+    cycle_seconds_ = seconds;
 }
 
-// Generate GPRMC sentence
-std::string NmeaGenerator::generateGPRMC(const LocationData& loc)
+// Accelerated simulation clock (--time-scale): every reported time
+// field — HHMMSS.ss, DDMMYY, ZDA, the TAG block epoch — advances at
+// scale x real time from here on, while emission pacing stays on the
+// real-time scheduler, so a 24-hour day-boundary scenario runs in 24
+// minutes at 60x without changing the cycle rate consumers see.
+void NmeaGenerator::setTimeScale(double scale)
 {
-    std::string utc_time      = getUTCTime();
-    std::string date_str      = getUTCDate();
+    struct timespec real, mono;
+    clock_gettime(CLOCK_REALTIME, &real);
+    clock_gettime(CLOCK_MONOTONIC, &mono);
+    sim_epoch_real_ns_ = real.tv_sec * 1000000000LL + real.tv_nsec;
+    sim_epoch_mono_ns_ = mono.tv_sec * 1000000000LL + mono.tv_nsec;
+    time_scale_        = scale > 0 ? scale : 1.0;
+    cached_second_     = -1; // rebuild the digit caches on next refresh
+}
 
-    double speed_over_ground  = randomUniform(0, 100);
-    double course_over_ground = randomUniform(0, 360);
+// Install a compiled waypoint route and restart it from its first leg
+void NmeaGenerator::setRoute(std::vector<RouteSegment> segments)
+{
+    route_segments_     = std::move(segments);
+    route_index_        = 0;
+    route_cycle_        = 0;
+    motion_initialized_ = false;
+}
 
-    std::ostringstream gprmc_body;
-    gprmc_body << "GPRMC," << utc_time << ",A," << loc.latitude << "," << loc.ns << ","
-               << loc.longitude << "," << loc.ew << "," << std::fixed << std::setprecision(1)
-               << speed_over_ground << "," << course_over_ground << "," << date_str << ",,,";
-    std::string checksum = calculateChecksum(gprmc_body.str());
-    return "$" + gprmc_body.str() + "*" + checksum + "\r\n";
+void NmeaGenerator::setFixQuality(int quality)
+{
+    forced_fix_quality_ = quality >= 0 && quality <= 8 ? quality : -1;
 }
 
-// Generate GPGLL sentence
-std::string NmeaGenerator::generateGPGLL(const LocationData& loc)
+void NmeaGenerator::setForcedHdop(double hdop)
 {
-    std::string utc_time = getUTCTime();
+    forced_hdop_ = hdop > 0 ? hdop : 0.0;
+}
 
-    std::ostringstream gpgll_body;
-    gpgll_body << "GPGLL," << loc.latitude << "," << loc.ns << "," << loc.longitude << "," << loc.ew
-               << "," << utc_time << ",A";
-    std::string checksum = calculateChecksum(gpgll_body.str());
-    return "$" + gpgll_body.str() + "*" + checksum + "\r\n";
+// Steer the running motion model without touching the position
+void NmeaGenerator::adjustMotion(double speed_knots, double course_deg)
+{
+    if (!std::isnan(speed_knots)) {
+        speed_knots_ = std::min(100.0, std::max(0.0, speed_knots));
+    }
+    if (!std::isnan(course_deg)) {
+        course_deg_ = std::fmod(std::fmod(course_deg, 360.0) + 360.0, 360.0);
+    }
 }
 
-// Generate GPGSA sentence
-std::string NmeaGenerator::generateGPGSA(const std::vector<SatelliteInfo>& satellites)
+// Arc-minutes * 10^4 per whole degree; the base of the fixed-point
+// position representation
+constexpr int64_t kMinE4PerDeg = 60 * 10000;
+
+// Split the arc-minute position into the fixed-point LocationData; a
+// divide and a modulo each, no floating point on the path
+void NmeaGenerator::syncPosition()
 {
-    char mode            = 'A';
-    std::string fix_type = std::to_string(randomInt(1, 3));
+    int64_t lat = lat_me4_;
+    char ns     = (lat >= 0) ? 'N' : 'S';
+    if (lat < 0) {
+        lat = -lat;
+    }
+    int lat_deg = static_cast<int>(lat / kMinE4PerDeg);
+    int lat_e4  = static_cast<int>(lat % kMinE4PerDeg);
 
-    std::vector<int> prn_list;
-    // Select satellites that are used for the fix
-    int satellites_used = randomInt(4, 12);
-    for (int i = 0; i < satellites_used && i < satellites.size(); ++i) {
-        prn_list.push_back(satellites[i].prn);
+    int64_t lon = lon_me4_;
+    char ew     = (lon >= 0) ? 'E' : 'W';
+    if (lon < 0) {
+        lon = -lon;
     }
+    int lon_deg = static_cast<int>(lon / kMinE4PerDeg);
+    int lon_e4  = static_cast<int>(lon % kMinE4PerDeg);
 
-    while (prn_list.size() < 12) {
-        prn_list.push_back(0);
+    if (lat_deg != position_.lat_deg || lat_e4 != position_.lat_min_e4
+        || lon_deg != position_.lon_deg || lon_e4 != position_.lon_min_e4
+        || ns != position_.ns || ew != position_.ew) {
+        position_.lat_deg    = lat_deg;
+        position_.lat_min_e4 = lat_e4;
+        position_.lon_deg    = lon_deg;
+        position_.lon_min_e4 = lon_e4;
+        position_.ns         = ns;
+        position_.ew         = ew;
+        position_.invalidateText();
     }
+}
 
-    double pdop = randomUniform(1.0, 5.0);
-    double hdop = randomUniform(1.0, 5.0);
-    double vdop = randomUniform(1.0, 5.0);
+// Advance the motion model by one cycle
+void NmeaGenerator::updateMotion()
+{
+    constexpr double deg_per_rad = 180.0 / 3.14159265358979323846;
+    constexpr int64_t kLatMax    = 90 * kMinE4PerDeg;
+    constexpr int64_t kLonMax    = 180 * kMinE4PerDeg;
 
-    std::ostringstream gpgsa_body;
-    gpgsa_body << "GPGSA," << mode << "," << fix_type;
-    for (int prn : prn_list) {
-        if (prn != 0) {
-            gpgsa_body << "," << prn;
+    // Route following: the whole per-cycle update is the current leg's
+    // precomputed integer step pair — the trigonometry already ran at
+    // route compile time
+    if (!route_segments_.empty()) {
+        if (!motion_initialized_) {
+            // Leg 0 starts where the looping route ends: waypoint 0
+            lat_me4_            = route_segments_.back().end_lat_me4;
+            lon_me4_            = route_segments_.back().end_lon_me4;
+            route_index_        = 0;
+            route_cycle_        = 0;
+            motion_initialized_ = true;
         } else {
-            gpgsa_body << ",";
+            const RouteSegment& leg = route_segments_[route_index_];
+            lat_me4_ += leg.step_lat_me4;
+            lon_me4_ += leg.step_lon_me4;
+            if (lon_me4_ > kLonMax) {
+                lon_me4_ -= 2 * kLonMax;
+            } else if (lon_me4_ < -kLonMax) {
+                lon_me4_ += 2 * kLonMax;
+            }
+            if (++route_cycle_ >= leg.cycles) {
+                // Snap to the waypoint so step rounding never accumulates
+                lat_me4_     = leg.end_lat_me4;
+                lon_me4_     = leg.end_lon_me4;
+                route_cycle_ = 0;
+                route_index_ = (route_index_ + 1) % route_segments_.size();
+            }
+        }
+        const RouteSegment& leg = route_segments_[route_index_];
+        speed_knots_            = leg.speed_knots;
+        course_deg_             = leg.course_deg;
+        syncPosition();
+        return;
+    }
+
+    if (!motion_initialized_) {
+        double lat0 = std::isnan(start_lat_) ? randomUniform(-90.0, 90.0) : start_lat_;
+        double lon0 = std::isnan(start_lon_) ? randomUniform(-180.0, 180.0) : start_lon_;
+        lat_me4_    = std::llround(lat0 * static_cast<double>(kMinE4PerDeg));
+        lon_me4_    = std::llround(lon0 * static_cast<double>(kMinE4PerDeg));
+        if (std::isnan(speed_knots_)) {
+            speed_knots_ = randomUniform(0, 100);
         }
+        if (std::isnan(course_deg_)) {
+            course_deg_ = randomUniform(0, 360);
+        }
+        motion_initialized_ = true;
+        syncPosition();
+        return;
+    }
+
+    // Distance covered this cycle in min*10^4 (1 nm = 1' of latitude).
+    // The course projection is the one remaining float computation; it
+    // is rounded to the wire resolution once, and the position then
+    // accumulates purely in integers — no FP drift path, so a given
+    // start state replays the same trajectory to the last digit.
+    double dist_me4   = speed_knots_ * cycle_seconds_ / 3600.0 * 60.0 * 10000.0;
+    double course_rad = course_deg_ / deg_per_rad;
+    double coslat
+        = std::cos(static_cast<double>(lat_me4_) / static_cast<double>(kMinE4PerDeg) / deg_per_rad);
+    int64_t dlat = std::llround(dist_me4 * std::cos(course_rad));
+    int64_t dlon
+        = coslat > 1e-6 ? std::llround(dist_me4 * std::sin(course_rad) / coslat) : 0;
+
+    lat_me4_ += dlat;
+    lon_me4_ += dlon;
+
+    // Reflect at the poles, wrap at the antimeridian — exact in integers
+    if (lat_me4_ > kLatMax || lat_me4_ < -kLatMax) {
+        lat_me4_    = (lat_me4_ > kLatMax) ? 2 * kLatMax - lat_me4_ : -2 * kLatMax - lat_me4_;
+        course_deg_ = std::fmod(course_deg_ + 180.0, 360.0);
     }
-    gpgsa_body << "," << std::fixed << std::setprecision(1) << pdop << "," << hdop << "," << vdop;
-    std::string checksum = calculateChecksum(gpgsa_body.str());
-    return "$" + gpgsa_body.str() + "*" + checksum + "\r\n";
+    if (lon_me4_ > kLonMax) {
+        lon_me4_ -= 2 * kLonMax;
+    } else if (lon_me4_ < -kLonMax) {
+        lon_me4_ += 2 * kLonMax;
+    }
+
+    // Heading and speed drift slowly instead of teleporting
+    course_deg_ += randomUniform(-2.0, 2.0);
+    course_deg_ = std::fmod(course_deg_ + 360.0, 360.0);
+    speed_knots_ += randomUniform(-1.0, 1.0);
+    speed_knots_ = std::min(100.0, std::max(0.0, speed_knots_));
+
+    syncPosition();
+}
+
+namespace {
+
+// Everything constellation-specific in one read-only row per
+// Constellation enumerator, in enum order: the PRN range, the default
+// population bounds, and the GSV address both as a bare id (sentence
+// filtering) and as a pre-XORed skeleton fragment (emission). Adding a
+// constellation is one new row; satellite maintenance, GSV emission and
+// the --sentences filter all drive off this table, and the table itself
+// lives in .rodata shared across every --count device.
+struct ConstellationSpec {
+    int prn_min;
+    int prn_max;
+    int count_min;
+    int count_max;
+    std::string_view gsv_id; // talker+type address, e.g. "GPGSV"
+    Fragment gsv_frag;       // address with trailing comma folded in
+    int system_id;           // NMEA 4.1 system id (GNGSA final field)
+};
+
+constexpr ConstellationSpec constellation_specs[] = {
+    { 1, 32, 4, 12, "GPGSV", frag("GPGSV,"), 1 }, // GPS
+    { 65, 96, 4, 12, "GLGSV", frag("GLGSV,"), 2 }, // GLONASS
+    { 201, 237, 4, 12, "GAGSV", frag("GAGSV,"), 3 }, // Galileo
+    { 301, 336, 4, 12, "GBGSV", frag("GBGSV,"), 4 }, // Beidou
+    { 193, 200, 1, 4, "GQZSV", frag("GQZSV,"), 5 }, // QZSS
+};
+
+constexpr int num_constellations
+    = sizeof(constellation_specs) / sizeof(constellation_specs[0]);
+
+// Population bounds for one constellation: the realistic spec defaults,
+// or an even split of the --sats target with a small wiggle band so the
+// appear/disappear churn still has room in both directions. PRNs may
+// repeat once a share exceeds the constellation's PRN range; dense-sky
+// stress cares about sentence volume, not PRN uniqueness.
+void satelliteBounds(unsigned target, int c, int& lo, int& hi)
+{
+    if (target == 0) {
+        lo = constellation_specs[c].count_min;
+        hi = constellation_specs[c].count_max;
+        return;
+    }
+    int share = static_cast<int>(target) / num_constellations
+        + (c < static_cast<int>(target) % num_constellations ? 1 : 0);
+    lo = share > 2 ? share - 2 : 0;
+    hi = share + 2;
+}
+
+} // namespace
+
+// New table entry with randomized sky geometry and drift rates. The
+// rates are drawn once here; afterwards the satellite's track costs no
+// RNG draws at all.
+SatelliteInfo NmeaGenerator::spawnSatellite(int c)
+{
+    const auto& spec = constellation_specs[c];
+    SatelliteInfo sat {};
+    sat.prn           = randomInt(spec.prn_min, spec.prn_max);
+    sat.constellation = static_cast<Constellation>(c);
+    sat.el16          = randomInt(0, 90) * 16;
+    sat.az16          = randomInt(0, 359) * 16;
+    sat.snr16         = 30 * 16;
+    sat.el_rate       = randomInt(-8, 8); // up to 0.5 deg/cycle
+    sat.az_rate       = randomInt(-16, 16); // up to 1 deg/cycle
+
+    // Seed the SNR noise stream from stable satellite identity instead
+    // of the main RNG, so --seed reproducibility of everything else is
+    // untouched whether or not anyone looks at SNR
+    uint32_t mix = static_cast<uint32_t>(sat.prn) * 2654435761u
+        ^ (static_cast<uint32_t>(c) << 20) ^ ++noise_spawn_seq_;
+    sat.noise_state = mix != 0 ? mix : 1u;
+    return sat;
 }
 
-// Generate GxGSV sentences based on constellation
-std::string NmeaGenerator::generateGxGSV(const std::vector<SatelliteInfo>& satellites, Constellation constellation)
+// New GPS entry pinned to almanac trajectory idx: real PRN, geometry
+// from the precomputed table, no drift rates. The SNR noise stream is
+// kept — the almanac gives geometry, not signal strength.
+SatelliteInfo NmeaGenerator::spawnAlmanacSatellite(size_t idx, int el16, int az16)
 {
-    std::string message_id;
-    switch (constellation) {
-    case Constellation::GPS:
-        message_id = "GPGSV";
-        break;
-    case Constellation::GLONASS:
-        message_id = "GLGSV";
-        break;
-    case Constellation::Galileo:
-        message_id = "GAGSV";
-        break;
-    case Constellation::Beidou:
-        message_id = "GBGSV";
-        break;
-    case Constellation::QZSS:
-        message_id = "GQZSV";
-        break;
-    default:
-        message_id = "GPGSV";
-        break;
+    SatelliteInfo sat = spawnSatellite(0);
+    sat.prn           = almanac_.prn(idx);
+    sat.el16          = el16;
+    sat.az16          = az16;
+    sat.el_rate       = 0;
+    sat.az_rate       = 0;
+    sat.alm_index     = static_cast<short>(idx);
+    return sat;
+}
+
+// Maintain the persistent satellite table
+void NmeaGenerator::evolveSatellites()
+{
+    NMEA_ALLOC_SCOPE("NmeaGenerator::evolveSatellites");
+    if (satellites_.empty()) {
+        // Initial population, laid out partition-by-partition; sized up
+        // front so dense-sky targets never grow the table mid-build
+        satellites_.reserve(sat_target_ > 0 ? sat_target_ + 2 * num_constellations : 64);
+        size_t offset = 0;
+        for (int c = 0; c < num_constellations; ++c) {
+            constellation_offsets_[c] = offset;
+            if (c == 0 && almanac_.loaded()) {
+                // Almanac mode: the GPS partition is every almanac
+                // satellite above the mask at t=0, real PRNs and all
+                for (size_t i = 0; i < almanac_.satCount(); ++i) {
+                    int el16, az16;
+                    if (almanac_.sampleAt(i, 0.0, el16, az16)) {
+                        satellites_.push_back(spawnAlmanacSatellite(i, el16, az16));
+                    }
+                }
+                offset = satellites_.size();
+                continue;
+            }
+            int lo, hi;
+            satelliteBounds(sat_target_, c, lo, hi);
+            int count = randomInt(lo, hi);
+            for (int i = 0; i < count; ++i) {
+                satellites_.push_back(spawnSatellite(c));
+            }
+            offset += count;
+        }
+        constellation_offsets_[num_constellations] = offset;
+        sky_dirty_                                 = true;
+        sky_structural_                            = true;
+        return;
+    }
+
+    // Advance every satellite's geometry by its drift: elevation and
+    // SNR reflect at their bounds, azimuth wraps. Integer adds only —
+    // the emission cache downstream turns unchanged rounded values
+    // into straight byte re-emission.
+    constexpr int kEl16Max  = 90 * 16;
+    constexpr int kAz16Wrap = 360 * 16;
+    constexpr int kSnr16Max = 50 * 16;
+    double sim_t            = 0.0;
+    if (almanac_.loaded()) {
+        // Simulated elapsed seconds for the trajectory tables; under
+        // --time-scale cycle_seconds_ is already the scaled pitch, so
+        // the sky accelerates with the reported clock
+        sim_t = ++sky_sim_cycles_ * cycle_seconds_;
+    }
+    for (auto& sat : satellites_) {
+        if (sat.alm_index >= 0) {
+            // Table interpolation instead of drift — a few FLOPs. A
+            // satellite that set since the last minute boundary keeps
+            // its final geometry until the membership pass below
+            // retires it.
+            int el16, az16;
+            if (almanac_.sampleAt(sat.alm_index, sim_t, el16, az16)) {
+                sat.el16 = el16;
+                sat.az16 = az16;
+            }
+        } else {
+            sat.el16 += sat.el_rate;
+            if (sat.el16 < 0) {
+                sat.el16    = -sat.el16;
+                sat.el_rate = -sat.el_rate;
+            } else if (sat.el16 > kEl16Max) {
+                sat.el16    = 2 * kEl16Max - sat.el16;
+                sat.el_rate = -sat.el_rate;
+            }
+            sat.az16 += sat.az_rate;
+            if (sat.az16 < 0) {
+                sat.az16 += kAz16Wrap;
+            } else if (sat.az16 >= kAz16Wrap) {
+                sat.az16 -= kAz16Wrap;
+            }
+        }
+        // SNR: one xorshift32 step for a fresh white sample and an
+        // exponential pull toward it (first-order low-pass, alpha 1/8;
+        // ~0.8 s time constant at 10 Hz) — correlated fades and
+        // recoveries rather than white noise, in a handful of integer
+        // ops per satellite
+        uint32_t x = sat.noise_state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        sat.noise_state = x;
+        int white       = static_cast<int>(x % static_cast<uint32_t>(kSnr16Max + 1));
+        sat.snr16 += (white - sat.snr16) / 8;
+
+        // Dirty only when the drift crosses a whole degree/dB — the
+        // granularity GSV actually shows — so slow-change skies leave
+        // the cached block untouched for many consecutive cycles
+        if (sat.text_len == 0 || (sat.el16 >> 4) != sat.text_el
+            || (sat.az16 >> 4) != sat.text_az
+            || (sat.snr16 >> 4) != sat.text_snr) {
+            sky_dirty_ = true;
+        }
+    }
+
+    // Almanac rise/set: at each table-pitch boundary, retire GPS
+    // satellites that dropped below the mask and spawn the ones that
+    // rose. One scan per simulated minute, not per cycle — between
+    // boundaries membership is fixed and the loop above is all that
+    // runs.
+    if (almanac_.loaded()) {
+        int minute = static_cast<int>(sim_t / 60.0);
+        if (minute != almanac_minute_) {
+            almanac_minute_  = minute;
+            uint64_t present = 0;
+            size_t i         = constellation_offsets_[0];
+            while (i < constellation_offsets_[1]) {
+                int el16, az16;
+                if (!almanac_.sampleAt(satellites_[i].alm_index, sim_t, el16, az16)) {
+                    satellites_.erase(satellites_.begin() + i);
+                    for (int j = 1; j <= num_constellations; ++j) {
+                        --constellation_offsets_[j];
+                    }
+                    sky_dirty_      = true;
+                    sky_structural_ = true;
+                    continue;
+                }
+                present |= 1ull << satellites_[i].alm_index;
+                ++i;
+            }
+            for (size_t a = 0; a < almanac_.satCount() && a < 64; ++a) {
+                int el16, az16;
+                if ((present & (1ull << a)) != 0
+                    || !almanac_.sampleAt(a, sim_t, el16, az16)) {
+                    continue;
+                }
+                satellites_.insert(satellites_.begin() + constellation_offsets_[1],
+                                   spawnAlmanacSatellite(a, el16, az16));
+                for (int j = 1; j <= num_constellations; ++j) {
+                    ++constellation_offsets_[j];
+                }
+                sky_dirty_      = true;
+                sky_structural_ = true;
+            }
+        }
+    }
+
+    // Satellites appear and disappear gradually: at most one change per
+    // cycle, keeping each partition within its population bounds
+    if (randomInt(0, 3) != 0) {
+        return;
+    }
+
+    // With an almanac the GPS partition's membership is the sky's to
+    // decide; the random churn keeps the other constellations honest
+    int c = randomInt(almanac_.loaded() ? 1 : 0, num_constellations - 1);
+    size_t begin = constellation_offsets_[c];
+    size_t end   = constellation_offsets_[c + 1];
+    int count    = static_cast<int>(end - begin);
+    int lo, hi;
+    satelliteBounds(sat_target_, c, lo, hi);
+
+    bool grow;
+    if (count <= lo) {
+        grow = true;
+    } else if (count >= hi) {
+        grow = false;
+    } else {
+        grow = (randomInt(0, 1) == 1);
     }
 
-    // Filter satellites for the specified constellation
-    std::vector<SatelliteInfo> constell_satellites;
-    for (const auto& sat : satellites) {
-        if (sat.constellation == constellation) {
-            constell_satellites.push_back(sat);
+    if (grow) {
+        satellites_.insert(satellites_.begin() + end, spawnSatellite(c));
+        for (int j = c + 1; j <= num_constellations; ++j) {
+            ++constellation_offsets_[j];
+        }
+    } else {
+        satellites_.erase(satellites_.begin() + begin + randomInt(0, count - 1));
+        for (int j = c + 1; j <= num_constellations; ++j) {
+            --constellation_offsets_[j];
         }
     }
+    sky_dirty_      = true; // membership changed
+    sky_structural_ = true;
+}
 
-    int total_sats = constell_satellites.size();
-    if (total_sats == 0) {
-        // If no satellites for this constellation, return empty string
-        return "";
+// Clear one constellation's partition in place; the per-cycle churn
+// regrows it toward its population bound one satellite at a time, so a
+// dropout is followed by a gradual, realistic reacquisition
+void NmeaGenerator::dropConstellation(int c)
+{
+    if (c < 0 || c >= num_constellations || satellites_.empty()) {
+        return;
+    }
+    size_t begin = constellation_offsets_[c];
+    size_t end   = constellation_offsets_[c + 1];
+    if (begin == end) {
+        return;
+    }
+    satellites_.erase(satellites_.begin() + begin, satellites_.begin() + end);
+    size_t removed = end - begin;
+    for (int j = c + 1; j <= num_constellations; ++j) {
+        constellation_offsets_[j] -= removed;
     }
+    sky_dirty_      = true;
+    sky_structural_ = true;
+}
 
-    int sats_per_message = 4;
-    int total_messages   = (total_sats + sats_per_message - 1) / sats_per_message;
+// One fix per cycle: pick the used satellites from the GPS partition
+// (so they are a subset of what GSV advertises), draw HDOP and VDOP
+// once and derive PDOP from them, and settle quality, type and status
+// together. Scenario overrides (--scenario fix_quality / hdop) land
+// here, so every sentence quoting the fix sees them.
+void NmeaGenerator::updateFixState()
+{
+    size_t begin  = constellation_offsets_[static_cast<int>(Constellation::GPS)];
+    size_t end    = constellation_offsets_[static_cast<int>(Constellation::GPS) + 1];
+    int available = static_cast<int>(end - begin);
 
-    std::ostringstream gsv_sentences;
+    // A forced quality of 0 scripts a fix loss; otherwise the solution
+    // holds and only its dimensionality varies
+    bool no_fix      = forced_fix_quality_ == 0;
+    fix_.fix_type    = no_fix ? 1 : randomInt(2, 3);
+    fix_.fix_quality = forced_fix_quality_ >= 0 ? forced_fix_quality_
+                                                : randomInt(1, 5);
+    fix_.status      = no_fix ? 'V' : 'A';
 
-    for (int msg_num = 1; msg_num <= total_messages; ++msg_num) {
-        std::ostringstream gsv_body;
-        gsv_body << message_id << "," << total_messages << "," << msg_num << "," << total_sats;
+    fix_.prns = {};
+    fix_.used = no_fix ? 0 : std::min(randomInt(4, 12), available);
+    for (int i = 0; i < fix_.used; ++i) {
+        fix_.prns[i] = satellites_[begin + i].prn;
+    }
 
-        int start_idx = (msg_num - 1) * sats_per_message;
-        int end_idx   = std::min(start_idx + sats_per_message, total_sats);
+    fix_.hdop = forced_hdop_ > 0 ? forced_hdop_ : randomUniform(0.5, 2.5);
+    fix_.vdop = randomUniform(1.0, 5.0);
+    fix_.pdop = std::sqrt(fix_.hdop * fix_.hdop + fix_.vdop * fix_.vdop);
+}
 
-        for (int i = start_idx; i < end_idx; ++i) {
-            int prn       = constell_satellites[i].prn;
-            int elevation = randomInt(0, 90);
-            int azimuth   = randomInt(0, 359);
-            int snr       = randomInt(0, 50);
-            gsv_body << "," << prn << "," << elevation << "," << azimuth << "," << snr;
+// Shared tail of the cached-emission fast path: overwrite the cached
+// sentence's time field with the current clock, fold the old and new
+// spans into the checksum digits (TimePatch.hpp's XOR identity), and
+// append the bytes otherwise untouched — nine compares and at most
+// eleven byte writes for the whole sentence
+void NmeaGenerator::emitCachedTime(EmitCache& cache, std::string& out)
+{
+    std::string_view now = getUTCTime();
+    char* text           = cache.text;
+    if (cache.time_off != 0 && memcmp(text + cache.time_off, now.data(), 9) != 0) {
+        uint8_t diff = 0;
+        for (int i = 0; i < 9; ++i) {
+            diff = static_cast<uint8_t>(diff
+                                        ^ static_cast<uint8_t>(text[cache.time_off + i])
+                                        ^ static_cast<uint8_t>(now[i]));
+        }
+        memcpy(text + cache.time_off, now.data(), 9);
+        if (diff != 0) {
+            size_t sum        = cache.len - 4u; // "*hh\r\n" tail
+            uint8_t fresh     = static_cast<uint8_t>(
+                ((hexNibble(text[sum]) << 4) | hexNibble(text[sum + 1])) ^ diff);
+            text[sum]     = hex_table.digits[fresh][0];
+            text[sum + 1] = hex_table.digits[fresh][1];
         }
+    }
+    out.append(text, cache.len);
+}
 
-        // If less than 4 satellites in this message, fill with empty fields
-        int sats_in_this_msg = end_idx - start_idx;
-        for (int i = sats_in_this_msg; i < sats_per_message; ++i) {
-            gsv_body << ",,,";
+// Capture the bytes a builder just appended as the sentence's cache.
+// Tagged emission stays uncached (the prefix re-stamps every second),
+// and an oversized sentence simply opts out.
+void NmeaGenerator::rememberEmit(EmitCache& cache, const std::string& out,
+                                 size_t start, size_t time_off)
+{
+    size_t n = out.size() - start;
+    if (tag_enabled_ || n > sizeof(cache.text) || time_off > 255) {
+        cache.len = 0;
+        return;
+    }
+    memcpy(cache.text, out.data() + start, n);
+    cache.len      = static_cast<unsigned char>(n);
+    cache.time_off = static_cast<unsigned char>(time_off);
+}
+
+// Generate GPGGA sentence
+void NmeaGenerator::generateGPGGA(std::string& out, const LocationData& loc, int numSatellites)
+{
+    // Quality, HDOP and the in-use count quote the cycle's shared fix
+    // (scenario overrides already folded in); altitude and geoid keep
+    // their per-cycle estimates
+    int fix_quality       = fix_.fix_quality;
+    double horizontal_dil = fix_.hdop;
+    double altitude       = randomUniform(10.0, 100.0);
+    double geoid_sep      = randomUniform(-50.0, 50.0);
+
+    SentenceBuilder sb(tagView(), fixed_width_);
+    sb.add(frag_gpgga);
+    sb.field(getUTCTime());
+    sb.ch(',');
+    sb.field(loc.latitude());
+    sb.ch(',');
+    sb.ch(loc.ns);
+    sb.ch(',');
+    sb.field(loc.longitude());
+    sb.ch(',');
+    sb.ch(loc.ew);
+    sb.ch(',');
+    sb.intField(fix_quality);
+    sb.ch(',');
+    sb.intField(numSatellites, 2);
+    sb.ch(',');
+    sb.fixedField(horizontal_dil, 1, 4);
+    sb.ch(',');
+    sb.fixedField(altitude, 1, 5);
+    sb.add(frag_m_mid);
+    sb.fixedField(geoid_sep, 1, 5);
+    sb.add(frag_m_tail);
+    sb.finalize(out);
+}
+
+// Generate GPRMC sentence
+void NmeaGenerator::generateGPRMC(std::string& out, const LocationData& loc)
+{
+    // Roll the clock before the key check so a midnight crossing
+    // invalidates on the date key this cycle, not one sentence late
+    getUTCTime();
+
+    // Static-track fast path: position, speed, course and date
+    // unchanged since the cached emission means only the time field
+    // moved; patch it in the cached bytes instead of rebuilding
+    if (rmc_cache_.len != 0 && loc.version() == rmc_pos_ver_
+        && speed_knots_ == rmc_speed_ && course_deg_ == rmc_course_
+        && cached_day_ == rmc_day_ && fix_.status == rmc_status_) {
+        emitCachedTime(rmc_cache_, out);
+        return;
+    }
+
+    // Report the motion model's actual speed and course so consumers see
+    // values consistent with the position track
+    double speed_over_ground  = speed_knots_;
+    double course_over_ground = course_deg_;
+
+    size_t start = out.size();
+    SentenceBuilder sb(tagView(), fixed_width_);
+    sb.add(frag_gprmc);
+    size_t time_off = sb.size();
+    sb.field(getUTCTime());
+    sb.ch(',');
+    sb.ch(fix_.status); // agrees with GSA's fix type and GGA's quality
+    sb.ch(',');
+    sb.field(loc.latitude());
+    sb.ch(',');
+    sb.ch(loc.ns);
+    sb.ch(',');
+    sb.field(loc.longitude());
+    sb.ch(',');
+    sb.ch(loc.ew);
+    sb.ch(',');
+    sb.fixedField(speed_over_ground, 1, 5);
+    sb.ch(',');
+    sb.fixedField(course_over_ground, 1, 5);
+    sb.ch(',');
+    sb.field(getUTCDate());
+    sb.add(frag_rmc_end);
+    sb.finalize(out);
+    rememberEmit(rmc_cache_, out, start, time_off);
+    rmc_pos_ver_ = loc.version();
+    rmc_speed_   = speed_knots_;
+    rmc_course_  = course_deg_;
+    rmc_day_     = cached_day_;
+    rmc_status_  = fix_.status;
+}
+
+// Generate GPGLL sentence
+void NmeaGenerator::generateGPGLL(std::string& out, const LocationData& loc)
+{
+    // GLL carries only position and time; an unmoved position leaves
+    // the time field as the single dirty span
+    if (gll_cache_.len != 0 && loc.version() == gll_pos_ver_) {
+        emitCachedTime(gll_cache_, out);
+        return;
+    }
+
+    size_t start = out.size();
+    SentenceBuilder sb(tagView(), fixed_width_);
+    sb.add(frag_gpgll);
+    sb.field(loc.latitude());
+    sb.ch(',');
+    sb.ch(loc.ns);
+    sb.ch(',');
+    sb.field(loc.longitude());
+    sb.ch(',');
+    sb.ch(loc.ew);
+    sb.ch(',');
+    size_t time_off = sb.size();
+    sb.field(getUTCTime());
+    sb.add(frag_a_tail);
+    sb.finalize(out);
+    rememberEmit(gll_cache_, out, start, time_off);
+    gll_pos_ver_ = loc.version();
+}
+
+// Generate GPGSA sentence
+void NmeaGenerator::generateGPGSA(std::string& out)
+{
+    // Everything variable here quotes the cycle's shared fix: the
+    // 12-slot PRN frame (zero slots cover the padding), the fix type
+    // GGA's quality and RMC's status already agree with, and the DOP
+    // triple GGA's HDOP is drawn from
+    char mode = 'A';
+
+    SentenceBuilder sb(tagView(), fixed_width_);
+    sb.add(frag_gpgsa);
+    sb.ch(mode);
+    sb.ch(',');
+    sb.intField(fix_.fix_type);
+    for (int i = 0; i < 12; ++i) {
+        int prn = fix_.prns[i];
+        sb.ch(',');
+        if (prn != 0) {
+            sb.intField(prn, 3);
         }
+    }
+    sb.ch(',');
+    sb.fixedField(fix_.pdop, 1, 4);
+    sb.ch(',');
+    sb.fixedField(fix_.hdop, 1, 4);
+    sb.ch(',');
+    sb.fixedField(fix_.vdop, 1, 4);
+    sb.finalize(out);
+}
+
+// Generate the NMEA 4.1 GNGNS combined-fix summary. Every variable
+// field re-emits bytes already formatted for the other sentences — the
+// per-second time cache, the position text spans, the partition index —
+// so enabling the summary costs little beyond the memcpys.
+void NmeaGenerator::generateGNGNS(std::string& out, const LocationData& loc)
+{
+    double hdop      = fix_.hdop;
+    double altitude  = randomUniform(10.0, 100.0);
+    double geoid_sep = randomUniform(-50.0, 50.0);
+
+    SentenceBuilder sb(tagView(), fixed_width_);
+    sb.add(frag_gngns);
+    sb.field(getUTCTime());
+    sb.ch(',');
+    sb.field(loc.latitude());
+    sb.ch(',');
+    sb.ch(loc.ns);
+    sb.ch(',');
+    sb.field(loc.longitude());
+    sb.ch(',');
+    sb.ch(loc.ew);
+    sb.ch(',');
+    // Mode indicator: one character per system in table order, 'A'
+    // where the partition holds satellites, 'N' where it is empty
+    for (int c = 0; c < num_constellations; ++c) {
+        bool tracked = constellation_offsets_[c + 1] > constellation_offsets_[c];
+        sb.ch(tracked ? 'A' : 'N');
+    }
+    sb.ch(',');
+    sb.intField(static_cast<int>(satellites_.size()), 3);
+    sb.ch(',');
+    sb.fixedField(hdop, 1, 4);
+    sb.ch(',');
+    sb.fixedField(altitude, 1, 5);
+    sb.ch(',');
+    sb.fixedField(geoid_sep, 1, 5);
+    sb.add(frag_gns_tail);
+    sb.finalize(out);
+}
 
-        // Calculate checksum
-        std::string checksum = calculateChecksum(gsv_body.str());
+// Generate one NMEA 4.1 GNGSA per tracked constellation, PRNs walked
+// straight out of the partition index the GSV stream advertises and
+// the system id taken from the constellation table
+void NmeaGenerator::generateGNGSA(std::string& out)
+{
+    // One solution, quoted on every per-system line: real receivers
+    // repeat the shared fix type and DOP triple rather than inventing
+    // a fresh geometry per constellation
+    for (int c = 0; c < num_constellations; ++c) {
+        size_t begin = constellation_offsets_[c];
+        size_t end   = constellation_offsets_[c + 1];
+        if (begin == end) {
+            continue;
+        }
+        int used = std::min(12, static_cast<int>(end - begin));
 
-        // Complete sentence
-        std::string sentence = "$" + gsv_body.str() + "*" + checksum + "\r\n";
-        gsv_sentences << sentence;
+        SentenceBuilder sb(tagView(), fixed_width_);
+        sb.add(frag_gngsa);
+        sb.intField(fix_.fix_type);
+        for (int i = 0; i < 12; ++i) {
+            sb.ch(',');
+            if (i < used) {
+                sb.intField(satellites_[begin + i].prn, 3);
+            }
+        }
+        sb.ch(',');
+        sb.fixedField(fix_.pdop, 1, 4);
+        sb.ch(',');
+        sb.fixedField(fix_.hdop, 1, 4);
+        sb.ch(',');
+        sb.fixedField(fix_.vdop, 1, 4);
+        sb.ch(',');
+        sb.intField(constellation_specs[c].system_id);
+        sb.finalize(out);
     }
+}
+
+// Emit every constellation's GSV block in one pass over the satellite
+// table. The table is partitioned by constellation in emission order,
+// so a single index walks it front to back; the per-constellation
+// grouping — message count, message number, satellite total — falls
+// out of the partition offsets as the walk crosses each boundary, and
+// every line builds directly into the cycle buffer. GSV cost is linear
+// in satellite count with no per-constellation re-derivation.
+void NmeaGenerator::generateAllGSV(std::string& out)
+{
+    constexpr int sats_per_message = 4;
+    int c = 0;
+    for (size_t i = 0; i < satellites_.size();) {
+        // Advance past empty partitions to the one holding index i
+        while (i >= constellation_offsets_[c + 1]) {
+            ++c;
+        }
+        size_t range_begin = constellation_offsets_[c];
+        size_t range_end   = constellation_offsets_[c + 1];
+        int total_sats     = static_cast<int>(range_end - range_begin);
+        int total_messages = (total_sats + sats_per_message - 1) / sats_per_message;
+        int msg_num        = static_cast<int>(i - range_begin) / sats_per_message + 1;
+
+        SentenceBuilder sb(tagView(), fixed_width_);
+        sb.add(constellation_specs[c].gsv_frag);
+        sb.intField(total_messages, 2);
+        sb.ch(',');
+        sb.intField(msg_num, 2);
+        sb.ch(',');
+        sb.intField(total_sats, 2);
+
+        size_t msg_end = std::min(i + sats_per_message, range_end);
+        int in_msg     = static_cast<int>(msg_end - i);
+        for (; i < msg_end; ++i) {
+            SatelliteInfo& sat = satellites_[i];
+
+            // Round the persistent geometry to whole degrees; most
+            // cycles nothing moved a full degree and the cached field
+            // run is re-emitted as-is
+            int el  = sat.el16 >> 4;
+            int az  = sat.az16 >> 4;
+            int snr = sat.snr16 >> 4;
+            if (sat.text_len == 0 || el != sat.text_el || az != sat.text_az
+                || snr != sat.text_snr) {
+                // Fixed-width mode pads the cached run too: PRN to 3,
+                // elevation and SNR to 2, azimuth to 3 (worst case 14
+                // bytes against the 16-byte cache)
+                auto put = [&](char* p, int value, int width) {
+                    char* q = std::to_chars(p, sat.text + sizeof(sat.text), value).ptr;
+                    if (fixed_width_ && q - p < width) {
+                        size_t shift = static_cast<size_t>(width) - (q - p);
+                        std::memmove(p + shift, p, q - p);
+                        std::memset(p, ' ', shift);
+                        q = p + width;
+                    }
+                    return q;
+                };
+                char* p = sat.text;
+                *p++    = ',';
+                p       = put(p, sat.prn, 3);
+                *p++    = ',';
+                p       = put(p, el, 2);
+                *p++    = ',';
+                p       = put(p, az, 3);
+                *p++    = ',';
+                p       = put(p, snr, 2);
+                sat.text_len = static_cast<signed char>(p - sat.text);
+                sat.text_el  = static_cast<signed char>(el);
+                sat.text_az  = static_cast<short>(az);
+                sat.text_snr = static_cast<signed char>(snr);
+            }
+            sb.field(std::string_view(sat.text, static_cast<size_t>(sat.text_len)));
+        }
+
+        // If less than 4 satellites in this message, fill with empty fields
+        for (int pad = in_msg; pad < sats_per_message; ++pad) {
+            sb.add(frag_gsv_pad);
+        }
 
-    return gsv_sentences.str();
+        sb.finalize(out);
+    }
 }
 
 // Generate NFIMU sentence
-std::string NmeaGenerator::generateNFIMU()
+void NmeaGenerator::generateNFIMU(std::string& out)
 {
     int calibration_status = randomInt(0, 1);
     double temperature     = randomUniform(10, 80);
-    double acc_x           = randomUniform(-100, 100);
-    double acc_y           = randomUniform(-100, 100);
-    double acc_z           = randomUniform(-100, 100);
-    double gyro_x          = randomUniform(-2 * 3.14, 2 * 3.14);
-    double gyro_y          = randomUniform(-2 * 3.14, 2 * 3.14);
-    double gyro_z          = randomUniform(-2 * 3.14, 2 * 3.14);
 
-    std::string veh_acc_x, veh_acc_y, veh_acc_z;
-    std::string veh_gyro_x, veh_gyro_y, veh_gyro_z;
+    // NFIMU runs at the highest rates of any sentence, so the axis
+    // values come from two batch draws like the GSV field batches
+    // instead of six helper calls
+    double acc[3];
+    double gyro[3];
+    fillUniform(acc, 3, -100, 100);
+    fillUniform(gyro, 3, -2 * 3.14, 2 * 3.14);
 
+    SentenceBuilder sb(tagView(), fixed_width_);
+    sb.add(frag_nfimu);
+    sb.intField(calibration_status);
+    sb.ch(',');
+    sb.fixedField(temperature, 4, 7);
+    for (int i = 0; i < 3; ++i) {
+        sb.ch(',');
+        sb.fixedField(acc[i], 4, 9);
+    }
+    for (int i = 0; i < 3; ++i) {
+        sb.ch(',');
+        sb.fixedField(gyro[i], 4, 7);
+    }
+
+    // Only append veh_acc and veh_gyro values if calibration_status == 1
     if (calibration_status == 1) {
-        veh_acc_x  = std::to_string(acc_x + randomUniform(-10, 10));
-        veh_acc_y  = std::to_string(acc_y + randomUniform(-10, 10));
-        veh_acc_z  = std::to_string(acc_z + randomUniform(-10, 10));
-        veh_gyro_x = std::to_string(gyro_x + randomUniform(-2 * 3.14 * 0.1, 2 * 3.14 * 0.1));
-        veh_gyro_y = std::to_string(gyro_y + randomUniform(-2 * 3.14 * 0.1, 2 * 3.14 * 0.1));
-        veh_gyro_z = std::to_string(gyro_z + randomUniform(-2 * 3.14 * 0.1, 2 * 3.14 * 0.1));
+        double acc_noise[3];
+        double gyro_noise[3];
+        fillUniform(acc_noise, 3, -10, 10);
+        fillUniform(gyro_noise, 3, -2 * 3.14 * 0.1, 2 * 3.14 * 0.1);
+        for (int i = 0; i < 3; ++i) {
+            sb.ch(',');
+            sb.fixedField(acc[i] + acc_noise[i], 6, 11);
+        }
+        for (int i = 0; i < 3; ++i) {
+            sb.ch(',');
+            sb.fixedField(gyro[i] + gyro_noise[i], 6, 9);
+        }
     } else {
-        veh_acc_x = veh_acc_y = veh_acc_z = veh_gyro_x = veh_gyro_y = veh_gyro_z = "";
+        sb.add(frag_imu_pad); // Placeholder commas for missing data
     }
 
-    std::ostringstream nfimu_body;
-    nfimu_body << "NFIMU," << calibration_status << "," << std::fixed << std::setprecision(4)
-               << temperature << "," << acc_x << "," << acc_y << "," << acc_z << "," << gyro_x
-               << "," << gyro_y << "," << gyro_z;
+    sb.finalize(out);
+}
 
-    // Only append veh_acc and veh_gyro if calibration_status == 1
-    if (calibration_status == 1) {
-        nfimu_body << "," << veh_acc_x << "," << veh_acc_y << "," << veh_acc_z << "," << veh_gyro_x
-                   << "," << veh_gyro_y << "," << veh_gyro_z;
+// Generate GPVTG sentence (track made good and ground speed)
+void NmeaGenerator::generateGPVTG(std::string& out)
+{
+    // No time field at all: an unchanged track re-emits the cached
+    // bytes with zero patching
+    if (vtg_cache_.len != 0 && speed_knots_ == vtg_speed_
+        && course_deg_ == vtg_course_) {
+        out.append(vtg_cache_.text, vtg_cache_.len);
+        return;
+    }
+
+    double speed_kmh = speed_knots_ * 1.852;
+
+    size_t start = out.size();
+    SentenceBuilder sb(tagView(), fixed_width_);
+    sb.add(frag_gpvtg);
+    sb.fixedField(course_deg_, 1, 5);
+    sb.add(frag_t_mid); // true course; magnetic left empty
+    sb.fixedField(speed_knots_, 1, 5);
+    sb.add(frag_n_mid);
+    sb.fixedField(speed_kmh, 1, 6);
+    sb.add(frag_k_tail);
+    sb.finalize(out);
+    rememberEmit(vtg_cache_, out, start, 0);
+    vtg_speed_  = speed_knots_;
+    vtg_course_ = course_deg_;
+}
+
+// Generate GPZDA sentence (precise time and date)
+void NmeaGenerator::generateGPZDA(std::string& out)
+{
+    // Slice day/month/year out of the cached DDMMYY date; the call
+    // also rolls the clock, so the day key below is current
+    std::string_view date = getUTCDate();
+
+    // Within one civil day only the time field moves
+    if (zda_cache_.len != 0 && cached_day_ == zda_day_) {
+        emitCachedTime(zda_cache_, out);
+        return;
+    }
+
+    size_t start = out.size();
+    SentenceBuilder sb(tagView(), fixed_width_);
+    sb.add(frag_gpzda);
+    size_t time_off = sb.size();
+    sb.field(getUTCTime());
+    sb.ch(',');
+    sb.field(date.substr(0, 2));
+    sb.ch(',');
+    sb.field(date.substr(2, 2));
+    sb.add(frag_century);
+    sb.field(date.substr(4, 2));
+    sb.add(frag_zda_end);
+    sb.finalize(out);
+    rememberEmit(zda_cache_, out, start, time_off);
+    zda_day_ = cached_day_;
+}
+
+// Generate GPGST sentence (pseudorange error statistics)
+void NmeaGenerator::generateGPGST(std::string& out)
+{
+    double rms       = randomUniform(0.5, 5.0);
+    double smjr      = randomUniform(1.0, 10.0);
+    double smnr      = randomUniform(0.5, smjr);
+    double orient    = randomUniform(0.0, 180.0);
+    double lat_sigma = randomUniform(0.5, 10.0);
+    double lon_sigma = randomUniform(0.5, 10.0);
+    double alt_sigma = randomUniform(0.5, 15.0);
+
+    SentenceBuilder sb(tagView(), fixed_width_);
+    sb.add(frag_gpgst);
+    sb.field(getUTCTime());
+    sb.ch(',');
+    sb.fixedField(rms, 1, 4);
+    sb.ch(',');
+    sb.fixedField(smjr, 1, 4);
+    sb.ch(',');
+    sb.fixedField(smnr, 1, 4);
+    sb.ch(',');
+    sb.fixedField(orient, 1, 5);
+    sb.ch(',');
+    sb.fixedField(lat_sigma, 1, 4);
+    sb.ch(',');
+    sb.fixedField(lon_sigma, 1, 4);
+    sb.ch(',');
+    sb.fixedField(alt_sigma, 1, 4);
+    sb.finalize(out);
+}
+
+// New vessel scattered around the own-ship position with randomized
+// motion. The per-cycle step pair is the same course projection
+// updateMotion uses, run once at spawn; afterwards dead reckoning per
+// vessel is two integer adds.
+AisVessel NmeaGenerator::spawnVessel()
+{
+    constexpr double deg_per_rad = 180.0 / 3.14159265358979323846;
+
+    AisVessel v;
+    v.mmsi    = static_cast<uint32_t>(randomInt(201000000, 775999999));
+    v.lat_me4 = static_cast<int32_t>(lat_me4_ + randomInt(-120000, 120000));
+    v.lon_me4 = static_cast<int32_t>(lon_me4_ + randomInt(-120000, 120000));
+    v.sog10   = randomInt(0, 250);
+    v.cog10   = randomInt(0, 3599);
+    v.heading = v.cog10 / 10;
+
+    double knots      = v.sog10 / 10.0;
+    double course_rad = v.cog10 / 10.0 / deg_per_rad;
+    double dist_me4   = knots * cycle_seconds_ / 3600.0 * 60.0 * 10000.0;
+    double coslat     = std::cos(static_cast<double>(v.lat_me4)
+                             / static_cast<double>(kMinE4PerDeg) / deg_per_rad);
+    v.lat_step = static_cast<int32_t>(std::llround(dist_me4 * std::cos(course_rad)));
+    v.lon_step = coslat > 1e-6
+        ? static_cast<int32_t>(std::llround(dist_me4 * std::sin(course_rad) / coslat))
+        : 0;
+
+    // Class A position reports run every 2..10 s depending on vessel
+    // dynamics; a randomized interval in that band keeps the
+    // population's reports staggered instead of bursting together
+    double interval_s  = randomUniform(2.0, 10.0);
+    v.report_cycles    = std::max(1, static_cast<int>(interval_s / cycle_seconds_));
+    v.report_countdown = randomInt(1, v.report_cycles);
+    return v;
+}
+
+// One !AIVDM Type 1 position report. The stored fixed-point position is
+// already in the wire unit, so packing is pure shifts; 168 bits divide
+// evenly into 28 armored characters, so the fill-bit count is always 0.
+void NmeaGenerator::generateAIVDM(std::string& out, const AisVessel& v)
+{
+    AisPayload p;
+    p.put(1, 6); // message type 1: position report class A
+    p.put(0, 2); // repeat indicator
+    p.put(v.mmsi, 30);
+    p.put(0, 4); // nav status: under way using engine
+    p.put(128, 8); // rate of turn: not available
+    p.put(static_cast<uint32_t>(v.sog10), 10);
+    p.put(0, 1); // position accuracy
+    p.put(static_cast<uint32_t>(v.lon_me4), 28);
+    p.put(static_cast<uint32_t>(v.lat_me4), 27);
+    p.put(static_cast<uint32_t>(v.cog10), 12);
+    p.put(static_cast<uint32_t>(v.heading), 9);
+    p.put(static_cast<uint32_t>(cached_second_ % 60), 6);
+    p.put(0, 2); // maneuver indicator
+    p.put(0, 3); // spare
+    p.put(0, 1); // RAIM
+    p.put(0, 19); // radio status
+
+    SentenceBuilder sb(tagView(), fixed_width_);
+    sb.lead('!');
+    sb.add(ais_channel_b_ ? frag_aivdm_b : frag_aivdm_a);
+    ais_channel_b_ = !ais_channel_b_;
+    sb.field(p.view());
+    sb.add(frag_ais_fill);
+    sb.finalize(out);
+}
+
+// NAV-PVT from the motion model. Date and time digits are re-read from
+// the per-second NMEA string caches, so the frame costs no extra
+// gmtime; position and heading are unit conversions of the fixed-point
+// motion state.
+void NmeaGenerator::generateUbxNavPvt(std::string& out)
+{
+    getUTCTime();
+    getUTCDate();
+
+    UbxNavPvt pvt {};
+    pvt.itow     = static_cast<uint32_t>((cached_second_ % 604800) * 1000);
+    pvt.year     = static_cast<uint16_t>(2000 + (utc_date_[4] - '0') * 10 + (utc_date_[5] - '0'));
+    pvt.month    = static_cast<uint8_t>((utc_date_[2] - '0') * 10 + (utc_date_[3] - '0'));
+    pvt.day      = static_cast<uint8_t>((utc_date_[0] - '0') * 10 + (utc_date_[1] - '0'));
+    pvt.hour     = static_cast<uint8_t>((utc_time_[0] - '0') * 10 + (utc_time_[1] - '0'));
+    pvt.min      = static_cast<uint8_t>((utc_time_[2] - '0') * 10 + (utc_time_[3] - '0'));
+    pvt.sec      = static_cast<uint8_t>((utc_time_[4] - '0') * 10 + (utc_time_[5] - '0'));
+    pvt.valid    = 0x07; // date, time and fully resolved
+    pvt.fix_type = 3; // 3D fix
+    pvt.flags    = 0x01; // gnssFixOK
+    pvt.num_sv   = static_cast<uint8_t>(std::min<size_t>(satellites_.size(), 255));
+    // 1e-7-degree wire unit from arc-minutes * 1e4: * 1e7 / 600000
+    pvt.lon      = static_cast<int32_t>(lon_me4_ * 50 / 3);
+    pvt.lat      = static_cast<int32_t>(lat_me4_ * 50 / 3);
+    pvt.height   = static_cast<int32_t>(randomUniform(10.0, 100.0) * 1000.0);
+    pvt.h_msl    = pvt.height;
+    pvt.h_acc    = 5000;
+    pvt.v_acc    = 8000;
+
+    constexpr double deg_per_rad = 180.0 / 3.14159265358979323846;
+    double course_rad = course_deg_ / deg_per_rad;
+    double mm_s       = speed_knots_ * 514.444; // knots to mm/s
+    pvt.vel_n    = static_cast<int32_t>(mm_s * std::cos(course_rad));
+    pvt.vel_e    = static_cast<int32_t>(mm_s * std::sin(course_rad));
+    pvt.g_speed  = static_cast<int32_t>(mm_s);
+    pvt.head_mot = static_cast<int32_t>(course_deg_ * 1e5);
+    pvt.head_veh = pvt.head_mot;
+    pvt.s_acc    = 200;
+    pvt.head_acc = 300000;
+    pvt.p_dop    = static_cast<uint16_t>((forced_hdop_ > 0 ? forced_hdop_ : 1.4) * 100);
+
+    UbxFrame frame(0x01, 0x07);
+    frame.payload(&pvt, sizeof(pvt));
+    frame.finalize(out);
+}
+
+// NAV-SAT straight off the persistent satellite table: one 12-byte
+// struct per satellite, PRNs rebased to per-system svId ranges
+void NmeaGenerator::generateUbxNavSat(std::string& out)
+{
+    UbxFrame frame(0x01, 0x35);
+
+    UbxNavSatHeader hdr {};
+    hdr.itow    = static_cast<uint32_t>((cached_second_ % 604800) * 1000);
+    hdr.version = 1;
+    hdr.num_svs = static_cast<uint8_t>(std::min<size_t>(satellites_.size(), 255));
+    frame.payload(&hdr, sizeof(hdr));
+
+    for (size_t i = 0; i < hdr.num_svs; ++i) {
+        const SatelliteInfo& sat = satellites_[i];
+        int c                    = static_cast<int>(sat.constellation);
+
+        UbxNavSatSv sv {};
+        sv.gnss_id = ubx_gnss_id[c];
+        sv.sv_id   = static_cast<uint8_t>(sat.prn - constellation_specs[c].prn_min + 1);
+        sv.cno     = static_cast<uint8_t>(sat.snr16 / 16);
+        sv.elev    = static_cast<int8_t>(sat.el16 / 16);
+        sv.azim    = static_cast<int16_t>(sat.az16 / 16);
+        sv.flags   = 0x0F; // code+carrier locked, used in the fix
+        frame.payload(&sv, sizeof(sv));
+    }
+    frame.finalize(out);
+}
+
+// Upper-bound byte size of one generated cycle. Talker sentences are
+// bounded by the NMEA frame limit; NFIMU carries seven free-form
+// numeric fields and gets its own cap; GSV scales with the satellite
+// population, bounded by the top of each partition's wiggle band so
+// gradual growth never outruns the prediction. Exact to the high side:
+// a reserve of this size means generation never reallocates, first
+// cycle included.
+size_t NmeaGenerator::predictCycleBytes() const
+{
+    constexpr size_t kTalkerSentenceBytes = 96; // frame limit is 82
+    constexpr size_t kNfimuBytes          = 160;
+    constexpr size_t kGsvMessageBytes     = 96; // 4 satellites per message
+
+    size_t total = 0;
+    for (const auto& entry : sentence_registry_) {
+        if (!(sentence_mask_ & entry.bit)) {
+            continue;
+        }
+        if (entry.bit == SENTENCE_GSV) {
+            for (int c = 0; c < num_constellations; ++c) {
+                int lo, hi;
+                satelliteBounds(sat_target_, c, lo, hi);
+                total += static_cast<size_t>((hi + 3) / 4) * kGsvMessageBytes;
+            }
+        } else if (entry.bit == SENTENCE_NFIMU) {
+            total += kNfimuBytes;
+        } else if (entry.bit == SENTENCE_GNGSA) {
+            // One sentence per tracked constellation
+            total += num_constellations * kTalkerSentenceBytes;
+        } else if (entry.bit == SENTENCE_AIS) {
+            // Worst case: every vessel's reporting countdown expires
+            // in the same cycle
+            total += vessel_count_ * kTalkerSentenceBytes;
+        } else if (entry.bit == SENTENCE_UBX) {
+            // NAV-PVT plus NAV-SAT at the dense-sky population bound
+            size_t svs = 0;
+            for (int c = 0; c < num_constellations; ++c) {
+                int lo, hi;
+                satelliteBounds(sat_target_, c, lo, hi);
+                svs += static_cast<size_t>(hi);
+            }
+            total += (sizeof(UbxNavPvt) + 8)
+                + (sizeof(UbxNavSatHeader) + std::min<size_t>(svs, 255) * sizeof(UbxNavSatSv) + 8);
+        } else {
+            total += kTalkerSentenceBytes;
+        }
+    }
+    return total;
+}
+
+// Batch-generate n consecutive cycles into one caller-owned buffer
+void NmeaGenerator::generateCycles(size_t n, std::string& out)
+{
+    // One exact-to-the-high-side reserve keeps growth reallocation out
+    // of the generation loop entirely, including the very first cycle
+    if (predicted_cycle_bytes_ == 0) {
+        predicted_cycle_bytes_ = predictCycleBytes();
+    }
+    out.reserve(out.size() + n * predicted_cycle_bytes_);
+    for (size_t i = 0; i < n; ++i) {
+        generateAllSentences(out);
+    }
+}
+
+// Registry wrappers with a uniform emitter signature
+void NmeaGenerator::emitRMC(std::string& out) { generateGPRMC(out, position_); }
+void NmeaGenerator::emitGGA(std::string& out) { generateGPGGA(out, position_, fix_.used); }
+void NmeaGenerator::emitGSA(std::string& out) { generateGPGSA(out); }
+void NmeaGenerator::emitGLL(std::string& out) { generateGPGLL(out, position_); }
+void NmeaGenerator::emitNFIMU(std::string& out) { generateNFIMU(out); }
+void NmeaGenerator::emitVTG(std::string& out) { generateGPVTG(out); }
+void NmeaGenerator::emitZDA(std::string& out) { generateGPZDA(out); }
+void NmeaGenerator::emitGST(std::string& out) { generateGPGST(out); }
+void NmeaGenerator::emitGNS(std::string& out) { generateGNGNS(out, position_); }
+void NmeaGenerator::emitGNGSA(std::string& out) { generateGNGSA(out); }
+
+// Advance every vessel's dead-reckoned track, then emit a Type 1
+// report for each vessel whose countdown expires. The pass is linear
+// like the satellite churn; at the default 24-vessel population and
+// Class A intervals this interleaves a few thousand AIVDM per minute
+// with the GNSS cycle, on the same thread and through the same cycle
+// buffer — no extra threads or syscalls.
+void NmeaGenerator::emitAIS(std::string& out)
+{
+    if (vessels_.size() != vessel_count_) {
+        vessels_.clear();
+        vessels_.reserve(vessel_count_);
+        for (unsigned i = 0; i < vessel_count_; ++i) {
+            vessels_.push_back(spawnVessel());
+        }
+    }
+    getUTCTime(); // refresh the cached UTC second for the timestamp field
+    constexpr int32_t kLonMax = static_cast<int32_t>(180 * kMinE4PerDeg);
+    for (auto& v : vessels_) {
+        v.lat_me4 += v.lat_step;
+        v.lon_me4 += v.lon_step;
+        if (v.lon_me4 > kLonMax) {
+            v.lon_me4 -= 2 * kLonMax;
+        } else if (v.lon_me4 < -kLonMax) {
+            v.lon_me4 += 2 * kLonMax;
+        }
+        if (--v.report_countdown <= 0) {
+            v.report_countdown = v.report_cycles;
+            generateAIVDM(out, v);
+        }
+    }
+}
+
+// Emit NAV-PVT and NAV-SAT on their independent divisors. Both land in
+// the same cycle buffer and therefore ride the same single writev as
+// the NMEA text — mixed-protocol output costs no extra syscalls.
+void NmeaGenerator::emitUBX(std::string& out)
+{
+    if (++ubx_pvt_count_ >= ubx_pvt_div_) {
+        ubx_pvt_count_ = 0;
+        generateUbxNavPvt(out);
+    }
+    if (++ubx_sat_count_ >= ubx_sat_div_) {
+        ubx_sat_count_ = 0;
+        generateUbxNavSat(out);
+    }
+}
+
+// Self-describing throughput trailer (--sentences ...,PSIMT):
+// "$PSIMT,<seq>,<tx_monotonic_ns>,<bytes_so_far>" as the last registry
+// row of the cycle. Consumers diff the sequence for loss, the
+// machine-wide monotonic stamp for same-host one-way latency, and the
+// running byte count for partial-loss accounting — no packet capture
+// or wall-clock alignment on either side. bytes_so_far counts the
+// stream up to (not including) this trailer; plugin output, which is
+// appended after the registry walk, lands in the next trailer's count.
+void NmeaGenerator::emitPSIMT(std::string& out)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    SentenceBuilder sb(tagView(), fixed_width_);
+    sb.add(frag_psimt);
+    sb.intField(static_cast<long>(trace_seq_), 10);
+    sb.ch(',');
+    sb.intField(ts.tv_sec * 1000000000L + ts.tv_nsec, 19);
+    sb.ch(',');
+    sb.intField(static_cast<long>(gen_bytes_total_
+                                  + (out.size() - cycle_start_)),
+                12);
+    sb.finalize(out);
+}
+
+// The ~2 KB GSV block changes far more slowly than the cycle rate: the
+// block is built once into a cache and appended as-is until the sky
+// dirty flag trips (a rounded field moved, table membership changed).
+// With --gsv-suppress the block is additionally omitted except every
+// m-th cycle — receivers schedule GSV below the fix rate the same way
+// — while a structural change (a satellite appearing or disappearing)
+// still forces the block out immediately so consumers never see a
+// stale constellation.
+void NmeaGenerator::emitGSV(std::string& out)
+{
+    if (gsv_suppress_ > 1 && !sky_structural_) {
+        if (++gsv_cycle_ % gsv_suppress_ != 0) {
+            return;
+        }
     } else {
-        nfimu_body << ",,,,,"; // Placeholder commas for missing data
+        gsv_cycle_ = 0;
+    }
+    // With tagging on the block embeds the TAG's c: timestamp, so the
+    // cached bytes are only valid within the second they were built
+    bool cache_ok = !sky_dirty_ && !gsv_cache_.empty()
+        && (!tag_enabled_ || gsv_cache_second_ == tag_second_);
+    if (cache_ok) {
+        out.append(gsv_cache_);
+        return;
+    }
+    gsv_cache_.clear();
+    generateAllGSV(gsv_cache_);
+    out.append(gsv_cache_);
+    sky_dirty_        = false;
+    sky_structural_   = false;
+    gsv_cache_second_ = tag_second_;
+}
+
+// Sentence registry, in cycle emission order. GNGSA precedes GSA so
+// sentenceBitOf's exact-address match wins before the talker+type
+// fallback would classify a GNGSA line as GSA.
+const NmeaGenerator::SentenceEntry NmeaGenerator::sentence_registry_[14] = {
+    { SENTENCE_RMC, "RMC", &NmeaGenerator::emitRMC },
+    { SENTENCE_GGA, "GGA", &NmeaGenerator::emitGGA },
+    { SENTENCE_GNS, "GNS", &NmeaGenerator::emitGNS },
+    { SENTENCE_VTG, "VTG", &NmeaGenerator::emitVTG },
+    { SENTENCE_ZDA, "ZDA", &NmeaGenerator::emitZDA },
+    { SENTENCE_GST, "GST", &NmeaGenerator::emitGST },
+    { SENTENCE_GNGSA, "GNGSA", &NmeaGenerator::emitGNGSA },
+    { SENTENCE_GSA, "GSA", &NmeaGenerator::emitGSA },
+    { SENTENCE_GSV, "GSV", &NmeaGenerator::emitGSV },
+    { SENTENCE_GLL, "GLL", &NmeaGenerator::emitGLL },
+    { SENTENCE_NFIMU, "NFIMU", &NmeaGenerator::emitNFIMU },
+    { SENTENCE_AIS, "AIS", &NmeaGenerator::emitAIS },
+    { SENTENCE_UBX, "UBX", &NmeaGenerator::emitUBX },
+    // Trailer last, so its byte count covers the whole cycle before it
+    { SENTENCE_PSIMT, "PSIMT", &NmeaGenerator::emitPSIMT },
+};
+
+// Restrict emission to the given SentenceId bits; bits outside the
+// compiled profile have no emitter in this build and are masked off
+void NmeaGenerator::setSentenceMask(unsigned mask)
+{
+    sentence_mask_         = mask & kCompiledSentenceMask;
+    predicted_cycle_bytes_ = 0;
+}
+
+void NmeaGenerator::setTagSource(const std::string& source)
+{
+    // Constant head "s:SRC,c:" and its checksum contribution, computed
+    // once; second rollovers then fold only the epoch digits
+    tag_head_len_ = 0;
+    tag_head_[tag_head_len_++] = 's';
+    tag_head_[tag_head_len_++] = ':';
+    for (char c : source) {
+        tag_head_[tag_head_len_++] = c;
+    }
+    tag_head_[tag_head_len_++] = ',';
+    tag_head_[tag_head_len_++] = 'c';
+    tag_head_[tag_head_len_++] = ':';
+    tag_base_csum_ = 0;
+    for (size_t i = 0; i < tag_head_len_; ++i) {
+        tag_base_csum_ ^= static_cast<uint8_t>(tag_head_[i]);
+    }
+    tag_enabled_           = true;
+    tag_second_            = -1; // rebuilt on the next clock refresh
+    predicted_cycle_bytes_ = 0;
+}
+
+void NmeaGenerator::setGsvSuppress(unsigned cycles)
+{
+    gsv_suppress_          = cycles;
+    gsv_cycle_             = 0;
+    predicted_cycle_bytes_ = 0;
+}
+
+void NmeaGenerator::setFixedWidth(bool enable)
+{
+    fixed_width_ = enable;
+    // Cached GSV field runs were formatted at the old widths
+    for (SatelliteInfo& sat : satellites_) {
+        sat.text_len = 0;
+    }
+    sky_dirty_             = true;
+    predicted_cycle_bytes_ = 0;
+}
+
+void NmeaGenerator::setSatelliteTarget(unsigned total)
+{
+    sat_target_ = total;
+    // Force a rebuild so the new density takes effect immediately
+    // instead of churning toward it one satellite per cycle
+    satellites_.clear();
+    constellation_offsets_ = {};
+    predicted_cycle_bytes_ = 0;
+}
+
+// Parse a YUMA almanac and precompute the GPS az/el trajectory tables
+// (--almanac). The observer is the configured start position; the
+// random-start default anchors the sky at 0,0, which is as good a
+// fixed observer as any for geometry realism. Rebuilds the satellite
+// table so the almanac partition takes over immediately.
+bool NmeaGenerator::loadAlmanac(const std::string& path)
+{
+    double lat = std::isnan(start_lat_) ? 0.0 : start_lat_;
+    double lon = std::isnan(start_lon_) ? 0.0 : start_lon_;
+    if (!almanac_.load(path, lat, lon)) {
+        return false;
+    }
+    satellites_.clear();
+    constellation_offsets_ = {};
+    sky_sim_cycles_        = 0;
+    almanac_minute_        = -1;
+    predicted_cycle_bytes_ = 0;
+    return true;
+}
+
+// Divide every sentence except NFIMU down to every divisor-th cycle;
+// with the cycle interval set to the IMU pitch this yields the fast
+// IMU / slow GNSS split from a single scheduler
+void NmeaGenerator::setImuOversample(unsigned divisor)
+{
+    for (size_t i = 0; i < sentence_divisor_.size(); ++i) {
+        bool is_imu          = sentence_registry_[i].bit == SENTENCE_NFIMU;
+        sentence_divisor_[i] = is_imu ? 1 : (divisor > 0 ? divisor : 1);
+        sentence_cycle_[i]   = 0;
+    }
+    rebuildSchedule();
+}
+
+// Compile the per-row divisors into a repeating per-tick schedule: the
+// hyperperiod (lcm of the divisors) unrolled into one due-mask per
+// tick. The hot loop then answers "what is due now" with a single
+// array index; the per-row counter test-and-update survives only as
+// the fallback for divisor sets whose hyperperiod would not fit. The
+// fresh table is built on the side and swapped in whole, so a rebuild
+// never leaves a half-written schedule behind.
+void NmeaGenerator::rebuildSchedule()
+{
+    uint64_t hyper = 1;
+    for (unsigned d : sentence_divisor_) {
+        hyper = std::lcm(hyper, static_cast<uint64_t>(d > 0 ? d : 1));
+        if (hyper > kMaxSchedule) {
+            schedule_.clear();
+            schedule_pos_ = 0;
+            return;
+        }
+    }
+    std::vector<unsigned> fresh(static_cast<size_t>(hyper), 0);
+    for (uint64_t t = 0; t < hyper; ++t) {
+        for (size_t i = 0; i < sentence_divisor_.size(); ++i) {
+            if (t % sentence_divisor_[i] == 0) {
+                fresh[t] |= sentence_registry_[i].bit;
+            }
+        }
+    }
+    schedule_.swap(fresh);
+    schedule_pos_ = 0;
+}
+
+// Counter-walk fallback for divisor sets too coprime to unroll; same
+// emission pattern as the schedule, one increment per row per tick
+unsigned NmeaGenerator::dueFromCounters()
+{
+    unsigned due = 0;
+    for (size_t i = 0; i < sentence_divisor_.size(); ++i) {
+        if (sentence_cycle_[i] == 0) {
+            due |= sentence_registry_[i].bit;
+        }
+        if (++sentence_cycle_[i] >= sentence_divisor_[i]) {
+            sentence_cycle_[i] = 0;
+        }
+    }
+    return due;
+}
+
+void NmeaGenerator::setUbxRates(unsigned pvt_div, unsigned sat_div)
+{
+    ubx_pvt_div_   = pvt_div > 0 ? pvt_div : 1;
+    ubx_sat_div_   = sat_div > 0 ? sat_div : 1;
+    ubx_pvt_count_ = 0;
+    ubx_sat_count_ = 0;
+}
+
+void NmeaGenerator::setVesselCount(unsigned count)
+{
+    vessel_count_ = count;
+    // Respawned lazily on the next AIS cycle
+    vessels_.clear();
+    predicted_cycle_bytes_ = 0;
+}
+
+// Parse "RMC,GGA"-style lists into a mask; 0 signals an unknown name
+// Load a custom sentence plugin (--plugin). The handle is kept for the
+// process lifetime: generator clones (fleet mode, pipeline hand-off)
+// share the loaded object, so there is deliberately no dlclose.
+bool NmeaGenerator::loadPlugin(const std::string& path)
+{
+    if (plugin_count_ >= kMaxPlugins) {
+        std::cerr << "Error: at most " << kMaxPlugins << " plugins can be loaded."
+                  << std::endl;
+        return false;
+    }
+    void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (handle == nullptr) {
+        std::cerr << "Error loading plugin: " << dlerror() << std::endl;
+        return false;
+    }
+    auto abi  = reinterpret_cast<uint32_t (*)(void)>(dlsym(handle, "nmea_plugin_abi"));
+    auto emit = reinterpret_cast<NmeaPluginEmitFn>(dlsym(handle, "nmea_plugin_emit"));
+    if (abi == nullptr || emit == nullptr || abi() != NMEA_PLUGIN_ABI_VERSION) {
+        std::cerr << "Error: " << path << " is not a compatible sentence plugin (ABI "
+                  << NMEA_PLUGIN_ABI_VERSION << ")." << std::endl;
+        dlclose(handle);
+        return false;
+    }
+    plugins_[plugin_count_].handle = handle;
+    plugins_[plugin_count_].emit   = emit;
+    ++plugin_count_;
+    predicted_cycle_bytes_ = 0; // plugin output changes the cycle size
+    return true;
+}
+
+// Append the loaded plugins' output for this cycle. Context assembly is
+// gated on plugin_count_, so rigs without plugins pay one branch. The
+// span handed to each plugin lives inside the cycle buffer itself —
+// resize to the append budget, emit, trim — which stays within the
+// buffer's steady-state capacity, so the zero-alloc property of the
+// cycle loop holds with plugins loaded.
+void NmeaGenerator::emitPlugins(std::string& out)
+{
+    if (plugin_count_ == 0) {
+        return;
+    }
+    NmeaPluginContext ctx {};
+    ctx.cycle          = trace_seq_;
+    ctx.latitude_deg   = static_cast<double>(lat_me4_) / 600000.0;
+    ctx.longitude_deg  = static_cast<double>(lon_me4_) / 600000.0;
+    ctx.speed_knots    = speed_knots_;
+    ctx.course_deg     = course_deg_;
+    std::string_view t = getUTCTime();
+    std::string_view d = getUTCDate();
+    std::memcpy(ctx.utc_time, t.data(), std::min(t.size(), sizeof(ctx.utc_time) - 1));
+    std::memcpy(ctx.utc_date, d.data(), std::min(d.size(), sizeof(ctx.utc_date) - 1));
+    size_t sat_count = std::min(satellites_.size(), kCheckpointMaxSats);
+    for (size_t i = 0; i < sat_count; ++i) {
+        const SatelliteInfo& s = satellites_[i];
+        plugin_sats_[i]        = { s.prn, static_cast<int32_t>(s.constellation),
+                                   s.el16 / 16.0, s.az16 / 16.0, s.snr16 / 16.0 };
+    }
+    ctx.sats      = plugin_sats_;
+    ctx.sat_count = sat_count;
+
+    for (size_t p = 0; p < plugin_count_; ++p) {
+        size_t start = out.size();
+        out.resize(start + kPluginSpan);
+        size_t n = plugins_[p].emit(&ctx, out.data() + start, kPluginSpan);
+        out.resize(start + (n <= kPluginSpan ? n : 0));
+    }
+}
+
+unsigned NmeaGenerator::sentenceMaskFromList(const std::string& csv)
+{
+    unsigned mask = 0;
+    size_t pos    = 0;
+    while (pos <= csv.size()) {
+        size_t comma     = csv.find(',', pos);
+        size_t end       = (comma == std::string::npos) ? csv.size() : comma;
+        std::string name = csv.substr(pos, end - pos);
+        bool found       = false;
+        for (const auto& entry : sentence_registry_) {
+            if (name == entry.name) {
+                mask |= entry.bit;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            return 0;
+        }
+        if (comma == std::string::npos) {
+            break;
+        }
+        pos = comma + 1;
+    }
+    return mask;
+}
+
+unsigned NmeaGenerator::sentenceBitOf(std::string_view line)
+{
+    if (line.size() < 2) {
+        return 0;
+    }
+    if (line[0] == '!') {
+        // AIS frames open with '!'; AIVDM is the only one generated
+        return line.substr(1, 6) == "AIVDM," ? SENTENCE_AIS : 0;
+    }
+    if (line[0] != '$') {
+        return 0;
+    }
+    size_t comma = line.find(',');
+    if (comma == std::string_view::npos) {
+        return 0;
     }
+    std::string_view addr = line.substr(1, comma - 1);
+    // GSV addresses come from the per-constellation talker table and do
+    // not all follow the talker+type pattern (GQZSV)
+    for (const auto& spec : constellation_specs) {
+        if (addr == spec.gsv_id) {
+            return SENTENCE_GSV;
+        }
+    }
+    for (const auto& entry : sentence_registry_) {
+        // Exact match covers proprietary addresses (NFIMU); talker
+        // sentences carry a two-character talker before the type
+        if (addr == entry.name
+            || (addr.size() == 5 && addr.substr(2) == entry.name)) {
+            return entry.bit;
+        }
+    }
+    return 0;
+}
+
+// Generate all NMEA sentences, appending into a caller-owned buffer
+namespace {
 
-    std::string checksum = calculateChecksum(nfimu_body.str());
-    return "$" + nfimu_body.str() + "*" + checksum + "\r\n";
+// Counter-based engines rebase on the cycle number before any draw,
+// making each cycle's randomness a function of (seed, stream, cycle)
+// alone; compiles away entirely for the default xoshiro engine
+template <typename Engine>
+inline void seekEngineCycle(Engine& e, uint64_t cycle)
+{
+    if constexpr (requires { e.seekCycle(cycle); }) {
+        e.seekCycle(cycle);
+    }
 }
 
-// Generate all NMEA sentences
-std::string NmeaGenerator::generateAllSentences()
+} // namespace
+
+// One block per sentence type in registry order (GNGSA before GSA,
+// trailer last). With the default all-types mask this is the same
+// call sequence the registry walk made, minus the member-pointer
+// indirection; a fixed profile build (-DNMEA_SENTENCE_PROFILE) drops
+// the absent types' blocks entirely and folds the cycle into one
+// straight-line function.
+template <unsigned Mask>
+void NmeaGenerator::emitProfile(std::string& out, unsigned due)
 {
-    LocationData loc                      = generateLocation();
-    std::vector<SatelliteInfo> satellites = generateSatellites();
+    if constexpr ((Mask & SENTENCE_RMC) != 0) {
+        if ((due & SENTENCE_RMC) != 0)
+            emitRMC(out);
+    }
+    if constexpr ((Mask & SENTENCE_GGA) != 0) {
+        if ((due & SENTENCE_GGA) != 0)
+            emitGGA(out);
+    }
+    if constexpr ((Mask & SENTENCE_GNS) != 0) {
+        if ((due & SENTENCE_GNS) != 0)
+            emitGNS(out);
+    }
+    if constexpr ((Mask & SENTENCE_VTG) != 0) {
+        if ((due & SENTENCE_VTG) != 0)
+            emitVTG(out);
+    }
+    if constexpr ((Mask & SENTENCE_ZDA) != 0) {
+        if ((due & SENTENCE_ZDA) != 0)
+            emitZDA(out);
+    }
+    if constexpr ((Mask & SENTENCE_GST) != 0) {
+        if ((due & SENTENCE_GST) != 0)
+            emitGST(out);
+    }
+    if constexpr ((Mask & SENTENCE_GNGSA) != 0) {
+        if ((due & SENTENCE_GNGSA) != 0)
+            emitGNGSA(out);
+    }
+    if constexpr ((Mask & SENTENCE_GSA) != 0) {
+        if ((due & SENTENCE_GSA) != 0)
+            emitGSA(out);
+    }
+    if constexpr ((Mask & SENTENCE_GSV) != 0) {
+        if ((due & SENTENCE_GSV) != 0)
+            emitGSV(out);
+    }
+    if constexpr ((Mask & SENTENCE_GLL) != 0) {
+        if ((due & SENTENCE_GLL) != 0)
+            emitGLL(out);
+    }
+    if constexpr ((Mask & SENTENCE_NFIMU) != 0) {
+        if ((due & SENTENCE_NFIMU) != 0)
+            emitNFIMU(out);
+    }
+    if constexpr ((Mask & SENTENCE_AIS) != 0) {
+        if ((due & SENTENCE_AIS) != 0)
+            emitAIS(out);
+    }
+    if constexpr ((Mask & SENTENCE_UBX) != 0) {
+        if ((due & SENTENCE_UBX) != 0)
+            emitUBX(out);
+    }
+    if constexpr ((Mask & SENTENCE_PSIMT) != 0) {
+        if ((due & SENTENCE_PSIMT) != 0)
+            emitPSIMT(out);
+    }
+}
 
-    std::ostringstream all_sentences;
-    all_sentences << generateGPRMC(loc);
-    all_sentences << generateGPGGA(loc, randomInt(4, 12));
-    all_sentences << generateGPGSA(satellites);
+void NmeaGenerator::generateAllSentences(std::string& out)
+{
+    NMEA_ALLOC_SCOPE("NmeaGenerator::generateAllSentences");
+    NMEA_TRACE_GEN_START(trace_seq_);
+    size_t start = out.size();
+    cycle_start_ = start; // PSIMT's byte accounting keys on this
 
-    // Generate GSV sentences for each constellation
-    std::vector<Constellation> constellations = {
-        Constellation::GPS,
-        Constellation::GLONASS,
-        Constellation::Galileo,
-        Constellation::Beidou,
-        Constellation::QZSS
-    };
+    seekEngineCycle(rng_, trace_seq_);
+    updateMotion();
+    evolveSatellites();
+    updateFixState();
 
-    for (const auto& constell : constellations) {
-        std::string gsv = generateGxGSV(satellites, constell);
-        if (!gsv.empty()) {
-            all_sentences << gsv;
+    // Per-sentence divisors (--imu-rate) are precompiled into the
+    // schedule, so rate selection is one array read per tick
+    unsigned due;
+    if (!schedule_.empty()) {
+        due = schedule_[schedule_pos_];
+        if (++schedule_pos_ == schedule_.size()) {
+            schedule_pos_ = 0;
         }
+    } else {
+        due = dueFromCounters();
     }
 
-    all_sentences << generateGPGLL(loc);
-    all_sentences << generateNFIMU();
-    return all_sentences.str();
+    emitProfile<kCompiledSentenceMask>(out, sentence_mask_ & due);
+
+    emitPlugins(out);
+
+    gen_bytes_total_ += out.size() - start;
+    NMEA_TRACE_GEN_END(trace_seq_, out.size() - start);
+    ++trace_seq_;
+    StartupReport::mark(StartupReport::FirstGenerate);
 }
@@ -2,14 +2,240 @@
 #ifndef NMEA_GENERATOR_HPP
 #define NMEA_GENERATOR_HPP
 
+#include "AlmanacSky.hpp"
+#include "NmeaPlugin.h"
+#include "RoutePlan.hpp"
+
+#include <array>
 #include <chrono>
 #include <ctime>
-#include <iomanip>
+#include <limits>
 #include <random>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
+// xoshiro256++ engine: 32 bytes of state versus std::mt19937's 2.5 KB,
+// and a handful of shifts/rotates per draw. Satisfies
+// UniformRandomBitGenerator so the standard distributions work unchanged.
+class Xoshiro256pp {
+public:
+    using result_type = uint64_t;
+
+    explicit Xoshiro256pp(uint64_t seed)
+    {
+        // Expand the seed through splitmix64 as recommended upstream
+        for (auto& s : state_) {
+            seed += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = seed;
+            z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z          = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            s          = z ^ (z >> 31);
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~result_type(0); }
+
+    result_type operator()()
+    {
+        uint64_t result = rotl(state_[0] + state_[3], 23) + state_[0];
+        uint64_t t      = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+        return result;
+    }
+
+    // Advance 2^128 draws, giving up to 2^128 non-overlapping parallel
+    // streams from one seed (upstream xoshiro jump polynomial)
+    void jump()
+    {
+        static constexpr uint64_t jump_poly[] = {
+            0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+            0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+        };
+        uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        for (uint64_t mask : jump_poly) {
+            for (int b = 0; b < 64; ++b) {
+                if (mask & (uint64_t(1) << b)) {
+                    s0 ^= state_[0];
+                    s1 ^= state_[1];
+                    s2 ^= state_[2];
+                    s3 ^= state_[3];
+                }
+                (*this)();
+            }
+        }
+        state_[0] = s0;
+        state_[1] = s1;
+        state_[2] = s2;
+        state_[3] = s3;
+    }
+
+    // Raw state access for warm-start checkpointing (--checkpoint):
+    // restoring the four words puts the stream at the exact draw it
+    // was saved at, so a resumed --seed run continues bit-for-bit
+    void saveState(uint64_t out[4]) const
+    {
+        for (int i = 0; i < 4; ++i) {
+            out[i] = state_[i];
+        }
+    }
+    void restoreState(const uint64_t in[4])
+    {
+        for (int i = 0; i < 4; ++i) {
+            state_[i] = in[i];
+        }
+    }
+
+private:
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    uint64_t state_[4];
+};
+
+// Philox4x32-10 counter-based engine (-DNMEA_RNG_PHILOX): the draw is
+// a pure function of (key, counter), so a device stream is its 8-byte
+// key plus a 16-byte counter — no evolving pool at all — and distinct
+// keys give provably disjoint streams without jump arithmetic. The
+// generator rebases the counter's high half on the cycle number each
+// cycle (seekCycle), so any cycle's randomness can be regenerated on
+// demand from (seed, device, cycle) alone, which --count fleets and
+// checkpoint tooling exploit. Ten rounds of the standard multiply-
+// xor-shuffle per 128-bit block; two 64-bit results served per block.
+class Philox4x32 {
+public:
+    using result_type = uint64_t;
+
+    explicit Philox4x32(uint64_t seed)
+    {
+        // One splitmix64 step spreads thin seeds over the key space
+        seed += 0x9E3779B97F4A7C15ULL;
+        uint64_t z = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z          = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        key_       = z ^ (z >> 31);
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~result_type(0); }
+
+    result_type operator()()
+    {
+        if (sub_ == 0) {
+            block();
+            ++ctr_lo_;
+            if (ctr_lo_ == 0) {
+                ++ctr_hi_;
+            }
+        }
+        result_type r = out_[sub_];
+        sub_ ^= 1;
+        return r;
+    }
+
+    // Stream split, same contract as Xoshiro256pp::jump(): a bumped
+    // key is an independent permutation, so parent and clone never
+    // produce overlapping sequences
+    void jump()
+    {
+        key_ += 0x9E3779B97F4A7C15ULL;
+        ctr_lo_ = ctr_hi_ = 0;
+        sub_              = 0;
+    }
+
+    // Rebase the counter on a cycle number: draws within a cycle count
+    // up from (cycle, 0), so the cycle's randomness is a function of
+    // the cycle number alone, not of how many draws history made
+    void seekCycle(uint64_t cycle)
+    {
+        ctr_hi_ = cycle;
+        ctr_lo_ = 0;
+        sub_    = 0;
+    }
+
+    // Checkpoint image: key, counter and the within-block position fit
+    // the same four words the xoshiro engine saves (engines are a
+    // compile-time choice, so a checkpoint only restores into the
+    // build flavor that wrote it)
+    void saveState(uint64_t out[4]) const
+    {
+        out[0] = key_;
+        out[1] = ctr_lo_;
+        out[2] = ctr_hi_;
+        out[3] = sub_;
+    }
+    void restoreState(const uint64_t in[4])
+    {
+        key_    = in[0];
+        ctr_lo_ = in[1];
+        ctr_hi_ = in[2];
+        sub_    = static_cast<unsigned>(in[3] & 1);
+        if (sub_ != 0) {
+            // Mid-block save: the counter had already moved past the
+            // interrupted block, so regenerate it one step back and
+            // leave its second half pending
+            uint64_t saved_lo = ctr_lo_;
+            uint64_t saved_hi = ctr_hi_;
+            ctr_hi_ -= (ctr_lo_ == 0) ? 1 : 0;
+            ctr_lo_ -= 1;
+            block();
+            ctr_lo_ = saved_lo;
+            ctr_hi_ = saved_hi;
+        }
+    }
+
+private:
+    static void round(uint32_t c[4], uint32_t k0, uint32_t k1)
+    {
+        uint64_t p0 = 0xD2511F53ULL * c[0];
+        uint64_t p1 = 0xCD9E8D57ULL * c[2];
+        uint32_t h0 = static_cast<uint32_t>(p0 >> 32);
+        uint32_t l0 = static_cast<uint32_t>(p0);
+        uint32_t h1 = static_cast<uint32_t>(p1 >> 32);
+        uint32_t l1 = static_cast<uint32_t>(p1);
+        c[0]        = h1 ^ c[1] ^ k0;
+        c[1]        = l1;
+        c[2]        = h0 ^ c[3] ^ k1;
+        c[3]        = l0;
+    }
+
+    void block()
+    {
+        uint32_t c[4] = { static_cast<uint32_t>(ctr_lo_),
+                          static_cast<uint32_t>(ctr_lo_ >> 32),
+                          static_cast<uint32_t>(ctr_hi_),
+                          static_cast<uint32_t>(ctr_hi_ >> 32) };
+        uint32_t k0   = static_cast<uint32_t>(key_);
+        uint32_t k1   = static_cast<uint32_t>(key_ >> 32);
+        for (int r = 0; r < 10; ++r) {
+            round(c, k0, k1);
+            k0 += 0x9E3779B9u; // Weyl key schedule
+            k1 += 0xBB67AE85u;
+        }
+        out_[0] = static_cast<uint64_t>(c[0]) | (static_cast<uint64_t>(c[1]) << 32);
+        out_[1] = static_cast<uint64_t>(c[2]) | (static_cast<uint64_t>(c[3]) << 32);
+    }
+
+    uint64_t key_    = 0;
+    uint64_t ctr_lo_ = 0;
+    uint64_t ctr_hi_ = 0;
+    uint64_t out_[2] = {};
+    unsigned sub_    = 0;
+};
+
+// Engine policy for NmeaGenerator. Swap back to std::mt19937 here if a
+// standard engine is ever needed for comparison runs; NMEA_RNG_PHILOX
+// selects the counter-based engine above.
+#ifdef NMEA_RNG_PHILOX
+using RngEngine = Philox4x32;
+#else
+using RngEngine = Xoshiro256pp;
+#endif
+
 // Enum for satellite constellations
 enum class Constellation {
     GPS,
@@ -19,18 +245,184 @@ enum class Constellation {
     QZSS
 };
 
-// Structure to hold satellite information
+// Bit per sentence type, for the emission enable mask
+enum SentenceId : unsigned {
+    SENTENCE_RMC   = 1u << 0,
+    SENTENCE_GGA   = 1u << 1,
+    SENTENCE_GSA   = 1u << 2,
+    SENTENCE_GSV   = 1u << 3,
+    SENTENCE_GLL   = 1u << 4,
+    SENTENCE_NFIMU = 1u << 5,
+    SENTENCE_VTG   = 1u << 6,
+    SENTENCE_ZDA   = 1u << 7,
+    SENTENCE_GST   = 1u << 8,
+    SENTENCE_GNS   = 1u << 9,
+    SENTENCE_GNGSA = 1u << 10,
+    SENTENCE_AIS   = 1u << 11,
+    SENTENCE_UBX   = 1u << 12,
+    SENTENCE_PSIMT = 1u << 13, // proprietary throughput trailer
+};
+
+// Historical default set; VTG/ZDA/GST, the NMEA 4.1 GN-talker
+// summaries (GNS, GNGSA), the AIS vessel traffic (AIS) and the u-blox
+// binary frames (UBX) are opt-in via --sentences
+constexpr unsigned kAllSentences = SENTENCE_RMC | SENTENCE_GGA | SENTENCE_GSA
+    | SENTENCE_GSV | SENTENCE_GLL | SENTENCE_NFIMU;
+
+// Compile-time sentence profile: building with
+// -DNMEA_SENTENCE_PROFILE (cmake -DNMEA_SENTENCE_PROFILE=RMC,GGA)
+// fixes the profile mask here, and the cycle body — a template over
+// this constant — compiles to direct straight-line emitter calls with
+// every out-of-profile emitter pruned. The default keeps all types
+// compiled in and defers the choice to --sentences; a profile build
+// silently masks off out-of-profile bits requested at runtime, the
+// same contract --sentences has for unknown names.
+#ifdef NMEA_SENTENCE_PROFILE
+constexpr unsigned kCompiledSentenceMask = static_cast<unsigned>(NMEA_SENTENCE_PROFILE);
+#else
+constexpr unsigned kCompiledSentenceMask = (SENTENCE_PSIMT << 1) - 1; // every type
+#endif
+
+// Structure to hold satellite information. Sky geometry is persistent
+// and advances by small per-cycle deltas in 1/16-degree fixed point —
+// satellites track across the sky instead of teleporting, and the
+// advance is pure integer arithmetic with no per-cycle RNG draws. The
+// GSV field run (",prn,el,az,snr") is formatted once and re-emitted as
+// cached bytes until a rounded value actually changes, which at these
+// drift rates is every dozen-odd cycles rather than every cycle.
 struct SatelliteInfo {
     int prn;
     Constellation constellation;
+
+    int el16; // elevation, degrees * 16 (0..90*16)
+    int az16; // azimuth, degrees * 16 (0..360*16)
+    int snr16; // SNR, dB-Hz * 16 (0..50*16)
+    int el_rate; // per-cycle drift, 1/16-degree units
+    int az_rate;
+
+    // Private xorshift32 stream driving the low-passed SNR noise; kept
+    // out of the main RNG so the noise never perturbs --seed
+    // reproducibility of everything else
+    uint32_t noise_state;
+
+    // Index into the almanac tables (--almanac); -1 = random drift.
+    // Almanac satellites take their geometry from the precomputed
+    // trajectory instead of the el/az rates.
+    short alm_index = -1;
+
+    // Cached GSV field bytes and the rounded values they were built
+    // from; text_len 0 = not yet formatted
+    char text[16];
+    signed char text_len = 0;
+    signed char text_el  = -1;
+    short text_az        = -1;
+    signed char text_snr = -1;
 };
 
-// Structure to hold location data
+// One simulated AIS vessel. The position is stored in 1/10000
+// arc-minute fixed point — the exact unit the Type 1 position report
+// carries on the wire — so the payload packer consumes the stored
+// integers directly, and the per-cycle dead-reckoning advance is the
+// step pair precomputed from speed and course at spawn. Reporting is a
+// countdown in cycles, randomized per vessel across the Class A
+// interval band so reports stay staggered instead of bursting.
+struct AisVessel {
+    uint32_t mmsi;
+    int32_t lat_me4; // latitude, arc-minutes * 10^4 (the AIS wire unit)
+    int32_t lon_me4;
+    int32_t lat_step; // per-cycle advance, same units
+    int32_t lon_step;
+    int sog10; // speed over ground, 0.1-knot units
+    int cog10; // course over ground, 0.1-degree units
+    int heading; // degrees true
+    int report_cycles; // reporting interval in cycles
+    int report_countdown; // cycles until the next AIVDM
+};
+
+// Structure to hold location data. The position is stored numerically
+// (whole degrees plus decimal minutes in 1e-4 fixed point) and the NMEA
+// text forms ("ddmm.mmmm" / "dddmm.mmmm") are formatted lazily into
+// attached caches, so an unchanged position between cycles costs zero
+// formatting. The whole struct fits in a cache line.
 struct LocationData {
-    std::string latitude;
-    char ns;
-    std::string longitude;
-    char ew;
+    int lat_deg    = 0; // whole degrees, 0..90
+    int lat_min_e4 = 0; // decimal minutes * 10000
+    int lon_deg    = 0; // whole degrees, 0..180
+    int lon_min_e4 = 0; // decimal minutes * 10000
+    char ns        = 'N';
+    char ew        = 'E';
+
+    // Formatted NMEA text, cached until the position changes
+    std::string_view latitude() const;
+    std::string_view longitude() const;
+
+    // Call after mutating the numeric fields
+    void invalidateText()
+    {
+        lat_len_ = 0;
+        lon_len_ = 0;
+        ++version_;
+    }
+
+    // Bumped by every invalidateText(); the emitted-sentence caches
+    // key on it, so "position unchanged" is one integer compare
+    uint32_t version() const { return version_; }
+
+private:
+    uint32_t version_ = 0;
+    mutable char lat_text_[12]  = {};
+    mutable char lon_text_[12]  = {};
+    mutable unsigned char lat_len_ = 0;
+    mutable unsigned char lon_len_ = 0;
+};
+
+// Warm-start snapshot (--checkpoint / --resume): everything a restart
+// loses — trajectory position, sky geometry, vessel traffic, RNG
+// stream position, emission counters. Fixed size so one buffer is one
+// write and a torn file is detectable from its length alone; a sky or
+// fleet denser than the caps is not snapshotted and respawns through
+// the normal churn after resume. Same-build layout only, like the
+// capture format.
+// "CHK2" little-endian; bumped when the record layout changed with the
+// 14th sentence registry row (PSIMT), so stale checkpoints refuse to
+// restore instead of misreading
+constexpr uint32_t kCheckpointMagic    = 0x324B4843;
+constexpr size_t kCheckpointMaxSats    = 128;
+constexpr size_t kCheckpointMaxVessels = 64;
+
+struct CheckpointSat {
+    int32_t prn;
+    int32_t constellation;
+    int32_t el16;
+    int32_t az16;
+    int32_t snr16;
+    int32_t el_rate;
+    int32_t az_rate;
+    uint32_t noise_state;
+};
+
+struct GeneratorCheckpoint {
+    uint32_t magic        = kCheckpointMagic;
+    uint32_t sat_count    = 0;
+    uint32_t vessel_count = 0;
+    uint32_t noise_spawn_seq = 0;
+    uint64_t rng_state[4]    = {};
+    int64_t lat_me4          = 0;
+    int64_t lon_me4          = 0;
+    double speed_knots       = 0.0;
+    double course_deg        = 0.0;
+    uint64_t cycle           = 0; // generation cycle sequence
+    uint64_t route_cycle     = 0;
+    uint32_t route_index     = 0;
+    uint32_t ubx_pvt_count   = 0;
+    uint32_t ubx_sat_count   = 0;
+    uint8_t ais_channel_b    = 0;
+    uint8_t motion_initialized = 0;
+    uint8_t pad[2]             = {};
+    uint32_t sentence_cycle[14] = {};
+    uint32_t sat_offsets[6]     = {};
+    CheckpointSat sats[kCheckpointMaxSats] = {};
+    AisVessel vessels[kCheckpointMaxVessels] = {};
 };
 
 class NmeaGenerator {
@@ -38,40 +430,476 @@ public:
     NmeaGenerator();
     ~NmeaGenerator() = default;
 
-    // Generate all NMEA sentences
-    std::string generateAllSentences();
+    // Append all NMEA sentences for one cycle into a caller-owned buffer.
+    // The buffer is not cleared; callers reuse one pre-reserved buffer per
+    // thread so steady-state generation avoids per-cycle heap allocation.
+    void generateAllSentences(std::string& out);
+
+    // Batch-generate n consecutive cycles into a caller-owned buffer,
+    // amortizing clock lookups, RNG state and buffer growth across the
+    // whole batch. Intended for corpus pre-production and prefetching.
+    void generateCycles(size_t n, std::string& out);
+
+    // Configure the motion model. Any NaN argument keeps the default
+    // (randomized) value for that parameter.
+    void configureMotion(double start_lat, double start_lon, double speed_knots, double course_deg);
+
+    // Seconds the position advances per generated cycle
+    void setCycleSeconds(double seconds);
+
+    // Accelerated simulation clock (--time-scale): every reported time
+    // field advances at scale x real time from the moment of the call,
+    // while emission pacing stays real-time. 1 = wall clock.
+    void setTimeScale(double scale);
+
+    // Steer the running motion model (--scenario phase changes): adjust
+    // speed and/or course without resetting the position the way
+    // configureMotion does. NaN keeps the current value.
+    void adjustMotion(double speed_knots, double course_deg);
+
+    // Scripted impairments (--scenario events): force the GGA/GNS fix
+    // quality or dilution fields, or clear one constellation's
+    // partition so reacquisition runs through the normal churn
+    void setFixQuality(int quality); // -1 restores the randomized value
+    void setForcedHdop(double hdop); // <= 0 restores the randomized value
+    void dropConstellation(int c);
+
+    // Follow a compiled waypoint route (--route) instead of the random
+    // drift: the per-cycle update is the segment's precomputed integer
+    // step pair, and GPRMC speed/course reflect the current leg
+    void setRoute(std::vector<RouteSegment> segments);
+
+    // Cheap per-thread clone: copies configuration and motion state, and
+    // places the clone on a disjoint RNG stream via jump(), so multiple
+    // writer threads can generate in parallel without locks or sharing.
+    // The lookup tables are constexpr and shared by construction.
+    NmeaGenerator cloneForThread();
+
+    // Warm-start checkpointing (--checkpoint / --resume): snapshot the
+    // resumable state into a fixed-size record, or restore it so a
+    // restarted soak continues at the exact cycle it stopped —
+    // including the RNG stream position under --seed. restoreState
+    // returns false on a magic mismatch.
+    void saveState(GeneratorCheckpoint& out) const;
+    bool restoreState(const GeneratorCheckpoint& in);
+
+    // Reseed deterministically (--seed): pins the RNG stream and resets
+    // the satellite table and motion model so two runs with the same
+    // seed generate an identical workload
+    void reseed(uint64_t seed);
+
+    // Restrict emission to the given SentenceId bits; disabled sentences
+    // cost zero generation time
+    void setSentenceMask(unsigned mask);
+
+    // NMEA 4.10 TAG block prefixing (--tag): every sentence goes out as
+    // "\s:source,c:UNIXTIME*hh\$...", the attribution form downstream
+    // multiplexers key on. Costs no extra clock read — the tag is
+    // rebuilt from the cached clock on second rollover only.
+    void setTagSource(const std::string& source);
+
+    // GSV suppression (--gsv-suppress): emit the GSV block only every
+    // cycles-th cycle — receivers schedule GSV below the fix rate the
+    // same way — except when the constellation changed structurally,
+    // which forces the block out immediately. 0 disables suppression;
+    // an unchanged block still re-emits from cache either way.
+    void setGsvSuppress(unsigned cycles);
+
+    // Fixed-width field layout (--fixed-width): variable-width numeric
+    // fields are space-padded to per-field fixed widths — still
+    // checksum-valid NMEA — so field offsets within a sentence type
+    // are constant and consumers parse by offset with no scanning
+    void setFixedWidth(bool enable);
+
+    // Target total satellite count across all constellations (--sats);
+    // 0 keeps the realistic per-constellation defaults. The table stays
+    // partition-indexed, so GSV emission remains linear in sentences
+    // emitted no matter how dense the simulated sky is.
+    void setSatelliteTarget(unsigned total);
+
+    // Almanac-driven GPS geometry (--almanac): parse a YUMA almanac
+    // and precompute per-satellite az/el trajectories, so the GPS
+    // partition shows real rise/set tracks from the configured start
+    // position instead of random drift. Reports and returns false on
+    // a bad file.
+    bool loadAlmanac(const std::string& path);
+
+    // Independent IMU rate (--imu-rate): the cycle runs at the fast IMU
+    // pitch and every sentence except NFIMU emits only on every
+    // divisor-th cycle, so one process and one scheduler produce e.g.
+    // 200 Hz NFIMU against 1 Hz GNSS. A slow sentence's skipped cycle
+    // costs one counter increment.
+    void setImuOversample(unsigned divisor);
+
+    // Emission divisors for the UBX binary messages when SENTENCE_UBX
+    // is enabled (--ubx-rate): NAV-PVT every pvt_div cycles, NAV-SAT
+    // every sat_div cycles, so the two rates are independent of each
+    // other and of the NMEA cycle
+    void setUbxRates(unsigned pvt_div, unsigned sat_div);
+
+    // Simulated AIS vessel population size (--vessels); takes effect
+    // when SENTENCE_AIS is enabled. Message volume scales with the
+    // population: count * (cycle rate / reporting interval) AIVDM/s.
+    void setVesselCount(unsigned count);
+
+    // Load a custom sentence plugin (--plugin path.so): dlopen the
+    // object, verify its ABI version (NmeaPlugin.h), and append its
+    // output to every cycle after the built-in registry. False, with a
+    // message, when the object cannot be loaded or the ABI disagrees.
+    bool loadPlugin(const std::string& path);
+
+    // Parse a comma-separated sentence list ("RMC,GGA") into a mask.
+    // Returns 0 if any name is unknown.
+    static unsigned sentenceMaskFromList(const std::string& csv);
+
+    // Classify a generated sentence line ("$GPRMC,...") to its
+    // SentenceId bit, any talker accepted; 0 for unknown types
+    static unsigned sentenceBitOf(std::string_view line);
 
 private:
+    // The micro-benchmark suite (NmeaBench.cpp, NMEA_BUILD_BENCH=ON)
+    // times the private generation stages individually
+    friend struct NmeaGeneratorBench;
+
     // Random number generation
     double randomUniform(double min, double max);
     int randomInt(int min, int max);
 
-    // Checksum calculation
-    std::string calculateChecksum(const std::string& nmea_sentence) const;
+    // Batch fills: one tight pass over the engine per block of draws,
+    // amenable to vectorization, instead of a distribution object per call
+    void fillUniform(double* dst, size_t n, double min, double max);
+    void fillInt(int* dst, size_t n, int min, int max);
+
+    // Checksum of a sentence body as two hex digits; the view points
+    // into the static digit-pair table and never expires
+    std::string_view calculateChecksum(std::string_view nmea_sentence) const;
+
+    // Time and date retrieval. The returned views point into per-second
+    // caches and stay valid until the next call that rolls the second over.
+    std::string_view getUTCTime();
+    std::string_view getUTCDate();
+
+    // Recompute the cached HHMMSS/DDMMYY strings when the second changes
+    void refreshClock();
+
+    // Motion model: advances the position incrementally each cycle
+    // instead of drawing an unrelated random fix, and keeps the GPRMC
+    // speed/course fields consistent with the actual movement
+    void updateMotion();
+
+    // Mirror the signed-degree position into position_'s fixed-point
+    // fields, invalidating the cached text only when something changed
+    void syncPosition();
+
+    // Incremental satellite table maintenance: populates the table on the
+    // first call, afterwards lets satellites appear/disappear gradually
+    // instead of rebuilding the vector every cycle, and advances each
+    // satellite's persistent geometry by its per-cycle drift
+    void evolveSatellites();
+
+    // Derive the cycle's fix once (consistency engine): the
+    // used-satellite set, DOPs, quality, type and status that GGA, GSA,
+    // GNGSA, GNS and RMC all quote. Before this, each sentence rolled
+    // its own fix fields and cross-checking consumers (sats used must
+    // be a subset of sats seen, quality must agree with status) flagged
+    // every cycle; now the overlapping draws happen once and the story
+    // is coherent.
+    void updateFixState();
+
+    // New table entry for constellation c with randomized geometry and
+    // drift rates
+    SatelliteInfo spawnSatellite(int c);
+
+    // New GPS table entry bound to almanac trajectory idx, geometry
+    // from the table instead of random drift
+    SatelliteInfo spawnAlmanacSatellite(size_t idx, int el16, int az16);
+
+    // New AIS vessel scattered around the own-ship position with
+    // randomized motion and reporting interval
+    AisVessel spawnVessel();
 
-    // Time and date retrieval
-    std::string getUTCTime() const;
-    std::string getUTCDate() const;
+    // One !AIVDM Type 1 position report for the given vessel
+    void generateAIVDM(std::string& out, const AisVessel& v);
 
-    // Location generation
-    LocationData generateLocation();
+    // UBX binary frames: packed payload structs memcpy'd into the cycle
+    // buffer behind the standard 0xB5 0x62 header, with the Fletcher-8
+    // checksum folded incrementally as the payload is copied
+    void generateUbxNavPvt(std::string& out);
+    void generateUbxNavSat(std::string& out);
 
-    // Satellite generation
-    std::vector<SatelliteInfo> generateSatellites();
+    // NMEA sentence generation; each appends complete "$...*hh\r\n"
+    // sentences into the caller's buffer
+    void generateGPGGA(std::string& out, const LocationData& loc, int numSatellites);
+    void generateGPRMC(std::string& out, const LocationData& loc);
+    void generateGPGLL(std::string& out, const LocationData& loc);
+    void generateGPGSA(std::string& out);
+    // All constellations' GSV blocks in one pass over the partitioned
+    // satellite table; grouping comes from the partition offsets
+    void generateAllGSV(std::string& out);
+    void generateNFIMU(std::string& out);
+    void generateGPVTG(std::string& out);
+    void generateGPZDA(std::string& out);
+    void generateGPGST(std::string& out);
+    void generateGNGNS(std::string& out, const LocationData& loc);
+    void generateGNGSA(std::string& out);
 
-    // NMEA sentence generation
-    std::string generateGPGGA(const LocationData& loc, int numSatellites);
-    std::string generateGPRMC(const LocationData& loc);
-    std::string generateGPGLL(const LocationData& loc);
-    std::string generateGPGSA(const std::vector<SatelliteInfo>& satellites);
-    std::string generateGxGSV(const std::vector<SatelliteInfo>& satellites, Constellation constellation);
-    std::string generateNFIMU();
+    // Registry wrappers with a uniform signature, so emission is driven
+    // by a function table instead of a hard-coded call sequence
+    void emitRMC(std::string& out);
+    void emitGGA(std::string& out);
+    void emitGSA(std::string& out);
+    void emitGSV(std::string& out);
+    void emitGLL(std::string& out);
+    void emitNFIMU(std::string& out);
+    void emitVTG(std::string& out);
+    void emitZDA(std::string& out);
+    void emitGST(std::string& out);
+    void emitGNS(std::string& out);
+    void emitGNGSA(std::string& out);
+    void emitAIS(std::string& out);
+    void emitUBX(std::string& out);
+    void emitPSIMT(std::string& out);
 
-    // Generate multiple GSV sentences for all constellations
-    std::string generateGPGSV(const std::vector<SatelliteInfo>& satellites);
+    // Custom sentence plugins (--plugin): one function-pointer call per
+    // loaded object per cycle, appending into a span of the cycle
+    // buffer. Handles stay loaded for the process lifetime — clones
+    // (fleet mode) share them, so no dlclose bookkeeping.
+    struct Plugin {
+        void* handle             = nullptr;
+        NmeaPluginEmitFn emit    = nullptr;
+    };
+    static constexpr size_t kMaxPlugins   = 8;
+    static constexpr size_t kPluginSpan   = 1024; // append budget per plugin per cycle
+    Plugin plugins_[kMaxPlugins]          = {};
+    size_t plugin_count_                  = 0;
+    NmeaPluginSat plugin_sats_[kCheckpointMaxSats] = {};
+    void emitPlugins(std::string& out);
+
+    // One registry row per sentence type, in cycle emission order
+    struct SentenceEntry {
+        unsigned bit;
+        const char* name;
+        void (NmeaGenerator::*emit)(std::string& out);
+    };
+    static const SentenceEntry sentence_registry_[14];
+
+    // Cycle body as a template over the compiled profile mask: direct,
+    // inlinable emitter calls with out-of-profile emitters pruned at
+    // compile time. The hot path instantiates it once with
+    // kCompiledSentenceMask; the registry above keeps serving the cold
+    // name/bit lookups.
+    template <unsigned Mask>
+    void emitProfile(std::string& out, unsigned due);
+
+    // Per-registry-row emission divisor and its cycle counter; a
+    // sentence emits on the cycles where its counter is zero. All-ones
+    // (the default) reduces to the plain every-cycle walk.
+    std::array<unsigned, 14> sentence_divisor_;
+    std::array<unsigned, 14> sentence_cycle_;
+
+    // Divisors compiled into a repeating per-tick schedule: the
+    // hyperperiod (lcm of the divisors) unrolled into one mask per
+    // tick, so the hot loop answers "what is due now" with a single
+    // array index instead of a counter test and update per row. The
+    // rebuild runs off the hot path at configuration time and swaps
+    // the fresh table in whole; an absurdly coprime divisor set that
+    // would blow kMaxSchedule falls back to the counter walk.
+    static constexpr size_t kMaxSchedule = 16384;
+    void rebuildSchedule();
+    unsigned dueFromCounters();
+    std::vector<unsigned> schedule_;
+    uint32_t schedule_pos_ = 0;
 
     // Random device and generator
-    std::mt19937 rng_;
+    RngEngine rng_;
+
+    // Persistent satellite table, partitioned by constellation;
+    // constellation_offsets_[c] .. constellation_offsets_[c + 1] is the
+    // contiguous range holding constellation c. GSV emission walks these
+    // ranges directly, with no per-cycle filtering or allocation.
+    std::vector<SatelliteInfo> satellites_;
+    std::array<size_t, 6> constellation_offsets_ = {};
+
+    // Sky change tracking, two granularities. sky_dirty_ is set by any
+    // state mutation that can alter what GSV shows (rounded geometry
+    // movement, SNR whole-dB moves, membership, restore/drop events)
+    // and cleared when the block cache is rebuilt; while clear, emitGSV
+    // re-emits the cached bytes without regeneration. sky_structural_
+    // marks membership changes only — with gsv_suppress_ > 1 the block
+    // is omitted except every m-th cycle unless a structural change
+    // forces it out immediately (--gsv-suppress).
+    bool sky_dirty_        = true;
+    bool sky_structural_   = true;
+    std::string gsv_cache_;
+    unsigned gsv_suppress_ = 0;
+    unsigned gsv_cycle_    = 0;
+
+    // Fixed-width field layout armed (--fixed-width)
+    bool fixed_width_ = false;
+
+    // Scripted impairment overrides; -1 / 0 keep the randomized values
+    int forced_fix_quality_ = -1;
+    double forced_hdop_     = 0.0;
+
+    // The cycle's fix, computed once by updateFixState(). The PRN
+    // frame is the zero-padded 12-slot layout GSA emits; used doubles
+    // as GGA's satellites-in-use count. PDOP is derived from HDOP and
+    // VDOP (pdop^2 = hdop^2 + vdop^2) instead of drawn, so the triple
+    // is internally consistent too.
+    struct FixState {
+        std::array<int, 12> prns {};
+        int used        = 0;
+        int fix_type    = 3; // GSA: 1 none, 2 2D, 3 3D
+        int fix_quality = 1; // GGA field 6; 0 exactly when fix_type is 1
+        char status     = 'A'; // RMC status; V exactly when fix_type is 1
+        double pdop     = 1.0;
+        double hdop     = 1.0;
+        double vdop     = 1.0;
+    };
+    FixState fix_;
+
+    // Simulated AIS vessel population, built lazily on the first AIS
+    // cycle so vessels spawn around the initialized own-ship position
+    std::vector<AisVessel> vessels_;
+    unsigned vessel_count_ = 24;
+    bool ais_channel_b_    = false; // alternate VHF channel A/B
+
+    // UBX emission divisors and their cycle counters. NAV-SAT scales
+    // with the satellite table and defaults to a lower rate, matching
+    // how receivers schedule the two messages.
+    unsigned ubx_pvt_div_   = 1;
+    unsigned ubx_sat_div_   = 5;
+    unsigned ubx_pvt_count_ = 0;
+    unsigned ubx_sat_count_ = 0;
+
+    // Spawn counter folded into each satellite's SNR noise seed, so
+    // respawned PRNs get distinct noise streams
+    uint32_t noise_spawn_seq_ = 0;
+
+    // Total satellites requested across constellations; 0 = defaults
+    unsigned sat_target_ = 0;
+
+    // Precomputed almanac trajectories (--almanac); empty = random
+    // drift. sky_sim_cycles_ tracks simulated elapsed cycles for the
+    // table index, almanac_minute_ throttles the rise/set membership
+    // scan to table-pitch boundaries.
+    AlmanacSky almanac_;
+    uint64_t sky_sim_cycles_ = 0;
+    int almanac_minute_      = -1;
+
+    // Motion model state. The position accumulates as signed total
+    // arc-minutes * 10^4 (the wire resolution), so a cycle step is two
+    // integer adds with exact reflect/wrap arithmetic and identical
+    // trajectories replay bit-for-bit across runs; the split into
+    // position_ (fixed point + cached text) is a divide and a modulo.
+    LocationData position_;
+    bool motion_initialized_ = false;
+    double start_lat_        = std::numeric_limits<double>::quiet_NaN();
+    double start_lon_        = std::numeric_limits<double>::quiet_NaN();
+    int64_t lat_me4_         = 0; // latitude, arc-minutes * 10^4
+    int64_t lon_me4_         = 0; // longitude, arc-minutes * 10^4
+    double speed_knots_      = std::numeric_limits<double>::quiet_NaN();
+    double course_deg_       = std::numeric_limits<double>::quiet_NaN();
+    double cycle_seconds_    = 1.0;
+
+    // Compiled --route legs; non-empty replaces the random drift with
+    // precomputed per-cycle integer steps
+    std::vector<RouteSegment> route_segments_;
+    size_t route_index_   = 0;
+    uint64_t route_cycle_ = 0;
+
+    // Enabled SentenceId bits, clamped to the compiled profile
+    unsigned sentence_mask_ = kAllSentences & kCompiledSentenceMask;
+
+    // Upper-bound byte size of one cycle for the current mask and
+    // satellite density; recomputed lazily after either changes so
+    // generateCycles can reserve exactly once
+    size_t predictCycleBytes() const;
+    mutable size_t predicted_cycle_bytes_ = 0;
+
+    // Cycle sequence carried by the gen_start/gen_end tracepoints
+    uint64_t trace_seq_ = 0;
+
+    // Stream byte accounting for the PSIMT throughput trailer: total
+    // bytes generated before the current cycle, and where this cycle
+    // started in the caller's buffer
+    uint64_t gen_bytes_total_ = 0;
+    size_t cycle_start_       = 0;
+
+    // Clock caches: HHMMSS digits refresh on second rollover, the civil
+    // date only on day rollover; the ".ss" centiseconds are rewritten
+    // per call
+    std::time_t cached_second_ = -1;
+    int64_t cached_day_        = -1;
+    char utc_time_[12]         = {};
+    char utc_date_[8]          = {};
+
+    // Simulation clock (--time-scale): reported UTC is the scaled
+    // monotonic elapsed rebased onto the real time captured when the
+    // scale was set. 1.0 keeps the direct CLOCK_REALTIME read.
+    double time_scale_         = 1.0;
+    int64_t sim_epoch_real_ns_ = 0; // CLOCK_REALTIME at setTimeScale
+    int64_t sim_epoch_mono_ns_ = 0; // CLOCK_MONOTONIC at setTimeScale
+
+    // NMEA 4.10 TAG block prefix (--tag): "\s:SRC,c:UNIXTIME*hh\"
+    // rebuilt from the cached clock on second rollover only — the
+    // constant "s:SRC,c:" head and its checksum contribution are
+    // precomputed when the source is set, so a rebuild folds just the
+    // epoch digits. tag_len_ 0 means tagging is off and every
+    // SentenceBuilder sees an empty prefix.
+    void rebuildTag(int64_t unix_sec);
+    std::string_view tagView() const
+    {
+        return std::string_view(tag_block_, tag_len_);
+    }
+    bool tag_enabled_       = false;
+    std::time_t tag_second_ = -1;
+    char tag_head_[20]      = {}; // "s:SRC,c:"
+    size_t tag_head_len_    = 0;
+    uint8_t tag_base_csum_  = 0;
+    char tag_block_[40]     = {};
+    size_t tag_len_         = 0;
+
+    // Second the cached GSV block was built in; with tagging on the
+    // block embeds a timestamp, so the cache is only valid within it
+    std::time_t gsv_cache_second_ = -1;
+
+    // Emitted-sentence caches (dirty-byte minimization). The sentences
+    // whose inputs all track cheap version keys — RMC, GLL, VTG, ZDA —
+    // keep their last emitted bytes; while the keys hold, emission
+    // overwrites only the 9-byte time field in the cached text and
+    // repairs the checksum from the old and new spans (the
+    // TimePatch.hpp XOR identity), then appends. A static-antenna soak
+    // (a route leg at speed 0) reduces these sentences to time
+    // patching. Sentences that draw per-cycle noise by design (GGA,
+    // GSA, GST, GNS) keep their existing paths — their bytes change
+    // every cycle on purpose — and GSV already caches at block level.
+    // Tagged emission (--tag) bypasses the caches: the prefix
+    // re-stamps every second outside the sentence checksum.
+    struct EmitCache {
+        char text[192];
+        unsigned char len      = 0; // 0 = cache invalid
+        unsigned char time_off = 0; // hhmmss.ss offset; 0 = no time field
+    };
+    void emitCachedTime(EmitCache& cache, std::string& out);
+    void rememberEmit(EmitCache& cache, const std::string& out, size_t start,
+                      size_t time_off);
+    EmitCache rmc_cache_;
+    EmitCache gll_cache_;
+    EmitCache vtg_cache_;
+    EmitCache zda_cache_;
+
+    // Input keys the caches were built from; len 0 above is the master
+    // validity bit, so the initial values here never match anything
+    uint32_t rmc_pos_ver_ = 0;
+    double rmc_speed_     = 0.0;
+    double rmc_course_    = 0.0;
+    int64_t rmc_day_      = -1;
+    char rmc_status_      = 0; // fix status the RMC cache was built with
+    uint32_t gll_pos_ver_ = 0;
+    double vtg_speed_     = 0.0;
+    double vtg_course_    = 0.0;
+    int64_t zda_day_      = -1;
 };
 
 #endif // NMEA_GENERATOR_HPP
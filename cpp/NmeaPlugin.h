@@ -0,0 +1,69 @@
+/* NmeaPlugin.h — C ABI for out-of-tree sentence generator plugins.
+ *
+ * Teams with proprietary sentences (vendor NFIMU-like extensions) build
+ * a small shared object against this header instead of forking the
+ * simulator. The simulator dlopen()s it (--plugin path.so), verifies
+ * the ABI version, and calls the emit entry point once per cycle with a
+ * read-only snapshot of the shared cycle context and a span of the
+ * cycle buffer to append into. The call runs on the generator's
+ * zero-alloc hot path: the plugin must not allocate per call, must not
+ * block, and must write complete CRLF-terminated (and, for NMEA frames,
+ * checksummed) sentences only.
+ *
+ * Plain C so the boundary is a stable function-pointer call, immune to
+ * C++ name mangling and libstdc++ ABI drift between the simulator and
+ * the plugin toolchain.
+ */
+#ifndef NMEA_PLUGIN_H
+#define NMEA_PLUGIN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bumped whenever the context layout or calling convention changes;
+ * the loader refuses a plugin whose nmea_plugin_abi() disagrees. */
+#define NMEA_PLUGIN_ABI_VERSION 1u
+
+/* One visible satellite; constellation indices follow the simulator's
+ * order (0 GPS, 1 GLONASS, 2 Galileo, 3 BeiDou, 4 QZSS, 5 NavIC). */
+typedef struct NmeaPluginSat {
+    int32_t prn;
+    int32_t constellation;
+    double elevation_deg;
+    double azimuth_deg;
+    double snr_db;
+} NmeaPluginSat;
+
+/* Read-only snapshot of the generator state for one cycle. Pointers
+ * are valid only for the duration of the emit call. */
+typedef struct NmeaPluginContext {
+    uint64_t cycle; /* generation sequence number */
+    double latitude_deg; /* signed, north positive */
+    double longitude_deg; /* signed, east positive */
+    double speed_knots;
+    double course_deg;
+    char utc_time[16]; /* "hhmmss.ss", NUL-terminated */
+    char utc_date[8]; /* "ddmmyy", NUL-terminated */
+    const NmeaPluginSat* sats;
+    size_t sat_count;
+} NmeaPluginContext;
+
+/* Append up to cap bytes of complete sentences into dst and return the
+ * number of bytes written; 0 is a valid "nothing this cycle". Returning
+ * more than cap is treated as a plugin bug and the output is dropped. */
+typedef size_t (*NmeaPluginEmitFn)(const NmeaPluginContext* ctx, char* dst, size_t cap);
+
+/* Required exports:
+ *   uint32_t nmea_plugin_abi(void);  — must return NMEA_PLUGIN_ABI_VERSION
+ *   size_t nmea_plugin_emit(const NmeaPluginContext*, char*, size_t);
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NMEA_PLUGIN_H */
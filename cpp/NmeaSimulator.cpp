@@ -14,6 +14,395 @@ NmeaSimulator::NmeaSimulator(const std::string& pipe_path,
     , generator_()
     , pty_handler_(pipe_path_, serial_port_, symlink_path_, interval_, &generator_, file_path_) // Pass file_path_
 {
+    generator_.setCycleSeconds(interval_);
+}
+
+void NmeaSimulator::configureMotion(double start_lat, double start_lon, double speed_knots, double course_deg)
+{
+    generator_.configureMotion(start_lat, start_lon, speed_knots, course_deg);
+}
+
+void NmeaSimulator::setSentenceMask(unsigned mask)
+{
+    generator_.setSentenceMask(mask);
+}
+
+void NmeaSimulator::setTimeScale(double scale)
+{
+    generator_.setTimeScale(scale);
+    // The position advances in simulation time too, so speed over
+    // ground stays consistent with the accelerated timestamps
+    generator_.setCycleSeconds(interval_ * scale);
+}
+
+void NmeaSimulator::setSatelliteTarget(unsigned total)
+{
+    generator_.setSatelliteTarget(total);
+}
+
+void NmeaSimulator::setGsvSuppress(unsigned cycles)
+{
+    generator_.setGsvSuppress(cycles);
+}
+
+void NmeaSimulator::setFixedWidth(bool enable)
+{
+    generator_.setFixedWidth(enable);
+}
+
+void NmeaSimulator::setTagSource(const std::string& source)
+{
+    generator_.setTagSource(source);
+}
+
+void NmeaSimulator::setVesselCount(unsigned count)
+{
+    generator_.setVesselCount(count);
+}
+
+void NmeaSimulator::setUbxRates(unsigned pvt_div, unsigned sat_div)
+{
+    generator_.setUbxRates(pvt_div, sat_div);
+}
+
+void NmeaSimulator::setImuOversample(unsigned divisor)
+{
+    generator_.setImuOversample(divisor);
+}
+
+bool NmeaSimulator::openCapture(const std::string& path)
+{
+    return pty_handler_.openCapture(path);
+}
+
+void NmeaSimulator::setCaptureDirect(bool direct)
+{
+    pty_handler_.setCaptureDirect(direct);
+}
+
+void NmeaSimulator::setCheckpoint(const std::string& path)
+{
+    pty_handler_.setCheckpoint(path);
+}
+
+bool NmeaSimulator::resumeFrom(const GeneratorCheckpoint& ckpt)
+{
+    return generator_.restoreState(ckpt);
+}
+
+bool NmeaSimulator::loadPlugin(const std::string& path)
+{
+    return generator_.loadPlugin(path);
+}
+
+bool NmeaSimulator::loadAlmanac(const std::string& path)
+{
+    return generator_.loadAlmanac(path);
+}
+
+void NmeaSimulator::setRoute(std::vector<RouteSegment> segments)
+{
+    generator_.setRoute(std::move(segments));
+}
+
+void NmeaSimulator::setSeed(uint64_t seed)
+{
+    generator_.reseed(seed);
+}
+
+void NmeaSimulator::setQuiet(bool quiet)
+{
+    pty_handler_.setQuiet(quiet);
+}
+
+void NmeaSimulator::setLogSampleEvery(unsigned n)
+{
+    pty_handler_.setLogSampleEvery(n);
+}
+
+void NmeaSimulator::setPreview(double seconds)
+{
+    pty_handler_.setPreview(seconds);
+}
+
+void NmeaSimulator::setBackpressurePolicy(BackpressurePolicy policy)
+{
+    pty_handler_.setBackpressurePolicy(policy);
+}
+
+void NmeaSimulator::setPendingQueue(size_t depth, QueuePolicy policy)
+{
+    pty_handler_.setPendingQueue(depth, policy);
+}
+
+void NmeaSimulator::setUseUring(bool use_uring)
+{
+    pty_handler_.setUseUring(use_uring);
+}
+
+void NmeaSimulator::setUseVmsplice(bool use_vmsplice)
+{
+    pty_handler_.setUseVmsplice(use_vmsplice);
+}
+
+void NmeaSimulator::setUsePipeline(bool use_pipeline)
+{
+    pty_handler_.setUsePipeline(use_pipeline);
+}
+
+void NmeaSimulator::setUseOverlap(bool use_overlap)
+{
+    pty_handler_.setUseOverlap(use_overlap);
+}
+
+void NmeaSimulator::setLateStamp(bool enable)
+{
+    pty_handler_.setLateStamp(enable);
+}
+
+void NmeaSimulator::setCpuAffinity(int cpu)
+{
+    pty_handler_.setCpuAffinity(cpu);
+}
+
+void NmeaSimulator::setGenCpuAffinity(int cpu)
+{
+    pty_handler_.setGenCpuAffinity(cpu);
+}
+
+void NmeaSimulator::setRtPriority(int prio)
+{
+    pty_handler_.setRtPriority(prio);
+}
+
+void NmeaSimulator::setPrebake(size_t cycles, bool patch_time)
+{
+    pty_handler_.setPrebake(cycles, patch_time);
+}
+
+void NmeaSimulator::setLineSpeed(speed_t speed)
+{
+    pty_handler_.setLineSpeed(speed);
+}
+
+void NmeaSimulator::setUartPace(unsigned baud)
+{
+    pty_handler_.setUartPace(baud);
+}
+
+void NmeaSimulator::setPipeBuffer(size_t bytes)
+{
+    pty_handler_.setPipeBuffer(bytes);
+}
+
+void NmeaSimulator::setSelfTest(bool enable)
+{
+    pty_handler_.setSelfTest(enable);
+}
+
+void NmeaSimulator::setRawProfile(bool raw)
+{
+    pty_handler_.setRawProfile(raw);
+}
+
+void NmeaSimulator::setFlushPolicy(FlushMode mode, double value)
+{
+    pty_handler_.setFlushPolicy(mode, value);
+}
+
+void NmeaSimulator::setEnablePty(bool enable)
+{
+    pty_handler_.setEnablePty(enable);
+}
+
+void NmeaSimulator::setUdpTarget(const std::string& host, uint16_t port, int ttl)
+{
+    pty_handler_.setUdpTarget(host, port, ttl);
+}
+
+void NmeaSimulator::setUdpTxtime(bool enable)
+{
+    pty_handler_.setUdpTxtime(enable);
+}
+
+void NmeaSimulator::setTcpBind(const std::string& host, uint16_t port)
+{
+    pty_handler_.setTcpBind(host, port);
+}
+
+void NmeaSimulator::setUnixSocket(const std::string& path)
+{
+    pty_handler_.setUnixSocket(path);
+}
+
+void NmeaSimulator::setShmName(const std::string& name)
+{
+    pty_handler_.setShmName(name);
+}
+
+void NmeaSimulator::setMmapOut(const std::string& path)
+{
+    pty_handler_.setMmapOut(path);
+}
+
+void NmeaSimulator::setCycleCallback(PtyHandler::CycleCallback cb)
+{
+    pty_handler_.setCycleCallback(std::move(cb));
+}
+
+void NmeaSimulator::setDeviceCount(unsigned count)
+{
+    pty_handler_.setDeviceCount(count);
+}
+
+void NmeaSimulator::setFleetCoro(bool coro)
+{
+    pty_handler_.setFleetCoro(coro);
+}
+
+void NmeaSimulator::setForkSinks(bool fork_sinks)
+{
+    pty_handler_.setForkSinks(fork_sinks);
+}
+
+void NmeaSimulator::setSinkPool(unsigned workers, const std::string& socket_path)
+{
+    pty_handler_.setSinkPool(workers, socket_path);
+}
+
+void NmeaSimulator::setStatsInterval(double seconds)
+{
+    pty_handler_.setStatsInterval(seconds);
+}
+
+void NmeaSimulator::setBacklogWarn(size_t bytes)
+{
+    pty_handler_.setBacklogWarn(bytes);
+}
+
+void NmeaSimulator::setAdaptiveRate(std::vector<unsigned> levels)
+{
+    pty_handler_.setAdaptiveRate(std::move(levels));
+}
+
+void NmeaSimulator::setMetricsSocket(const std::string& name)
+{
+    pty_handler_.setMetricsSocket(name);
+}
+
+void NmeaSimulator::setControlSocket(const std::string& name)
+{
+    pty_handler_.setControlSocket(name);
+}
+
+void NmeaSimulator::setLeaseSocket(const std::string& name)
+{
+    pty_handler_.setLeaseSocket(name);
+}
+
+void NmeaSimulator::setCalibrate(double seconds)
+{
+    pty_handler_.setCalibrate(seconds);
+}
+
+void NmeaSimulator::setCalibrateJson(bool json)
+{
+    pty_handler_.setCalibrateJson(json);
+}
+
+void NmeaSimulator::setBridge(const std::string& in_port, const std::string& out_port)
+{
+    pty_handler_.setBridge(in_port, out_port);
+}
+
+void NmeaSimulator::setCompressSinks(bool enable)
+{
+    pty_handler_.setCompressSinks(enable);
+}
+
+void NmeaSimulator::setRelay(const std::string& host, uint16_t port)
+{
+    pty_handler_.setRelay(host, port);
+}
+
+void NmeaSimulator::setPps(const std::string& path)
+{
+    pty_handler_.setPps(path);
+}
+
+bool NmeaSimulator::emitLog(const std::string& path, uint64_t cycles)
+{
+    return pty_handler_.emitLog(path, cycles);
+}
+
+void NmeaSimulator::setScenario(ScenarioPlan plan)
+{
+    pty_handler_.setScenario(std::move(plan));
+}
+
+void NmeaSimulator::setDuration(double seconds)
+{
+    pty_handler_.setDuration(seconds);
+}
+
+void NmeaSimulator::setBurst(unsigned burst)
+{
+    pty_handler_.setBurst(burst);
+}
+
+void NmeaSimulator::setJitter(JitterDist dist, double amplitude_seconds, uint64_t seed)
+{
+    pty_handler_.setJitter(dist, amplitude_seconds, seed);
+}
+
+void NmeaSimulator::setSinkRate(PtyHandler::SinkId sink, unsigned divisor)
+{
+    pty_handler_.setSinkRate(sink, divisor);
+}
+
+void NmeaSimulator::setSinkMask(PtyHandler::SinkId sink, unsigned mask)
+{
+    pty_handler_.setSinkMask(sink, mask);
+}
+
+void NmeaSimulator::setExtraReplayFiles(std::vector<std::string> paths)
+{
+    pty_handler_.setExtraReplayFiles(std::move(paths));
+}
+
+void NmeaSimulator::setStartCycle(uint64_t cycle)
+{
+    pty_handler_.setStartCycle(cycle);
+}
+
+void NmeaSimulator::setRate(double rate)
+{
+    pty_handler_.setRate(rate);
+}
+
+void NmeaSimulator::setLogPacing(bool pace_log)
+{
+    pty_handler_.setLogPacing(pace_log);
+}
+
+void NmeaSimulator::setFollow(bool follow)
+{
+    pty_handler_.setFollow(follow);
+}
+
+void NmeaSimulator::setRetime(bool retime)
+{
+    pty_handler_.setRetime(retime);
+}
+
+void NmeaSimulator::setReplayFilter(std::vector<std::string> types, bool drop)
+{
+    pty_handler_.setReplayFilter(std::move(types), drop);
+}
+
+void NmeaSimulator::setReplayPrefetch(unsigned mb)
+{
+    pty_handler_.setReplayPrefetch(mb);
 }
 
 NmeaSimulator::~NmeaSimulator()
@@ -4,6 +4,7 @@
 
 #include "NmeaGenerator.hpp"
 #include "PtyHandler.hpp"
+#include <cstdint>
 #include <string>
 
 class NmeaSimulator {
@@ -18,6 +19,232 @@ public:
     // Start the simulator
     void start();
 
+    // Forward motion-model configuration to the generator (NaN keeps the
+    // randomized default for that parameter)
+    void configureMotion(double start_lat, double start_lon, double speed_knots, double course_deg);
+
+    // Forward the sentence enable mask to the generator
+    void setSentenceMask(unsigned mask);
+
+    // Accelerated simulation clock (--time-scale); motion advances in
+    // simulation time too
+    void setTimeScale(double scale);
+
+    // Dense-sky stress: target total satellite count (--sats)
+    void setSatelliteTarget(unsigned total);
+
+    // Omit unchanged GSV blocks except every m-th cycle (--gsv-suppress)
+    void setGsvSuppress(unsigned cycles);
+
+    // Space-pad numeric fields to fixed offsets (--fixed-width)
+    void setFixedWidth(bool enable);
+
+    // Prefix every sentence with an NMEA 4.10 TAG block (--tag source)
+    void setTagSource(const std::string& source);
+
+    // AIS traffic density: simulated vessel population (--vessels)
+    void setVesselCount(unsigned count);
+
+    // UBX NAV-PVT / NAV-SAT emission divisors (--ubx-rate)
+    void setUbxRates(unsigned pvt_div, unsigned sat_div);
+
+    // Fast-IMU split (--imu-rate): non-NFIMU sentences emit every
+    // divisor-th cycle
+    void setImuOversample(unsigned divisor);
+
+    // Binary capture of the emitted stream (--capture); direct mode
+    // (--capture-direct) bypasses the page cache
+    bool openCapture(const std::string& path);
+    void setCaptureDirect(bool direct);
+
+    // Warm-start checkpointing (--checkpoint / --resume)
+    void setCheckpoint(const std::string& path);
+    bool resumeFrom(const GeneratorCheckpoint& ckpt);
+
+    // Load a custom sentence plugin shared object (--plugin)
+    bool loadPlugin(const std::string& path);
+
+    // Almanac-driven GPS sky geometry (--almanac)
+    bool loadAlmanac(const std::string& path);
+
+    // Follow a compiled waypoint route (--route)
+    void setRoute(std::vector<RouteSegment> segments);
+
+    // Pin the generator's RNG stream for reproducible workloads
+    void setSeed(uint64_t seed);
+
+    // Suppress per-cycle console output (--quiet)
+    void setQuiet(bool quiet);
+
+    // Log only every n-th cycle to the console
+    void setLogSampleEvery(unsigned n);
+
+    // Sampled live console mirror (--preview)
+    void setPreview(double seconds);
+
+    // Slow-consumer policy for PTY writes (--backpressure)
+    void setBackpressurePolicy(BackpressurePolicy policy);
+
+    // Bounded pending-cycle queue for the PTY sink (--queue)
+    void setPendingQueue(size_t depth, QueuePolicy policy);
+
+    // Use the io_uring output backend (--io-backend uring)
+    void setUseUring(bool use_uring);
+
+    // Use vmsplice for the named-pipe sink (--io-backend vmsplice)
+    void setUseVmsplice(bool use_vmsplice);
+
+    // Decouple generation from writing with an SPSC ring (--pipeline)
+    void setUsePipeline(bool use_pipeline);
+
+    // Lockstep double-buffered generation (--overlap)
+    void setUseOverlap(bool use_overlap);
+
+    // Patch time fields at emission instead of generation (--late-stamp)
+    void setLateStamp(bool enable);
+
+    // Thread scheduling (--cpu, --gen-cpu, --rt-prio)
+    void setCpuAffinity(int cpu);
+    void setGenCpuAffinity(int cpu);
+    void setRtPriority(int prio);
+
+    // Prebaked cycle corpus for consumer profiling (--prebake,
+    // --prebake-time)
+    void setPrebake(size_t cycles, bool patch_time);
+
+    // PTY line configuration (--baud, --tty-profile)
+    void setLineSpeed(speed_t speed);
+    void setRawProfile(bool raw);
+
+    // Byte-rate pacing at the --baud line rate (--uart-pace); 0 = off
+    void setUartPace(unsigned baud);
+
+    // Kernel FIFO capacity for the named-pipe sink (--pipe-buffer)
+    void setPipeBuffer(size_t bytes);
+
+    // Verified-loopback benchmark on our own PTY (--selftest)
+    void setSelfTest(bool enable);
+
+    // fsync policy for serial output (--flush)
+    void setFlushPolicy(FlushMode mode, double value);
+
+    // Add the PTY sink alongside pipe/serial for fan-out (--pty)
+    void setEnablePty(bool enable);
+
+    // UDP destination (--udp host:port, --udp-ttl)
+    void setUdpTarget(const std::string& host, uint16_t port, int ttl);
+
+    // SO_TXTIME deadline stamping for the UDP sink (--udp-txtime)
+    void setUdpTxtime(bool enable);
+
+    // Listening TCP sink (--tcp [host]:port)
+    void setTcpBind(const std::string& host, uint16_t port);
+
+    // Unix SOCK_SEQPACKET sink (--unix path)
+    void setUnixSocket(const std::string& path);
+
+    // Shared-memory ring sink (--shm name)
+    void setShmName(const std::string& name);
+
+    // In-process callback sink for embedders; replaces the byte-stream
+    // sinks with direct zero-copy delivery of each cycle buffer
+    void setCycleCallback(PtyHandler::CycleCallback cb);
+
+    // Memory-mapped ring-file sink (--mmap-out file)
+    void setMmapOut(const std::string& path);
+
+    // Number of simulated PTY devices in one process (--count)
+    void setDeviceCount(unsigned count);
+
+    // Run fleet devices as coroutines on an epoll reactor (--fleet-backend coro)
+    void setFleetCoro(bool coro);
+
+    // Emit through forked per-sink writer processes (--fork-sinks)
+    void setForkSinks(bool fork_sinks);
+
+    // Pre-forked writer pool with live consumer attach (--sink-pool)
+    void setSinkPool(unsigned workers, const std::string& socket_path);
+
+    // Periodic one-line per-sink throughput report (--stats)
+    void setStatsInterval(double seconds);
+
+    // Early-warning threshold for the kernel backlog gauges
+    // (--backlog-warn)
+    void setBacklogWarn(size_t bytes);
+
+    // Backpressure-driven rate stepping (--adaptive-rate)
+    void setAdaptiveRate(std::vector<unsigned> levels);
+
+    // JSON metrics endpoint on an abstract unix socket (--metrics)
+    void setMetricsSocket(const std::string& name);
+
+    // Runtime reconfiguration endpoint (--control)
+    void setControlSocket(const std::string& name);
+
+    // Fleet lease endpoint (--lease, with --count)
+    void setLeaseSocket(const std::string& name);
+
+    // Max-sustainable-rate calibration run (--calibrate)
+    void setCalibrate(double seconds);
+
+    // Machine-readable calibration report (--calibrate-json)
+    void setCalibrateJson(bool json);
+
+    // Native two-port PTY bridge (--bridge <in>:<out>)
+    void setBridge(const std::string& in_port, const std::string& out_port);
+
+    // Per-cycle deflate on the TCP/unix sinks (--compress)
+    void setCompressSinks(bool enable);
+
+    // Decompressing relay to a local PTY (--relay host:port)
+    void setRelay(const std::string& host, uint16_t port);
+
+    // 1PPS pulse FIFO on the writer's deadline grid (--pps)
+    void setPps(const std::string& path);
+
+    // Offline corpus generation to a file (--emit-log / --cycles)
+    bool emitLog(const std::string& path, uint64_t cycles);
+
+    // Clean shutdown after a fixed run length (--duration)
+    void setDuration(double seconds);
+
+    // Precompiled phase timeline for a scripted run (--scenario)
+    void setScenario(ScenarioPlan plan);
+
+    // Cycles emitted back to back per interval (--burst)
+    void setBurst(unsigned burst);
+
+    // Deterministic seeded deadline jitter (--jitter)
+    void setJitter(JitterDist dist, double amplitude_seconds, uint64_t seed);
+
+    // Per-sink fan-out shaping (--sink-rate, --sink-sentences)
+    void setSinkRate(PtyHandler::SinkId sink, unsigned divisor);
+    void setSinkMask(PtyHandler::SinkId sink, unsigned mask);
+
+    // Additional logs merged into the --file replay by timestamp
+    void setExtraReplayFiles(std::vector<std::string> paths);
+
+    // First cycle replayed in --file mode (--start-cycle)
+    void setStartCycle(uint64_t cycle);
+
+    // Replay rate multiplier (--rate); 0 means unpaced
+    void setRate(double rate);
+
+    // Timestamp-faithful replay pacing (--pace log)
+    void setLogPacing(bool pace_log);
+
+    // Tail a growing log at EOF instead of rewinding (--follow)
+    void setFollow(bool follow);
+
+    // Fresh wall-clock time fields on replayed cycles (--retime)
+    void setRetime(bool retime);
+
+    // Index-time replay sentence filter (--only / --drop)
+    void setReplayFilter(std::vector<std::string> types, bool drop);
+
+    // MADV_WILLNEED window ahead of the replay cursor (--prefetch)
+    void setReplayPrefetch(unsigned mb);
+
 private:
     std::string pipe_path_;
     std::string serial_port_;
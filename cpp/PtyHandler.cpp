@@ -1,14 +1,52 @@
 // PtyHandler.cpp
 #include "PtyHandler.hpp"
+#include "AllocProfiler.hpp"
+#include "CoroReactor.hpp"
+#include "CyclePipeline.hpp"
+#include "DeadlineHeap.hpp"
+#include "FleetScheduler.hpp"
+#include "FlightRecorder.hpp"
+#include "LatencyHistogram.hpp"
+#include "MemBudget.hpp"
 #include "NmeaGenerator.hpp"
+#include "ReplayLog.hpp"
+#include "ReplayMerge.hpp"
+#include "ShmRing.hpp"
+#include "StartupReport.hpp"
+#include "ThreadTuning.hpp"
+#include "Tracepoints.hpp"
+#include "UringWriter.hpp"
 
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <fcntl.h>
-#include <fstream>
+#include <linux/net_tstamp.h>
+#include <linux/perf_event.h>
+#include <netdb.h>
+#include <netinet/in.h>
 #include <iostream>
+#include <mutex>
+#include <poll.h>
 #include <pty.h>
+#include <random>
 #include <signal.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <zlib.h>
+#include <sys/socket.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <sys/wait.h>
 #include <termios.h>
 #include <unistd.h>
 #include <vector>
@@ -16,6 +54,17 @@
 // Initialize static member
 PtyHandler* PtyHandler::instance_ = nullptr;
 
+namespace {
+
+// Shutdown wake eventfd: written once on shutdown and never read back,
+// so it stays level-readable and a single write wakes every thread
+// polling it. File scope so the deadline waiters below can see it
+// without plumbing; write() is async-signal-safe, so the SIGINT
+// handler may signal it directly.
+int shutdown_wake_fd = -1;
+
+} // namespace
+
 // Constructor
 PtyHandler::PtyHandler(const std::string& pipe_path,
                        const std::string& serial_port,
@@ -32,6 +81,10 @@ PtyHandler::PtyHandler(const std::string& pipe_path,
     , generator_(generator)
     , file_path_(file_path) // Initialize new member
 {
+    // -1 marks "never sampled", distinct from a healthy empty buffer
+    for (auto& gauge : sink_backlog_) {
+        gauge.store(-1, std::memory_order_relaxed);
+    }
 }
 
 // Destructor
@@ -43,9 +96,40 @@ PtyHandler::~PtyHandler()
 // Static signal handler
 void PtyHandler::signalHandler(int signal)
 {
+    if (signal == SIGUSR2) {
+        // Live flight-recorder dump; the run continues undisturbed
+        flightRecorder().dumpSignalSafe();
+        return;
+    }
+    if (signal == SIGSEGV || signal == SIGABRT || signal == SIGBUS
+        || signal == SIGFPE) {
+        // Abnormal exit: get the ring to disk, then die the normal way
+        // so cores and exit codes are unchanged
+        flightRecorder().dumpSignalSafe();
+        struct sigaction dfl;
+        dfl.sa_handler = SIG_DFL;
+        sigemptyset(&dfl.sa_mask);
+        dfl.sa_flags = 0;
+        sigaction(signal, &dfl, nullptr);
+        raise(signal);
+        return;
+    }
     if (signal == SIGINT && instance_) {
         std::cout << "\nKeyboardInterrupt received. Shutting down..." << std::endl;
-        instance_->shutdown_event_.store(true);
+        instance_->requestShutdown();
+    }
+}
+
+// Set the shutdown flag and wake every deadline waiter. The flag alone
+// is only observed at the next wakeup, which with --interval 30 meant
+// up to 30 s of exit latency (long enough for harnesses to SIGKILL us
+// past cleanup); the eventfd bounds shutdown at poll latency instead.
+void PtyHandler::requestShutdown()
+{
+    shutdown_event_.store(true);
+    if (shutdown_wake_fd != -1) {
+        uint64_t one = 1;
+        [[maybe_unused]] ssize_t n = write(shutdown_wake_fd, &one, sizeof(one));
     }
 }
 
@@ -53,11 +137,27 @@ void PtyHandler::signalHandler(int signal)
 void PtyHandler::setupSignalHandler()
 {
     instance_ = this;
+    if (shutdown_wake_fd == -1) {
+        shutdown_wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    }
     struct sigaction sa;
     sa.sa_handler = PtyHandler::signalHandler;
     sigemptyset(&sa.sa_mask);
     sa.sa_flags = 0;
     sigaction(SIGINT, &sa, nullptr);
+
+    // Flight recorder: SIGUSR2 dumps the metadata ring on demand, and
+    // the fatal signals dump it on the way out
+    flightRecorder().preparePath();
+    sigaction(SIGUSR2, &sa, nullptr);
+    sigaction(SIGSEGV, &sa, nullptr);
+    sigaction(SIGABRT, &sa, nullptr);
+    sigaction(SIGBUS, &sa, nullptr);
+    sigaction(SIGFPE, &sa, nullptr);
+
+    // Reader disconnects surface as EPIPE from write() instead of
+    // killing the process
+    signal(SIGPIPE, SIG_IGN);
 }
 
 // Start the handler
@@ -65,9 +165,180 @@ void PtyHandler::start()
 {
     setupSignalHandler();
 
-    if (!serial_port_.empty()) {
+    // Periodic side work (--stats tick, backlog sampling, --checkpoint
+    // flush, --duration shutdown) shares one DeadlineHeap thread: each
+    // activity is a heap
+    // entry behind a single timerfd, not a thread with its own sleep
+    // loop. None of it touches the hot loops — the stats tick reads
+    // relaxed counters, the checkpoint flush serializes a snapshot the
+    // writer already published.
+    if (stats_interval_ > 0 || !checkpoint_path_.empty() || run_seconds_ > 0
+        || !metrics_name_.empty() || backlog_warn_ > 0) {
+        if (!checkpoint_path_.empty()) {
+            last_checkpoint_ = std::chrono::steady_clock::now();
+        }
+        service_thread_ = std::thread(&PtyHandler::serviceLoop, this);
+    }
+    if (!metrics_name_.empty()) {
+        metrics_thread_ = std::thread(&PtyHandler::metricsLoop, this);
+    }
+    if (!control_name_.empty()) {
+        control_thread_ = std::thread(&PtyHandler::controlLoop, this);
+    }
+    // 1PPS pulses (--pps) ride the writer scheduler's deadline grid;
+    // the thread adopts its epoch once the writer publishes it
+    if (!pps_path_.empty()) {
+        pps_thread_ = std::thread(&PtyHandler::ppsLoop, this);
+        applyThreadTuning(pps_thread_.native_handle(), cpu_affinity_, rt_priority_,
+                          "PPS thread");
+    }
+
+    // Bridge mode (--bridge): this process is the two-port PTY relay
+    // itself — the topology the old socat recipe built, minus the
+    // extra process. No generator runs.
+    if (!bridge_out_.empty()) {
+        writer_thread_ = std::thread(&PtyHandler::bridgeLoop, this);
+        applyThreadTuning(writer_thread_.native_handle(), cpu_affinity_, rt_priority_,
+                          "bridge thread");
+        if (writer_thread_.joinable()) {
+            writer_thread_.join();
+        }
+        cleanup();
+        return;
+    }
+
+    // Relay mode (--relay): this process is a decompressing consumer
+    // for a --compress TCP sink, re-emitting the inflated stream on a
+    // local PTY. No generator runs.
+    if (!relay_host_.empty()) {
+        writer_thread_ = std::thread(&PtyHandler::relayLoop, this);
+        applyThreadTuning(writer_thread_.native_handle(), cpu_affinity_, rt_priority_,
+                          "relay thread");
+        if (writer_thread_.joinable()) {
+            writer_thread_.join();
+        }
+        cleanup();
+        return;
+    }
+
+    // Calibration mode (--calibrate): unpaced generate + write for a
+    // fixed duration, then report and exit. No real sink is set up.
+    if (calibrate_seconds_ > 0) {
+        writer_thread_ = std::thread(&PtyHandler::calibrateLoop, this);
+        applyThreadTuning(writer_thread_.native_handle(), cpu_affinity_, rt_priority_,
+                          "calibration thread");
+        if (writer_thread_.joinable()) {
+            writer_thread_.join();
+        }
+        cleanup();
+        return;
+    }
+
+    // Fleet mode: N PTY devices in this one process (--count). The
+    // fleet writer owns device setup and its worker pool end to end.
+    if (device_count_ > 1) {
+        writer_thread_ = std::thread(&PtyHandler::writerFleet, this);
+        if (writer_thread_.joinable()) {
+            writer_thread_.join();
+        }
+        std::cout << "PtyHandler exited gracefully." << std::endl;
+        return;
+    }
+
+    // Fan-out mode: several sinks requested, one generation pass feeds
+    // them all. Replay mode keeps the historical single-sink behavior.
+    int sink_count = (serial_port_.empty() ? 0 : 1) + (pipe_path_.empty() ? 0 : 1)
+        + (force_pty_ ? 1 : 0) + (udp_host_.empty() ? 0 : 1) + (tcp_port_ != 0 ? 1 : 0)
+        + (unix_path_.empty() ? 0 : 1) + (shm_name_.empty() ? 0 : 1);
+    // Forked fan-out mode: one writer process per sink, fed from a
+    // shared ring (--fork-sinks)
+    // Pre-forked pool mode (--sink-pool): no sinks are configured up
+    // front; consumers attach at the control socket and the producer
+    // hands their fds to the workers
+    if (sink_pool_workers_ > 0 && file_path_.empty()) {
+        writer_thread_ = std::thread(&PtyHandler::writerPool, this);
+        applyThreadTuning(writer_thread_.native_handle(), cpu_affinity_, rt_priority_,
+                          "writer thread");
+        if (writer_thread_.joinable()) {
+            writer_thread_.join();
+        }
+        cleanup();
+        return;
+    }
+
+    if (fork_sinks_ && file_path_.empty() && sink_count >= 1) {
+        if (!pipe_path_.empty()) {
+            setupNamedPipe();
+            if (shutdown_event_.load())
+                return;
+            std::cout << "Connect your GNSS-consuming application to the named pipe: "
+                      << pipe_path_ << std::endl;
+        }
+        if (force_pty_) {
+            setupPTY();
+            if (shutdown_event_.load())
+                return;
+        }
+        writer_thread_ = std::thread(&PtyHandler::writerForked, this);
+        if (writer_thread_.joinable()) {
+            writer_thread_.join();
+        }
+        cleanup();
+        return;
+    }
+
+    if (file_path_.empty() && sink_count > 1) {
+        if (!pipe_path_.empty()) {
+            setupNamedPipe();
+            if (shutdown_event_.load())
+                return;
+            std::cout << "Connect your GNSS-consuming application to the named pipe: "
+                      << pipe_path_ << std::endl;
+        }
+        if (force_pty_) {
+            setupPTY();
+            if (shutdown_event_.load())
+                return;
+        }
+        if (!serial_port_.empty()) {
+            std::cout << "Using serial port: " << serial_port_ << std::endl;
+        }
+        writer_thread_ = std::thread(&PtyHandler::writerMulti, this);
+        applyThreadTuning(writer_thread_.native_handle(), cpu_affinity_, rt_priority_,
+                          "writer thread");
+        if (writer_thread_.joinable()) {
+            writer_thread_.join();
+        }
+        cleanup();
+        return;
+    }
+
+    if (cycle_callback_) {
+        writer_thread_ = std::thread(&PtyHandler::writerCallback, this);
+    } else if (!serial_port_.empty()) {
         std::cout << "Using serial port: " << serial_port_ << std::endl;
         writer_thread_ = std::thread(&PtyHandler::writerSerial, this);
+    } else if (!udp_host_.empty()) {
+        std::cout << "Sending to UDP destination: " << udp_host_ << ":" << udp_port_;
+        if (!udp_extra_.empty()) {
+            std::cout << " (+" << udp_extra_.size() << " more via sendmmsg)";
+        }
+        std::cout << std::endl;
+        writer_thread_ = std::thread(&PtyHandler::writerUdp, this);
+    } else if (tcp_port_ != 0) {
+        std::cout << "Listening for TCP consumers on "
+                  << (tcp_host_.empty() ? "*" : tcp_host_) << ":" << tcp_port_ << std::endl;
+        writer_thread_ = std::thread(&PtyHandler::writerTcp, this);
+    } else if (!unix_path_.empty()) {
+        std::cout << "Listening for unix-socket consumers on " << unix_path_ << std::endl;
+        writer_thread_ = std::thread(&PtyHandler::writerUnix, this);
+    } else if (!shm_name_.empty()) {
+        std::cout << "Publishing cycles to shared-memory ring: " << shm_name_ << std::endl;
+        writer_thread_ = std::thread(&PtyHandler::writerShm, this);
+    } else if (!mmap_out_path_.empty()) {
+        std::cout << "Writing cycles to memory-mapped ring file: " << mmap_out_path_
+                  << std::endl;
+        writer_thread_ = std::thread(&PtyHandler::writerMmap, this);
     } else if (!pipe_path_.empty()) {
         setupNamedPipe();
         if (shutdown_event_.load())
@@ -80,9 +351,14 @@ void PtyHandler::start()
         if (shutdown_event_.load())
             return; // Exit if setup failed
         // The setupPTY now already prints the symlink path
+        if (selftest_) {
+            selftest_thread_ = std::thread(&PtyHandler::selfTestLoop, this);
+        }
         writer_thread_ = std::thread(&PtyHandler::writerPTY, this);
     }
 
+    applyThreadTuning(writer_thread_.native_handle(), cpu_affinity_, rt_priority_,
+                      "writer thread");
     if (writer_thread_.joinable()) {
         writer_thread_.join();
     }
@@ -96,7 +372,7 @@ void PtyHandler::setupNamedPipe()
     if (access(pipe_path_.c_str(), F_OK) == -1) {
         if (mkfifo(pipe_path_.c_str(), 0666) != 0) {
             std::cerr << "Failed to create named pipe: " << pipe_path_ << std::endl;
-            shutdown_event_.store(true);
+            requestShutdown();
             return;
         }
         std::cout << "Named pipe created at: " << pipe_path_ << std::endl;
@@ -104,422 +380,4673 @@ void PtyHandler::setupNamedPipe()
         struct stat stat_buf;
         if (stat(pipe_path_.c_str(), &stat_buf) != 0 || !S_ISFIFO(stat_buf.st_mode)) {
             std::cerr << "Path exists and is not a FIFO: " << pipe_path_.c_str() << std::endl;
-            shutdown_event_.store(true);
+            requestShutdown();
             return;
         }
         std::cout << "Using existing named pipe: " << pipe_path_.c_str() << std::endl;
     }
+    StartupReport::mark(StartupReport::Setup);
 }
 
-// Setup PTY
-void PtyHandler::setupPTY()
+// Grow the kernel FIFO on a freshly attached fd (--pipe-buffer). The
+// capacity belongs to the pipe object, not the path, so it has to be
+// reapplied at every attach. Requests above /proc/sys/fs/pipe-max-size
+// fail for unprivileged processes; the achieved size is reported so a
+// silently capped grant is visible in the run log.
+void PtyHandler::applyPipeBuffer(int fd)
+{
+    // Every pipe attach funnels through here, so this is also where
+    // the backlog sampler learns the live FIFO descriptor
+    pipe_probe_fd_.store(fd, std::memory_order_relaxed);
+    if (pipe_buffer_bytes_ == 0 || fd == -1) {
+        return;
+    }
+    if (fcntl(fd, F_SETPIPE_SZ, static_cast<int>(pipe_buffer_bytes_)) == -1) {
+        std::cerr << "Failed to set pipe buffer to " << pipe_buffer_bytes_
+                  << " bytes: " << strerror(errno) << std::endl;
+    }
+    int got = fcntl(fd, F_GETPIPE_SZ);
+    if (got != -1) {
+        std::cout << "Pipe buffer: " << got << " bytes (requested "
+                  << pipe_buffer_bytes_ << ")" << std::endl;
+    }
+}
+
+// Open one PTY master configured the way every sink in this process
+// expects it: non-blocking master, slave termios per --baud and
+// --tty-profile, slave fd closed after configuration. Returns the
+// master fd, or -1 with the error already reported. Shared by the
+// single-device setupPTY path and the --count fleet.
+int PtyHandler::openPtyMaster(std::string& slave_name)
 {
-    char slave_name_buffer[256];
     struct termios tty;
-    int slave_fd = -1; // Variable to store slave file descriptor
+    bool have_template = false;
+    return openPtyMasterTpl(slave_name, tty, have_template);
+}
+
+// Template-aware variant behind openPtyMaster, used directly by the
+// fleet pool: the first call reads the slave's attributes and
+// configures them, later calls apply the finished template verbatim
+// and skip the tcgetattr ioctl. Fresh devpts slaves all start with
+// identical default attributes, so the template is exact.
+int PtyHandler::openPtyMasterTpl(std::string& slave_name, struct termios& tty,
+                                 bool& have_template)
+{
+    char slave_name_buffer[256];
+    int master_fd = -1;
+    int slave_fd  = -1;
 
-    // Create PTY master and slave
-    if (openpty(&master_fd_, &slave_fd, slave_name_buffer, nullptr, nullptr) == -1) {
+    if (openpty(&master_fd, &slave_fd, slave_name_buffer, nullptr, nullptr) == -1) {
         std::cerr << "Failed to create virtual serial port: " << strerror(errno) << std::endl;
-        shutdown_event_.store(true);
-        return;
+        return -1;
     }
 
-    slave_name_ = slave_name_buffer;
-    std::cout << "Virtual serial port created at: " << slave_name_ << std::endl;
+    slave_name = slave_name_buffer;
 
-    // Configure the slave PTY as a serial port
-    if (tcgetattr(slave_fd, &tty) == -1) {
-        std::cerr << "Failed to get terminal attributes: " << strerror(errno) << std::endl;
-        close(slave_fd);
-        shutdown_event_.store(true);
-        return;
+    // Non-blocking master: a consumer that stops reading fills the PTY
+    // buffer and would otherwise freeze the writer in write(); with
+    // O_NONBLOCK the writer sees EAGAIN and applies the configured
+    // backpressure policy instead
+    int flags = fcntl(master_fd, F_GETFL, 0);
+    if (flags == -1 || fcntl(master_fd, F_SETFL, flags | O_NONBLOCK) == -1) {
+        std::cerr << "Failed to set PTY non-blocking: " << strerror(errno) << std::endl;
     }
 
-    // Configure serial port settings (example: 9600 baud, 8N1)
-    cfsetispeed(&tty, B9600);
-    cfsetospeed(&tty, B9600);
+    if (!have_template) {
+        // Configure the slave PTY as a serial port
+        if (tcgetattr(slave_fd, &tty) == -1) {
+            std::cerr << "Failed to get terminal attributes: " << strerror(errno) << std::endl;
+            close(slave_fd);
+            close(master_fd);
+            return -1;
+        }
+
+        // Configure serial port settings (default: 9600 baud, 8N1). The
+        // advertised speed must keep up with the pushed byte rate or
+        // speed-honoring consumers throttle themselves (--baud).
+        cfsetispeed(&tty, line_speed_);
+        cfsetospeed(&tty, line_speed_);
 
-    tty.c_cflag &= ~PARENB; // No parity
-    tty.c_cflag &= ~CSTOPB; // 1 stop bit
-    tty.c_cflag &= ~CSIZE;
-    tty.c_cflag |= CS8; // 8 data bits
-    tty.c_cflag &= ~CRTSCTS; // No hardware flow control
-    tty.c_cflag |= CREAD | CLOCAL; // Enable receiver, ignore modem control lines
+        if (raw_profile_) {
+            cfmakeraw(&tty); // No input translation at all (--tty-profile raw)
+            tty.c_cflag |= CREAD | CLOCAL;
+        } else {
+            tty.c_cflag &= ~PARENB; // No parity
+            tty.c_cflag &= ~CSTOPB; // 1 stop bit
+            tty.c_cflag &= ~CSIZE;
+            tty.c_cflag |= CS8; // 8 data bits
+            tty.c_cflag &= ~CRTSCTS; // No hardware flow control
+            tty.c_cflag |= CREAD | CLOCAL; // Enable receiver, ignore modem control lines
 
-    tty.c_lflag &= ~(ICANON | ECHO | ECHOE | ISIG); // Raw input
-    tty.c_iflag &= ~(IXON | IXOFF | IXANY); // No software flow control
-    tty.c_oflag &= ~OPOST; // Raw output
+            tty.c_lflag &= ~(ICANON | ECHO | ECHOE | ISIG); // Raw input
+            tty.c_iflag &= ~(IXON | IXOFF | IXANY); // No software flow control
+            tty.c_oflag &= ~OPOST; // Raw output
+        }
+        have_template = true;
+    }
 
     if (tcsetattr(slave_fd, TCSANOW, &tty) == -1) {
         std::cerr << "Failed to set terminal attributes: " << strerror(errno) << std::endl;
         close(slave_fd);
-        shutdown_event_.store(true);
-        return;
+        close(master_fd);
+        return -1;
     }
 
     close(slave_fd); // Configuration done
+    return master_fd;
+}
 
-    // Create a symbolic link for the slave PTY
-    // Remove existing symlink if it exists
-    if (!symlink_path_.empty()) {
-        if (unlink(symlink_path_.c_str()) != 0 && errno != ENOENT) {
-            std::cerr << "Warning: Failed to remove existing symbolic link: "
-                      << symlink_path_ << " (" << strerror(errno) << ")" << std::endl;
-        }
+namespace {
+
+// One unlink-and-relink attempt; announces success. Failures are the
+// caller's to handle (first attempt and background retries report
+// differently).
+bool attemptSymlink(const std::string& target, const std::string& link)
+{
+    if (unlink(link.c_str()) != 0 && errno != ENOENT) {
+        std::cerr << "Warning: Failed to remove existing symbolic link: "
+                  << link << " (" << strerror(errno) << ")" << std::endl;
+    }
+    if (symlink(target.c_str(), link.c_str()) == 0) {
+        std::cout << "Symbolic link created at: " << link << std::endl;
+        return true;
     }
+    return false;
+}
 
-    // Attempt to create the symlink with retries
-    int retries = 3;
-    while (retries > 0) {
-        if (symlink(slave_name_.c_str(), symlink_path_.c_str()) == 0) {
-            std::cout << "Symbolic link created at: " << symlink_path_ << std::endl;
-            break;
-        } else {
-            std::cerr << "Failed to create symbolic link: " << symlink_path_
-                      << " (" << strerror(errno) << ")" << std::endl;
-            retries--;
-            if (retries > 0) {
-                std::cerr << "Retrying in 1 second..." << std::endl;
-                std::this_thread::sleep_for(std::chrono::seconds(1));
-            } else {
-                std::cerr << "Exceeded maximum retries. Continuing without symlink." << std::endl;
-                break;
-            }
-        }
+} // namespace
+
+// Setup PTY
+void PtyHandler::setupPTY()
+{
+    master_fd_ = openPtyMaster(slave_name_);
+    if (master_fd_ == -1) {
+        requestShutdown();
+        return;
     }
+    std::cout << "Virtual serial port created at: " << slave_name_ << std::endl;
+    StartupReport::mark(StartupReport::Setup);
+
+    // One synchronous symlink attempt — the common case succeeds
+    // instantly — then any retrying moves off the start path, so
+    // time-to-first-sentence is governed by the PTY, not /tmp hygiene
+    if (!attemptSymlink(slave_name_, symlink_path_)) {
+        std::cerr << "Failed to create symbolic link: " << symlink_path_
+                  << " (" << strerror(errno) << "); retrying in the background" << std::endl;
+        startSymlinkReconciler({ { slave_name_, symlink_path_ } });
+    }
+    // The symlink phase is off the start path from here even when the
+    // reconciler is still retrying
+    StartupReport::mark(StartupReport::Symlink);
 
     // Inform the user about the symlink
     std::cout << "Connect your GNSS-consuming application to the virtual serial port: "
               << symlink_path_ << std::endl;
 }
 
-// Helper function to check if a line is an RMC sentence
-bool isRmcSentence(const std::string& line)
+// Background retry loop for symlinks that failed their first attempt.
+// The old in-line retry blocked generation for up to 3 seconds; here
+// the same three spaced attempts run concurrently with emission, in
+// 100 ms slices so shutdown stays responsive.
+void PtyHandler::startSymlinkReconciler(std::vector<std::pair<std::string, std::string>> pending)
 {
-    // Trim leading spaces
-    size_t start = line.find_first_not_of(" \t\r\n");
-    if (start == std::string::npos)
-        return false;
-
-    // Check if line starts with "$GPRMC" or "$GNRMC" or "$GLRMC" etc.
-    return (line.compare(start, 6, "$GPRMC") == 0 || line.compare(start, 6, "$GNRMC") == 0 || line.compare(start, 6, "$GLRMC") == 0 || line.compare(start, 6, "$GRRMC") == 0 || line.compare(start, 6, "$GGRMC") == 0);
+    symlink_thread_ = std::thread([this, pending = std::move(pending)]() mutable {
+        for (int attempt = 0; attempt < 3 && !pending.empty(); ++attempt) {
+            for (int slice = 0; slice < 10 && !shutdown_event_.load(); ++slice) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+            if (shutdown_event_.load()) {
+                return;
+            }
+            pending.erase(std::remove_if(pending.begin(), pending.end(),
+                                         [](const auto& p) {
+                                             return attemptSymlink(p.first, p.second);
+                                         }),
+                          pending.end());
+        }
+        for (const auto& p : pending) {
+            std::cerr << "Exceeded maximum retries for symbolic link " << p.second
+                      << ". Continuing without it." << std::endl;
+        }
+    });
 }
 
-// Writer to named pipe
-void PtyHandler::writerPipe()
-{
-    if (!file_path_.empty()) {
-        // Mode: Read from file with cycle consideration
-        std::ifstream infile(file_path_);
-        if (!infile.is_open()) {
-            std::cerr << "Error opening NMEA log file: " << file_path_ << std::endl;
-            shutdown_event_.store(true);
-            return;
+namespace {
+
+// Deadline offsets for --jitter, in seconds, drawn once at startup
+// from a seeded distribution; every scheduler reads slot cycle % size.
+// File scope like shutdown_wake_fd so the schedulers below see it
+// without plumbing: filled before the writer threads start and
+// read-only afterwards, so no synchronization is needed. Empty when
+// --jitter is off.
+std::vector<double> jitter_offsets;
+
+// Epoch of the first writer scheduler, published for the 1PPS thread
+// (--pps): pulses scheduled against the same epoch sit on the same
+// absolute-deadline grid as the sentences, so pulse-to-sentence
+// alignment is bounded by timer accuracy instead of two independent
+// clocks' start offsets. -1 until a scheduler exists. File scope like
+// jitter_offsets: written once as pacing starts, read-only after.
+std::atomic<long long> scheduler_epoch_ns { -1 };
+
+// Absolute-deadline cycle pacing, shared by all three writer loops.
+// Sleeping for the interval after the work lets generation and write
+// time accumulate as drift (~4% cycle-rate error at 10 Hz); instead
+// each cycle sleeps until N x interval from a fixed epoch, so the
+// long-run rate matches the requested interval exactly. A cycle that
+// misses its slot is counted as an overrun and the schedule skips to
+// the next future deadline rather than bunching catch-up cycles.
+class CycleScheduler {
+public:
+    explicit CycleScheduler(double interval_seconds)
+        : interval_(interval_seconds)
+        , epoch_(std::chrono::steady_clock::now())
+    {
+        // First scheduler in wins: that is the writer thread's, and
+        // its grid is the one the pulses must track
+        long long expected = -1;
+        scheduler_epoch_ns.compare_exchange_strong(
+            expected, static_cast<long long>(epoch_.time_since_epoch().count()));
+    }
+
+    void waitNextCycle()
+    {
+        ++cycle_;
+        auto deadline = deadlineFor(cycle_) + jitterFor(cycle_);
+        auto now      = std::chrono::steady_clock::now();
+        if (now > deadline) {
+            double elapsed = std::chrono::duration<double>(now - epoch_).count();
+            uint64_t next  = static_cast<uint64_t>(elapsed / interval_) + 1;
+            overruns_ += next - cycle_;
+            cycle_   = next;
+            deadline = deadlineFor(cycle_) + jitterFor(cycle_);
         }
-        std::string line;
-        std::vector<std::string> cycle_buffer;
+        waitUntil(deadline, now, interval_);
+    }
 
-        while (!shutdown_event_.load()) {
-            while (std::getline(infile, line)) {
-                if (shutdown_event_.load())
-                    break;
-                if (line.empty())
-                    continue;
+    // Variable-delta variant for timestamp-faithful replay: advance the
+    // absolute schedule by delta seconds instead of the fixed interval.
+    // Deltas accumulate against the same epoch, so the log's timing is
+    // honored long-run even when individual sleeps wake late. A missed
+    // deadline resets the schedule to now rather than bunching
+    // catch-up cycles.
+    void waitDelta(double delta_seconds)
+    {
+        offset_ += delta_seconds;
+        auto deadline = epoch_
+            + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(offset_));
+        auto now = std::chrono::steady_clock::now();
+        if (now > deadline) {
+            ++overruns_;
+            offset_  = std::chrono::duration<double>(now - epoch_).count();
+            deadline = now;
+        }
+        waitUntil(deadline, now, delta_seconds);
+    }
 
-                // Check if the line is an RMC sentence
-                if (isRmcSentence(line)) {
-                    // If buffer has data, send it as one cycle
-                    if (!cycle_buffer.empty()) {
-                        // Open the pipe in append mode
-                        std::ofstream pipe(pipe_path_, std::ios::app);
-                        if (!pipe.is_open()) {
-                            std::cerr << "Error opening pipe: " << pipe_path_ << std::endl;
-                            shutdown_event_.store(true);
-                            break;
-                        }
+    // Retime the schedule mid-run (--scenario rate changes): future
+    // deadlines continue from the current cycle's slot at the new
+    // pitch, so a rate change neither bunches cycles nor leaves a gap
+    void setInterval(double interval_seconds)
+    {
+        epoch_    = deadlineFor(cycle_);
+        cycle_    = 0;
+        interval_ = interval_seconds;
+    }
 
-                        // Send all sentences in the buffer
-                        for (const auto& sentence : cycle_buffer) {
-                            pipe << sentence << "\r\n";
-                        }
-                        pipe.flush();
-                        std::cout << "Sent to pipe (Cycle):\n";
-                        for (const auto& sentence : cycle_buffer) {
-                            std::cout << sentence << "\n";
-                        }
+    // Cycles that missed their deadline since construction
+    uint64_t overruns() const { return overruns_; }
 
-                        // Clear the buffer for the next cycle
-                        cycle_buffer.clear();
+    // Deadline of the cycle currently being emitted; emission time
+    // minus this is the cycle's deadline error. Includes the injected
+    // --jitter offset: the histograms measure adherence to the target
+    // actually aimed at, not the unjittered grid, so deliberate jitter
+    // does not read as scheduler error.
+    std::chrono::steady_clock::time_point currentDeadline() const
+    {
+        return deadlineFor(cycle_) + jitterFor(cycle_);
+    }
 
-                        // Sleep for the specified interval
-                        std::this_thread::sleep_for(std::chrono::duration<double>(interval_));
-                    }
+    // Deadline of the cycle after the one being emitted — the instant
+    // by which this cycle's generate + write must finish for the
+    // schedule to hold. The watchdog compares against this, not
+    // currentDeadline(): work always runs after the wake instant, so
+    // the current slot's deadline is in the past on every healthy
+    // cycle.
+    std::chrono::steady_clock::time_point nextDeadline() const
+    {
+        return deadlineFor(cycle_ + 1) + jitterFor(cycle_ + 1);
+    }
 
-                    // Start a new cycle buffer with the current RMC sentence
-                    cycle_buffer.push_back(line);
-                } else {
-                    // Add non-RMC sentences to the current cycle buffer
-                    cycle_buffer.push_back(line);
-                }
-            }
+private:
+    // Below this interval the hybrid sleep/spin waiter takes over
+    static constexpr double kSpinThreshold = 0.002;
+    // How far ahead of the deadline the coarse sleep aims
+    static constexpr std::chrono::microseconds kSpinWindow { 200 };
+
+    std::chrono::steady_clock::time_point deadlineFor(uint64_t cycle) const
+    {
+        return epoch_
+            + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(cycle * interval_));
+    }
 
-            // After reaching EOF, reset to the beginning for continuous simulation
-            infile.clear(); // Clear EOF flag
-            infile.seekg(0, std::ios::beg);
+    // Injected --jitter offset for this cycle; zero when jitter is off.
+    // Kept out of deadlineFor so setInterval's epoch rebase stays on
+    // the unjittered grid — one cycle's random offset must not become
+    // a permanent schedule shift across a rate change.
+    static std::chrono::steady_clock::duration jitterFor(uint64_t cycle)
+    {
+        if (jitter_offsets.empty()) {
+            return std::chrono::steady_clock::duration::zero();
         }
-        infile.close();
+        return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(jitter_offsets[cycle % jitter_offsets.size()]));
+    }
 
-        // Send any remaining data in the buffer upon shutdown
-        if (!cycle_buffer.empty()) {
-            std::ofstream pipe(pipe_path_, std::ios::app);
-            if (pipe.is_open()) {
-                for (const auto& sentence : cycle_buffer) {
-                    pipe << sentence << "\r\n";
-                }
-                pipe.flush();
-                std::cout << "Sent to pipe (Final Cycle):\n";
-                for (const auto& sentence : cycle_buffer) {
-                    std::cout << sentence << "\n";
-                }
+    // Hybrid wait shared by both pacing modes. Sub-millisecond spans
+    // sleep coarsely to just short of the deadline and spin the
+    // remainder on the monotonic clock — scheduler wake-up latency
+    // alone is hundreds of microseconds. Relaxed spans sleep fully.
+    static void waitUntil(std::chrono::steady_clock::time_point deadline,
+                          std::chrono::steady_clock::time_point now,
+                          double span_seconds)
+    {
+        if (span_seconds < kSpinThreshold) {
+            auto coarse = deadline - kSpinWindow;
+            if (coarse > now) {
+                std::this_thread::sleep_until(coarse);
             }
-        }
-    } else {
-        // Mode: Generate data
-        while (!shutdown_event_.load()) {
-            std::ofstream pipe(pipe_path_);
-            if (!pipe.is_open()) {
-                std::cerr << "Error opening pipe: " << pipe_path_ << std::endl;
-                break;
+            while (std::chrono::steady_clock::now() < deadline) {
+#if defined(__x86_64__) || defined(__i386__)
+                __builtin_ia32_pause();
+#endif
             }
-            while (!shutdown_event_.load()) {
-                std::string sentences = generator_->generateAllSentences();
-                pipe << sentences;
-                pipe.flush();
-                std::cout << "Sent to pipe:\n"
-                          << sentences;
-                std::this_thread::sleep_for(std::chrono::duration<double>(interval_));
+        } else if (shutdown_wake_fd != -1) {
+            // Interruptible wait: poll the shutdown eventfd up to the
+            // deadline, so SIGINT cuts even a --interval 30 sleep short
+            // at poll latency. The sub-millisecond tail still uses
+            // sleep_until so pacing accuracy is unchanged.
+            for (;;) {
+                now = std::chrono::steady_clock::now();
+                if (now >= deadline) {
+                    break;
+                }
+                int timeout_ms = static_cast<int>(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now)
+                        .count());
+                if (timeout_ms <= 0) {
+                    std::this_thread::sleep_until(deadline);
+                    break;
+                }
+                struct pollfd pfd = { shutdown_wake_fd, POLLIN, 0 };
+                if (poll(&pfd, 1, timeout_ms) > 0) {
+                    return; // shutdown requested; caller re-checks the flag
+                }
             }
+        } else {
+            std::this_thread::sleep_until(deadline);
         }
     }
-    std::cout << "Pipe writer thread exiting." << std::endl;
-}
-
-// Writer to serial port
-void PtyHandler::writerSerial()
-{
-    if (!file_path_.empty()) {
-        // Mode: Read from file with cycle consideration
-        std::ifstream infile(file_path_);
-        if (!infile.is_open()) {
-            std::cerr << "Error opening NMEA log file: " << file_path_ << std::endl;
-            shutdown_event_.store(true);
-            return;
-        }
-        std::string line;
-        std::vector<std::string> cycle_buffer;
 
-        while (!shutdown_event_.load()) {
-            while (std::getline(infile, line)) {
-                if (shutdown_event_.load())
-                    break;
-                if (line.empty())
-                    continue;
+    double interval_;
+    std::chrono::steady_clock::time_point epoch_;
+    uint64_t cycle_    = 0;
+    uint64_t overruns_ = 0;
 
-                // Check if the line is an RMC sentence
-                if (isRmcSentence(line)) {
-                    // If buffer has data, send it as one cycle
-                    if (!cycle_buffer.empty()) {
-                        int fd = open(serial_port_.c_str(), O_WRONLY | O_NOCTTY);
-                        if (fd == -1) {
-                            std::cerr << "Error opening serial port: " << serial_port_ << std::endl;
-                            shutdown_event_.store(true);
-                            break;
-                        }
+    // Accumulated schedule offset used by the variable-delta waiter
+    double offset_ = 0.0;
+};
 
-                        // Send all sentences in the buffer
-                        for (const auto& sentence : cycle_buffer) {
-                            std::string full_sentence = sentence + "\r\n";
-                            ssize_t bytes_written     = write(fd, full_sentence.c_str(), full_sentence.size());
-                            if (bytes_written == -1) {
-                                std::cerr << "Error writing to serial port: " << serial_port_ << std::endl;
-                                close(fd);
-                                shutdown_event_.store(true);
-                                break;
-                            }
-                        }
-                        fsync(fd);
-                        std::cout << "Sent to serial port (Cycle):\n";
-                        for (const auto& sentence : cycle_buffer) {
-                            std::cout << sentence << "\n";
-                        }
+// Runtime reconfiguration (--control): the control thread parses each
+// command into one of these and publishes it with an atomic pointer
+// swap; the writer exchanges it out at its next cycle boundary, so the
+// hot loop pays one pointer load per cycle when nothing is pending and
+// never takes a lock. Sentinels mean "leave unchanged", mirroring
+// ScenarioEvent. File scope like shutdown_wake_fd, so the shared
+// cycle-boundary hook below reaches it without plumbing.
+struct ControlUpdate {
+    double interval = 0.0; // new cycle interval; 0 = unchanged
+    double speed    = NAN; // knots; NaN = unchanged
+    double course   = NAN; // degrees; NaN = unchanged
+    int sats        = -1; // satellite target; -1 = unchanged
+    int fix         = -2; // forced fix quality; -2 = unchanged
+    double hdop     = NAN; // forced HDOP; NaN = unchanged
+    unsigned mask   = 0; // sentence mask; 0 = unchanged
+};
 
-                        close(fd);
+std::atomic<ControlUpdate*> pending_control { nullptr };
 
-                        // Clear the buffer for the next cycle
-                        cycle_buffer.clear();
+// Generator-side subset of a ControlUpdate; the interval is scheduler
+// state and applied by callers that own one
+void applyControlToGenerator(const ControlUpdate& update, NmeaGenerator* generator)
+{
+    generator->adjustMotion(update.speed, update.course);
+    if (update.sats >= 0) {
+        generator->setSatelliteTarget(static_cast<unsigned>(update.sats));
+    }
+    if (update.fix >= -1) {
+        generator->setFixQuality(update.fix);
+    }
+    if (!std::isnan(update.hdop)) {
+        generator->setForcedHdop(update.hdop);
+    }
+    if (update.mask != 0) {
+        generator->setSentenceMask(update.mask);
+    }
+}
 
-                        // Sleep for the specified interval
-                        std::this_thread::sleep_for(std::chrono::duration<double>(interval_));
-                    }
+// Parse one "name value" command line into update, appending the
+// per-command acknowledgement to reply. Shared by the --control
+// responder and the fleet lease server; the latter disallows interval,
+// which is fleet-wide state a single device cannot change.
+void parseControlCommand(const char* line, ControlUpdate& update, std::string& reply,
+                         bool allow_interval)
+{
+    char name[32];
+    char value[64];
+    if (sscanf(line, "%31s %63s", name, value) != 2) {
+        reply += "error: expected <command> <value>\n";
+        return;
+    }
+    std::string cmd(name);
+    bool ok = true;
+    if (cmd == "interval") {
+        if (!allow_interval) {
+            reply += "error: interval is fleet-wide; set it at daemon start\n";
+            return;
+        }
+        update.interval = atof(value);
+        ok              = update.interval > 0;
+    } else if (cmd == "speed") {
+        update.speed = atof(value);
+    } else if (cmd == "course") {
+        update.course = atof(value);
+    } else if (cmd == "sats") {
+        update.sats = atoi(value);
+        ok          = update.sats > 0;
+    } else if (cmd == "fix") {
+        update.fix = atoi(value);
+        ok         = update.fix >= -1;
+    } else if (cmd == "hdop") {
+        update.hdop = atof(value);
+    } else if (cmd == "sentences") {
+        update.mask = NmeaGenerator::sentenceMaskFromList(value);
+        ok          = update.mask != 0;
+    } else {
+        reply += "error: unknown command " + cmd + "\n";
+        return;
+    }
+    reply += ok ? "ok\n" : "error: bad value for " + cmd + "\n";
+}
 
-                    // Start a new cycle buffer with the current RMC sentence
-                    cycle_buffer.push_back(line);
-                } else {
-                    // Add non-RMC sentences to the current cycle buffer
-                    cycle_buffer.push_back(line);
-                }
+// Apply --scenario phase changes that have come due, at a cycle
+// boundary so the generator is quiescent. The no-event case is one
+// bound check inside due(); a drained plan costs the same.
+void applyScenario(ScenarioPlan& plan, NmeaGenerator* generator, CycleScheduler& scheduler)
+{
+    // Runtime commands (--control) ride the same cycle-boundary hook
+    // the scenario timeline uses; when none is pending the whole cost
+    // is this one load
+    if (pending_control.load(std::memory_order_acquire) != nullptr) {
+        ControlUpdate* update = pending_control.exchange(nullptr, std::memory_order_acq_rel);
+        if (update != nullptr) {
+            applyControlToGenerator(*update, generator);
+            if (update->interval > 0) {
+                scheduler.setInterval(update->interval);
+                generator->setCycleSeconds(update->interval);
             }
+            delete update;
+        }
+    }
 
-            // After reaching EOF, reset to the beginning for continuous simulation
-            infile.clear(); // Clear EOF flag
-            infile.seekg(0, std::ios::beg);
+    while (const ScenarioEvent* event = plan.due()) {
+        generator->adjustMotion(event->speed, event->course);
+        if (event->sats >= 0) {
+            generator->setSatelliteTarget(static_cast<unsigned>(event->sats));
+        }
+        if (event->interval > 0) {
+            scheduler.setInterval(event->interval);
+            generator->setCycleSeconds(event->interval);
+        }
+        if (event->fix >= -1) {
+            generator->setFixQuality(event->fix);
+        }
+        if (!std::isnan(event->hdop)) {
+            generator->setForcedHdop(event->hdop);
+        }
+        if (event->dropout >= 0) {
+            generator->dropConstellation(event->dropout);
         }
-        infile.close();
+    }
+}
 
-        // Send any remaining data in the buffer upon shutdown
-        if (!cycle_buffer.empty()) {
-            int fd = open(serial_port_.c_str(), O_WRONLY | O_NOCTTY);
-            if (fd != -1) {
-                for (const auto& sentence : cycle_buffer) {
-                    std::string full_sentence = sentence + "\r\n";
-                    ssize_t bytes_written     = write(fd, full_sentence.c_str(), full_sentence.size());
-                    if (bytes_written == -1) {
-                        std::cerr << "Error writing to serial port: " << serial_port_ << std::endl;
-                        break;
-                    }
-                }
-                fsync(fd);
-                std::cout << "Sent to serial port (Final Cycle):\n";
-                for (const auto& sentence : cycle_buffer) {
-                    std::cout << sentence << "\n";
-                }
-                close(fd);
-            }
+// Adaptive rate stepping (--adaptive-rate): consumers that slow down
+// legitimately — battery rigs under thermal throttling — turn a fixed
+// cycle rate into either a stalled writer or a flooded reader, and
+// both invalidate the test. Once per window the controller sums the
+// sink backpressure counters (drops, EAGAIN retries, stalls); any
+// pressure in the window steps the cycle pitch down one configured
+// level, and a run of clean windows steps it back up, so degradation
+// is a deliberate, observable rate change instead of random loss.
+// Each transition prints one [stats] line. The per-cycle cost with
+// the controller idle is one clock read and a bound check.
+class RateController {
+public:
+    RateController(const std::vector<unsigned>& levels, double base_interval,
+                   const SinkCounters* counters)
+        : levels_(levels)
+        , base_(base_interval)
+        , counters_(counters)
+        , next_check_(std::chrono::steady_clock::now() + kWindow)
+    {
+    }
+
+    void cycle(CycleScheduler& scheduler, NmeaGenerator* generator)
+    {
+        if (levels_.empty() || base_ <= 0) {
+            return;
         }
-    } else {
-        // Mode: Generate data
-        int fd = open(serial_port_.c_str(), O_WRONLY | O_NOCTTY);
-        if (fd == -1) {
-            std::cerr << "Error opening serial port: " << serial_port_ << std::endl;
+        auto now = std::chrono::steady_clock::now();
+        if (now < next_check_) {
             return;
         }
+        next_check_ = now + kWindow;
 
-        while (!shutdown_event_.load()) {
-            std::string sentences = generator_->generateAllSentences();
-            ssize_t bytes_written = write(fd, sentences.c_str(), sentences.size());
-            if (bytes_written == -1) {
-                std::cerr << "Error writing to serial port: " << serial_port_ << std::endl;
-                break;
-            }
-            fsync(fd);
-            std::cout << "Sent to serial port:\n"
-                      << sentences;
-            std::this_thread::sleep_for(std::chrono::duration<double>(interval_));
+        uint64_t total = 0;
+        for (size_t s = 0; s < static_cast<size_t>(PtyHandler::SinkId::Count); ++s) {
+            const SinkCounters& c = counters_[s];
+            total += c.dropped.load(std::memory_order_relaxed)
+                + c.retries.load(std::memory_order_relaxed)
+                + c.stalls.load(std::memory_order_relaxed);
         }
-        close(fd);
-        std::cout << "Serial port writer thread exiting." << std::endl;
-    }
-}
+        uint64_t delta = total - last_total_;
+        last_total_    = total;
 
-// Writer to PTY
-void PtyHandler::writerPTY()
-{
-    if (!file_path_.empty()) {
-        // Mode: Read from file with cycle consideration
-        std::ifstream infile(file_path_);
-        if (!infile.is_open()) {
-            std::cerr << "Error opening NMEA log file: " << file_path_ << std::endl;
-            shutdown_event_.store(true);
+        size_t level = level_;
+        if (delta > 0) {
+            calm_ = 0;
+            if (level + 1 < levels_.size()) {
+                ++level;
+            }
+        } else if (level > 0 && ++calm_ >= kCalmWindows) {
+            calm_ = 0;
+            --level;
+        }
+        if (level == level_) {
             return;
         }
-        std::string line;
-        std::vector<std::string> cycle_buffer;
+        bool down       = level > level_;
+        level_          = level;
+        double interval = base_ * levels_[level_];
+        scheduler.setInterval(interval);
+        generator->setCycleSeconds(interval);
+        std::cout << "[stats] adaptive rate " << (down ? "down" : "up") << " to level "
+                  << (level_ + 1) << "/" << levels_.size() << ": interval " << interval
+                  << " s" << (down ? " (backpressure)" : " (drained)") << std::endl;
+    }
 
-        while (!shutdown_event_.load()) {
-            while (std::getline(infile, line)) {
-                if (shutdown_event_.load())
-                    break;
-                if (line.empty())
-                    continue;
+private:
+    // Pressure sampling period; windows shorter than a second chase
+    // single-write noise, longer ones flood for seconds before reacting
+    static constexpr std::chrono::seconds kWindow { 1 };
+    // Clean windows required before stepping the rate back up, so a
+    // consumer that is merely oscillating does not drag the rate with it
+    static constexpr unsigned kCalmWindows = 5;
 
-                // Check if the line is an RMC sentence
-                if (isRmcSentence(line)) {
-                    // If buffer has data, send it as one cycle
-                    if (!cycle_buffer.empty()) {
-                        // Send all sentences in the buffer
-                        for (const auto& sentence : cycle_buffer) {
-                            std::string full_sentence = sentence + "\r\n";
-                            ssize_t bytes_written     = write(master_fd_, full_sentence.c_str(), full_sentence.size());
-                            if (bytes_written == -1) {
-                                std::cerr << "Error writing to PTY" << std::endl;
-                                shutdown_event_.store(true);
-                                break;
-                            }
-                        }
-                        std::cout << "Sent to PTY (Cycle):\n";
-                        for (const auto& sentence : cycle_buffer) {
-                            std::cout << sentence << "\n";
-                        }
+    const std::vector<unsigned>& levels_;
+    double base_;
+    const SinkCounters* counters_;
+    std::chrono::steady_clock::time_point next_check_;
+    uint64_t last_total_ = 0;
+    size_t level_        = 0;
+    unsigned calm_       = 0;
+};
+
+// Log missed cycle deadlines once, as the writer thread winds down
+void reportOverruns(const char* writer, const CycleScheduler& scheduler)
+{
+    if (scheduler.overruns() > 0) {
+        std::cout << writer << " missed " << scheduler.overruns()
+                  << " cycle deadline(s)." << std::endl;
+    }
+}
 
-                        // Clear the buffer for the next cycle
-                        cycle_buffer.clear();
+// Emission timing instrumentation shared by the writer loops: one
+// steady_clock pair per cycle feeds two log-bucketed histograms —
+// how long the write itself took, and how far past its deadline the
+// cycle actually left the process. Both are dumped as one-line
+// percentile summaries on the shutdown path, so a SIGINT is all it
+// takes to read p99.9 emission jitter off a live rig.
+struct EmissionTiming {
+    LatencyHistogram deadline_error;
+    LatencyHistogram write_duration;
+    std::chrono::steady_clock::time_point cycle_start;
+    std::chrono::steady_clock::time_point t0;
+    std::chrono::steady_clock::time_point last_warn;
+    const char* writer      = "Writer";
+    // Optional p99 publication slot for the stats/metrics threads
+    std::atomic<int64_t>* p99_out = nullptr;
+    // SinkId ordinal stamped into flight-recorder slots
+    uint8_t sink            = 0;
+    uint64_t seq            = 0;
+    size_t bytes            = 0;
+    uint64_t gen_overruns   = 0;
+    uint64_t write_overruns = 0;
 
-                        // Sleep for the specified interval
-                        std::this_thread::sleep_for(std::chrono::duration<double>(interval_));
-                    }
+    // At most one watchdog warning per period; the counters keep the
+    // full tally for the shutdown report
+    static constexpr std::chrono::seconds kWarnPeriod { 1 };
 
-                    // Start a new cycle buffer with the current RMC sentence
-                    cycle_buffer.push_back(line);
-                } else {
-                    // Add non-RMC sentences to the current cycle buffer
-                    cycle_buffer.push_back(line);
-                }
-            }
+    void beginCycle() { cycle_start = std::chrono::steady_clock::now(); }
+
+    void beginWrite(size_t nbytes)
+    {
+        bytes = nbytes;
+        NMEA_TRACE_WRITE_START(seq, nbytes);
+        t0 = std::chrono::steady_clock::now();
+    }
 
-            // After reaching EOF, reset to the beginning for continuous simulation
-            infile.clear(); // Clear EOF flag
-            infile.seekg(0, std::ios::beg);
+    void endWrite(const CycleScheduler& scheduler)
+    {
+        auto t1 = std::chrono::steady_clock::now();
+        NMEA_TRACE_WRITE_END(seq, bytes);
+        auto deadline    = scheduler.currentDeadline();
+        int64_t write_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                               .count();
+        int64_t err_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - deadline)
+                             .count();
+        flightRecorder().record(sink, seq, err_ns, write_ns, bytes);
+        ++seq;
+        write_duration.record(write_ns);
+        deadline_error.record(err_ns);
+        if (p99_out != nullptr && (seq & 63) == 0) {
+            p99_out->store(write_duration.percentileBound(0.99), std::memory_order_relaxed);
         }
-        infile.close();
 
-        // Send any remaining data in the buffer upon shutdown
-        if (!cycle_buffer.empty()) {
-            for (const auto& sentence : cycle_buffer) {
-                std::string full_sentence = sentence + "\r\n";
-                ssize_t bytes_written     = write(master_fd_, full_sentence.c_str(), full_sentence.size());
-                if (bytes_written == -1) {
-                    std::cerr << "Error writing to PTY" << std::endl;
-                    break;
-                }
+        // Watchdog: the cycle's work was still in flight when the next
+        // slot came due — generate + write exceeded the interval, so
+        // the schedule cannot hold. The stage that was still running
+        // when the budget ran out gets the blame; t0 is the
+        // generate/write boundary.
+        auto budget = scheduler.nextDeadline();
+        if (t1 > budget) {
+            bool gen_blew = t0 > budget;
+            if (gen_blew) {
+                ++gen_overruns;
+            } else {
+                ++write_overruns;
             }
-            std::cout << "Sent to PTY (Final Cycle):\n";
-            for (const auto& sentence : cycle_buffer) {
-                std::cout << sentence << "\n";
+            if (t1 - last_warn >= kWarnPeriod) {
+                last_warn  = t1;
+                double gen_ms = std::chrono::duration<double, std::milli>(t0 - cycle_start)
+                                    .count();
+                double write_ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+                double late_ms = std::chrono::duration<double, std::milli>(t1 - budget)
+                                     .count();
+                char line[160];
+                snprintf(line, sizeof(line),
+                         "%s cycle %llu missed its deadline by %.2f ms in %s "
+                         "(generate %.2f ms, write %.2f ms)",
+                         writer, static_cast<unsigned long long>(seq - 1), late_ms,
+                         gen_blew ? "generate" : "write", gen_ms, write_ms);
+                std::cerr << line << std::endl;
             }
         }
-    } else {
-        // Mode: Generate data
-        while (!shutdown_event_.load()) {
-            std::string sentences = generator_->generateAllSentences();
-            ssize_t bytes_written = write(master_fd_, sentences.c_str(), sentences.size());
-            if (bytes_written == -1) {
-                std::cerr << "Error writing to PTY" << std::endl;
-                shutdown_event_.store(true);
-                break;
-            }
-            std::cout << "Sent to PTY:\n"
-                      << sentences;
-            std::this_thread::sleep_for(std::chrono::duration<double>(interval_));
+    }
+
+    void dump() const
+    {
+        std::string label = writer;
+        deadline_error.dump((label + " deadline error").c_str());
+        write_duration.dump((label + " write duration").c_str());
+        if (gen_overruns + write_overruns > 0) {
+            std::cout << label << " watchdog: " << gen_overruns + write_overruns
+                      << " cycle(s) emitted past their deadline (" << gen_overruns
+                      << " blown in generate, " << write_overruns << " in write)."
+                      << std::endl;
         }
     }
-    close(master_fd_);
-    std::cout << "PTY writer thread exiting." << std::endl;
-}
+};
+
+// Per-cycle compression for the network sinks (--compress): NMEA text
+// deflates well even cycle-by-cycle, and the links to remote lab hosts
+// are the one place the stream crosses constrained bandwidth. The
+// context is created once and reset per cycle, so steady state touches
+// no allocator; each frame is an independent deflate unit, which costs
+// a few header bytes per cycle but lets consumers attach mid-stream
+// and decode from the next frame. On byte-stream sinks the frame is
+// preceded by a 4-byte little-endian payload length; SEQPACKET
+// messages are self-framing and skip it. deflate rather than zstd on
+// purpose: zlib is the one compression dependency this tree carries
+// (gzip replay takes the same stance).
+class CycleDeflate {
+public:
+    CycleDeflate()
+    {
+        std::memset(&strm_, 0, sizeof(strm_));
+        ready_ = deflateInit(&strm_, Z_BEST_SPEED) == Z_OK;
+    }
+
+    ~CycleDeflate()
+    {
+        if (ready_) {
+            deflateEnd(&strm_);
+        }
+    }
+
+    bool ready() const { return ready_; }
+
+    // Compress one cycle into the reused output buffer; returns the
+    // frame (length header included when framed), or an empty view on
+    // deflate failure
+    std::string_view compress(const char* data, size_t len, bool framed)
+    {
+        size_t head  = framed ? 4 : 0;
+        size_t bound = deflateBound(&strm_, static_cast<uLong>(len));
+        if (buf_.size() < head + bound) {
+            buf_.resize(head + bound);
+        }
+        deflateReset(&strm_);
+        strm_.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+        strm_.avail_in  = static_cast<uInt>(len);
+        strm_.next_out  = reinterpret_cast<Bytef*>(buf_.data() + head);
+        strm_.avail_out = static_cast<uInt>(buf_.size() - head);
+        if (deflate(&strm_, Z_FINISH) != Z_STREAM_END) {
+            return std::string_view();
+        }
+        size_t clen = buf_.size() - head - strm_.avail_out;
+        if (framed) {
+            buf_[0] = static_cast<char>(clen & 0xFF);
+            buf_[1] = static_cast<char>((clen >> 8) & 0xFF);
+            buf_[2] = static_cast<char>((clen >> 16) & 0xFF);
+            buf_[3] = static_cast<char>((clen >> 24) & 0xFF);
+        }
+        return std::string_view(buf_.data(), head + clen);
+    }
+
+private:
+    z_stream strm_;
+    std::string buf_;
+    bool ready_ = false;
+};
+
+// Listening TCP sink: an epoll loop accepts any number of consumers and
+// every generated cycle is fanned out to all of them from the one shared
+// buffer. Writes are non-blocking with a bounded per-client backlog; a
+// client that falls further behind than the backlog cap is disconnected
+// so it cannot stall the cycle schedule for everyone else.
+class TcpFanout {
+public:
+    ~TcpFanout()
+    {
+        for (const Client& client : clients_) {
+            close(client.fd);
+        }
+        if (epfd_ != -1)
+            close(epfd_);
+        if (listen_fd_ != -1)
+            close(listen_fd_);
+    }
+
+    bool listenOn(const std::string& host, uint16_t port)
+    {
+        listen_fd_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+        if (listen_fd_ == -1) {
+            std::cerr << "Error creating TCP socket: " << strerror(errno) << std::endl;
+            return false;
+        }
+        int one = 1;
+        setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+        struct sockaddr_in addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port   = htons(port);
+        if (host.empty()) {
+            addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        } else if (inet_pton(AF_INET, host.c_str(), &addr.sin_addr) != 1) {
+            std::cerr << "Error: invalid TCP bind address " << host << std::endl;
+            return false;
+        }
+        if (bind(listen_fd_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) == -1
+            || listen(listen_fd_, 16) == -1) {
+            std::cerr << "Error binding TCP socket: " << strerror(errno) << std::endl;
+            return false;
+        }
+
+        epfd_ = epoll_create1(0);
+        if (epfd_ != -1) {
+            struct epoll_event ev {};
+            ev.events  = EPOLLIN;
+            ev.data.fd = listen_fd_;
+            epoll_ctl(epfd_, EPOLL_CTL_ADD, listen_fd_, &ev);
+        }
+        return true;
+    }
+
+    // Accept any consumers waiting on the listener; never blocks
+    void pump()
+    {
+        struct epoll_event events[4];
+        while (epoll_wait(epfd_, events, 4, 0) > 0) {
+            for (;;) {
+                int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK);
+                if (fd == -1)
+                    break;
+                int one = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+                clients_.push_back(Client { fd, std::string() });
+                std::cout << "TCP consumer connected (" << clients_.size()
+                          << " total)." << std::endl;
+            }
+        }
+    }
+
+    // Fan one cycle out to every client from the shared buffer
+    void broadcast(const char* data, size_t len)
+    {
+        for (size_t i = 0; i < clients_.size();) {
+            Client& client = clients_[i];
+            bool drop      = false;
+
+            // Flush backlog first so bytes stay in order
+            if (!client.pending.empty()) {
+                ssize_t n = send(client.fd, client.pending.data(), client.pending.size(),
+                                 MSG_NOSIGNAL);
+                if (n > 0) {
+                    client.pending.erase(0, static_cast<size_t>(n));
+                } else if (n == -1 && errno != EAGAIN && errno != EWOULDBLOCK) {
+                    drop = true;
+                }
+            }
+            if (!drop) {
+                if (client.pending.empty()) {
+                    ssize_t n = send(client.fd, data, len, MSG_NOSIGNAL);
+                    size_t sent = n > 0 ? static_cast<size_t>(n) : 0;
+                    if (n == -1 && errno != EAGAIN && errno != EWOULDBLOCK) {
+                        drop = true;
+                    } else if (sent < len) {
+                        client.pending.assign(data + sent, len - sent);
+                    }
+                } else {
+                    client.pending.append(data, len);
+                }
+                if (client.pending.size() > kMaxPending) {
+                    drop = true;
+                    ++dropped_slow_;
+                }
+            }
+
+            if (drop) {
+                close(client.fd);
+                clients_[i] = std::move(clients_.back());
+                clients_.pop_back();
+                std::cout << "TCP consumer disconnected (" << clients_.size()
+                          << " remain)." << std::endl;
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    uint64_t droppedSlow() const { return dropped_slow_; }
+
+private:
+    struct Client {
+        int fd;
+        std::string pending;
+    };
+
+    // A client this far behind is presumed dead and cut loose
+    static constexpr size_t kMaxPending = 256 * 1024;
+
+    int listen_fd_ = -1;
+    int epfd_      = -1;
+    std::vector<Client> clients_;
+    uint64_t dropped_slow_ = 0;
+};
+
+// Local-socket sink with SOCK_SEQPACKET framing: each cycle is one
+// atomic message, so consumers skip line reassembly entirely, and the
+// send buffer is raised well past the 64 KB FIFO limit so bursty
+// consumers don't backpressure the writer. Messages that still don't
+// fit are dropped per-client (packet semantics — no torn cycles).
+class UnixFanout {
+public:
+    ~UnixFanout()
+    {
+        for (int fd : clients_) {
+            close(fd);
+        }
+        if (listen_fd_ != -1)
+            close(listen_fd_);
+        if (!path_.empty())
+            unlink(path_.c_str());
+    }
+
+    bool listenOn(const std::string& path)
+    {
+        listen_fd_ = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK, 0);
+        if (listen_fd_ == -1) {
+            std::cerr << "Error creating unix socket: " << strerror(errno) << std::endl;
+            return false;
+        }
+        struct sockaddr_un addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+        unlink(path.c_str()); // stale socket from a previous run
+        if (bind(listen_fd_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) == -1
+            || listen(listen_fd_, 16) == -1) {
+            std::cerr << "Error binding unix socket " << path << ": " << strerror(errno)
+                      << std::endl;
+            return false;
+        }
+        path_ = path;
+        return true;
+    }
+
+    // Accept waiting consumers; never blocks
+    void pump()
+    {
+        for (;;) {
+            int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK);
+            if (fd == -1)
+                break;
+            int sndbuf = kSendBuffer;
+            setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+            clients_.push_back(fd);
+            std::cout << "Unix-socket consumer connected (" << clients_.size()
+                      << " total)." << std::endl;
+        }
+    }
+
+    // One atomic message per client per cycle
+    void broadcast(const char* data, size_t len)
+    {
+        for (size_t i = 0; i < clients_.size();) {
+            ssize_t n = send(clients_[i], data, len, MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                ++dropped_; // consumer's buffer full; skip this cycle for it
+                ++i;
+            } else if (n == -1) {
+                close(clients_[i]);
+                clients_[i] = clients_.back();
+                clients_.pop_back();
+                std::cout << "Unix-socket consumer disconnected (" << clients_.size()
+                          << " remain)." << std::endl;
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    uint64_t droppedMessages() const { return dropped_; }
+
+private:
+    // Default FIFO capacity is 64 KB; give bursty consumers real slack
+    static constexpr int kSendBuffer = 1 << 20;
+
+    int listen_fd_ = -1;
+    std::string path_;
+    std::vector<int> clients_;
+    uint64_t dropped_ = 0;
+};
+
+// Zero-copy pipe writer (--io-backend vmsplice): instead of write()
+// copying every cycle into the kernel, vmsplice(2) makes the pipe
+// reference the generator's own buffer pages. The catch is buffer
+// lifetime — the pipe holds those pages until the reader consumes
+// them, so a buffer must not be rewritten while still referenced.
+// Cycles therefore rotate through a pool of reserved buffers and a
+// buffer is only reused once at least a full pipe capacity of bytes
+// has been written after its submission (the pipe can hold at most
+// that much, so its pages must have drained). When no buffer has
+// drained yet — small cycles, slow reader — the cycle falls back to a
+// plain copying write, which is always safe.
+class VmsplicePipe {
+public:
+    bool init(int fd)
+    {
+        fd_          = fd;
+        long pipe_sz = fcntl(fd, F_GETPIPE_SZ);
+        if (pipe_sz <= 0) {
+            return false;
+        }
+        pipe_size_ = static_cast<size_t>(pipe_sz);
+        if (slots_.empty()) {
+            slots_.resize(pipe_size_ / kSlotBytes + 2);
+            for (Slot& slot : slots_) {
+                slot.buf.reserve(kSlotBytes);
+            }
+            scratch_.reserve(kSlotBytes);
+        }
+        // A fresh pipe references nothing, so every slot starts drained
+        written_ = pipe_size_;
+        for (Slot& slot : slots_) {
+            slot.retired_at = 0;
+        }
+        ready_ = true;
+        return true;
+    }
+
+    bool ready() const { return ready_; }
+
+    // Hand out the buffer to generate the next cycle into: a drained
+    // pool slot when available, the scratch buffer (copying path)
+    // otherwise. The buffer comes back cleared.
+    std::string* acquire()
+    {
+        Slot& slot = slots_[next_];
+        if (written_ - slot.retired_at >= pipe_size_) {
+            pending_is_slot_ = true;
+            slot.buf.clear();
+            return &slot.buf;
+        }
+        ++fallback_cycles_;
+        pending_is_slot_ = false;
+        scratch_.clear();
+        return &scratch_;
+    }
+
+    // Submit the buffer returned by the last acquire(). Returns false
+    // on a hard write error with errno preserved (EPIPE included, so
+    // the caller can reopen and re-init()).
+    bool submit(const std::string& buf)
+    {
+        size_t off = 0;
+        while (off < buf.size()) {
+            ssize_t n;
+            if (pending_is_slot_) {
+                struct iovec iov;
+                iov.iov_base = const_cast<char*>(buf.data()) + off;
+                iov.iov_len  = buf.size() - off;
+                n            = vmsplice(fd_, &iov, 1, 0);
+            } else {
+                n = write(fd_, buf.data() + off, buf.size() - off);
+            }
+            if (n == -1) {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            off += static_cast<size_t>(n);
+            written_ += static_cast<size_t>(n);
+        }
+        if (pending_is_slot_) {
+            slots_[next_].retired_at = written_;
+            next_                    = (next_ + 1) % slots_.size();
+        }
+        return true;
+    }
+
+    // Cycles that took the copying fallback path
+    uint64_t fallbackCycles() const { return fallback_cycles_; }
+
+private:
+    // Covers the ~4 KB stress payloads with headroom; an oversized
+    // cycle merely reallocates its slot buffer, which is harmless (the
+    // drained old pages are freed, the new ones are what gets spliced)
+    static constexpr size_t kSlotBytes = 8192;
+
+    struct Slot {
+        std::string buf;
+        size_t retired_at = 0; // written_ when this slot was last submitted
+    };
+
+    int fd_            = -1;
+    size_t pipe_size_  = 0;
+    size_t written_    = 0; // cumulative bytes pushed into the pipe
+    size_t next_       = 0;
+    bool ready_        = false;
+    bool pending_is_slot_ = false;
+    std::vector<Slot> slots_;
+    std::string scratch_;
+    uint64_t fallback_cycles_ = 0;
+};
+
+// Kernel-side capture for the named-pipe sink: with --capture active
+// the plain path moves every cycle through userspace twice — write()
+// to the FIFO plus the capture ring's memcpy and the drain thread's
+// fwrite. Here the cycle is written once into a private staging pipe,
+// tee(2) duplicates the page references into a second pipe headed for
+// the capture file, and two splice(2) calls move the payload to the
+// FIFO and the duplicate to disk without touching userspace again.
+// The capture stays a valid CAP1 container: the 12-byte record header
+// is the only extra userspace write, pushed into the capture pipe
+// ahead of the teed payload. Unlike the buffered CaptureLog, capture
+// I/O here shares the writer thread — a capture-disk stall can overrun
+// a cycle — which is the bandwidth/isolation trade the zero-copy path
+// makes.
+class TeeCapturePipe {
+public:
+    ~TeeCapturePipe()
+    {
+        closeFd(stage_[0]);
+        closeFd(stage_[1]);
+        closeFd(cap_[0]);
+        closeFd(cap_[1]);
+        closeFd(file_fd_);
+        closeFd(null_fd_);
+    }
+
+    // Open the staging pipes and the capture file, then probe tee(2)
+    // with one byte so an unsupported kernel is caught up front.
+    // Returns false with everything closed again; the caller keeps the
+    // buffered double-write.
+    bool init(const std::string& capture_path)
+    {
+        if (pipe2(stage_, O_CLOEXEC) == -1 || pipe2(cap_, O_CLOEXEC) == -1) {
+            teardown();
+            return false;
+        }
+        // Both pipes must hold a full cycle plus framing or the writes
+        // below would deadlock against our own splice; oversized cycles
+        // take the copying fallback in emit(). Best effort — the 64 KB
+        // default already covers typical cycles.
+        fcntl(stage_[1], F_SETPIPE_SZ, kPipeBytes);
+        fcntl(cap_[1], F_SETPIPE_SZ, kPipeBytes);
+        long stage_sz = fcntl(stage_[1], F_GETPIPE_SZ);
+        long cap_sz   = fcntl(cap_[1], F_GETPIPE_SZ);
+        if (stage_sz <= 0 || cap_sz <= 0) {
+            teardown();
+            return false;
+        }
+        capacity_ = static_cast<size_t>(std::min(stage_sz, cap_sz));
+
+        // O_APPEND would make splice-to-file fail with EINVAL, so seek
+        // to the end explicitly; this fd is the file's only writer for
+        // the rest of the run (CaptureLog's stream stays idle)
+        file_fd_ = open(capture_path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+        null_fd_ = open("/dev/null", O_WRONLY | O_CLOEXEC);
+        if (file_fd_ == -1 || null_fd_ == -1) {
+            teardown();
+            return false;
+        }
+        off_t end = lseek(file_fd_, 0, SEEK_END);
+        if (end == 0) {
+            CaptureHeader hdr { kCaptureMagic, 0 };
+            if (!writeAll(file_fd_, &hdr, sizeof(hdr))) {
+                teardown();
+                return false;
+            }
+        }
+
+        char probe = 0;
+        if (!writeAll(stage_[1], &probe, 1) || tee(stage_[0], cap_[1], 1, 0) != 1
+            || read(stage_[0], &probe, 1) != 1 || read(cap_[0], &probe, 1) != 1) {
+            teardown();
+            return false;
+        }
+        ready_ = true;
+        return true;
+    }
+
+    bool ready() const { return ready_; }
+
+    // Emit one cycle: payload to fifo_fd, framed header plus payload
+    // to the capture file. Returns false on a hard FIFO error with
+    // errno preserved (EPIPE included); the capture record is written
+    // either way, matching the double-write path which records every
+    // generated cycle.
+    bool emit(int fifo_fd, const char* data, size_t len)
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        CaptureRecordHeader hdr;
+        hdr.t_ns = static_cast<uint64_t>(ts.tv_sec) * 1000000000ull
+            + static_cast<uint64_t>(ts.tv_nsec);
+        hdr.len = static_cast<uint32_t>(len);
+
+        if (len + sizeof(hdr) > capacity_) {
+            // Cycle outgrew the pipes; copy it the ordinary way so the
+            // record stream stays in order
+            ++copied_cycles_;
+            writeAll(file_fd_, &hdr, sizeof(hdr));
+            writeAll(file_fd_, data, len);
+            return writeAll(fifo_fd, data, len);
+        }
+
+        // Header first so it precedes the teed payload in the capture
+        // pipe; then the single userspace copy of the payload, the
+        // kernel-side duplication, and the two zero-copy drains
+        if (!writeAll(cap_[1], &hdr, sizeof(hdr)) || !writeAll(stage_[1], data, len)
+            || !teeAll(len)) {
+            return false;
+        }
+        bool ok       = spliceAll(stage_[0], fifo_fd, len);
+        int saved_err = errno;
+        if (!ok) {
+            // Reader went away mid-splice: discard what it never took
+            // so the next cycle starts from an empty staging pipe
+            spliceAll(stage_[0], null_fd_, pendingStage());
+        }
+        spliceAll(cap_[0], file_fd_, sizeof(hdr) + len);
+        errno = saved_err;
+        return ok;
+    }
+
+    // Cycles that outgrew the staging pipes and took the copying path
+    uint64_t copiedCycles() const { return copied_cycles_; }
+
+private:
+    // Room for dense-sky burst cycles well past the 64 KB FIFO default
+    static constexpr int kPipeBytes = 1 << 20;
+
+    static void closeFd(int& fd)
+    {
+        if (fd != -1) {
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    void teardown()
+    {
+        closeFd(stage_[0]);
+        closeFd(stage_[1]);
+        closeFd(cap_[0]);
+        closeFd(cap_[1]);
+        closeFd(file_fd_);
+        closeFd(null_fd_);
+    }
+
+    static bool writeAll(int fd, const void* data, size_t len)
+    {
+        const char* p = static_cast<const char*>(data);
+        while (len > 0) {
+            ssize_t n = write(fd, p, len);
+            if (n == -1) {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            p += n;
+            len -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    bool teeAll(size_t len)
+    {
+        while (len > 0) {
+            ssize_t n = tee(stage_[0], cap_[1], len, 0);
+            if (n == -1) {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            len -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    static bool spliceAll(int from, int to, size_t len)
+    {
+        while (len > 0) {
+            ssize_t n = splice(from, nullptr, to, nullptr, len, 0);
+            if (n <= 0) {
+                if (n == -1 && errno == EINTR)
+                    continue;
+                return false;
+            }
+            len -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    // Bytes still queued in the staging pipe, for the error drain
+    size_t pendingStage() const
+    {
+        int queued = 0;
+        if (ioctl(stage_[0], FIONREAD, &queued) == -1 || queued < 0) {
+            return 0;
+        }
+        return static_cast<size_t>(queued);
+    }
+
+    int stage_[2] = { -1, -1 }; // cycle staging pipe (write once here)
+    int cap_[2]   = { -1, -1 }; // teed duplicate headed for the file
+    int file_fd_  = -1;
+    int null_fd_  = -1;
+    size_t capacity_ = 0;
+    bool ready_      = false;
+    uint64_t copied_cycles_ = 0;
+};
+
+// Line terminator shared by every iovec pair in a scatter-gather flush
+constexpr char kCrlf[] = "\r\n";
+
+// Drain iov[0..count) completely, resuming after short writes and EINTR.
+// On EAGAIN (non-blocking descriptor, e.g. the PTY master) the call
+// waits for writability, preserving lossless semantics for replay mode.
+// The wait watches the shutdown eventfd alongside the descriptor (the
+// selfTestLoop / waitUntil idiom): a consumer that stalls or never
+// attaches would otherwise pin replay in this poll forever, past both
+// SIGINT and --duration. Returns false when shutdown cut the drain
+// short, same as a write error — the caller's cleanup path runs either
+// way.
+bool writevAll(int fd, struct iovec* iov, int count)
+{
+    while (count > 0) {
+        ssize_t n = writev(fd, iov, count);
+        if (n == -1) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                struct pollfd pfds[2] = { { fd, POLLOUT, 0 },
+                                          { shutdown_wake_fd, POLLIN, 0 } };
+                nfds_t nfds = shutdown_wake_fd != -1 ? 2 : 1;
+                if (poll(pfds, nfds, -1) > 0 && (pfds[1].revents & POLLIN) != 0) {
+                    return false; // shutdown requested mid-drain
+                }
+                continue;
+            }
+            return false;
+        }
+        while (count > 0 && n >= static_cast<ssize_t>(iov->iov_len)) {
+            n -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+        if (count > 0 && n > 0) {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + n;
+            iov->iov_len -= n;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+// Scatter-gather flush of one replay cycle: two iovecs per sentence (the
+// stored line and the shared CRLF), batched well under IOV_MAX, so a
+// typical cycle goes out in a single writev() with no concatenation
+bool PtyHandler::writeCycleV(int fd, const std::vector<std::string_view>& cycle)
+{
+    struct iovec iov[128];
+    int count = 0;
+    for (const auto& sentence : cycle) {
+        iov[count].iov_base     = const_cast<char*>(sentence.data());
+        iov[count].iov_len      = sentence.size();
+        iov[count + 1].iov_base = const_cast<char*>(kCrlf);
+        iov[count + 1].iov_len  = 2;
+        count += 2;
+        if (count == 128) {
+            if (!writevAll(fd, iov, count))
+                return false;
+            count = 0;
+        }
+    }
+    return count == 0 || writevAll(fd, iov, count);
+}
+
+// Verbatim flush of one replayed cycle straight from the log mapping.
+// When the log is already CRLF wire format there is nothing to splice,
+// so the whole cycle is one iovec and the kernel copies it once.
+bool PtyHandler::writeCycleRaw(int fd, std::string_view raw)
+{
+    struct iovec iov = { const_cast<char*>(raw.data()), raw.size() };
+    return writevAll(fd, &iov, 1);
+}
+
+// Write one generated cycle to the non-blocking PTY master. A fast
+// consumer takes the common path: one write(), no epoll call. Under
+// backpressure the configured policy decides between discarding data
+// and waiting, but never blocks past one cycle interval, so a stuck
+// consumer cannot stall the cycle schedule.
+bool PtyHandler::writePtyCycle(int epfd, const char* data, size_t len)
+{
+    // UART pacing (--uart-pace) trickles the cycle out at the line
+    // rate and so never races the consumer; it replaces both the
+    // backpressure policy and the pending queue
+    if (uart_pace_baud_ > 0) {
+        return writePtyPaced(data, len);
+    }
+    // Queue mode (--queue) parks what the consumer refuses instead of
+    // dropping it at the first EAGAIN; it replaces the per-write policy
+    if (!pending_.empty()) {
+        return writePtyQueued(data, len);
+    }
+    auto deadline = std::chrono::steady_clock::now()
+        + std::chrono::duration<double>(interval_);
+    size_t off = 0;
+    while (off < len) {
+        ssize_t n = write(master_fd_, data + off, len - off);
+        if (n > 0) {
+            off += static_cast<size_t>(n);
+            continue;
+        }
+        if (n == -1 && errno == EINTR)
+            continue;
+        if (n == -1 && errno != EAGAIN && errno != EWOULDBLOCK) {
+            logger_.logError("Error writing to PTY", errno);
+            return false;
+        }
+
+        // PTY buffer is full: consumer is not keeping up
+        if (backpressure_ != BackpressurePolicy::Block) {
+            ++dropped_cycles_;
+            return true;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            ++dropped_cycles_;
+            return true;
+        }
+        int timeout_ms = static_cast<int>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count());
+        struct epoll_event ev;
+        epoll_wait(epfd, &ev, 1, timeout_ms > 0 ? timeout_ms : 1);
+    }
+    return true;
+}
+
+// Paced PTY write emulating a real UART at the --baud line rate: a
+// token bucket earns baud/10 bytes per second (8N1 is ten line bits
+// per byte) and each earned chunk goes out in one write(), so the
+// consumer sees bytes trickle in mid-cycle the way hardware delivers
+// them instead of one burst per interval. Quanta are the 1 ms poll
+// granularity to keep the syscall count low (at 9600 baud that is
+// about one byte per wakeup); the bucket is capped at a FIFO-sized
+// burst plus two quanta of credit so a stall never pays itself back
+// as a catch-up burst, which real line timing would not.
+bool PtyHandler::writePtyPaced(const char* data, size_t len)
+{
+    const double bytes_per_sec = uart_pace_baud_ / 10.0;
+    const double token_cap = std::max(16.0, bytes_per_sec * 0.002);
+    double tokens = token_cap;
+    auto last     = std::chrono::steady_clock::now();
+    size_t off    = 0;
+    while (off < len && !shutdown_event_.load()) {
+        auto now = std::chrono::steady_clock::now();
+        tokens += std::chrono::duration<double>(now - last).count() * bytes_per_sec;
+        last = now;
+        if (tokens > token_cap) {
+            tokens = token_cap;
+        }
+        size_t chunk = static_cast<size_t>(tokens);
+        if (chunk == 0) {
+            // Not a full byte earned yet: wait one quantum, shutdown-
+            // interruptible like every other deadline wait
+            struct pollfd pfd = { shutdown_wake_fd, POLLIN, 0 };
+            poll(&pfd, 1, 1);
+            continue;
+        }
+        if (chunk > len - off) {
+            chunk = len - off;
+        }
+        ssize_t n = write(master_fd_, data + off, chunk);
+        if (n > 0) {
+            off += static_cast<size_t>(n);
+            tokens -= static_cast<double>(n);
+            continue;
+        }
+        if (n == -1 && errno == EINTR) {
+            continue;
+        }
+        if (n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            // Consumer stalled outright; pacing is already slower than
+            // any real reader, so just wait a quantum and retry
+            struct pollfd pfd = { shutdown_wake_fd, POLLIN, 0 };
+            poll(&pfd, 1, 1);
+            continue;
+        }
+        logger_.logError("Error writing to PTY", errno);
+        return false;
+    }
+    return true;
+}
+
+// Drain parked cycles in arrival order. Returns 1 when the backlog is
+// empty, 0 when the kernel buffer filled mid-drain (partial progress is
+// remembered in the slot offset, so nothing is rewritten), -1 on a hard
+// write error.
+int PtyHandler::flushPending()
+{
+    while (pending_count_ > 0) {
+        PendingSlot& slot = pending_[pending_head_];
+        while (slot.off < slot.data.size()) {
+            ssize_t n = write(master_fd_, slot.data.data() + slot.off,
+                              slot.data.size() - slot.off);
+            if (n > 0) {
+                slot.off += static_cast<size_t>(n);
+                continue;
+            }
+            if (n == -1 && errno == EINTR)
+                continue;
+            if (n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                return 0;
+            logger_.logError("Error writing to PTY", errno);
+            return -1;
+        }
+        pending_head_ = (pending_head_ + 1) % pending_.size();
+        --pending_count_;
+    }
+    return 1;
+}
+
+// Park one cycle (or its unwritten tail) in the ring. A full ring is
+// where the configured policy earns its name: evict the head, refuse
+// the newcomer, or collapse the whole backlog down to this one cycle.
+void PtyHandler::enqueuePending(const char* data, size_t len)
+{
+    if (pending_count_ == pending_.size()) {
+        switch (queue_policy_) {
+        case QueuePolicy::DropNewest:
+            ++q_dropped_newest_;
+            counters(SinkId::Pty).recordDropped();
+            return;
+        case QueuePolicy::DropOldest:
+            ++q_dropped_oldest_;
+            counters(SinkId::Pty).recordDropped();
+            pending_head_ = (pending_head_ + 1) % pending_.size();
+            --pending_count_;
+            break;
+        case QueuePolicy::Latest:
+            q_coalesced_ += pending_count_;
+            counters(SinkId::Pty).recordDropped();
+            pending_count_ = 0;
+            break;
+        }
+    }
+    PendingSlot& slot = pending_[(pending_head_ + pending_count_) % pending_.size()];
+    slot.data.assign(data, len);
+    slot.off = 0;
+    ++pending_count_;
+}
+
+// Queue-mode PTY write: backlog first (so cycles stay in order), then
+// the fresh cycle; anything the kernel buffer refuses is parked rather
+// than dropped. Never waits, so short consumer stalls cost latency
+// instead of data and the cycle schedule is untouched.
+bool PtyHandler::writePtyQueued(const char* data, size_t len)
+{
+    int drained = flushPending();
+    if (drained < 0)
+        return false;
+    if (drained == 0) {
+        enqueuePending(data, len);
+        return true;
+    }
+    size_t off = 0;
+    while (off < len) {
+        ssize_t n = write(master_fd_, data + off, len - off);
+        if (n > 0) {
+            off += static_cast<size_t>(n);
+            continue;
+        }
+        if (n == -1 && errno == EINTR)
+            continue;
+        if (n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            enqueuePending(data + off, len - off);
+            return true;
+        }
+        logger_.logError("Error writing to PTY", errno);
+        return false;
+    }
+    return true;
+}
+
+// Write one replay cycle to the FIFO descriptor. On EPIPE (reader went
+// away; SIGPIPE is ignored) the FIFO is reopened once, blocking until a
+// new reader attaches, and the cycle is retried from the top.
+int PtyHandler::writeCycleToPipeFd(int fd, const std::vector<std::string_view>& cycle, std::string_view raw)
+{
+    bool reopened = false;
+    for (;;) {
+        // One writev per cycle instead of the historical two write()
+        // calls per sentence; the raw path is a single verbatim iovec
+        if (raw.empty() ? writeCycleV(fd, cycle) : writeCycleRaw(fd, raw)) {
+            return fd;
+        }
+        if (errno != EPIPE || reopened) {
+            logger_.logError("Error writing to pipe", errno);
+            close(fd);
+            pipe_probe_fd_.store(-1, std::memory_order_relaxed);
+            return -1;
+        }
+
+        close(fd);
+        pipe_probe_fd_.store(-1, std::memory_order_relaxed);
+        fd = open(pipe_path_.c_str(), O_WRONLY);
+        if (fd == -1) {
+            if (errno != EINTR) {
+                std::cerr << "Error reopening pipe: " << pipe_path_ << std::endl;
+            }
+            return -1;
+        }
+        applyPipeBuffer(fd);
+        reopened = true;
+    }
+}
+
+// The one replay driver behind every --file sink. Opens and indexes
+// the log, seeks to --start-cycle, and emits indexed cycles through
+// the sink under the configured pacing, so the mmap/index/verbatim/
+// pacing machinery exists exactly once instead of per sink.
+void PtyHandler::replayLoop(const char* heading, const ReplaySink& sink)
+{
+    // One source is the overwhelmingly common case and ReplayMerge
+    // delegates it straight through; extra --file inputs interleave by
+    // their precomputed cycle timestamps, one heap pop per cycle
+    ReplayMerge log;
+    std::vector<std::string> paths;
+    paths.reserve(1 + extra_files_.size());
+    paths.push_back(file_path_);
+    paths.insert(paths.end(), extra_files_.begin(), extra_files_.end());
+    if (!replay_filter_types_.empty()) {
+        // Filtering happens while the index is built, so it must be in
+        // place before open() scans (or picks the cached index for)
+        // the logs
+        log.setSentenceFilter(replay_filter_types_, replay_filter_drop_);
+    }
+    if (!log.open(paths)) {
+        requestShutdown();
+        return;
+    }
+    log.setRetime(retime_log_);
+    if (!follow_) {
+        // Follow mode remaps the file as it grows, which would pull
+        // the mapping out from under the prefetch thread
+        log.startPrefetch(replay_prefetch_mb_ * 1024ull * 1024ull);
+    }
+
+    // Replay's resident footprint is known the moment the index
+    // exists; a log the budget cannot hold is refused here, before the
+    // soak starts
+    if (!MemBudget::reserve("replay cache", log.residentBytes())) {
+        requestShutdown();
+        return;
+    }
+
+    // --rate scales replay pacing; the absolute-deadline schedule
+    // keeps multiplied rates accurate instead of compounding per-cycle
+    // rounding, and rate 0 (--rate max) skips pacing entirely
+    CycleScheduler scheduler(rate_ > 0.0 ? interval_ / rate_ : interval_);
+    std::vector<std::string_view> cycle_buffer;
+    log.seekCycle(start_cycle_);
+
+    while (!shutdown_event_.load()) {
+        if (follow_) {
+            // Tail mode: a cycle is emitted only once a later cycle
+            // start proves it complete, and EOF waits for appended
+            // data instead of rewinding
+            while (!log.hasCompleteCycle()) {
+                if (!log.waitForGrowth(shutdown_event_)) {
+                    return;
+                }
+            }
+            log.nextCycle(cycle_buffer);
+        } else if (!log.nextCycle(cycle_buffer)) {
+            // End of log: an O(1) index jump, no re-parsing
+            log.rewind();
+            if (!log.nextCycle(cycle_buffer)) {
+                break; // log contains no cycles
+            }
+        }
+        if (!sink(cycle_buffer,
+                  log.crlfTerminated() ? log.lastCycleRaw() : std::string_view())) {
+            requestShutdown();
+            break;
+        }
+        logger_.logCycle(heading, cycle_buffer);
+
+        // Wait for this cycle's absolute deadline; log pacing sleeps
+        // the RMC-derived delta to the next cycle instead
+        if (rate_ > 0.0) {
+            double delta = pace_log_ ? log.nextCycleDelta() : -1.0;
+            if (delta >= 0.0) {
+                scheduler.waitDelta(delta / rate_);
+            } else if (pace_log_) {
+                scheduler.waitDelta(interval_ / rate_);
+            } else {
+                scheduler.waitNextCycle();
+            }
+        }
+    }
+}
+
+// Writer to named pipe
+void PtyHandler::writerPipe()
+{
+    NMEA_ALLOC_SCOPE("PtyHandler::writerPipe");
+    CycleScheduler scheduler(interval_);
+    RateController rate_ctl(adapt_levels_, interval_, sink_counters_);
+    if (!file_path_.empty()) {
+        // Mode: Replay. The FIFO is opened on the first cycle and the
+        // descriptor kept for the writer's lifetime; a per-cycle reopen
+        // costs an open/close syscall pair per cycle and makes readers
+        // observe EOF glitches.
+        int pipe_fd = -1;
+        replayLoop("Sent to pipe (Cycle):",
+                   [&](const std::vector<std::string_view>& cycle, std::string_view raw) {
+                       if (pipe_fd == -1) {
+                           pipe_fd = open(pipe_path_.c_str(), O_WRONLY);
+                           if (pipe_fd == -1) {
+                               if (errno != EINTR) {
+                                   std::cerr << "Error opening pipe: " << pipe_path_
+                                             << std::endl;
+                               }
+                               return false;
+                           }
+                           applyPipeBuffer(pipe_fd);
+                       }
+                       pipe_fd = writeCycleToPipeFd(pipe_fd, cycle, raw);
+                       return pipe_fd != -1;
+                   });
+        if (pipe_fd != -1) {
+            close(pipe_fd);
+        }
+    } else {
+        // Mode: Generate data
+        // One reusable cycle buffer per writer thread avoids per-cycle
+        // heap allocation in steady state. Writing the raw descriptor
+        // directly means one write() per cycle with no userspace stream
+        // buffer to flush; the kernel pipe buffer provides ordering.
+        //
+        // With no reader attached a blocking open(O_WRONLY) would hang
+        // indefinitely — the process looks stuck and time-to-first-
+        // sentence is unbounded. Instead the attach is attempted
+        // non-blocking once per cycle while generation and the cycle
+        // schedule keep running, so a reader receives its first cycle
+        // within one interval of attaching.
+        int pipe_fd           = -1;
+        bool waiting_reported = false;
+        uint64_t unattached   = 0;
+        EmissionTiming timing;
+        timing.writer  = "Pipe writer";
+        timing.p99_out = &sink_write_p99_[static_cast<size_t>(SinkId::Pipe)];
+        timing.sink    = static_cast<uint8_t>(SinkId::Pipe);
+
+        // Optional zero-copy backend, initialized at each attach since
+        // it is bound to the descriptor
+        VmsplicePipe vms;
+
+        // Kernel-side capture duplication on the plain write() path;
+        // the vmsplice backend's buffers already live in the pipe and
+        // keep the buffered double-write instead
+        TeeCapturePipe tcap;
+        if (capture_.enabled() && !use_vmsplice_ && !tcap.init(capture_path_)) {
+            std::cerr << "tee capture unavailable, keeping the buffered double-write"
+                      << std::endl;
+        }
+
+        // The splice backend generates into its own drain-tracked
+        // buffers, so the pipeline covers only the write() path
+        CyclePipeline pipeline(generator_);
+        if (!use_vmsplice_) {
+            startPipeline(pipeline);
+        }
+
+        while (!shutdown_event_.load()) {
+            if (!scenario_.empty() || !control_name_.empty()) {
+                applyScenario(scenario_, generator_, scheduler);
+            }
+            rate_ctl.cycle(scheduler, generator_);
+            if (pipe_fd == -1) {
+                pipe_fd = open(pipe_path_.c_str(), O_WRONLY | O_NONBLOCK);
+                if (pipe_fd == -1) {
+                    if (errno == ENXIO) {
+                        // No reader yet; say so once and keep cycling
+                        if (!waiting_reported) {
+                            std::cout << "Waiting for a reader on " << pipe_path_
+                                      << "..." << std::endl;
+                            waiting_reported = true;
+                        }
+                    } else if (errno != EINTR) {
+                        std::cerr << "Error opening pipe: " << pipe_path_ << std::endl;
+                        break;
+                    }
+                } else {
+                    waiting_reported = false;
+                    // Restore blocking writes; only the open needed to
+                    // be non-blocking, cycles stay lossless
+                    int flags = fcntl(pipe_fd, F_GETFL, 0);
+                    if (flags != -1) {
+                        fcntl(pipe_fd, F_SETFL, flags & ~O_NONBLOCK);
+                    }
+                    applyPipeBuffer(pipe_fd);
+                    if (use_vmsplice_ && !vms.init(pipe_fd)) {
+                        std::cerr << "vmsplice unavailable, falling back to write()"
+                                  << std::endl;
+                    }
+                }
+            }
+            if (pipe_fd == -1) {
+                // Generate anyway so the motion model advances in real
+                // time; the cycle has no consumer and is forfeited
+                const std::string* buf = pipeline.next();
+                if (buf == nullptr)
+                    break;
+                ++unattached;
+                counters(SinkId::Pipe).recordDropped();
+                pipeline.release();
+                scheduler.waitNextCycle();
+                continue;
+            }
+
+            const std::string* buf;
+            bool ok;
+            timing.beginCycle();
+            if (vms.ready()) {
+                std::string* slot = vms.acquire();
+                generator_->generateCycles(burst_, *slot);
+                if (late_stamp_) {
+                    pipeline.stamp(*slot);
+                }
+                timing.beginWrite(slot->size());
+                ok  = vms.submit(*slot);
+                buf = slot;
+            } else {
+                buf = pipeline.next();
+                if (buf == nullptr)
+                    break;
+                timing.beginWrite(buf->size());
+                // A FIFO with no room at write time is a consumer-pause
+                // incident; the write below then blocks into whatever
+                // capacity --pipe-buffer granted instead of failing
+                struct pollfd pfd = { pipe_fd, POLLOUT, 0 };
+                if (poll(&pfd, 1, 0) == 0) {
+                    counters(SinkId::Pipe).recordStall();
+                }
+                if (tcap.ready()) {
+                    ok = tcap.emit(pipe_fd, buf->c_str(), buf->size());
+                } else {
+                    ok = write(pipe_fd, buf->c_str(), buf->size()) != -1;
+                }
+            }
+            // The tee backend owns the capture record for this cycle;
+            // appending here too would duplicate it
+            if (!tcap.ready()) {
+                captureCycle(*buf);
+            }
+            checkpointCycle();
+            if (!ok) {
+                if (errno == EPIPE) {
+                    // Reader went away; the interrupted cycle is
+                    // forfeited and the non-blocking attach loop above
+                    // waits for the next reader. The old pipe dies with
+                    // all its page references, so the splice pool is
+                    // re-initialized at the next attach.
+                    close(pipe_fd);
+                    pipe_fd = -1;
+                    pipe_probe_fd_.store(-1, std::memory_order_relaxed);
+                    counters(SinkId::Pipe).recordRetry();
+                    pipeline.release();
+                    continue;
+                }
+                logger_.logError("Error writing to pipe", errno);
+                break;
+            }
+            timing.endWrite(scheduler);
+            counters(SinkId::Pipe).recordCycle(buf->c_str(), buf->size());
+            logger_.logCycle("Sent to pipe:", *buf);
+            pipeline.release();
+            scheduler.waitNextCycle();
+        }
+        timing.dump();
+        if (vms.ready() && vms.fallbackCycles() > 0) {
+            std::cout << "Pipe writer copied " << vms.fallbackCycles()
+                      << " cycle(s) whose splice buffers had not drained." << std::endl;
+        }
+        if (tcap.ready() && tcap.copiedCycles() > 0) {
+            std::cout << "Capture copied " << tcap.copiedCycles()
+                      << " cycle(s) too large for the tee staging pipes." << std::endl;
+        }
+        if (unattached > 0) {
+            std::cout << "Pipe writer generated " << unattached
+                      << " cycle(s) with no reader attached." << std::endl;
+        }
+        if (pipe_fd != -1) {
+            close(pipe_fd);
+        }
+    }
+    reportOverruns("Pipe writer", scheduler);
+    std::cout << "Pipe writer thread exiting." << std::endl;
+}
+
+// Writer to serial port
+void PtyHandler::writerSerial()
+{
+    NMEA_ALLOC_SCOPE("PtyHandler::writerSerial");
+    CycleScheduler scheduler(interval_);
+    RateController rate_ctl(adapt_levels_, interval_, sink_counters_);
+    if (!file_path_.empty()) {
+        // Mode: Replay. The port is opened once for the replay
+        // lifetime: on real USB-serial adapters a per-cycle open()
+        // takes milliseconds and toggles DTR, so the device under test
+        // saw a line reset at every cycle boundary. The descriptor is
+        // reopened only after a write error.
+        int fd = open(serial_port_.c_str(), O_WRONLY | O_NOCTTY);
+        if (fd == -1) {
+            std::cerr << "Error opening serial port: " << serial_port_ << std::endl;
+            requestShutdown();
+            return;
+        }
+
+        replayLoop("Sent to serial port (Cycle):",
+                   [&](const std::vector<std::string_view>& cycle, std::string_view raw) {
+                       if (!(raw.empty() ? writeCycleV(fd, cycle)
+                                         : writeCycleRaw(fd, raw))) {
+                           logger_.logError("Error writing to serial port, reopening", errno);
+                           close(fd);
+                           fd = open(serial_port_.c_str(), O_WRONLY | O_NOCTTY);
+                           if (fd == -1
+                               || !(raw.empty() ? writeCycleV(fd, cycle)
+                                                : writeCycleRaw(fd, raw))) {
+                               logger_.logError("Error writing to serial port", errno);
+                               return false;
+                           }
+                       }
+                       if (shouldFlush()) {
+                           fsync(fd);
+                       }
+                       return true;
+                   });
+
+        if (fd != -1) {
+            close(fd);
+        }
+    } else {
+        // Mode: Generate data
+        int fd = open(serial_port_.c_str(), O_WRONLY | O_NOCTTY);
+        if (fd == -1) {
+            std::cerr << "Error opening serial port: " << serial_port_ << std::endl;
+            return;
+        }
+        serial_fd_.store(fd);
+
+        UringWriter uring;
+        if (use_uring_ && !uring.init(fd)) {
+            std::cerr << "io_uring unavailable, falling back to write()" << std::endl;
+        }
+        // A reconnected adapter gets a fresh fd the ring was not
+        // registered against, so after the first unplug the writer
+        // stays on plain write()
+        bool uring_ok = uring.ready();
+
+        CyclePipeline pipeline(generator_);
+        startPipeline(pipeline);
+
+        EmissionTiming timing;
+        timing.writer  = "Serial port writer";
+        timing.p99_out = &sink_write_p99_[static_cast<size_t>(SinkId::Serial)];
+        timing.sink    = static_cast<uint8_t>(SinkId::Serial);
+        while (!shutdown_event_.load()) {
+            if (!scenario_.empty() || !control_name_.empty()) {
+                applyScenario(scenario_, generator_, scheduler);
+            }
+            rate_ctl.cycle(scheduler, generator_);
+            timing.beginCycle();
+            const std::string* cycle = pipeline.next();
+            if (cycle == nullptr)
+                break;
+            timing.beginWrite(cycle->size());
+            captureCycle(*cycle);
+            checkpointCycle();
+
+            // Adapter unplugged (POLLERR/POLLHUP) or still reopening:
+            // count the missed cycle and keep the schedule running so
+            // generator state and sibling sinks are untouched
+            fd = serial_fd_.load();
+            bool lost = fd == -1;
+            if (!lost && serialDisconnected(fd)) {
+                beginSerialReopen();
+                uring_ok = false;
+                lost     = true;
+            }
+            if (!lost) {
+                if (uring_ok) {
+                    if (!uring.writeCycle(cycle->c_str(), cycle->size())) {
+                        beginSerialReopen();
+                        uring_ok = false;
+                        lost     = true;
+                    }
+                } else {
+                    ssize_t bytes_written = write(fd, cycle->c_str(), cycle->size());
+                    if (bytes_written == -1) {
+                        // EIO from a yanked adapter: recover, not exit
+                        beginSerialReopen();
+                        lost = true;
+                    } else if (shouldFlush()) {
+                        fsync(fd);
+                    }
+                }
+            }
+            if (lost) {
+                ++serial_lost_cycles_;
+                counters(SinkId::Serial).recordDropped();
+                pipeline.release();
+                scheduler.waitNextCycle();
+                continue;
+            }
+            timing.endWrite(scheduler);
+            counters(SinkId::Serial).recordCycle(cycle->c_str(), cycle->size());
+            logger_.logCycle("Sent to serial port:", *cycle);
+            pipeline.release();
+            scheduler.waitNextCycle();
+        }
+        if (uring.ready()) {
+            uring.drain();
+        }
+        if (serial_reopen_thread_.joinable()) {
+            serial_reopen_thread_.join();
+        }
+        fd = serial_fd_.exchange(-1);
+        if (fd != -1) {
+            close(fd);
+        }
+        timing.dump();
+        if (serial_lost_cycles_ > 0) {
+            std::cout << "Serial writer lost " << serial_lost_cycles_
+                      << " cycle(s) across " << serial_reconnects_
+                      << " reconnect(s)." << std::endl;
+        }
+        std::cout << "Serial port writer thread exiting." << std::endl;
+    }
+    reportOverruns("Serial port writer", scheduler);
+}
+
+// Non-destructive disconnect probe: POLLERR/POLLHUP show up with no
+// events requested, so a healthy fd costs one zero-timeout poll()
+bool PtyHandler::serialDisconnected(int fd)
+{
+    struct pollfd pfd = { fd, 0, 0 };
+    if (poll(&pfd, 1, 0) <= 0) {
+        return false;
+    }
+    return (pfd.revents & (POLLERR | POLLHUP)) != 0;
+}
+
+// Retire the dead fd and hand reopening to a side thread, so open()
+// stalls on a half-enumerated USB device never block the writer
+void PtyHandler::beginSerialReopen()
+{
+    int fd = serial_fd_.exchange(-1);
+    if (fd != -1) {
+        close(fd);
+    }
+    std::cerr << "Serial port disconnected: " << serial_port_ << ", reconnecting"
+              << std::endl;
+    if (serial_reopen_thread_.joinable()) {
+        serial_reopen_thread_.join();
+    }
+    serial_reopen_thread_ = std::thread(&PtyHandler::serialReopenLoop, this);
+}
+
+// Exponential backoff from 50 ms to a 2 s ceiling: fast enough that a
+// replug resumes within a cycle or two, slow enough not to hammer a
+// udev node that is gone for good. Sleeps are sliced so SIGINT still
+// shuts down promptly mid-retry.
+void PtyHandler::serialReopenLoop()
+{
+    unsigned backoff_ms = 50;
+    while (!shutdown_event_.load()) {
+        int fd = open(serial_port_.c_str(), O_WRONLY | O_NOCTTY);
+        if (fd != -1) {
+            ++serial_reconnects_;
+            serial_fd_.store(fd);
+            std::cout << "Serial port reconnected: " << serial_port_ << std::endl;
+            return;
+        }
+        for (unsigned slept = 0; slept < backoff_ms && !shutdown_event_.load();
+             slept += 10) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        if (backoff_ms < 2000) {
+            backoff_ms *= 2;
+        }
+    }
+}
+
+// Writer to PTY
+// Verified loopback (--selftest): read everything we emit back off our
+// own slave PTY and check it end to end. Framing and checksums are
+// verified with an incremental scan over the raw read buffer — memchr
+// (libc's vectorized scan) hops over inter-frame bytes such as UBX
+// binary, and the XOR folds as bytes stream past, so the reader keeps
+// up with anything the writer can push. Because the reader drains the
+// PTY continuously, the writer side sees no backpressure and the run
+// measures the verified end-to-end rate of this host.
+void PtyHandler::selfTestLoop()
+{
+    int fd = -1;
+    for (int tries = 0; tries < 100 && fd == -1 && !shutdown_event_.load(); ++tries) {
+        fd = open(slave_name_.c_str(), O_RDONLY | O_NOCTTY | O_NONBLOCK);
+        if (fd == -1) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    if (fd == -1) {
+        std::cerr << "Self-test: could not open " << slave_name_ << std::endl;
+        return;
+    }
+
+    enum class Frame { Idle, Body, Hex1, Hex2 };
+    Frame state    = Frame::Idle;
+    unsigned sum   = 0;
+    unsigned given = 0;
+    uint64_t ok = 0, bad = 0, bytes_read = 0;
+    auto hexVal = [](char c) -> unsigned {
+        if (c >= '0' && c <= '9')
+            return static_cast<unsigned>(c - '0');
+        if (c >= 'A' && c <= 'F')
+            return static_cast<unsigned>(c - 'A' + 10);
+        if (c >= 'a' && c <= 'f')
+            return static_cast<unsigned>(c - 'a' + 10);
+        return 16;
+    };
+    auto scan = [&](const char* p, size_t len) {
+        const char* end = p + len;
+        while (p < end) {
+            if (state == Frame::Idle) {
+                p = static_cast<const char*>(memchr(p, '$', static_cast<size_t>(end - p)));
+                if (p == nullptr) {
+                    return;
+                }
+                ++p;
+                sum   = 0;
+                state = Frame::Body;
+                continue;
+            }
+            char c = *p++;
+            if (state == Frame::Body) {
+                if (c == '*') {
+                    given = 0;
+                    state = Frame::Hex1;
+                } else if (c == '$' || c == '\n') {
+                    ++bad; // frame ended without a checksum
+                    sum   = 0;
+                    state = (c == '$') ? Frame::Body : Frame::Idle;
+                } else {
+                    sum ^= static_cast<unsigned char>(c);
+                }
+            } else {
+                unsigned digit = hexVal(c);
+                if (digit > 15) {
+                    ++bad;
+                    state = Frame::Idle;
+                } else {
+                    given = given * 16 + digit;
+                    if (state == Frame::Hex1) {
+                        state = Frame::Hex2;
+                    } else {
+                        given == sum ? ++ok : ++bad;
+                        state = Frame::Idle;
+                    }
+                }
+            }
+        }
+    };
+
+    char buf[65536];
+    auto started  = std::chrono::steady_clock::now();
+    bool saw_data = false;
+    for (;;) {
+        struct pollfd pfds[2] = { { fd, POLLIN, 0 }, { shutdown_wake_fd, POLLIN, 0 } };
+        poll(pfds, 2, 100);
+        ssize_t n = read(fd, buf, sizeof(buf));
+        if (n > 0) {
+            if (!saw_data) {
+                saw_data = true;
+                started  = std::chrono::steady_clock::now();
+            }
+            bytes_read += static_cast<uint64_t>(n);
+            scan(buf, static_cast<size_t>(n));
+            continue; // keep draining while data flows
+        }
+        if (n == 0 || (n == -1 && errno != EAGAIN && errno != EINTR)) {
+            break; // writer closed the master
+        }
+        if (shutdown_event_.load()) {
+            // One last grab of anything still queued in the PTY
+            n = read(fd, buf, sizeof(buf));
+            if (n > 0) {
+                bytes_read += static_cast<uint64_t>(n);
+                scan(buf, static_cast<size_t>(n));
+            }
+            break;
+        }
+    }
+    close(fd);
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    uint64_t sent  = counters(SinkId::Pty).bytes.load(std::memory_order_relaxed);
+    std::cout << "Self-test: verified " << ok << " sentence(s), " << bad
+              << " corrupt, read " << bytes_read << " of " << sent << " byte(s)";
+    if (sent > bytes_read) {
+        std::cout << " (" << (sent - bytes_read) << " lost)";
+    }
+    if (saw_data && elapsed > 0) {
+        char rate[64];
+        snprintf(rate, sizeof(rate), ", %.1f KB/s verified",
+                 static_cast<double>(bytes_read) / elapsed / 1024.0);
+        std::cout << rate;
+    }
+    std::cout << "." << std::endl;
+}
+
+void PtyHandler::writerPTY()
+{
+    NMEA_ALLOC_SCOPE("PtyHandler::writerPTY");
+    CycleScheduler scheduler(interval_);
+    RateController rate_ctl(adapt_levels_, interval_, sink_counters_);
+    if (!file_path_.empty()) {
+        // Mode: Replay
+        replayLoop("Sent to PTY (Cycle):",
+                   [&](const std::vector<std::string_view>& cycle, std::string_view raw) {
+                       if (!(raw.empty() ? writeCycleV(master_fd_, cycle)
+                                         : writeCycleRaw(master_fd_, raw))) {
+                           logger_.logError("Error writing to PTY", errno);
+                           return false;
+                       }
+                       return true;
+                   });
+    } else {
+        // Mode: Generate data
+        int epfd = epoll_create1(0);
+        if (epfd != -1) {
+            struct epoll_event ev {};
+            ev.events  = EPOLLOUT;
+            ev.data.fd = master_fd_;
+            epoll_ctl(epfd, EPOLL_CTL_ADD, master_fd_, &ev);
+        }
+
+        // Optional io_uring backend; completions carrying EAGAIN drop
+        // the (by then stale) cycle, matching the drop policy
+        UringWriter uring;
+        if (use_uring_ && !uring.init(master_fd_)) {
+            std::cerr << "io_uring unavailable, falling back to write()" << std::endl;
+        }
+
+        CyclePipeline pipeline(generator_);
+        startPipeline(pipeline);
+
+        EmissionTiming timing;
+        timing.writer  = "PTY writer";
+        timing.p99_out = &sink_write_p99_[static_cast<size_t>(SinkId::Pty)];
+        timing.sink    = static_cast<uint8_t>(SinkId::Pty);
+        while (!shutdown_event_.load()) {
+            if (!scenario_.empty() || !control_name_.empty()) {
+                applyScenario(scenario_, generator_, scheduler);
+            }
+            rate_ctl.cycle(scheduler, generator_);
+            // Latest-only coalescing: if the PTY is not writable at the
+            // cycle boundary, skip the whole cycle so the consumer
+            // resumes on fresh state instead of a torn backlog
+            if (backpressure_ == BackpressurePolicy::Latest) {
+                struct pollfd pfd = { master_fd_, POLLOUT, 0 };
+                if (poll(&pfd, 1, 0) == 0) {
+                    ++dropped_cycles_;
+                    counters(SinkId::Pty).recordDropped();
+                    scheduler.waitNextCycle();
+                    continue;
+                }
+            }
+
+            timing.beginCycle();
+            const std::string* cycle = pipeline.next();
+            if (cycle == nullptr)
+                break;
+            timing.beginWrite(cycle->size());
+            captureCycle(*cycle);
+            checkpointCycle();
+            if (uring.ready()) {
+                if (!uring.writeCycle(cycle->c_str(), cycle->size())) {
+                    requestShutdown();
+                    break;
+                }
+            } else if (!writePtyCycle(epfd, cycle->c_str(), cycle->size())) {
+                requestShutdown();
+                break;
+            }
+            timing.endWrite(scheduler);
+            counters(SinkId::Pty).recordCycle(cycle->c_str(), cycle->size());
+            logger_.logCycle("Sent to PTY:", *cycle);
+            pipeline.release();
+            scheduler.waitNextCycle();
+        }
+        if (uring.ready()) {
+            uring.drain();
+            dropped_cycles_ += uring.droppedCycles();
+        }
+        if (epfd != -1) {
+            close(epfd);
+        }
+        timing.dump();
+    }
+    close(master_fd_);
+    reportOverruns("PTY writer", scheduler);
+    if (dropped_cycles_ > 0) {
+        std::cout << "PTY writer dropped " << dropped_cycles_
+                  << " cycle(s) to consumer backpressure." << std::endl;
+    }
+    if (q_dropped_oldest_ + q_dropped_newest_ + q_coalesced_ > 0) {
+        std::cout << "Pending queue evicted " << q_dropped_oldest_
+                  << " oldest / refused " << q_dropped_newest_
+                  << " newest cycle(s), coalesced " << q_coalesced_ << "."
+                  << std::endl;
+    }
+    std::cout << "PTY writer thread exiting." << std::endl;
+}
+
+// Fleet mode (--count): N virtual serial ports driven from one process.
+// One process per simulated receiver costs a full copy of the binary,
+// the tables and the runtime per device; here the devices share the
+// process image and a small worker pool, so a 200-device rig is one
+// start() call and tens of megabytes instead of gigabytes. Each device
+// keeps its own generator clone (disjoint RNG stream via jump(), own
+// motion state), workers own disjoint contiguous device ranges so no
+// locking is needed, and each worker reuses a single generation buffer
+// across its devices. Slow consumers get the drop policy: a device
+// whose PTY buffer is full skips that cycle rather than stalling the
+// worker's whole range.
+//
+// Scheduling is deadline-driven (FleetScheduler): each device is a
+// small task in a per-worker timing wheel with its first deadline
+// staggered across the interval, and idle workers steal due work from
+// busy ones, so thousands of loosely-synchronized devices run on a
+// handful of threads with balanced load and no once-per-interval
+// write stampede.
+//
+// With --fleet-backend coro the same devices run as coroutines on a
+// single-threaded epoll reactor instead: no worker pool at all, one
+// ~200-byte frame per device, and device switches that are resumes
+// rather than kernel context switches.
+namespace {
+
+// One simulated device as a coroutine: sleep to the cycle deadline,
+// generate, wait for the sink to accept (giving up when the next cycle
+// is due), emit. Sequential-looking code, but every co_await parks the
+// device on the shared reactor.
+CoroReactor::DeviceTask fleetDeviceLoop(CoroReactor& reactor,
+                                        const std::atomic<bool>& shutdown, int fd,
+                                        NmeaGenerator& gen, std::string& buffer,
+                                        double interval_seconds, double phase_seconds,
+                                        std::atomic<uint64_t>& dropped)
+{
+    auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(interval_seconds));
+    // Phase-staggered start, so the fleet trickles instead of bursting
+    auto deadline = std::chrono::steady_clock::now()
+        + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(phase_seconds));
+    for (;;) {
+        co_await reactor.sleepUntil(deadline);
+        if (shutdown.load()) {
+            co_return;
+        }
+        buffer.clear();
+        gen.generateAllSentences(buffer);
+        deadline += interval;
+        // Backpressure: wait for the PTY at most until the next cycle
+        // is due, then drop this one so the device never falls behind
+        if (!co_await reactor.writableBefore(fd, deadline)) {
+            if (shutdown.load()) {
+                co_return;
+            }
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        if (shutdown.load()) {
+            co_return;
+        }
+        ssize_t written = write(fd, buffer.data(), buffer.size());
+        if (written != static_cast<ssize_t>(buffer.size())) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+// Parse sysfs cpulist syntax ("0-7,16-23") into explicit CPU numbers
+std::vector<int> parseCpuList(const char* text)
+{
+    std::vector<int> cpus;
+    const char* p = text;
+    while (*p != '\0' && *p != '\n') {
+        char* end = nullptr;
+        long lo   = strtol(p, &end, 10);
+        long hi   = lo;
+        if (end == p) {
+            break;
+        }
+        p = end;
+        if (*p == '-') {
+            hi = strtol(p + 1, &end, 10);
+            p  = end;
+        }
+        for (long cpu = lo; cpu <= hi; ++cpu) {
+            cpus.push_back(static_cast<int>(cpu));
+        }
+        if (*p == ',') {
+            ++p;
+        }
+    }
+    return cpus;
+}
+
+// CPUs per NUMA node, from /sys/devices/system/node. Memory-only
+// nodes (empty cpulist) are skipped; a single-node or nodeless host
+// returns one entry or none, and placement stands down.
+std::vector<std::vector<int>> numaNodeCpus()
+{
+    std::vector<std::vector<int>> nodes;
+    for (int node = 0;; ++node) {
+        char path[64];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+        FILE* f = fopen(path, "r");
+        if (f == nullptr) {
+            break;
+        }
+        char line[512];
+        if (fgets(line, sizeof(line), f) != nullptr) {
+            std::vector<int> cpus = parseCpuList(line);
+            if (!cpus.empty()) {
+                nodes.push_back(std::move(cpus));
+            }
+        }
+        fclose(f);
+    }
+    return nodes;
+}
+
+// Lease protocol for a resident fleet (--lease): one warmed daemon
+// holds the device pool and each test attaches to a free device in
+// milliseconds instead of paying a fresh simulator spawn — PTYs,
+// generator clones and symlinks all exist before the first attach. A
+// client (the "attach" CLI verb) connects to the abstract socket and
+// sends "attach" plus any control-style "name value" lines to shape
+// the device; the reply's first line is the leased port path. The
+// connection is the lease: further lines reconfigure the device live,
+// and close — including a crashed test — is the detach, at which
+// point the owning worker recycles the generator to the configured
+// baseline and the slot returns to the free list. Per-device state
+// crosses into the workers through the same atomic-pointer scheme as
+// --control, so the hot path stays lock-free.
+class LeaseServer {
+public:
+    ~LeaseServer()
+    {
+        stop();
+        for (size_t i = 0; i < count_; ++i) {
+            delete slots_[i].pending.exchange(nullptr, std::memory_order_acq_rel);
+        }
+    }
+
+    // Set once before the workers start and never cleared, so the
+    // per-cycle check is a plain load
+    bool active() const { return started_; }
+
+    bool start(const std::string& name, std::vector<std::string> ports,
+               const std::atomic<bool>& shutdown)
+    {
+        ports_ = std::move(ports);
+        count_ = ports_.size();
+        slots_ = std::make_unique<Slot[]>(count_);
+        free_.reserve(count_);
+        // Lease low indices first, matching the order the ports print
+        for (size_t i = count_; i > 0; --i) {
+            free_.push_back(static_cast<uint32_t>(i - 1));
+        }
+
+        listen_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listen_fd_ == -1) {
+            std::cerr << "Error creating lease socket: " << strerror(errno) << std::endl;
+            return false;
+        }
+        struct sockaddr_un addr {};
+        addr.sun_family = AF_UNIX;
+        size_t name_len = std::min(name.size(), sizeof(addr.sun_path) - 1);
+        memcpy(addr.sun_path + 1, name.data(), name_len);
+        socklen_t addr_len
+            = static_cast<socklen_t>(offsetof(struct sockaddr_un, sun_path) + 1 + name_len);
+        if (bind(listen_fd_, reinterpret_cast<struct sockaddr*>(&addr), addr_len) == -1
+            || listen(listen_fd_, 8) == -1) {
+            std::cerr << "Error binding lease socket @" << name << ": " << strerror(errno)
+                      << std::endl;
+            close(listen_fd_);
+            listen_fd_ = -1;
+            return false;
+        }
+        started_ = true;
+        thread_  = std::thread(&LeaseServer::serve, this, &shutdown);
+        std::cout << "Lease endpoint listening on @" << name << "; " << count_
+                  << " device(s) in the pool" << std::endl;
+        return true;
+    }
+
+    void stop()
+    {
+        stop_.store(true);
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    // Worker-side hooks, called at the device's cycle boundary. A set
+    // recycle flag means the lease ended since the last cycle and the
+    // caller should restore the device's baseline generator state.
+    bool takeRecycle(uint32_t d)
+    {
+        return slots_[d].recycle.exchange(false, std::memory_order_acq_rel);
+    }
+    ControlUpdate* takePending(uint32_t d)
+    {
+        return slots_[d].pending.exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+private:
+    struct Slot {
+        std::atomic<ControlUpdate*> pending { nullptr };
+        std::atomic<bool> recycle { false };
+    };
+    struct Lease {
+        int fd;
+        uint32_t device;
+    };
+
+    // Fold the parsed commands into the device's pending slot; an
+    // update the worker has not consumed yet is merged, like --control
+    void publish(uint32_t d, std::unique_ptr<ControlUpdate> update)
+    {
+        ControlUpdate* stale = slots_[d].pending.exchange(nullptr, std::memory_order_acq_rel);
+        if (stale != nullptr) {
+            if (std::isnan(update->speed)) update->speed = stale->speed;
+            if (std::isnan(update->course)) update->course = stale->course;
+            if (update->sats < 0) update->sats = stale->sats;
+            if (update->fix < -1) update->fix = stale->fix;
+            if (std::isnan(update->hdop)) update->hdop = stale->hdop;
+            if (update->mask == 0) update->mask = stale->mask;
+            delete stale;
+        }
+        slots_[d].pending.store(update.release(), std::memory_order_release);
+    }
+
+    // Parse one request blob — command lines applied to the device —
+    // and answer with per-command acknowledgements
+    void applyCommands(int fd, uint32_t device, char* request)
+    {
+        auto update = std::make_unique<ControlUpdate>();
+        std::string reply;
+        char* save = nullptr;
+        for (char* line = strtok_r(request, "\r\n", &save); line != nullptr;
+             line       = strtok_r(nullptr, "\r\n", &save)) {
+            parseControlCommand(line, *update, reply, false);
+        }
+        publish(device, std::move(update));
+        (void)!write(fd, reply.c_str(), reply.size());
+    }
+
+    void handleAttach(int conn)
+    {
+        char request[512];
+        ssize_t got = read(conn, request, sizeof(request) - 1);
+        if (got <= 0) {
+            close(conn);
+            return;
+        }
+        request[got] = '\0';
+        char* save   = nullptr;
+        char* first  = strtok_r(request, "\r\n", &save);
+        if (first == nullptr || strncmp(first, "attach", 6) != 0) {
+            const char* err = "error: expected attach\n";
+            (void)!write(conn, err, strlen(err));
+            close(conn);
+            return;
+        }
+        if (free_.empty()) {
+            const char* err = "error: no free device\n";
+            (void)!write(conn, err, strlen(err));
+            close(conn);
+            return;
+        }
+        uint32_t device = free_.back();
+        free_.pop_back();
+        std::string reply = ports_[device] + "\n";
+        (void)!write(conn, reply.c_str(), reply.size());
+        char* rest = strtok_r(nullptr, "", &save);
+        if (rest != nullptr) {
+            applyCommands(conn, device, rest);
+        }
+        leases_.push_back(Lease { conn, device });
+    }
+
+    void detach(size_t lease_idx)
+    {
+        Lease lease = leases_[lease_idx];
+        leases_.erase(leases_.begin() + static_cast<long>(lease_idx));
+        close(lease.fd);
+        // Recycle before the slot is leasable again, so the next
+        // attach never sees the previous test's state
+        slots_[lease.device].recycle.store(true, std::memory_order_release);
+        free_.push_back(lease.device);
+    }
+
+    void serve(const std::atomic<bool>* shutdown)
+    {
+        std::vector<struct pollfd> pfds;
+        while (!stop_.load() && !shutdown->load()) {
+            pfds.clear();
+            pfds.push_back({ listen_fd_, POLLIN, 0 });
+            for (const Lease& lease : leases_) {
+                pfds.push_back({ lease.fd, POLLIN, 0 });
+            }
+            if (poll(pfds.data(), static_cast<nfds_t>(pfds.size()), 200) <= 0) {
+                continue;
+            }
+            // Walk leases back to front so detaching one does not
+            // shift the indices still to visit
+            for (size_t i = leases_.size(); i > 0; --i) {
+                if ((pfds[i].revents & (POLLIN | POLLHUP | POLLERR)) == 0) {
+                    continue;
+                }
+                char request[512];
+                ssize_t got = read(leases_[i - 1].fd, request, sizeof(request) - 1);
+                if (got <= 0) {
+                    detach(i - 1);
+                    continue;
+                }
+                request[got] = '\0';
+                applyCommands(leases_[i - 1].fd, leases_[i - 1].device, request);
+            }
+            if (pfds[0].revents & POLLIN) {
+                int conn = accept(listen_fd_, nullptr, nullptr);
+                if (conn != -1) {
+                    handleAttach(conn);
+                }
+            }
+        }
+        for (const Lease& lease : leases_) {
+            close(lease.fd);
+        }
+        leases_.clear();
+        close(listen_fd_);
+        listen_fd_ = -1;
+    }
+
+    std::vector<std::string> ports_;
+    std::unique_ptr<Slot[]> slots_;
+    size_t count_ = 0;
+    std::vector<uint32_t> free_;
+    std::vector<Lease> leases_;
+    int listen_fd_ = -1;
+    bool started_  = false;
+    std::atomic<bool> stop_ { false };
+    std::thread thread_;
+};
+
+} // namespace
+
+void PtyHandler::writerFleet()
+{
+    NMEA_ALLOC_SCOPE("PtyHandler::writerFleet");
+    struct FleetDevice {
+        int fd;
+        std::string link;
+        NmeaGenerator gen;
+    };
+
+    std::vector<FleetDevice> devices;
+    devices.reserve(device_count_);
+
+    // Pool creation is parallel: each openpty() is a devpts inode
+    // create plus several tty ioctls, and done sequentially a
+    // 500-device rig spends tens of seconds before the first sentence.
+    // A few setup threads overlap that kernel work, each building its
+    // termios template once and stamping it onto every slave it opens.
+    // Startup time is a first-class metric for CI rigs, so the
+    // aggregate time-to-all-ready is reported.
+    auto setup_start = std::chrono::steady_clock::now();
+    std::vector<int> fds(device_count_, -1);
+    std::vector<std::string> slaves(device_count_);
+    unsigned hw_setup      = std::thread::hardware_concurrency();
+    unsigned setup_threads = std::min({ device_count_, hw_setup > 0 ? hw_setup : 1u, 8u });
+    {
+        std::vector<std::thread> pool;
+        pool.reserve(setup_threads);
+        for (unsigned t = 0; t < setup_threads; ++t) {
+            pool.emplace_back([this, t, setup_threads, &fds, &slaves]() {
+                struct termios tmpl;
+                bool have_tmpl = false;
+                for (unsigned i = t; i < device_count_; i += setup_threads) {
+                    fds[i] = openPtyMasterTpl(slaves[i], tmpl, have_tmpl);
+                    if (fds[i] == -1) {
+                        requestShutdown();
+                        return;
+                    }
+                }
+            });
+        }
+        for (auto& worker : pool) {
+            worker.join();
+        }
+    }
+
+    // The link template's "%d" expands to the device index. Failed
+    // links go to the background reconciler rather than delaying the
+    // remaining N-1 devices behind retries. Symlinks and generator
+    // clones are microseconds apiece, so they stay sequential.
+    std::vector<std::pair<std::string, std::string>> failed_links;
+    std::vector<std::string> lease_ports;
+    size_t marker = symlink_path_.find("%d");
+    for (unsigned i = 0; i < device_count_; ++i) {
+        if (fds[i] == -1) {
+            continue;
+        }
+        std::string link;
+        if (marker != std::string::npos) {
+            link = symlink_path_.substr(0, marker) + std::to_string(i)
+                + symlink_path_.substr(marker + 2);
+            if (!attemptSymlink(slaves[i], link)) {
+                std::cerr << "Failed to create symbolic link: " << link << " ("
+                          << strerror(errno) << "); retrying in the background" << std::endl;
+                failed_links.emplace_back(slaves[i], link);
+            }
+        }
+        if (!lease_name_.empty()) {
+            lease_ports.push_back(link.empty() ? slaves[i] : link);
+        }
+        devices.push_back(FleetDevice { fds[i], std::move(link), generator_->cloneForThread() });
+    }
+    if (!failed_links.empty()) {
+        startSymlinkReconciler(std::move(failed_links));
+    }
+
+    if (!shutdown_event_.load()) {
+        auto ready_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now() - setup_start)
+                            .count();
+        std::cout << "Fleet: " << devices.size() << " virtual serial ports at "
+                  << symlink_path_ << " (0.." << devices.size() - 1 << "), all ready in "
+                  << ready_ms << " ms" << std::endl;
+
+        unsigned hw = std::thread::hardware_concurrency();
+        unsigned workers
+            = std::min<unsigned>(static_cast<unsigned>(devices.size()), hw > 0 ? hw : 1);
+
+        // Per-device reusable generation buffers; the scheduler never
+        // runs the same device concurrently, so no locking
+        std::vector<std::string> buffers(devices.size());
+
+        // NUMA placement for multi-socket rigs: with device state,
+        // cycle buffers and workers landing on arbitrary nodes, large
+        // --count runs pay cross-socket traffic on every cycle and
+        // show run-to-run variance from wherever the pages happened to
+        // fault in. Workers are split contiguously across the nodes
+        // and pinned to their node's CPU set, and a pinned thread per
+        // node rebuilds its devices' generator state and faults their
+        // buffers, so first-touch lands every page node-local to the
+        // worker that will run the device.
+        std::vector<FleetScheduler::WorkerPlacement> placement;
+        std::vector<std::vector<int>> nodes = numaNodeCpus();
+        if (!fleet_coro_ && workers > 1 && nodes.size() > 1) {
+            placement.resize(workers);
+            for (unsigned w = 0; w < workers; ++w) {
+                size_t node  = static_cast<size_t>(w) * nodes.size() / workers;
+                placement[w] = FleetScheduler::WorkerPlacement { nodes[node],
+                                                                 static_cast<int>(node) };
+            }
+            std::vector<std::thread> movers;
+            movers.reserve(nodes.size());
+            for (size_t node = 0; node < nodes.size(); ++node) {
+                movers.emplace_back([&, node]() {
+                    cpu_set_t set;
+                    CPU_ZERO(&set);
+                    for (int cpu : nodes[node]) {
+                        CPU_SET(cpu, &set);
+                    }
+                    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+                    for (size_t d = 0; d < devices.size(); ++d) {
+                        unsigned w = FleetScheduler::workerOf(static_cast<uint32_t>(d),
+                                                              workers);
+                        if (placement[w].node != static_cast<int>(node)) {
+                            continue;
+                        }
+                        // Copy-and-move rebuilds the generator's heap
+                        // state through this node's allocator without
+                        // disturbing its RNG stream or trajectory
+                        NmeaGenerator local(devices[d].gen);
+                        devices[d].gen = std::move(local);
+                        // Fault the buffer's pages here, not on the
+                        // first generation
+                        buffers[d].assign(2048, '\0');
+                        buffers[d].clear();
+                    }
+                });
+            }
+            for (auto& mover : movers) {
+                mover.join();
+            }
+            std::cout << "Fleet: NUMA placement across " << nodes.size() << " node(s), "
+                      << workers << " pinned worker(s), device state node-local."
+                      << std::endl;
+        } else {
+            for (auto& buffer : buffers) {
+                buffer.reserve(2048);
+            }
+        }
+
+        // The lease server outlives the workers; main rejects --lease
+        // with the coroutine backend, whose device loops lack the
+        // cycle-boundary hook
+        LeaseServer lease;
+        std::mutex recycle_clone_mutex;
+        if (!lease_name_.empty() && !fleet_coro_) {
+            if (!lease.start(lease_name_, std::move(lease_ports), shutdown_event_)) {
+                requestShutdown();
+            }
+        }
+
+        std::atomic<uint64_t> dropped { 0 };
+        bool use_threads = !fleet_coro_;
+        if (fleet_coro_) {
+            CoroReactor reactor;
+            if (reactor.valid()) {
+                for (size_t d = 0; d < devices.size(); ++d) {
+                    fleetDeviceLoop(reactor, shutdown_event_, devices[d].fd, devices[d].gen,
+                                    buffers[d], interval_,
+                                    interval_ * static_cast<double>(d)
+                                        / static_cast<double>(devices.size()),
+                                    dropped);
+                }
+                reactor.run(shutdown_event_);
+            } else {
+                std::cerr << "epoll unavailable for the coroutine reactor, "
+                             "falling back to the thread-pool fleet"
+                          << std::endl;
+                use_threads = true;
+            }
+        }
+        if (use_threads) {
+            FleetScheduler scheduler(static_cast<uint32_t>(devices.size()), interval_,
+                                     workers);
+            if (!placement.empty()) {
+                scheduler.setPlacement(std::move(placement));
+            }
+            scheduler.run(
+                [&](uint32_t d) {
+                    if (lease.active()) {
+                        if (lease.takeRecycle(d)) {
+                            // A lease ended: restore the configured
+                            // baseline so the next attach never sees
+                            // the previous test's state. cloneForThread
+                            // advances the prototype RNG, so concurrent
+                            // recycles are serialized; detaches are
+                            // rare enough that the lock never shows.
+                            std::lock_guard<std::mutex> lock(recycle_clone_mutex);
+                            devices[d].gen = generator_->cloneForThread();
+                        }
+                        if (ControlUpdate* update = lease.takePending(d)) {
+                            applyControlToGenerator(*update, &devices[d].gen);
+                            delete update;
+                        }
+                    }
+                    std::string& buffer = buffers[d];
+                    buffer.clear();
+                    devices[d].gen.generateAllSentences(buffer);
+                    ssize_t written = write(devices[d].fd, buffer.data(), buffer.size());
+                    if (written != static_cast<ssize_t>(buffer.size())) {
+                        dropped.fetch_add(1, std::memory_order_relaxed);
+                    }
+                },
+                shutdown_event_);
+
+            if (scheduler.lateCycles() > 0) {
+                std::cout << "Fleet scheduler ran " << scheduler.lateCycles()
+                          << " device-cycle(s) a full interval late; consider a longer "
+                             "--interval or fewer devices."
+                          << std::endl;
+            }
+        }
+        if (dropped.load() > 0) {
+            std::cout << "Fleet writers dropped " << dropped.load()
+                      << " device-cycle(s) to consumer backpressure." << std::endl;
+        }
+    }
+
+    for (auto& dev : devices) {
+        close(dev.fd);
+        if (!dev.link.empty()) {
+            unlink(dev.link.c_str());
+        }
+    }
+    std::cout << "Fleet writer threads exiting." << std::endl;
+}
+
+// Open a datagram socket connected to the configured UDP destination.
+// Multicast groups get IP_MULTICAST_TTL, unicast gets IP_TTL; the
+// socket is connected so the hot path is a plain send() per cycle.
+int PtyHandler::openUdpSocket()
+{
+    struct addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family   = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+
+    char port[16];
+    std::snprintf(port, sizeof(port), "%u", static_cast<unsigned>(udp_port_));
+    struct addrinfo* res = nullptr;
+    int rc               = getaddrinfo(udp_host_.c_str(), port, &hints, &res);
+    if (rc != 0 || res == nullptr) {
+        std::cerr << "Error resolving UDP destination " << udp_host_ << ": "
+                  << gai_strerror(rc) << std::endl;
+        return -1;
+    }
+
+    int fd = socket(res->ai_family, SOCK_DGRAM, 0);
+    if (fd == -1) {
+        std::cerr << "Error creating UDP socket: " << strerror(errno) << std::endl;
+        freeaddrinfo(res);
+        return -1;
+    }
+
+    const struct sockaddr_in* sin = reinterpret_cast<const struct sockaddr_in*>(res->ai_addr);
+    if (IN_MULTICAST(ntohl(sin->sin_addr.s_addr))) {
+        unsigned char ttl = static_cast<unsigned char>(udp_ttl_);
+        setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+    } else {
+        int ttl = udp_ttl_;
+        setsockopt(fd, IPPROTO_IP, IP_TTL, &ttl, sizeof(ttl));
+    }
+
+    if (connect(fd, res->ai_addr, res->ai_addrlen) == -1) {
+        std::cerr << "Error connecting UDP socket: " << strerror(errno) << std::endl;
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+    return fd;
+}
+
+#if defined(SO_TXTIME)
+namespace {
+
+// Map a monotonic deadline onto CLOCK_TAI, which is what the ETF qdisc
+// keys on. The two clocks tick at the same rate, only the epoch
+// differs, so the rebase costs one clock_gettime and no drift.
+uint64_t txtimeFor(std::chrono::steady_clock::time_point deadline)
+{
+    struct timespec tai;
+    clock_gettime(CLOCK_TAI, &tai);
+    int64_t ahead = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        deadline - std::chrono::steady_clock::now())
+                        .count();
+    return static_cast<uint64_t>(tai.tv_sec * 1000000000LL + tai.tv_nsec
+                                 + ahead);
+}
+
+// Send one datagram stamped for release at the given monotonic deadline
+bool sendStamped(int fd, const std::string& payload,
+                 std::chrono::steady_clock::time_point deadline)
+{
+    uint64_t txtime_ns = txtimeFor(deadline);
+
+    struct iovec iov;
+    iov.iov_base = const_cast<char*>(payload.c_str());
+    iov.iov_len  = payload.size();
+    char ctrl[CMSG_SPACE(sizeof(txtime_ns))] = {};
+    struct msghdr msg {};
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = ctrl;
+    msg.msg_controllen = sizeof(ctrl);
+    struct cmsghdr* cm = CMSG_FIRSTHDR(&msg);
+    cm->cmsg_level     = SOL_SOCKET;
+    cm->cmsg_type      = SCM_TXTIME;
+    cm->cmsg_len       = CMSG_LEN(sizeof(txtime_ns));
+    std::memcpy(CMSG_DATA(cm), &txtime_ns, sizeof(txtime_ns));
+    return sendmsg(fd, &msg, 0) != -1 || errno == ECONNREFUSED;
+}
+
+} // namespace
+#endif
+
+// Writer to a UDP destination: one datagram per cycle, so consumers get
+// natural cycle framing with no line reassembly
+void PtyHandler::writerUdp()
+{
+    if (!udp_extra_.empty()) {
+        writerUdpFanout();
+        return;
+    }
+    CycleScheduler scheduler(interval_);
+    RateController rate_ctl(adapt_levels_, interval_, sink_counters_);
+    int fd = openUdpSocket();
+    if (fd == -1) {
+        requestShutdown();
+        return;
+    }
+
+    // Hardware-paced emission (--udp-txtime): the kernel or NIC holds
+    // each datagram until its stamped deadline, so wire-level release
+    // jitter is the qdisc's, not the thread scheduler's. Userspace runs
+    // one interval ahead and the stamp is the slot waitNextCycle sleeps
+    // to. When the kernel refuses the option the writer says so once
+    // and the hybrid timer alone paces the stream as before.
+    bool txtime = udp_txtime_;
+#if defined(SO_TXTIME)
+    if (txtime) {
+        struct sock_txtime txcfg {};
+        txcfg.clockid = CLOCK_TAI;
+        if (setsockopt(fd, SOL_SOCKET, SO_TXTIME, &txcfg, sizeof(txcfg)) == -1) {
+            std::cerr << "SO_TXTIME unavailable (" << strerror(errno)
+                      << "); pacing in software." << std::endl;
+            txtime = false;
+        }
+    }
+#else
+    if (txtime) {
+        std::cerr << "SO_TXTIME not supported by this build; pacing in software."
+                  << std::endl;
+        txtime = false;
+    }
+#endif
+
+    CyclePipeline pipeline(generator_);
+    startPipeline(pipeline);
+
+#if defined(SO_TXTIME)
+    const auto interval_span
+        = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(interval_));
+#endif
+
+    while (!shutdown_event_.load()) {
+        rate_ctl.cycle(scheduler, generator_);
+        const std::string* cycle = pipeline.next();
+        if (cycle == nullptr)
+            break;
+        bool sent;
+#if defined(SO_TXTIME)
+        if (txtime) {
+            sent = sendStamped(fd, *cycle,
+                               scheduler.currentDeadline() + interval_span);
+        } else
+#endif
+        {
+            // ECONNREFUSED is just an ICMP echo of a closed consumer
+            // port; anything else is a real socket error
+            sent = send(fd, cycle->c_str(), cycle->size(), 0) != -1
+                || errno == ECONNREFUSED;
+        }
+        if (!sent) {
+            logger_.logError("Error sending UDP datagram", errno);
+            break;
+        }
+        counters(SinkId::Udp).recordCycle(cycle->c_str(), cycle->size());
+        logger_.logCycle("Sent to UDP:", *cycle);
+        pipeline.release();
+        scheduler.waitNextCycle();
+    }
+    close(fd);
+    reportOverruns("UDP writer", scheduler);
+    std::cout << "UDP writer thread exiting." << std::endl;
+}
+
+// Multi-destination UDP writer: with tens of consumers, a sendto per
+// client per cycle is one syscall per client — 5,000/s at 100 Hz x 50
+// clients, all carrying identical payloads. Instead every consumer's
+// msghdr references the one shared cycle buffer through a single
+// shared iovec and the whole batch leaves in one sendmmsg; the msghdr
+// array is built once and reused, so an additional consumer costs one
+// msghdr entry, not one syscall.
+void PtyHandler::writerUdpFanout()
+{
+    CycleScheduler scheduler(interval_);
+    RateController rate_ctl(adapt_levels_, interval_, sink_counters_);
+
+    // Resolve every destination up front; a bad address is a setup
+    // error, not something to discover on the hot path
+    std::vector<struct sockaddr_in> addrs(1 + udp_extra_.size());
+    auto resolve = [](const std::string& host, uint16_t port,
+                      struct sockaddr_in& out) {
+        struct addrinfo hints;
+        std::memset(&hints, 0, sizeof(hints));
+        hints.ai_family   = AF_INET;
+        hints.ai_socktype = SOCK_DGRAM;
+        char portstr[16];
+        std::snprintf(portstr, sizeof(portstr), "%u", static_cast<unsigned>(port));
+        struct addrinfo* res = nullptr;
+        int rc               = getaddrinfo(host.c_str(), portstr, &hints, &res);
+        if (rc != 0 || res == nullptr) {
+            std::cerr << "Error resolving UDP destination " << host << ": "
+                      << gai_strerror(rc) << std::endl;
+            return false;
+        }
+        std::memcpy(&out, res->ai_addr, sizeof(out));
+        freeaddrinfo(res);
+        return true;
+    };
+    bool resolved = resolve(udp_host_, udp_port_, addrs[0]);
+    for (size_t i = 0; i < udp_extra_.size() && resolved; ++i) {
+        resolved = resolve(udp_extra_[i].first, udp_extra_[i].second,
+                           addrs[1 + i]);
+    }
+    if (!resolved) {
+        requestShutdown();
+        return;
+    }
+
+    // One unconnected socket serves every destination; both TTL forms
+    // are applied since the batch may mix unicast and multicast
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd == -1) {
+        std::cerr << "Error creating UDP socket: " << strerror(errno) << std::endl;
+        requestShutdown();
+        return;
+    }
+    {
+        int ttl = udp_ttl_;
+        setsockopt(fd, IPPROTO_IP, IP_TTL, &ttl, sizeof(ttl));
+        unsigned char mttl = static_cast<unsigned char>(udp_ttl_);
+        setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &mttl, sizeof(mttl));
+    }
+
+    bool txtime = udp_txtime_;
+#if defined(SO_TXTIME)
+    if (txtime) {
+        struct sock_txtime txcfg {};
+        txcfg.clockid = CLOCK_TAI;
+        if (setsockopt(fd, SOL_SOCKET, SO_TXTIME, &txcfg, sizeof(txcfg)) == -1) {
+            std::cerr << "SO_TXTIME unavailable (" << strerror(errno)
+                      << "); pacing in software." << std::endl;
+            txtime = false;
+        }
+    }
+#else
+    if (txtime) {
+        std::cerr << "SO_TXTIME not supported by this build; pacing in software."
+                  << std::endl;
+        txtime = false;
+    }
+#endif
+
+    // Persistent sendmmsg scaffolding, reused across cycles: only the
+    // shared iovec (and the shared txtime stamp) change per cycle
+    size_t n = addrs.size();
+    struct iovec iov {};
+    std::vector<struct mmsghdr> msgs(n);
+#if defined(SO_TXTIME)
+    char ctrl[CMSG_SPACE(sizeof(uint64_t))] = {};
+    if (txtime) {
+        struct cmsghdr* cm = reinterpret_cast<struct cmsghdr*>(ctrl);
+        cm->cmsg_level     = SOL_SOCKET;
+        cm->cmsg_type      = SCM_TXTIME;
+        cm->cmsg_len       = CMSG_LEN(sizeof(uint64_t));
+    }
+#endif
+    for (size_t i = 0; i < n; ++i) {
+        struct msghdr& mh = msgs[i].msg_hdr;
+        mh.msg_name       = &addrs[i];
+        mh.msg_namelen    = sizeof(addrs[i]);
+        mh.msg_iov        = &iov;
+        mh.msg_iovlen     = 1;
+#if defined(SO_TXTIME)
+        if (txtime) {
+            mh.msg_control    = ctrl;
+            mh.msg_controllen = sizeof(ctrl);
+        }
+#endif
+    }
+
+#if defined(SO_TXTIME)
+    const auto interval_span
+        = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(interval_));
+#endif
+
+    CyclePipeline pipeline(generator_);
+    startPipeline(pipeline);
+
+    while (!shutdown_event_.load()) {
+        rate_ctl.cycle(scheduler, generator_);
+        const std::string* cycle = pipeline.next();
+        if (cycle == nullptr)
+            break;
+        iov.iov_base = const_cast<char*>(cycle->c_str());
+        iov.iov_len  = cycle->size();
+#if defined(SO_TXTIME)
+        if (txtime) {
+            uint64_t stamp
+                = txtimeFor(scheduler.currentDeadline() + interval_span);
+            std::memcpy(CMSG_DATA(reinterpret_cast<struct cmsghdr*>(ctrl)),
+                        &stamp, sizeof(stamp));
+        }
+#endif
+        // sendmmsg stops at the first failing datagram; resume from
+        // there so one refused consumer never starves the rest
+        size_t off = 0;
+        bool fail  = false;
+        while (off < n) {
+            int sent = sendmmsg(fd, msgs.data() + off,
+                                static_cast<unsigned>(n - off), 0);
+            if (sent == -1) {
+                if (errno == EINTR)
+                    continue;
+                logger_.logError("Error sending UDP datagram batch", errno);
+                fail = true;
+                break;
+            }
+            off += static_cast<size_t>(sent);
+        }
+        if (fail)
+            break;
+        counters(SinkId::Udp).recordCycle(cycle->c_str(), cycle->size());
+        logger_.logCycle("Sent to UDP consumers:", *cycle);
+        pipeline.release();
+        scheduler.waitNextCycle();
+    }
+    close(fd);
+    reportOverruns("UDP fan-out writer", scheduler);
+    std::cout << "UDP fan-out writer thread exiting." << std::endl;
+}
+
+// In-process callback writer: the embedder's function gets the cycle
+// buffer directly — no serialization boundary, no kernel crossing —
+// while the scheduler and scenario machinery behave exactly as they do
+// for the byte-stream sinks. With --interval 0 the loop runs unpaced,
+// which is how fixtures fuzz a parser at millions of cycles per second.
+void PtyHandler::writerCallback()
+{
+    CycleScheduler scheduler(interval_);
+    RateController rate_ctl(adapt_levels_, interval_, sink_counters_);
+    CyclePipeline pipeline(generator_);
+    startPipeline(pipeline);
+
+    uint64_t seq = 0;
+    while (!shutdown_event_.load()) {
+        if (!scenario_.empty() || !control_name_.empty()) {
+            applyScenario(scenario_, generator_, scheduler);
+        }
+        rate_ctl.cycle(scheduler, generator_);
+        const std::string* cycle = pipeline.next();
+        if (cycle == nullptr)
+            break;
+        cycle_callback_(cycle->c_str(), cycle->size(), seq++);
+        counters(SinkId::Callback).recordCycle(cycle->c_str(), cycle->size());
+        pipeline.release();
+        // interval 0 = unpaced: skip the scheduler entirely, the
+        // deadline math has no meaning at fuzzing rates
+        if (interval_ > 0) {
+            scheduler.waitNextCycle();
+        }
+    }
+    if (interval_ > 0) {
+        reportOverruns("Callback writer", scheduler);
+    }
+}
+
+// Listening TCP writer: a 50-client rig is one process writing the one
+// shared buffer 50 times, not 50 simulator processes
+void PtyHandler::writerTcp()
+{
+    CycleScheduler scheduler(interval_);
+    RateController rate_ctl(adapt_levels_, interval_, sink_counters_);
+    TcpFanout server;
+    if (!server.listenOn(tcp_host_, tcp_port_)) {
+        requestShutdown();
+        return;
+    }
+
+    CyclePipeline pipeline(generator_);
+    startPipeline(pipeline);
+    CycleDeflate deflate;
+
+    // The fan-out's cumulative slow-consumer count, fed to the shared
+    // sink counters as deltas so --stats/--metrics and the adaptive
+    // controller see the pressure live, not just the exit report
+    uint64_t drops_fed = 0;
+
+    while (!shutdown_event_.load()) {
+        rate_ctl.cycle(scheduler, generator_);
+        server.pump();
+        const std::string* cycle = pipeline.next();
+        if (cycle == nullptr)
+            break;
+        if (compress_sinks_ && deflate.ready()) {
+            // Compressed once from the shared buffer, the same frame
+            // goes to every consumer
+            std::string_view frame = deflate.compress(cycle->c_str(), cycle->size(), true);
+            server.broadcast(frame.data(), frame.size());
+        } else {
+            server.broadcast(cycle->c_str(), cycle->size());
+        }
+        counters(SinkId::Tcp).recordCycle(cycle->c_str(), cycle->size());
+        uint64_t dropped = server.droppedSlow();
+        if (dropped > drops_fed) {
+            counters(SinkId::Tcp).dropped.fetch_add(dropped - drops_fed,
+                                                    std::memory_order_relaxed);
+            drops_fed = dropped;
+        }
+        logger_.logCycle("Sent to TCP consumers:", *cycle);
+        pipeline.release();
+        scheduler.waitNextCycle();
+    }
+    reportOverruns("TCP writer", scheduler);
+    if (server.droppedSlow() > 0) {
+        std::cout << "TCP writer disconnected " << server.droppedSlow()
+                  << " slow consumer(s)." << std::endl;
+    }
+    std::cout << "TCP writer thread exiting." << std::endl;
+}
+
+// Listening unix SEQPACKET writer: local consumers get connection
+// semantics plus per-cycle message framing without TCP overhead
+void PtyHandler::writerUnix()
+{
+    CycleScheduler scheduler(interval_);
+    RateController rate_ctl(adapt_levels_, interval_, sink_counters_);
+    UnixFanout server;
+    if (!server.listenOn(unix_path_)) {
+        requestShutdown();
+        return;
+    }
+
+    CyclePipeline pipeline(generator_);
+    startPipeline(pipeline);
+    CycleDeflate deflate;
+
+    // Cumulative full-buffer message drops, fed to the shared sink
+    // counters as deltas (the writerTcp() idiom)
+    uint64_t drops_fed = 0;
+
+    while (!shutdown_event_.load()) {
+        rate_ctl.cycle(scheduler, generator_);
+        server.pump();
+        const std::string* cycle = pipeline.next();
+        if (cycle == nullptr)
+            break;
+        if (compress_sinks_ && deflate.ready()) {
+            // One compressed message per cycle; SEQPACKET preserves
+            // the frame boundary, no length header needed
+            std::string_view frame = deflate.compress(cycle->c_str(), cycle->size(), false);
+            server.broadcast(frame.data(), frame.size());
+        } else {
+            server.broadcast(cycle->c_str(), cycle->size());
+        }
+        counters(SinkId::Unix).recordCycle(cycle->c_str(), cycle->size());
+        uint64_t dropped = server.droppedMessages();
+        if (dropped > drops_fed) {
+            counters(SinkId::Unix).dropped.fetch_add(dropped - drops_fed,
+                                                     std::memory_order_relaxed);
+            drops_fed = dropped;
+        }
+        logger_.logCycle("Sent to unix-socket consumers:", *cycle);
+        pipeline.release();
+        scheduler.waitNextCycle();
+    }
+    reportOverruns("Unix-socket writer", scheduler);
+    if (server.droppedMessages() > 0) {
+        std::cout << "Unix-socket writer dropped " << server.droppedMessages()
+                  << " message(s) to full consumer buffers." << std::endl;
+    }
+    std::cout << "Unix-socket writer thread exiting." << std::endl;
+}
+
+// Shared-memory writer: each cycle is one memcpy into the ring plus a
+// futex wake — no syscall on the data path, so the hand-off to a
+// mapped consumer is sub-microsecond versus ~20 us through the FIFO
+void PtyHandler::writerShm()
+{
+    CycleScheduler scheduler(interval_);
+    RateController rate_ctl(adapt_levels_, interval_, sink_counters_);
+    ShmRing ring;
+    if (!ring.create(shm_name_)) {
+        requestShutdown();
+        return;
+    }
+
+    CyclePipeline pipeline(generator_);
+    startPipeline(pipeline);
+
+    // Cumulative oversized-cycle truncations, fed to the shared sink
+    // counters as deltas (the writerTcp() idiom)
+    uint64_t drops_fed = 0;
+
+    while (!shutdown_event_.load()) {
+        rate_ctl.cycle(scheduler, generator_);
+        const std::string* cycle = pipeline.next();
+        if (cycle == nullptr)
+            break;
+        ring.publish(cycle->c_str(), cycle->size());
+        counters(SinkId::Shm).recordCycle(cycle->c_str(), cycle->size());
+        uint64_t truncated = ring.truncated();
+        if (truncated > drops_fed) {
+            counters(SinkId::Shm).dropped.fetch_add(truncated - drops_fed,
+                                                    std::memory_order_relaxed);
+            drops_fed = truncated;
+        }
+        logger_.logCycle("Published to shm ring:", *cycle);
+        pipeline.release();
+        scheduler.waitNextCycle();
+    }
+    reportOverruns("Shm-ring writer", scheduler);
+    if (ring.truncated() > 0) {
+        std::cout << "Shm-ring writer truncated " << ring.truncated()
+                  << " oversized cycle(s)." << std::endl;
+    }
+    std::cout << "Shm-ring writer thread exiting." << std::endl;
+}
+
+// Memory-mapped ring-file writer (--mmap-out): same slot protocol as
+// the shm ring, but backed by a plain file that offline consumers map
+// read-only and poll at leisure — no pipe coupling, no doorbell, and
+// the steady-state cost is one memcpy into the mapping with writeback
+// left to lazy msync. The file outlives the run as a flight recorder
+// of the last ring's worth of cycles.
+void PtyHandler::writerMmap()
+{
+    CycleScheduler scheduler(interval_);
+    ShmRing ring;
+    if (!ring.createFile(mmap_out_path_)) {
+        requestShutdown();
+        return;
+    }
+
+    CyclePipeline pipeline(generator_);
+    startPipeline(pipeline);
+
+    while (!shutdown_event_.load()) {
+        const std::string* cycle = pipeline.next();
+        if (cycle == nullptr)
+            break;
+        ring.publish(cycle->c_str(), cycle->size());
+        counters(SinkId::Mmap).recordCycle(cycle->c_str(), cycle->size());
+        logger_.logCycle("Published to ring file:", *cycle);
+        pipeline.release();
+        scheduler.waitNextCycle();
+    }
+    reportOverruns("Ring-file writer", scheduler);
+    if (ring.truncated() > 0) {
+        std::cout << "Ring-file writer truncated " << ring.truncated()
+                  << " oversized cycle(s)." << std::endl;
+    }
+    std::cout << "Ring-file writer thread exiting." << std::endl;
+}
+
+namespace {
+
+// One direction of the --bridge relay: bytes move src -> pipe -> dst
+// with two splice calls, so the payload never crosses into userspace.
+// Kernels that refuse splice on a tty end (EINVAL) flip that hop to a
+// read/write fallback on first refusal and the bridge keeps running —
+// still one process either way. A stalled destination drops bytes
+// rather than stalling the other direction, the same stance the PTY
+// writer takes against non-reading consumers.
+class BridgeRelay {
+public:
+    ~BridgeRelay()
+    {
+        if (fds_[0] != -1) {
+            close(fds_[0]);
+            close(fds_[1]);
+        }
+    }
+
+    bool init() { return pipe2(fds_, O_CLOEXEC | O_NONBLOCK) == 0; }
+
+    uint64_t dropped() const { return dropped_; }
+
+    // Move whatever src has ready toward dst. Returns false only on a
+    // hard error; EAGAIN and EIO are the normal weather of PTY ends
+    // whose consumers come and go.
+    bool forward(int src, int dst)
+    {
+        if (!splice_read_) {
+            return copyThrough(src, dst);
+        }
+        ssize_t n = splice(src, nullptr, fds_[1], nullptr, kHop,
+                           SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        if (n == -1) {
+            if (errno == EINVAL) {
+                splice_read_ = false; // tty end refuses splice; copy from now on
+                return copyThrough(src, dst);
+            }
+            return errno == EAGAIN || errno == EIO;
+        }
+        if (n == 0) {
+            return true;
+        }
+        return drainPipe(dst, static_cast<size_t>(n));
+    }
+
+private:
+    static constexpr size_t kHop = 65536;
+
+    // Push n bytes sitting in the pipe out to dst; whatever the
+    // destination refuses is discarded so the pipe never silts up
+    bool drainPipe(int dst, size_t n)
+    {
+        while (n > 0) {
+            ssize_t out = -1;
+            if (splice_write_) {
+                out = splice(fds_[0], nullptr, dst, nullptr, n,
+                             SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+                if (out == -1 && errno == EINVAL) {
+                    splice_write_ = false;
+                }
+            }
+            if (!splice_write_) {
+                ssize_t got = read(fds_[0], buf_, n < sizeof(buf_) ? n : sizeof(buf_));
+                if (got <= 0) {
+                    return true;
+                }
+                out = write(dst, buf_, static_cast<size_t>(got));
+                if (out == -1) {
+                    dropped_ += static_cast<uint64_t>(got);
+                    out = got; // bytes already left the pipe
+                    if (errno != EAGAIN && errno != EIO) {
+                        return false;
+                    }
+                }
+            } else if (out == -1) {
+                if (errno == EAGAIN || errno == EIO) {
+                    // Destination full or hung up: empty the pipe into
+                    // the scratch buffer and count the loss
+                    ssize_t got;
+                    while ((got = read(fds_[0], buf_, sizeof(buf_))) > 0) {
+                        dropped_ += static_cast<uint64_t>(got);
+                    }
+                    return true;
+                }
+                return false;
+            }
+            n -= static_cast<size_t>(out);
+        }
+        return true;
+    }
+
+    bool copyThrough(int src, int dst)
+    {
+        ssize_t got = read(src, buf_, sizeof(buf_));
+        if (got <= 0) {
+            return got == 0 || errno == EAGAIN || errno == EIO;
+        }
+        ssize_t put = write(dst, buf_, static_cast<size_t>(got));
+        if (put == -1) {
+            dropped_ += static_cast<uint64_t>(got);
+            return errno == EAGAIN || errno == EIO;
+        }
+        if (put < got) {
+            dropped_ += static_cast<uint64_t>(got - put);
+        }
+        return true;
+    }
+
+    int fds_[2]        = { -1, -1 };
+    bool splice_read_  = true;
+    bool splice_write_ = true;
+    uint64_t dropped_  = 0;
+    char buf_[4096];
+};
+
+} // namespace
+
+// The two-port topology the commented-out socat recipe used to build
+// (a PTY pair pair bridged by an external process), native: both
+// linked PTYs live in this process and a splice relay moves bytes
+// between their masters, shedding the socat process, its two context
+// switches and its copy per cycle. The relay is bidirectional, so
+// consumer-side writes (autopilot commands, say) reach the in port
+// too. An in port naming an existing character device — a real serial
+// port — is opened and forwarded instead of created.
+void PtyHandler::bridgeLoop()
+{
+    NMEA_ALLOC_SCOPE("PtyHandler::bridgeLoop");
+    int in_fd    = -1;
+    int out_fd   = -1;
+    int in_keep  = -1; // our own slave opens stop the masters from
+    int out_keep = -1; // hanging up between consumer attachments
+    bool in_created = false;
+
+    struct stat st;
+    if (stat(bridge_in_.c_str(), &st) == 0 && S_ISCHR(st.st_mode)) {
+        in_fd = ::open(bridge_in_.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+        if (in_fd == -1) {
+            std::cerr << "Error opening bridge device: " << bridge_in_ << ": "
+                      << strerror(errno) << std::endl;
+            requestShutdown();
+            return;
+        }
+        std::cout << "Forwarding existing device: " << bridge_in_ << std::endl;
+    } else {
+        std::string slave;
+        in_fd = openPtyMaster(slave);
+        if (in_fd == -1) {
+            requestShutdown();
+            return;
+        }
+        in_keep    = ::open(slave.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+        in_created = true;
+        if (!attemptSymlink(slave, bridge_in_)) {
+            std::cerr << "Failed to create symbolic link: " << bridge_in_ << " ("
+                      << strerror(errno) << ")" << std::endl;
+        }
+    }
+
+    {
+        std::string slave;
+        out_fd = openPtyMaster(slave);
+        if (out_fd == -1) {
+            close(in_fd);
+            if (in_keep != -1) {
+                close(in_keep);
+            }
+            requestShutdown();
+            return;
+        }
+        out_keep = ::open(slave.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+        if (!attemptSymlink(slave, bridge_out_)) {
+            std::cerr << "Failed to create symbolic link: " << bridge_out_ << " ("
+                      << strerror(errno) << ")" << std::endl;
+        }
+    }
+    StartupReport::mark(StartupReport::Setup);
+    StartupReport::mark(StartupReport::Symlink);
+
+    BridgeRelay in_to_out;
+    BridgeRelay out_to_in;
+    if (!in_to_out.init() || !out_to_in.init()) {
+        std::cerr << "Error creating bridge staging pipes: " << strerror(errno)
+                  << std::endl;
+        close(in_fd);
+        close(out_fd);
+        if (in_keep != -1) {
+            close(in_keep);
+        }
+        if (out_keep != -1) {
+            close(out_keep);
+        }
+        requestShutdown();
+        return;
+    }
+
+    std::cout << "Bridging " << bridge_in_ << " <-> " << bridge_out_ << "."
+              << std::endl;
+
+    struct pollfd fds[2] = { { in_fd, POLLIN, 0 }, { out_fd, POLLIN, 0 } };
+    while (!shutdown_event_.load()) {
+        fds[0].revents = 0;
+        fds[1].revents = 0;
+        int ready      = poll(fds, 2, 100);
+        if (ready == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::cerr << "Bridge poll error: " << strerror(errno) << std::endl;
+            break;
+        }
+        if (ready == 0) {
+            continue;
+        }
+        if ((fds[0].revents & POLLIN) && !in_to_out.forward(in_fd, out_fd)) {
+            break;
+        }
+        if ((fds[1].revents & POLLIN) && !out_to_in.forward(out_fd, in_fd)) {
+            break;
+        }
+        // Bare POLLHUP (a forwarded device whose far side closed):
+        // back off instead of spinning on an endlessly ready fd
+        if (((fds[0].revents | fds[1].revents) & POLLHUP)
+            && !((fds[0].revents | fds[1].revents) & POLLIN)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }
+
+    uint64_t dropped = in_to_out.dropped() + out_to_in.dropped();
+    if (dropped > 0) {
+        std::cout << "Bridge dropped " << dropped
+                  << " byte(s) against stalled ports." << std::endl;
+    }
+    close(in_fd);
+    close(out_fd);
+    if (in_keep != -1) {
+        close(in_keep);
+    }
+    if (out_keep != -1) {
+        close(out_keep);
+    }
+    if (in_created && unlink(bridge_in_.c_str()) == 0) {
+        std::cout << "Symbolic link removed: " << bridge_in_ << std::endl;
+    }
+    if (unlink(bridge_out_.c_str()) == 0) {
+        std::cout << "Symbolic link removed: " << bridge_out_ << std::endl;
+    }
+    std::cout << "Bridge thread exiting." << std::endl;
+}
+
+namespace {
+
+// Read exactly n bytes from a connected socket, polling so shutdown is
+// observed within 100 ms. Returns false on EOF, error or shutdown.
+bool readFull(int fd, char* dst, size_t n, const std::atomic<bool>& stop)
+{
+    size_t got = 0;
+    while (got < n && !stop.load()) {
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        int ready         = poll(&pfd, 1, 100);
+        if (ready == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (ready == 0) {
+            continue;
+        }
+        ssize_t r = recv(fd, dst + got, n - got, 0);
+        if (r <= 0) {
+            return false;
+        }
+        got += static_cast<size_t>(r);
+    }
+    return got == n;
+}
+
+} // namespace
+
+// Decompressing consumer for a --compress TCP sink (--relay): connect
+// to the producer, read its 4-byte length-framed deflate units,
+// inflate each one into a reused buffer and re-emit the plain text on
+// a local linked PTY — the remote stream crosses the constrained link
+// compressed and local consumers still see ordinary NMEA on a tty.
+// The inflate context is created once and reset per frame to mirror
+// the producer; frames are independent, so connecting mid-stream
+// decodes cleanly from the first complete frame.
+void PtyHandler::relayLoop()
+{
+    NMEA_ALLOC_SCOPE("PtyHandler::relayLoop");
+
+    struct addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family   = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    char port[16];
+    std::snprintf(port, sizeof(port), "%u", static_cast<unsigned>(relay_port_));
+    struct addrinfo* res = nullptr;
+    int rc               = getaddrinfo(relay_host_.c_str(), port, &hints, &res);
+    if (rc != 0 || res == nullptr) {
+        std::cerr << "Error resolving relay source " << relay_host_ << ": "
+                  << gai_strerror(rc) << std::endl;
+        requestShutdown();
+        return;
+    }
+
+    int sock = socket(res->ai_family, SOCK_STREAM, 0);
+    if (sock == -1 || connect(sock, res->ai_addr, res->ai_addrlen) == -1) {
+        std::cerr << "Error connecting to relay source " << relay_host_ << ":"
+                  << relay_port_ << ": " << strerror(errno) << std::endl;
+        if (sock != -1) {
+            close(sock);
+        }
+        freeaddrinfo(res);
+        requestShutdown();
+        return;
+    }
+    freeaddrinfo(res);
+
+    std::string slave;
+    int pty_fd = openPtyMaster(slave);
+    if (pty_fd == -1) {
+        close(sock);
+        requestShutdown();
+        return;
+    }
+    // Our own slave open stops the master from hanging up between
+    // consumer attachments, same as the bridge ports
+    int keep_fd = ::open(slave.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (!attemptSymlink(slave, symlink_path_)) {
+        std::cerr << "Failed to create symbolic link: " << symlink_path_ << " ("
+                  << strerror(errno) << ")" << std::endl;
+    }
+    StartupReport::mark(StartupReport::Setup);
+    StartupReport::mark(StartupReport::Symlink);
+
+    z_stream strm;
+    std::memset(&strm, 0, sizeof(strm));
+    if (inflateInit(&strm) != Z_OK) {
+        std::cerr << "Error initializing inflate context." << std::endl;
+        close(sock);
+        requestShutdown();
+        return;
+    }
+
+    std::cout << "Relaying " << relay_host_ << ":" << relay_port_ << " -> "
+              << symlink_path_ << "." << std::endl;
+
+    // A cycle is a few KB of text; anything claiming more than this
+    // compressed is a corrupt header or an uncompressed producer
+    constexpr size_t kMaxFrame = 1u << 20;
+    std::vector<char> frame;
+    std::vector<char> text;
+    uint64_t frames        = 0;
+    uint64_t dropped       = 0;
+    uint64_t in_bytes      = 0;
+    uint64_t out_bytes     = 0;
+
+    while (!shutdown_event_.load()) {
+        unsigned char head[4];
+        if (!readFull(sock, reinterpret_cast<char*>(head), sizeof(head),
+                      shutdown_event_)) {
+            break;
+        }
+        size_t clen = static_cast<size_t>(head[0]) | (static_cast<size_t>(head[1]) << 8)
+            | (static_cast<size_t>(head[2]) << 16) | (static_cast<size_t>(head[3]) << 24);
+        if (clen == 0 || clen > kMaxFrame) {
+            std::cerr << "Relay: implausible frame length " << clen
+                      << "; is the source running with --compress?" << std::endl;
+            break;
+        }
+        if (frame.size() < clen) {
+            frame.resize(clen);
+        }
+        if (!readFull(sock, frame.data(), clen, shutdown_event_)) {
+            break;
+        }
+
+        inflateReset(&strm);
+        strm.next_in  = reinterpret_cast<Bytef*>(frame.data());
+        strm.avail_in = static_cast<uInt>(clen);
+        size_t tlen   = 0;
+        bool ok       = true;
+        if (text.size() < 4 * clen + 256) {
+            text.resize(4 * clen + 256);
+        }
+        for (;;) {
+            strm.next_out  = reinterpret_cast<Bytef*>(text.data() + tlen);
+            strm.avail_out = static_cast<uInt>(text.size() - tlen);
+            int zrc        = inflate(&strm, Z_FINISH);
+            tlen           = strm.total_out;
+            if (zrc == Z_STREAM_END) {
+                break;
+            }
+            if (zrc == Z_BUF_ERROR || zrc == Z_OK) {
+                text.resize(text.size() * 2);
+                continue;
+            }
+            std::cerr << "Relay: inflate failed on frame " << frames << "."
+                      << std::endl;
+            ok = false;
+            break;
+        }
+        if (!ok) {
+            break;
+        }
+        ++frames;
+        in_bytes += 4 + clen;
+        out_bytes += tlen;
+
+        // Non-blocking master: a stalled local consumer costs this
+        // frame, not the connection — same stance as the PTY writer's
+        // drop policy
+        ssize_t w = write(pty_fd, text.data(), tlen);
+        if (w == -1) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                ++dropped;
+            } else if (errno != EINTR) {
+                logger_.logError("Error writing relayed cycle to PTY", errno);
+            }
+        }
+    }
+
+    inflateEnd(&strm);
+    close(sock);
+    close(pty_fd);
+    if (keep_fd != -1) {
+        close(keep_fd);
+    }
+    if (frames > 0) {
+        std::cout << "Relay inflated " << frames << " frame(s), " << in_bytes
+                  << " -> " << out_bytes << " bytes." << std::endl;
+    }
+    if (dropped > 0) {
+        std::cout << "Relay dropped " << dropped
+                  << " frame(s) against a stalled PTY." << std::endl;
+    }
+    std::cout << "Relay thread exiting." << std::endl;
+    requestShutdown();
+}
+
+namespace {
+
+// Slice one generated cycle to the sentence types in mask: the shared
+// buffer's CRLF-delimited sentence spans are copied through or skipped,
+// so a filtered sink costs one scan and copy, not a generation pass.
+// Unclassifiable lines pass through rather than silently vanish.
+void sliceCycleByMask(const std::string& cycle, unsigned mask, std::string& out)
+{
+    out.clear();
+    size_t pos = 0;
+    while (pos < cycle.size()) {
+        size_t nl   = cycle.find('\n', pos);
+        size_t next = (nl == std::string::npos) ? cycle.size() : nl + 1;
+        std::string_view line(cycle.data() + pos, next - pos);
+        unsigned bit = NmeaGenerator::sentenceBitOf(line);
+        if (bit == 0 || (bit & mask) != 0) {
+            out.append(line);
+        }
+        pos = next;
+    }
+}
+
+} // namespace
+
+// Fan-out writer: every cycle is generated exactly once into the shared
+// buffer and written to each configured sink from it, so consumers see
+// byte-identical, same-cycle data and each extra consumer costs only
+// one write() instead of a whole redundant generation pass.
+// Heterogeneous consumers are served by per-sink shaping (--sink-rate,
+// --sink-sentences): rate divisors skip cycles, sentence masks slice
+// the shared buffer.
+void PtyHandler::writerMulti()
+{
+    NMEA_ALLOC_SCOPE("PtyHandler::writerMulti");
+    CycleScheduler scheduler(interval_);
+    RateController rate_ctl(adapt_levels_, interval_, sink_counters_);
+
+    int serial_fd = -1;
+    if (!serial_port_.empty()) {
+        serial_fd = open(serial_port_.c_str(), O_WRONLY | O_NOCTTY);
+        if (serial_fd == -1) {
+            std::cerr << "Error opening serial port: " << serial_port_ << std::endl;
+            requestShutdown();
+            return;
+        }
+    }
+    int pipe_fd = -1;
+    if (!pipe_path_.empty()) {
+        pipe_fd = open(pipe_path_.c_str(), O_WRONLY);
+        if (pipe_fd != -1) {
+            applyPipeBuffer(pipe_fd);
+        }
+        if (pipe_fd == -1) {
+            std::cerr << "Error opening pipe: " << pipe_path_ << std::endl;
+            requestShutdown();
+            if (serial_fd != -1)
+                close(serial_fd);
+            return;
+        }
+    }
+    int udp_fd = -1;
+    if (!udp_host_.empty()) {
+        udp_fd = openUdpSocket();
+        if (udp_fd == -1) {
+            requestShutdown();
+            if (serial_fd != -1)
+                close(serial_fd);
+            if (pipe_fd != -1)
+                close(pipe_fd);
+            return;
+        }
+    }
+    TcpFanout tcp;
+    if (tcp_port_ != 0 && !tcp.listenOn(tcp_host_, tcp_port_)) {
+        requestShutdown();
+        if (serial_fd != -1)
+            close(serial_fd);
+        if (pipe_fd != -1)
+            close(pipe_fd);
+        if (udp_fd != -1)
+            close(udp_fd);
+        return;
+    }
+    UnixFanout unix_server;
+    if (!unix_path_.empty() && !unix_server.listenOn(unix_path_)) {
+        requestShutdown();
+        if (serial_fd != -1)
+            close(serial_fd);
+        if (pipe_fd != -1)
+            close(pipe_fd);
+        if (udp_fd != -1)
+            close(udp_fd);
+        return;
+    }
+    ShmRing shm_ring;
+    if (!shm_name_.empty() && !shm_ring.create(shm_name_)) {
+        requestShutdown();
+        if (serial_fd != -1)
+            close(serial_fd);
+        if (pipe_fd != -1)
+            close(pipe_fd);
+        if (udp_fd != -1)
+            close(udp_fd);
+        return;
+    }
+    int epfd = -1;
+    if (force_pty_ && master_fd_ != -1) {
+        epfd = epoll_create1(0);
+        if (epfd != -1) {
+            struct epoll_event ev {};
+            ev.events  = EPOLLOUT;
+            ev.data.fd = master_fd_;
+            epoll_ctl(epfd, EPOLL_CTL_ADD, master_fd_, &ev);
+        }
+    }
+
+    // Blocking full write for the serial sink
+    auto writeAll = [](int fd, const char* data, size_t len) {
+        size_t off = 0;
+        while (off < len) {
+            ssize_t n = write(fd, data + off, len - off);
+            if (n == -1) {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            off += static_cast<size_t>(n);
+        }
+        return true;
+    };
+
+    CyclePipeline pipeline(generator_);
+    startPipeline(pipeline);
+
+    // Per-sink slices of the shared cycle, rebuilt only for sinks with
+    // a sentence mask; the buffers are reused across cycles
+    std::string sliced[static_cast<size_t>(SinkId::Count)];
+    uint64_t fan_cycle = 0;
+
+    // Cumulative per-sink loss counts (slow-consumer disconnects, full
+    // SEQPACKET buffers, ring truncations), fed to the shared sink
+    // counters as deltas so the reporters and the adaptive controller
+    // see network-sink pressure live, not just the exit report
+    uint64_t tcp_drops_fed  = 0;
+    uint64_t unix_drops_fed = 0;
+    uint64_t shm_drops_fed  = 0;
+
+    // Per-sink write timing: a clock pair around each sink's emit
+    // feeds a local histogram, snapshotted into sink_write_p99_ so the
+    // stats/metrics threads can name the slow consumer
+    LatencyHistogram write_time[static_cast<size_t>(SinkId::Count)];
+    std::chrono::steady_clock::time_point ws;
+    auto recordWrite = [&](SinkId id) {
+        write_time[static_cast<size_t>(id)].record(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - ws)
+                .count());
+    };
+
+    while (!shutdown_event_.load()) {
+        if (!scenario_.empty() || !control_name_.empty()) {
+            applyScenario(scenario_, generator_, scheduler);
+        }
+        rate_ctl.cycle(scheduler, generator_);
+        const std::string* next = pipeline.next();
+        if (next == nullptr)
+            break;
+        const std::string& cycle_data = *next;
+
+        // Resolve one sink's view of the shared cycle: nullptr when its
+        // rate divisor skips this cycle, the shared buffer when it
+        // takes everything, its reused slice buffer otherwise
+        auto sinkView = [&](SinkId id) -> const std::string* {
+            const SinkShaping& shaping = sink_shaping_[static_cast<size_t>(id)];
+            if (shaping.divisor > 1 && fan_cycle % shaping.divisor != 0) {
+                return nullptr;
+            }
+            if (shaping.mask == 0) {
+                return &cycle_data;
+            }
+            std::string& out = sliced[static_cast<size_t>(id)];
+            sliceCycleByMask(cycle_data, shaping.mask, out);
+            return &out;
+        };
+
+        if (serial_fd != -1) {
+            if (const std::string* view = sinkView(SinkId::Serial)) {
+                ws = std::chrono::steady_clock::now();
+                if (!writeAll(serial_fd, view->c_str(), view->size())) {
+                    logger_.logError("Error writing to serial port", errno);
+                    break;
+                }
+                if (shouldFlush()) {
+                    fsync(serial_fd);
+                }
+                recordWrite(SinkId::Serial);
+                counters(SinkId::Serial).recordCycle(view->c_str(), view->size());
+            }
+        }
+        if (!pipe_path_.empty()) {
+            if (const std::string* view = sinkView(SinkId::Pipe)) {
+                if (pipe_fd == -1) {
+                    // Reader went away earlier; retry the attach without
+                    // blocking the other sinks
+                    pipe_fd = open(pipe_path_.c_str(), O_WRONLY | O_NONBLOCK);
+                    applyPipeBuffer(pipe_fd);
+                }
+                ws = std::chrono::steady_clock::now();
+                if (pipe_fd != -1 && write(pipe_fd, view->c_str(), view->size()) == -1) {
+                    if (errno == EPIPE) {
+                        close(pipe_fd);
+                        pipe_fd = -1;
+                        pipe_probe_fd_.store(-1, std::memory_order_relaxed);
+                        counters(SinkId::Pipe).recordRetry();
+                    } else if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                        logger_.logError("Error writing to pipe", errno);
+                        break;
+                    } else {
+                        counters(SinkId::Pipe).recordDropped();
+                    }
+                } else if (pipe_fd != -1) {
+                    recordWrite(SinkId::Pipe);
+                    counters(SinkId::Pipe).recordCycle(view->c_str(), view->size());
+                } else {
+                    counters(SinkId::Pipe).recordDropped();
+                }
+            }
+        }
+        if (force_pty_ && master_fd_ != -1) {
+            if (const std::string* view = sinkView(SinkId::Pty)) {
+                ws = std::chrono::steady_clock::now();
+                if (!writePtyCycle(epfd, view->c_str(), view->size())) {
+                    break;
+                }
+                recordWrite(SinkId::Pty);
+                counters(SinkId::Pty).recordCycle(view->c_str(), view->size());
+            }
+        }
+        if (udp_fd != -1) {
+            if (const std::string* view = sinkView(SinkId::Udp)) {
+                ws = std::chrono::steady_clock::now();
+                if (send(udp_fd, view->c_str(), view->size(), 0) == -1
+                    && errno != ECONNREFUSED) {
+                    logger_.logError("Error sending UDP datagram", errno);
+                    break;
+                }
+                recordWrite(SinkId::Udp);
+                counters(SinkId::Udp).recordCycle(view->c_str(), view->size());
+            }
+        }
+        if (tcp_port_ != 0) {
+            tcp.pump();
+            if (const std::string* view = sinkView(SinkId::Tcp)) {
+                ws = std::chrono::steady_clock::now();
+                tcp.broadcast(view->c_str(), view->size());
+                recordWrite(SinkId::Tcp);
+                counters(SinkId::Tcp).recordCycle(view->c_str(), view->size());
+            }
+            uint64_t dropped = tcp.droppedSlow();
+            if (dropped > tcp_drops_fed) {
+                counters(SinkId::Tcp).dropped.fetch_add(dropped - tcp_drops_fed,
+                                                        std::memory_order_relaxed);
+                tcp_drops_fed = dropped;
+            }
+        }
+        if (!unix_path_.empty()) {
+            unix_server.pump();
+            if (const std::string* view = sinkView(SinkId::Unix)) {
+                ws = std::chrono::steady_clock::now();
+                unix_server.broadcast(view->c_str(), view->size());
+                recordWrite(SinkId::Unix);
+                counters(SinkId::Unix).recordCycle(view->c_str(), view->size());
+            }
+            uint64_t dropped = unix_server.droppedMessages();
+            if (dropped > unix_drops_fed) {
+                counters(SinkId::Unix).dropped.fetch_add(dropped - unix_drops_fed,
+                                                         std::memory_order_relaxed);
+                unix_drops_fed = dropped;
+            }
+        }
+        if (shm_ring.ready()) {
+            if (const std::string* view = sinkView(SinkId::Shm)) {
+                ws = std::chrono::steady_clock::now();
+                shm_ring.publish(view->c_str(), view->size());
+                recordWrite(SinkId::Shm);
+                counters(SinkId::Shm).recordCycle(view->c_str(), view->size());
+            }
+            uint64_t truncated = shm_ring.truncated();
+            if (truncated > shm_drops_fed) {
+                counters(SinkId::Shm).dropped.fetch_add(truncated - shm_drops_fed,
+                                                        std::memory_order_relaxed);
+                shm_drops_fed = truncated;
+            }
+        }
+
+        // Publish p99 snapshots for the reporter threads; a bucket scan
+        // every 64 cycles, nothing on the per-write path
+        if ((fan_cycle & 63) == 0) {
+            for (size_t s = 0; s < static_cast<size_t>(SinkId::Count); ++s) {
+                if (!write_time[s].empty()) {
+                    sink_write_p99_[s].store(write_time[s].percentileBound(0.99),
+                                             std::memory_order_relaxed);
+                }
+            }
+        }
+
+        captureCycle(cycle_data);
+        checkpointCycle();
+        logger_.logCycle("Sent to all sinks:", cycle_data);
+        pipeline.release();
+        ++fan_cycle;
+        scheduler.waitNextCycle();
+    }
+
+    if (serial_fd != -1)
+        close(serial_fd);
+    if (pipe_fd != -1)
+        close(pipe_fd);
+    if (udp_fd != -1)
+        close(udp_fd);
+    if (epfd != -1)
+        close(epfd);
+    if (force_pty_ && master_fd_ != -1) {
+        close(master_fd_);
+        master_fd_ = -1;
+    }
+    reportOverruns("Fan-out writer", scheduler);
+    if (dropped_cycles_ > 0) {
+        std::cout << "Fan-out writer dropped " << dropped_cycles_
+                  << " cycle(s) to consumer backpressure." << std::endl;
+    }
+    std::cout << "Fan-out writer thread exiting." << std::endl;
+}
+
+// Forked fan-out (--fork-sinks): generation cost is paid once, per-sink
+// fault isolation is kept. The producer publishes each cycle into an
+// anonymous shared-memory ring; one forked child per configured sink
+// inherits the mapping and emits from it, so a crashing or wedged sink
+// process takes down only its own consumer while the producer and the
+// other sinks keep running. Children drain the ring and exit when the
+// producer raises the ring's stop flag; crashed children are reaped and
+// reported without stopping the run.
+void PtyHandler::writerForked()
+{
+    CycleScheduler scheduler(interval_);
+    ShmRing ring;
+    if (!ring.createAnonymous()) {
+        requestShutdown();
+        return;
+    }
+
+    auto writeAll = [](int fd, const char* data, size_t len) {
+        size_t off = 0;
+        while (off < len) {
+            ssize_t n = write(fd, data + off, len - off);
+            if (n == -1) {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            off += static_cast<size_t>(n);
+        }
+        return true;
+    };
+
+    struct SinkChild {
+        pid_t pid;
+        const char* name;
+    };
+    std::vector<SinkChild> children;
+
+    // Fork one child per sink. Children must be spawned before the
+    // pipeline starts so they never inherit its generator thread state;
+    // they exit with _exit so inherited stdio buffers flush only once.
+    auto spawn = [&](const char* name, const std::function<void()>& body) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            // The terminal delivers Ctrl-C to the whole group; the
+            // producer coordinates shutdown through the ring instead
+            signal(SIGINT, SIG_IGN);
+            body();
+            _exit(0);
+        }
+        if (pid > 0) {
+            children.push_back(SinkChild { pid, name });
+        } else {
+            std::cerr << "fork failed for " << name << " sink: " << strerror(errno)
+                      << std::endl;
+        }
+    };
+
+    if (!serial_port_.empty()) {
+        spawn("serial", [&] {
+            int fd = open(serial_port_.c_str(), O_WRONLY | O_NOCTTY);
+            if (fd == -1) {
+                std::cerr << "Error opening serial port: " << serial_port_ << std::endl;
+                return;
+            }
+            std::string buffer;
+            while (ring.nextCycle(buffer)) {
+                if (!writeAll(fd, buffer.data(), buffer.size())) {
+                    std::cerr << "Error writing to serial port: " << serial_port_
+                              << std::endl;
+                    break;
+                }
+                if (shouldFlush()) {
+                    fsync(fd);
+                }
+            }
+            close(fd);
+        });
+    }
+    if (!pipe_path_.empty()) {
+        spawn("pipe", [&] {
+            std::string buffer;
+            int fd = -1;
+            while (ring.nextCycle(buffer)) {
+                if (fd == -1) {
+                    // Non-blocking attach so a missing reader never
+                    // stops this child from draining the ring
+                    fd = open(pipe_path_.c_str(), O_WRONLY | O_NONBLOCK);
+                    if (fd == -1)
+                        continue;
+                    applyPipeBuffer(fd);
+                }
+                if (write(fd, buffer.data(), buffer.size()) == -1 && errno == EPIPE) {
+                    close(fd);
+                    fd = -1;
+                }
+            }
+            if (fd != -1)
+                close(fd);
+        });
+    }
+    if (!udp_host_.empty()) {
+        spawn("udp", [&] {
+            int fd = openUdpSocket();
+            if (fd == -1)
+                return;
+            std::string buffer;
+            while (ring.nextCycle(buffer)) {
+                if (send(fd, buffer.data(), buffer.size(), 0) == -1
+                    && errno != ECONNREFUSED) {
+                    std::cerr << "Error sending UDP datagram: " << strerror(errno)
+                              << std::endl;
+                    break;
+                }
+            }
+            close(fd);
+        });
+    }
+    if (tcp_port_ != 0) {
+        spawn("tcp", [&] {
+            TcpFanout server;
+            if (!server.listenOn(tcp_host_, tcp_port_))
+                return;
+            std::string buffer;
+            while (ring.nextCycle(buffer)) {
+                server.pump();
+                server.broadcast(buffer.data(), buffer.size());
+            }
+        });
+    }
+    if (!unix_path_.empty()) {
+        spawn("unix", [&] {
+            UnixFanout server;
+            if (!server.listenOn(unix_path_))
+                return;
+            std::string buffer;
+            while (ring.nextCycle(buffer)) {
+                server.pump();
+                server.broadcast(buffer.data(), buffer.size());
+            }
+        });
+    }
+    if (!shm_name_.empty()) {
+        spawn("shm", [&] {
+            ShmRing out;
+            if (!out.create(shm_name_))
+                return;
+            std::string buffer;
+            while (ring.nextCycle(buffer)) {
+                out.publish(buffer.data(), buffer.size());
+            }
+        });
+    }
+    if (force_pty_ && master_fd_ != -1) {
+        spawn("pty", [&] {
+            std::string buffer;
+            while (ring.nextCycle(buffer)) {
+                // Non-blocking master: a stalled consumer drops cycles
+                // instead of wedging this child
+                if (write(master_fd_, buffer.data(), buffer.size()) == -1
+                    && errno != EAGAIN && errno != EWOULDBLOCK && errno != EIO) {
+                    break;
+                }
+            }
+        });
+    }
+
+    if (children.empty()) {
+        std::cerr << "No sink processes could be started." << std::endl;
+        requestShutdown();
+        return;
+    }
+    std::cout << "Forked " << children.size() << " sink process(es)." << std::endl;
+
+    CyclePipeline pipeline(generator_);
+    startPipeline(pipeline);
+
+    while (!shutdown_event_.load()) {
+        // Reap crashed sink processes; the producer and the surviving
+        // sinks keep running
+        int status = 0;
+        pid_t dead;
+        while ((dead = waitpid(-1, &status, WNOHANG)) > 0) {
+            for (auto it = children.begin(); it != children.end(); ++it) {
+                if (it->pid == dead) {
+                    std::cerr << "Sink process (" << it->name << ") exited"
+                              << (WIFSIGNALED(status) ? " on a signal" : "")
+                              << "; continuing with the remaining sinks." << std::endl;
+                    children.erase(it);
+                    break;
+                }
+            }
+        }
+        if (children.empty()) {
+            std::cerr << "All sink processes exited; stopping." << std::endl;
+            break;
+        }
+
+        const std::string* cycle = pipeline.next();
+        if (cycle == nullptr)
+            break;
+        ring.publish(cycle->c_str(), cycle->size());
+        logger_.logCycle("Published to sink processes:", *cycle);
+        pipeline.release();
+        scheduler.waitNextCycle();
+    }
+
+    ring.requestStop();
+    for (const auto& child : children) {
+        int status = 0;
+        waitpid(child.pid, &status, 0);
+    }
+    reportOverruns("Forked fan-out writer", scheduler);
+    std::cout << "Forked fan-out writer exiting." << std::endl;
+}
+
+namespace {
+
+// One fd over a unix socket (SCM_RIGHTS), with a one-byte payload so
+// the message is never empty. The pool control protocol is only this:
+// the producer passes each accepted consumer fd to a worker; nothing
+// else crosses the pair.
+bool sendFd(int sock, int fd)
+{
+    char byte                          = 'A';
+    struct iovec iov                   = { &byte, 1 };
+    char ctrl[CMSG_SPACE(sizeof(int))] = {};
+    struct msghdr msg                  = {};
+    msg.msg_iov                        = &iov;
+    msg.msg_iovlen                     = 1;
+    msg.msg_control                    = ctrl;
+    msg.msg_controllen                 = sizeof(ctrl);
+    struct cmsghdr* cm                 = CMSG_FIRSTHDR(&msg);
+    cm->cmsg_level                     = SOL_SOCKET;
+    cm->cmsg_type                      = SCM_RIGHTS;
+    cm->cmsg_len                       = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(cm), &fd, sizeof(int));
+    return sendmsg(sock, &msg, 0) == 1;
+}
+
+// Non-blocking receive of one passed fd; -1 means nothing pending
+int recvFd(int sock)
+{
+    char byte;
+    struct iovec iov                   = { &byte, 1 };
+    char ctrl[CMSG_SPACE(sizeof(int))] = {};
+    struct msghdr msg                  = {};
+    msg.msg_iov                        = &iov;
+    msg.msg_iovlen                     = 1;
+    msg.msg_control                    = ctrl;
+    msg.msg_controllen                 = sizeof(ctrl);
+    if (recvmsg(sock, &msg, MSG_DONTWAIT) <= 0) {
+        return -1;
+    }
+    for (struct cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm != nullptr;
+         cm                 = CMSG_NXTHDR(&msg, cm)) {
+        if (cm->cmsg_level == SOL_SOCKET && cm->cmsg_type == SCM_RIGHTS) {
+            int fd;
+            std::memcpy(&fd, CMSG_DATA(cm), sizeof(int));
+            return fd;
+        }
+    }
+    return -1;
+}
+
+} // namespace
+
+// Pre-forked pool (--sink-pool): on rigs where consumers attach and
+// detach continuously, process-per-sink startup cost dominates — so
+// the workers are forked once, inherit the anonymous cycle ring, and
+// adopt consumers as they come. The producer accepts at the control
+// socket and passes each fd to the worker with the fewest adoptions
+// over SCM_RIGHTS; the worker starts writing it at the next published
+// cycle. An attach therefore costs one fd pass, with no generation or
+// parsing setup. Adoption happens at cycle boundaries, which adds no
+// observable latency: there is nothing to deliver between cycles.
+void PtyHandler::writerPool()
+{
+    CycleScheduler scheduler(interval_);
+    ShmRing ring;
+    if (!ring.createAnonymous()) {
+        requestShutdown();
+        return;
+    }
+
+    unlink(sink_pool_path_.c_str());
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+    struct sockaddr_un addr {};
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, sink_pool_path_.c_str(), sizeof(addr.sun_path) - 1);
+    if (listen_fd == -1
+        || bind(listen_fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0
+        || listen(listen_fd, 16) != 0) {
+        std::cerr << "Error creating pool control socket " << sink_pool_path_ << ": "
+                  << strerror(errno) << std::endl;
+        if (listen_fd != -1) {
+            close(listen_fd);
+        }
+        requestShutdown();
+        return;
+    }
+
+    struct PoolWorker {
+        pid_t pid;
+        int ctl; // producer's end of the control pair
+        unsigned adopted = 0;
+    };
+    std::vector<PoolWorker> workers;
+
+    // Fork the pool before the pipeline starts, like --fork-sinks
+    // children, so workers never inherit generator thread state
+    for (unsigned i = 0; i < sink_pool_workers_; ++i) {
+        int sv[2];
+        if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sv) != 0) {
+            std::cerr << "socketpair failed for pool worker: " << strerror(errno)
+                      << std::endl;
+            break;
+        }
+        pid_t pid = fork();
+        if (pid == 0) {
+            // Ctrl-C reaches the whole group; the ring coordinates
+            // shutdown, exactly as for --fork-sinks children
+            signal(SIGINT, SIG_IGN);
+            close(sv[0]);
+            close(listen_fd);
+            std::vector<int> sinks;
+            std::string buffer;
+            while (ring.nextCycle(buffer)) {
+                // Adopt every fd passed since the last cycle
+                for (int fd; (fd = recvFd(sv[1])) != -1;) {
+                    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+                    sinks.push_back(fd);
+                }
+                for (size_t s = 0; s < sinks.size();) {
+                    // EAGAIN drops this cycle for that consumer only —
+                    // the ring's own latest-state policy; a closed
+                    // consumer detaches on the write error
+                    if (write(sinks[s], buffer.data(), buffer.size()) == -1
+                        && errno != EAGAIN && errno != EWOULDBLOCK) {
+                        close(sinks[s]);
+                        sinks[s] = sinks.back();
+                        sinks.pop_back();
+                        continue;
+                    }
+                    ++s;
+                }
+            }
+            for (int fd : sinks) {
+                close(fd);
+            }
+            _exit(0);
+        }
+        close(sv[1]);
+        if (pid > 0) {
+            workers.push_back(PoolWorker { pid, sv[0] });
+        } else {
+            close(sv[0]);
+            std::cerr << "fork failed for pool worker: " << strerror(errno) << std::endl;
+        }
+    }
+    if (workers.empty()) {
+        std::cerr << "No pool workers could be started." << std::endl;
+        close(listen_fd);
+        unlink(sink_pool_path_.c_str());
+        requestShutdown();
+        return;
+    }
+    std::cout << "Pre-forked " << workers.size()
+              << " writer worker(s); consumers attach at " << sink_pool_path_
+              << std::endl;
+
+    CyclePipeline pipeline(generator_);
+    startPipeline(pipeline);
+
+    uint64_t attached = 0;
+    while (!shutdown_event_.load()) {
+        // Hand new consumers to the least-loaded worker before this
+        // cycle publishes, so it is the first thing they receive
+        for (;;) {
+            int conn = accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+            if (conn == -1) {
+                break;
+            }
+            PoolWorker* target = &workers[0];
+            for (auto& w : workers) {
+                if (w.adopted < target->adopted) {
+                    target = &w;
+                }
+            }
+            if (sendFd(target->ctl, conn)) {
+                ++target->adopted;
+                ++attached;
+            }
+            close(conn); // the worker holds its own copy now
+        }
+
+        const std::string* cycle = pipeline.next();
+        if (cycle == nullptr) {
+            break;
+        }
+        ring.publish(cycle->c_str(), cycle->size());
+        logger_.logCycle("Published to pool workers:", *cycle);
+        pipeline.release();
+        scheduler.waitNextCycle();
+    }
+
+    ring.requestStop();
+    for (const auto& w : workers) {
+        close(w.ctl);
+        int status = 0;
+        waitpid(w.pid, &status, 0);
+    }
+    close(listen_fd);
+    unlink(sink_pool_path_.c_str());
+    reportOverruns("Pool writer", scheduler);
+    std::cout << "Pool writer exiting (" << attached
+              << " consumer(s) attached over the run)." << std::endl;
+}
+
+// Cleanup resources
+void PtyHandler::cleanup()
+{
+    // The reconciler observes shutdown_event_ within 100 ms; joining it
+    // first means no link is re-created after we remove them below
+    if (symlink_thread_.joinable()) {
+        symlink_thread_.join();
+    }
+    if (service_thread_.joinable()) {
+        service_thread_.join();
+    }
+    if (metrics_thread_.joinable()) {
+        metrics_thread_.join();
+    }
+    if (control_thread_.joinable()) {
+        control_thread_.join();
+    }
+    if (pps_thread_.joinable()) {
+        pps_thread_.join();
+    }
+    if (selftest_thread_.joinable()) {
+        selftest_thread_.join();
+    }
 
-// Cleanup resources
-void PtyHandler::cleanup()
-{
     if (!pipe_path_.empty() && access(pipe_path_.c_str(), F_OK) != -1) {
         if (unlink(pipe_path_.c_str()) != 0) {
             std::cerr << "Error removing named pipe: " << pipe_path_.c_str() << std::endl;
@@ -528,25 +5055,1443 @@ void PtyHandler::cleanup()
         }
     }
 
-    if (!symlink_path_.empty()) {
-        // Remove the symbolic link
-        if (unlink(symlink_path_.c_str()) != 0) {
-            std::cerr << "Error removing symbolic link: " << symlink_path_.c_str() << std::endl;
-        } else {
-            std::cout << "Symbolic link removed: " << symlink_path_.c_str() << std::endl;
+    // In fleet mode the path is a template and the fleet writer already
+    // removed the per-device links
+    if (!symlink_path_.empty() && device_count_ <= 1) {
+        // Remove the symbolic link
+        if (unlink(symlink_path_.c_str()) != 0) {
+            std::cerr << "Error removing symbolic link: " << symlink_path_.c_str() << std::endl;
+        } else {
+            std::cout << "Symbolic link removed: " << symlink_path_.c_str() << std::endl;
+        }
+    }
+
+    if (master_fd_ != -1) {
+        close(master_fd_);
+        std::cout << "PTY writer thread exiting." << std::endl;
+    }
+
+    // Budgeted runs close with the kernel's verdict on the estimates
+    MemBudget::reportPeak();
+
+    std::cout << "PtyHandler exited gracefully." << std::endl;
+}
+
+// Signal shutdown
+void PtyHandler::signalShutdown()
+{
+    requestShutdown();
+}
+
+// Forward console-output policy to the async logger
+void PtyHandler::setQuiet(bool quiet)
+{
+    logger_.setQuiet(quiet);
+}
+
+void PtyHandler::setLogSampleEvery(unsigned n)
+{
+    logger_.setSampleEvery(n);
+}
+
+void PtyHandler::setPreview(double seconds)
+{
+    logger_.setPreview(seconds);
+}
+
+void PtyHandler::setBackpressurePolicy(BackpressurePolicy policy)
+{
+    backpressure_ = policy;
+}
+
+void PtyHandler::setPendingQueue(size_t depth, QueuePolicy policy)
+{
+    pending_.resize(depth);
+    queue_policy_ = policy;
+}
+
+void PtyHandler::setUseUring(bool use_uring)
+{
+    use_uring_ = use_uring;
+}
+
+void PtyHandler::setUseVmsplice(bool use_vmsplice)
+{
+    use_vmsplice_ = use_vmsplice;
+}
+
+void PtyHandler::setUsePipeline(bool use_pipeline)
+{
+    use_pipeline_ = use_pipeline;
+}
+
+void PtyHandler::setUseOverlap(bool use_overlap)
+{
+    use_overlap_ = use_overlap;
+}
+
+void PtyHandler::setLateStamp(bool enable)
+{
+    late_stamp_ = enable;
+}
+
+void PtyHandler::setCpuAffinity(int cpu)
+{
+    cpu_affinity_ = cpu;
+}
+
+void PtyHandler::setGenCpuAffinity(int cpu)
+{
+    gen_cpu_affinity_ = cpu;
+}
+
+void PtyHandler::setRtPriority(int prio)
+{
+    rt_priority_ = prio;
+}
+
+// The full SPSC ring wins when both overlap modes are requested
+void PtyHandler::startPipeline(CyclePipeline& pipeline)
+{
+    pipeline.setTuning(gen_cpu_affinity_, rt_priority_);
+    pipeline.setBatch(burst_);
+    pipeline.setLateStamp(late_stamp_);
+    if (prebake_cycles_ > 0) {
+        // Each baked buffer holds one burst of cycles; charge a
+        // per-cycle page as the upper bound so an oversized corpus is
+        // refused before baking starts, not OOM-killed after
+        if (!MemBudget::reserve("prebaked corpus",
+                                prebake_cycles_ * burst_ * 4096ull)) {
+            requestShutdown();
+            return;
+        }
+        // Corpus mode subsumes both overlap modes: the generator never
+        // runs again after baking, so there is nothing to overlap
+        pipeline.prebake(prebake_cycles_, prebake_time_);
+        std::cout << "Prebaked " << prebake_cycles_
+                  << " cycle buffer(s); streaming round-robin." << std::endl;
+        return;
+    }
+    if (use_pipeline_ || use_overlap_) {
+        // Ring slots plus the inline buffer; tiny, but the ledger
+        // should cover every pool it promises to
+        if (!MemBudget::reserve("cycle buffers",
+                                (CyclePipeline::kDepth + 1) * 4096ull)) {
+            requestShutdown();
+            return;
+        }
+    }
+    if (use_pipeline_) {
+        pipeline.start(&shutdown_event_);
+    } else if (use_overlap_) {
+        pipeline.startOverlap(&shutdown_event_);
+    }
+}
+
+void PtyHandler::setPrebake(size_t cycles, bool patch_time)
+{
+    prebake_cycles_ = cycles;
+    prebake_time_   = patch_time;
+}
+
+void PtyHandler::setEnablePty(bool enable)
+{
+    force_pty_ = enable;
+}
+
+void PtyHandler::setUdpTarget(const std::string& host, uint16_t port, int ttl)
+{
+    if (!udp_host_.empty()) {
+        // Further destinations fan out through one sendmmsg per cycle
+        udp_extra_.emplace_back(host, port);
+        return;
+    }
+    udp_host_ = host;
+    udp_port_ = port;
+    udp_ttl_  = ttl;
+}
+
+void PtyHandler::setUdpTxtime(bool enable)
+{
+    udp_txtime_ = enable;
+}
+
+void PtyHandler::setTcpBind(const std::string& host, uint16_t port)
+{
+    tcp_host_ = host;
+    tcp_port_ = port;
+}
+
+void PtyHandler::setUnixSocket(const std::string& path)
+{
+    unix_path_ = path;
+}
+
+void PtyHandler::setShmName(const std::string& name)
+{
+    shm_name_ = name;
+}
+
+void PtyHandler::setDeviceCount(unsigned count)
+{
+    device_count_ = count;
+}
+
+void PtyHandler::setFleetCoro(bool coro)
+{
+    fleet_coro_ = coro;
+}
+
+void PtyHandler::setSinkPool(unsigned workers, const std::string& socket_path)
+{
+    sink_pool_workers_ = workers;
+    sink_pool_path_    = socket_path;
+}
+
+void PtyHandler::setForkSinks(bool fork_sinks)
+{
+    fork_sinks_ = fork_sinks;
+}
+
+void PtyHandler::setBurst(unsigned burst)
+{
+    burst_ = burst > 0 ? burst : 1;
+}
+
+void PtyHandler::setScenario(ScenarioPlan plan)
+{
+    scenario_ = std::move(plan);
+}
+
+bool PtyHandler::openCapture(const std::string& path)
+{
+    capture_path_ = path;
+    return capture_.open(path);
+}
+
+void PtyHandler::setCaptureDirect(bool direct)
+{
+    capture_.setDirect(direct);
+}
+
+void PtyHandler::setStatsInterval(double seconds)
+{
+    stats_interval_ = seconds > 0 ? seconds : 0.0;
+}
+
+void PtyHandler::setBacklogWarn(size_t bytes)
+{
+    backlog_warn_ = bytes;
+}
+
+void PtyHandler::setAdaptiveRate(std::vector<unsigned> levels)
+{
+    adapt_levels_ = std::move(levels);
+}
+
+void PtyHandler::setMetricsSocket(const std::string& name)
+{
+    metrics_name_ = name;
+}
+
+void PtyHandler::setControlSocket(const std::string& name)
+{
+    control_name_ = name;
+}
+
+void PtyHandler::setLeaseSocket(const std::string& name)
+{
+    lease_name_ = name;
+}
+
+void PtyHandler::setPps(const std::string& path)
+{
+    pps_path_ = path;
+}
+
+namespace {
+
+// Sink display names, indexed by SinkId; shared by the --stats line
+// and the --metrics JSON snapshot
+const char* const sink_names[] = { "pipe", "serial", "pty", "udp", "tcp", "unix", "shm",
+                                   "callback", "mmap" };
+
+} // namespace
+
+// One --stats tick: snapshot the relaxed counters and print one line
+// of per-sink deltas since the previous tick. Sinks that have emitted
+// nothing stay out of the line. One line every N seconds from a cold
+// thread cannot perturb the writer timing the way the per-cycle
+// payload dump does.
+void PtyHandler::statsTick()
+{
+    constexpr size_t kSinks = static_cast<size_t>(SinkId::Count);
+    char field[64];
+
+    std::string line = "[stats]";
+    bool any         = false;
+    for (size_t s = 0; s < kSinks; ++s) {
+        SinkCounters& c = sink_counters_[s];
+        uint64_t now[6] = { c.cycles.load(std::memory_order_relaxed),
+                            c.sentences.load(std::memory_order_relaxed),
+                            c.bytes.load(std::memory_order_relaxed),
+                            c.dropped.load(std::memory_order_relaxed),
+                            c.retries.load(std::memory_order_relaxed),
+                            c.stalls.load(std::memory_order_relaxed) };
+        if (now[0] == 0 && now[3] == 0) {
+            continue;
+        }
+        uint64_t(&last)[6] = stats_last_[s];
+        snprintf(field, sizeof(field), "%s%s: %llu cyc %llu snt %.1f KB/s",
+                 any ? " | " : " ", sink_names[s],
+                 static_cast<unsigned long long>(now[0] - last[0]),
+                 static_cast<unsigned long long>(now[1] - last[1]),
+                 static_cast<double>(now[2] - last[2]) / stats_interval_ / 1024.0);
+        line += field;
+        if (now[3] != last[3]) {
+            snprintf(field, sizeof(field), " drop %llu",
+                     static_cast<unsigned long long>(now[3] - last[3]));
+            line += field;
+        }
+        if (now[4] != last[4]) {
+            snprintf(field, sizeof(field), " retry %llu",
+                     static_cast<unsigned long long>(now[4] - last[4]));
+            line += field;
+        }
+        if (now[5] != last[5]) {
+            snprintf(field, sizeof(field), " stall %llu",
+                     static_cast<unsigned long long>(now[5] - last[5]));
+            line += field;
+        }
+        int64_t p99 = sink_write_p99_[s].load(std::memory_order_relaxed);
+        if (p99 > 0) {
+            snprintf(field, sizeof(field), " p99 %.0fus", p99 / 1000.0);
+            line += field;
+        }
+        // Kernel-side backlog toward the consumer; quiet while the
+        // buffer is empty, a growing figure here is the early warning
+        int backlog = sink_backlog_[s].load(std::memory_order_relaxed);
+        if (backlog > 0) {
+            snprintf(field, sizeof(field), " bl %dB", backlog);
+            line += field;
+        }
+        for (int i = 0; i < 6; ++i) {
+            last[i] = now[i];
+        }
+        any = true;
+    }
+
+    // Name the slow consumer: the sink with the worst published
+    // p99 write latency this period
+    size_t slowest  = kSinks;
+    int64_t max_p99 = 0;
+    for (size_t s = 0; s < kSinks; ++s) {
+        int64_t p99 = sink_write_p99_[s].load(std::memory_order_relaxed);
+        if (p99 > max_p99) {
+            max_p99 = p99;
+            slowest = s;
+        }
+    }
+    if (slowest != kSinks) {
+        snprintf(field, sizeof(field), " | slowest: %s", sink_names[slowest]);
+        line += field;
+    }
+    if (any) {
+        std::cout << line << std::endl;
+    }
+}
+
+// Once-per-second backlog sampler: ask the kernel how many bytes sit
+// unconsumed toward each consumer — TIOCOUTQ on the serial and PTY
+// descriptors, FIONREAD on the FIFO — and publish the answers as
+// per-sink gauges for --stats and --metrics. By the time a write
+// blocks, the consumer has been falling behind for as long as the
+// kernel buffer took to fill; the gauge shows that fill as a trend,
+// so a slowdown is visible minutes before it becomes an emission
+// stall. Two ioctls a second from the service thread; the writers
+// never learn the sample happened.
+void PtyHandler::backlogTick()
+{
+    NMEA_ALLOC_SCOPE("PtyHandler::backlogTick");
+    struct Probe {
+        SinkId sink;
+        int fd;
+        unsigned long request;
+    } probes[] = {
+        { SinkId::Pipe, pipe_probe_fd_.load(std::memory_order_relaxed), FIONREAD },
+        { SinkId::Serial, serial_fd_.load(), TIOCOUTQ },
+        { SinkId::Pty, master_fd_, TIOCOUTQ },
+    };
+    for (const Probe& p : probes) {
+        size_t s = static_cast<size_t>(p.sink);
+        if (p.fd == -1) {
+            continue;
+        }
+        int queued = 0;
+        if (ioctl(p.fd, p.request, &queued) == -1 || queued < 0) {
+            continue; // descriptor mid-reopen; keep the last gauge
+        }
+        sink_backlog_[s].store(queued, std::memory_order_relaxed);
+        if (backlog_warn_ == 0) {
+            continue;
+        }
+        // Warn once per excursion: latch at the threshold, re-arm only
+        // after the sink drains back below half of it, so a consumer
+        // hovering at the line does not warn every second
+        if (!backlog_warned_[s] && static_cast<size_t>(queued) >= backlog_warn_) {
+            backlog_warned_[s] = true;
+            std::cerr << "Warning: " << sink_names[s] << " sink backlog " << queued
+                      << " bytes (threshold " << backlog_warn_
+                      << "); consumer is falling behind" << std::endl;
+        } else if (backlog_warned_[s]
+                   && static_cast<size_t>(queued) < backlog_warn_ / 2) {
+            backlog_warned_[s] = false;
+        }
+    }
+}
+
+// Service thread: register every configured periodic activity on one
+// DeadlineHeap and drive them behind a single timerfd. A fourth
+// periodic activity is one more heap.add() here; before the heap each
+// one was a dedicated thread inventing its own sleep-and-check loop.
+void PtyHandler::serviceLoop()
+{
+    DeadlineHeap heap;
+    if (stats_interval_ > 0) {
+        heap.add(stats_interval_, [this]() { statsTick(); });
+    }
+    // The backlog gauges feed --stats, --metrics and the --backlog-warn
+    // early warning; sampling runs only when someone is looking
+    if (stats_interval_ > 0 || !metrics_name_.empty() || backlog_warn_ > 0) {
+        heap.add(1.0, [this]() { backlogTick(); });
+    }
+    if (!checkpoint_path_.empty()) {
+        // The writer publishes a pending snapshot at most once per
+        // checkpoint period; this task serializes it within 100 ms of
+        // publication, the pitch the dedicated thread used to poll at
+        heap.add(0.1, [this]() {
+            if (ckpt_pending_.load(std::memory_order_acquire)) {
+                checkpointFlush();
+                ckpt_pending_.store(false, std::memory_order_release);
+            }
+        });
+    }
+    // Timed run (--duration): after the deadline, take the same clean
+    // shutdown path SIGINT does, so histograms and counters still dump
+    if (run_seconds_ > 0) {
+        heap.addOnce(run_seconds_, [this]() {
+            if (!shutdown_event_.load()) {
+                std::cout << "Run duration reached. Shutting down..." << std::endl;
+                requestShutdown();
+            }
+        });
+    }
+    heap.run(shutdown_event_, shutdown_wake_fd);
+
+    // A snapshot published in the final period still reaches the file:
+    // flush any pending checkpoint on the way out, as the dedicated
+    // thread did, so --resume sees the last few seconds of the run
+    if (!checkpoint_path_.empty() && ckpt_pending_.load(std::memory_order_acquire)) {
+        checkpointFlush();
+        ckpt_pending_.store(false, std::memory_order_release);
+    }
+}
+
+// 1PPS pulse thread (--pps): one byte written to a dedicated FIFO at
+// each top-of-second of the writer scheduler's deadline grid. Sharing
+// the writer's epoch — and its hybrid sleep/spin tail — bounds
+// pulse-to-sentence alignment by timer accuracy (tens of
+// microseconds), where the external pulse tool this replaces drifted
+// by two processes' scheduling. The pulse is a pipe byte rather than
+// a TIOCMSET modem-line toggle: Linux PTYs do not implement the
+// modem-control ioctls, so the control-line variant only ever worked
+// against real hardware.
+void PtyHandler::ppsLoop()
+{
+    NMEA_ALLOC_SCOPE("PtyHandler::ppsLoop");
+    if (access(pps_path_.c_str(), F_OK) == -1) {
+        if (mkfifo(pps_path_.c_str(), 0666) != 0) {
+            std::cerr << "Failed to create PPS pipe: " << pps_path_ << std::endl;
+            return;
+        }
+        std::cout << "PPS pipe created at: " << pps_path_ << std::endl;
+    }
+    // O_RDWR: the open must not block waiting for a consumer, and the
+    // pulses must not die of EPIPE when one detaches mid-run
+    int fd = ::open(pps_path_.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd == -1) {
+        std::cerr << "Failed to open PPS pipe: " << pps_path_ << ": "
+                  << strerror(errno) << std::endl;
+        return;
+    }
+
+    // Adopt the writer scheduler's epoch so pulses sit on the sentence
+    // grid; a mode that never builds one (or a slow start) falls back
+    // to our own after a beat
+    auto epoch = std::chrono::steady_clock::now();
+    for (int i = 0; i < 100 && scheduler_epoch_ns.load() == -1 && !shutdown_event_.load();
+         ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    long long epoch_ns = scheduler_epoch_ns.load();
+    if (epoch_ns != -1) {
+        epoch = std::chrono::steady_clock::time_point(
+            std::chrono::steady_clock::duration(epoch_ns));
+    }
+
+    uint64_t pulses    = 0;
+    uint64_t skipped   = 0;
+    uint64_t dropped   = 0;
+    long long worst_ns = 0;
+    uint64_t next      = 1;
+    while (!shutdown_event_.load()) {
+        auto deadline = epoch + std::chrono::seconds(next);
+        auto now      = std::chrono::steady_clock::now();
+        if (now > deadline) {
+            // Same policy as the cycle scheduler: a missed slot skips
+            // to the next future second rather than bursting catch-up
+            // pulses
+            uint64_t slot = static_cast<uint64_t>(
+                                std::chrono::duration<double>(now - epoch).count())
+                + 1;
+            skipped += slot - next;
+            next     = slot;
+            deadline = epoch + std::chrono::seconds(next);
+        }
+        // Interruptible coarse sleep to just short of the deadline,
+        // then spin the tail — the writer's hybrid waiter, at 1 Hz
+        auto coarse = deadline - std::chrono::microseconds(200);
+        while (!shutdown_event_.load()) {
+            now = std::chrono::steady_clock::now();
+            if (now >= coarse) {
+                break;
+            }
+            int timeout_ms = static_cast<int>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(coarse - now).count());
+            if (timeout_ms <= 0) {
+                std::this_thread::sleep_until(coarse);
+                break;
+            }
+            struct pollfd pfd = { shutdown_wake_fd, POLLIN, 0 };
+            if (poll(&pfd, 1, timeout_ms) > 0) {
+                break;
+            }
+        }
+        if (shutdown_event_.load()) {
+            break;
+        }
+        while (std::chrono::steady_clock::now() < deadline) {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        }
+        ssize_t n = write(fd, "\n", 1);
+        long long err_ns
+            = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now() - deadline)
+                  .count();
+        if (err_ns > worst_ns) {
+            worst_ns = err_ns;
+        }
+        if (n == 1) {
+            ++pulses;
+        } else if (n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            ++dropped; // unread FIFO full: consumer gone for ~18 hours
+        } else if (n == -1 && errno != EINTR) {
+            logger_.logError("Error writing PPS pulse", errno);
+        }
+        ++next;
+    }
+
+    close(fd);
+    if (unlink(pps_path_.c_str()) == 0) {
+        std::cout << "PPS pipe removed: " << pps_path_ << std::endl;
+    }
+    if (pulses > 0) {
+        std::cout << "PPS emitted " << pulses << " pulse(s), worst wake error "
+                  << worst_ns / 1000 << " us." << std::endl;
+    }
+    if (skipped + dropped > 0) {
+        std::cout << "PPS skipped " << skipped << " slot(s), dropped " << dropped
+                  << " pulse(s) to a full pipe." << std::endl;
+    }
+}
+
+// --metrics responder: an abstract unix socket (no filesystem entry,
+// vanishes with the process) that answers every connection with one
+// JSON snapshot of the sink counters and closes. The snapshot is
+// assembled here from the relaxed atomics, so a scrape costs the
+// writer threads zero syscalls — they never learn it happened.
+void PtyHandler::metricsLoop()
+{
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd == -1) {
+        std::cerr << "Error creating metrics socket: " << strerror(errno) << std::endl;
+        return;
+    }
+
+    struct sockaddr_un addr {};
+    addr.sun_family = AF_UNIX;
+    // Abstract namespace: a leading NUL instead of a path
+    size_t name_len = std::min(metrics_name_.size(), sizeof(addr.sun_path) - 1);
+    memcpy(addr.sun_path + 1, metrics_name_.data(), name_len);
+    socklen_t addr_len
+        = static_cast<socklen_t>(offsetof(struct sockaddr_un, sun_path) + 1 + name_len);
+
+    if (bind(listen_fd, reinterpret_cast<struct sockaddr*>(&addr), addr_len) == -1
+        || listen(listen_fd, 4) == -1) {
+        std::cerr << "Error binding metrics socket @" << metrics_name_ << ": "
+                  << strerror(errno) << std::endl;
+        close(listen_fd);
+        return;
+    }
+    std::cout << "Metrics endpoint listening on @" << metrics_name_ << std::endl;
+
+    constexpr size_t kSinks = static_cast<size_t>(SinkId::Count);
+    std::string snapshot;
+    char field[224];
+
+    while (!shutdown_event_.load()) {
+        struct pollfd pfd = { listen_fd, POLLIN, 0 };
+        if (poll(&pfd, 1, 200) <= 0) {
+            continue;
+        }
+        int conn = accept(listen_fd, nullptr, nullptr);
+        if (conn == -1) {
+            continue;
+        }
+
+        snapshot = "{\"sinks\":{";
+        bool any        = false;
+        size_t slowest  = kSinks;
+        int64_t max_p99 = 0;
+        for (size_t s = 0; s < kSinks; ++s) {
+            SinkCounters& c = sink_counters_[s];
+            uint64_t cycles = c.cycles.load(std::memory_order_relaxed);
+            uint64_t drops  = c.dropped.load(std::memory_order_relaxed);
+            if (cycles == 0 && drops == 0) {
+                continue;
+            }
+            int64_t p99 = sink_write_p99_[s].load(std::memory_order_relaxed);
+            if (p99 > max_p99) {
+                max_p99 = p99;
+                slowest = s;
+            }
+            snprintf(field, sizeof(field),
+                     "%s\"%s\":{\"cycles\":%llu,\"sentences\":%llu,\"bytes\":%llu,"
+                     "\"dropped\":%llu,\"retries\":%llu,\"write_p99_ns\":%lld",
+                     any ? "," : "", sink_names[s],
+                     static_cast<unsigned long long>(cycles),
+                     static_cast<unsigned long long>(
+                         c.sentences.load(std::memory_order_relaxed)),
+                     static_cast<unsigned long long>(c.bytes.load(std::memory_order_relaxed)),
+                     static_cast<unsigned long long>(drops),
+                     static_cast<unsigned long long>(c.retries.load(std::memory_order_relaxed)),
+                     static_cast<long long>(p99));
+            snapshot += field;
+            // Backlog gauge rides along once the sampler has seen the
+            // sink's descriptor; scrapers trend it for early warning
+            int backlog = sink_backlog_[s].load(std::memory_order_relaxed);
+            if (backlog >= 0) {
+                snprintf(field, sizeof(field), ",\"backlog_bytes\":%d", backlog);
+                snapshot += field;
+            }
+            snapshot += "}";
+            any = true;
+        }
+        snapshot += "}";
+        if (slowest != kSinks) {
+            snprintf(field, sizeof(field), ",\"slowest_sink\":\"%s\"", sink_names[slowest]);
+            snapshot += field;
+        }
+        snapshot += "}\n";
+
+        // Best-effort write; a slow or vanished scraper is its problem
+        (void)!write(conn, snapshot.c_str(), snapshot.size());
+        close(conn);
+    }
+    close(listen_fd);
+}
+
+// --control responder: an abstract unix socket (like --metrics) whose
+// connections carry one-line reconfiguration commands, e.g.
+// "interval 0.5" or "sentences RMC,GGA". Commands from one connection
+// merge into a single ControlUpdate published by pointer swap; an
+// update the writer has not consumed yet is folded in rather than
+// lost, so back-to-back connections never drop a change.
+void PtyHandler::controlLoop()
+{
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd == -1) {
+        std::cerr << "Error creating control socket: " << strerror(errno) << std::endl;
+        return;
+    }
+
+    struct sockaddr_un addr {};
+    addr.sun_family = AF_UNIX;
+    // Abstract namespace: a leading NUL instead of a path
+    size_t name_len = std::min(control_name_.size(), sizeof(addr.sun_path) - 1);
+    memcpy(addr.sun_path + 1, control_name_.data(), name_len);
+    socklen_t addr_len
+        = static_cast<socklen_t>(offsetof(struct sockaddr_un, sun_path) + 1 + name_len);
+
+    if (bind(listen_fd, reinterpret_cast<struct sockaddr*>(&addr), addr_len) == -1
+        || listen(listen_fd, 4) == -1) {
+        std::cerr << "Error binding control socket @" << control_name_ << ": "
+                  << strerror(errno) << std::endl;
+        close(listen_fd);
+        return;
+    }
+    std::cout << "Control endpoint listening on @" << control_name_ << std::endl;
+
+    while (!shutdown_event_.load()) {
+        struct pollfd pfd = { listen_fd, POLLIN, 0 };
+        if (poll(&pfd, 1, 200) <= 0) {
+            continue;
         }
+        int conn = accept(listen_fd, nullptr, nullptr);
+        if (conn == -1) {
+            continue;
+        }
+
+        char request[512];
+        ssize_t got = read(conn, request, sizeof(request) - 1);
+        if (got <= 0) {
+            close(conn);
+            continue;
+        }
+        request[got] = '\0';
+
+        auto update = std::make_unique<ControlUpdate>();
+        std::string reply;
+        char* save = nullptr;
+        for (char* line = strtok_r(request, "\r\n", &save); line != nullptr;
+             line       = strtok_r(nullptr, "\r\n", &save)) {
+            parseControlCommand(line, *update, reply, true);
+        }
+
+        // Fold in an update the writer has not consumed yet, then
+        // publish. The writer may consume between the exchange and the
+        // store; then both updates apply, which is also correct.
+        ControlUpdate* stale = pending_control.exchange(nullptr, std::memory_order_acq_rel);
+        if (stale != nullptr) {
+            if (update->interval <= 0) update->interval = stale->interval;
+            if (std::isnan(update->speed)) update->speed = stale->speed;
+            if (std::isnan(update->course)) update->course = stale->course;
+            if (update->sats < 0) update->sats = stale->sats;
+            if (update->fix < -1) update->fix = stale->fix;
+            if (std::isnan(update->hdop)) update->hdop = stale->hdop;
+            if (update->mask == 0) update->mask = stale->mask;
+            delete stale;
+        }
+        pending_control.store(update.release(), std::memory_order_release);
+
+        (void)!write(conn, reply.c_str(), reply.size());
+        close(conn);
     }
+    close(listen_fd);
 
-    if (master_fd_ != -1) {
-        close(master_fd_);
-        std::cout << "PTY writer thread exiting." << std::endl;
+    // Nothing will consume a command left pending at shutdown
+    delete pending_control.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+void PtyHandler::setDuration(double seconds)
+{
+    run_seconds_ = seconds > 0 ? seconds : 0.0;
+}
+
+void PtyHandler::setCalibrate(double seconds)
+{
+    calibrate_seconds_ = seconds > 0 ? seconds : 0.0;
+}
+
+void PtyHandler::setBridge(const std::string& in_port, const std::string& out_port)
+{
+    bridge_in_  = in_port;
+    bridge_out_ = out_port;
+    // The socat recipe ran its pairs raw (raw,echo=0); the bridge does
+    // too, so the relay is byte-exact — no CR translation on the way
+    // through
+    raw_profile_ = true;
+    // The default PTY link is never created in bridge mode; clearing
+    // it keeps cleanup() from complaining about a link that was never
+    // there
+    symlink_path_.clear();
+}
+
+void PtyHandler::setCompressSinks(bool enable)
+{
+    compress_sinks_ = enable;
+}
+
+void PtyHandler::setRelay(const std::string& host, uint16_t port)
+{
+    relay_host_ = host;
+    relay_port_ = port;
+    // The relay re-emits the producer's bytes verbatim; raw keeps the
+    // local PTY from translating the CRLFs on the way out
+    raw_profile_ = true;
+}
+
+void PtyHandler::setCalibrateJson(bool json)
+{
+    calibrate_json_ = json;
+}
+
+namespace {
+
+// Self-profiling hardware counters for the calibration loop
+// (perf_event_open(2)): the build farm runners have no perf CLI, but
+// the syscall works unprivileged for self-profiling, so --calibrate
+// can say why throughput moved, not just that it did. One group of
+// four counters — cycles, instructions, LLC read misses, dTLB read
+// misses — is opened on the calibration thread and read around the
+// generate and write phases; the three read() syscalls per iteration
+// land on both phases equally, so phase ratios stay honest. Hosts
+// that refuse the syscall (paranoid sysctl, containers, missing PMU)
+// degrade to the plain throughput report with a one-line note.
+class PerfCalibration {
+public:
+    static constexpr int kCounters = 4;
+
+    struct Phase {
+        uint64_t cycles       = 0;
+        uint64_t instructions = 0;
+        uint64_t llc_misses   = 0;
+        uint64_t dtlb_misses  = 0;
+    };
+
+    ~PerfCalibration() { closeAll(); }
+
+    bool open()
+    {
+        static const struct {
+            uint32_t type;
+            uint64_t config;
+        } kEvents[kCounters] = {
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            { PERF_TYPE_HW_CACHE,
+              PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                  | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+            { PERF_TYPE_HW_CACHE,
+              PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                  | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+        };
+        for (int i = 0; i < kCounters; ++i) {
+            struct perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size           = sizeof(attr);
+            attr.type           = kEvents[i].type;
+            attr.config         = kEvents[i].config;
+            attr.disabled       = (i == 0) ? 1 : 0;
+            attr.exclude_kernel = 1; // keeps the open unprivileged
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_GROUP;
+            int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1,
+                                              i == 0 ? -1 : fds_[0], 0));
+            if (fd == -1) {
+                closeAll();
+                return false;
+            }
+            fds_[i] = fd;
+        }
+        ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        ok_ = true;
+        return true;
     }
 
-    std::cout << "PtyHandler exited gracefully." << std::endl;
+    bool ok() const { return ok_; }
+
+    // One group read: running totals of all four counters
+    void sample(uint64_t out[kCounters])
+    {
+        struct {
+            uint64_t nr;
+            uint64_t values[kCounters];
+        } data;
+        if (read(fds_[0], &data, sizeof(data)) != sizeof(data)) {
+            ok_ = false;
+            return;
+        }
+        for (int i = 0; i < kCounters; ++i) {
+            out[i] = data.values[i];
+        }
+    }
+
+    static void accumulate(Phase& phase, const uint64_t before[kCounters],
+                           const uint64_t after[kCounters])
+    {
+        phase.cycles += after[0] - before[0];
+        phase.instructions += after[1] - before[1];
+        phase.llc_misses += after[2] - before[2];
+        phase.dtlb_misses += after[3] - before[3];
+    }
+
+    // IPC and misses per 1k instructions: the units regression
+    // thresholds are written in
+    static double ipc(const Phase& p)
+    {
+        return p.cycles > 0 ? static_cast<double>(p.instructions) / p.cycles : 0.0;
+    }
+    static double perKiloInstr(uint64_t misses, const Phase& p)
+    {
+        return p.instructions > 0 ? 1000.0 * misses / p.instructions : 0.0;
+    }
+
+private:
+    void closeAll()
+    {
+        for (int& fd : fds_) {
+            if (fd != -1) {
+                close(fd);
+                fd = -1;
+            }
+        }
+        ok_ = false;
+    }
+
+    int fds_[kCounters] = { -1, -1, -1, -1 };
+    bool ok_            = false;
+};
+
+} // namespace
+
+void PtyHandler::calibrateLoop()
+{
+    // An anonymous pipe with an internal draining reader: the loop
+    // exercises the real generate + write(2) path without blocking on
+    // an external consumer, so the result is the host's ceiling, not
+    // the consumer's.
+    int fds[2];
+    if (pipe2(fds, O_CLOEXEC) == -1) {
+        std::cerr << "Error creating calibration pipe: " << strerror(errno) << std::endl;
+        requestShutdown();
+        return;
+    }
+
+    std::thread drain([read_fd = fds[0]]() {
+        char sink[65536];
+        while (read(read_fd, sink, sizeof(sink)) > 0) { }
+    });
+
+    LatencyHistogram cycle_time;
+    std::string buf;
+    uint64_t cycles = 0;
+    uint64_t bytes  = 0;
+
+    PerfCalibration perf;
+    PerfCalibration::Phase gen_phase;
+    PerfCalibration::Phase write_phase;
+    if (!perf.open()) {
+        std::cout << "perf counters unavailable (" << strerror(errno)
+                  << "); reporting throughput only." << std::endl;
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    auto end   = begin + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                           std::chrono::duration<double>(calibrate_seconds_));
+
+    while (!shutdown_event_.load() && std::chrono::steady_clock::now() < end) {
+        uint64_t s0[PerfCalibration::kCounters];
+        uint64_t s1[PerfCalibration::kCounters];
+        uint64_t s2[PerfCalibration::kCounters];
+        auto t0 = std::chrono::steady_clock::now();
+        buf.clear();
+        if (perf.ok()) {
+            perf.sample(s0);
+        }
+        generator_->generateCycles(burst_, buf);
+        if (perf.ok()) {
+            perf.sample(s1);
+        }
+        ssize_t n = write(fds[1], buf.c_str(), buf.size());
+        auto t1 = std::chrono::steady_clock::now();
+        if (perf.ok()) {
+            perf.sample(s2);
+            PerfCalibration::accumulate(gen_phase, s0, s1);
+            PerfCalibration::accumulate(write_phase, s1, s2);
+        }
+        if (n == -1) {
+            std::cerr << "Error writing calibration pipe: " << strerror(errno) << std::endl;
+            break;
+        }
+        cycle_time.record(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        cycles += burst_;
+        bytes += buf.size();
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin)
+                         .count();
+
+    close(fds[1]);
+    drain.join();
+    close(fds[0]);
+
+    double cps = elapsed > 0 ? cycles / elapsed : 0;
+    char line[160];
+
+    // Machine-readable variant (--calibrate-json): the same numbers as
+    // one JSON object, so a harness parses them instead of scraping
+    // the report text
+    if (calibrate_json_) {
+        char json[768];
+        int len = snprintf(json, sizeof(json),
+                           "{\"cycles\":%llu,\"bytes\":%llu,\"seconds\":%.3f,"
+                           "\"cycles_per_sec\":%.1f,\"mb_per_sec\":%.2f,"
+                           "\"cycle_p50_ns\":%lld,\"cycle_p99_ns\":%lld,"
+                           "\"cycle_p999_ns\":%lld",
+                           static_cast<unsigned long long>(cycles),
+                           static_cast<unsigned long long>(bytes), elapsed, cps,
+                           elapsed > 0 ? bytes / elapsed / (1024.0 * 1024.0) : 0.0,
+                           static_cast<long long>(cycle_time.percentileBound(0.50)),
+                           static_cast<long long>(cycle_time.percentileBound(0.99)),
+                           static_cast<long long>(cycle_time.percentileBound(0.999)));
+        // Perf fields appear only when the counters opened, so a
+        // missing key tells the harness the host could not measure,
+        // not that the build got slower
+        if (perf.ok()) {
+            len += snprintf(
+                json + len, sizeof(json) - static_cast<size_t>(len),
+                ",\"gen_ipc\":%.3f,\"gen_llc_miss_per_ki\":%.3f,"
+                "\"gen_dtlb_miss_per_ki\":%.4f,\"write_ipc\":%.3f,"
+                "\"write_llc_miss_per_ki\":%.3f,\"write_dtlb_miss_per_ki\":%.4f",
+                PerfCalibration::ipc(gen_phase),
+                PerfCalibration::perKiloInstr(gen_phase.llc_misses, gen_phase),
+                PerfCalibration::perKiloInstr(gen_phase.dtlb_misses, gen_phase),
+                PerfCalibration::ipc(write_phase),
+                PerfCalibration::perKiloInstr(write_phase.llc_misses, write_phase),
+                PerfCalibration::perKiloInstr(write_phase.dtlb_misses, write_phase));
+        }
+        snprintf(json + len, sizeof(json) - static_cast<size_t>(len), "}");
+        std::cout << json << std::endl;
+        requestShutdown();
+        return;
+    }
+
+    std::cout << "Calibration: " << cycles << " cycles in ";
+    snprintf(line, sizeof(line), "%.2f s", elapsed);
+    std::cout << line << std::endl;
+    snprintf(line, sizeof(line), "  %.0f cycles/sec, %.2f MB/s", cps,
+             elapsed > 0 ? bytes / elapsed / (1024.0 * 1024.0) : 0);
+    std::cout << line << std::endl;
+    cycle_time.dump("  cycle time");
+    if (perf.ok()) {
+        char perf_line[200];
+        snprintf(perf_line, sizeof(perf_line),
+                 "  generate: IPC %.2f, %.2f LLC / %.3f dTLB misses per 1k instr "
+                 "(%.1fM instructions)",
+                 PerfCalibration::ipc(gen_phase),
+                 PerfCalibration::perKiloInstr(gen_phase.llc_misses, gen_phase),
+                 PerfCalibration::perKiloInstr(gen_phase.dtlb_misses, gen_phase),
+                 gen_phase.instructions / 1e6);
+        std::cout << perf_line << std::endl;
+        snprintf(perf_line, sizeof(perf_line),
+                 "  write:    IPC %.2f, %.2f LLC / %.3f dTLB misses per 1k instr "
+                 "(%.1fM instructions)",
+                 PerfCalibration::ipc(write_phase),
+                 PerfCalibration::perKiloInstr(write_phase.llc_misses, write_phase),
+                 PerfCalibration::perKiloInstr(write_phase.dtlb_misses, write_phase),
+                 write_phase.instructions / 1e6);
+        std::cout << perf_line << std::endl;
+    }
+    // Capacity hint in the units deployment planning actually uses
+    snprintf(line, sizeof(line), "  ~%.0f simulated devices at 10 Hz sustainable", cps / 10.0);
+    std::cout << line << std::endl;
+
+    requestShutdown();
 }
 
-// Signal shutdown
-void PtyHandler::signalShutdown()
+// Corpus generation at disk bandwidth: the historical workflow ran a
+// paced simulator against a FIFO with cat on the other end, so a 10 GB
+// corpus took as long as the simulated mission. Here the generator
+// runs flat out and cycles accumulate in one reused buffer that is
+// written in multi-megabyte slices — one write(2) per ~4 MB instead of
+// per cycle. Scenario phases fire on simulated time (emitted cycles x
+// interval), not the wall clock, so the scripted timeline lands where
+// it would in a live run.
+bool PtyHandler::emitLog(const std::string& path, uint64_t cycles)
 {
-    shutdown_event_.store(true);
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd == -1) {
+        std::cerr << "Error creating log file: " << path << ": " << strerror(errno)
+                  << std::endl;
+        return false;
+    }
+
+    auto writeAll = [](int fd, const char* data, size_t len) {
+        size_t off = 0;
+        while (off < len) {
+            ssize_t n = write(fd, data + off, len - off);
+            if (n == -1) {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            off += static_cast<size_t>(n);
+        }
+        return true;
+    };
+
+    constexpr size_t kFlushBytes = 4u << 20;
+    std::string buf;
+    buf.reserve(kFlushBytes + (64u << 10)); // slack for the last cycle past the mark
+
+    double interval  = interval_;
+    double sim_time  = 0.0;
+    uint64_t emitted = 0;
+    uint64_t bytes   = 0;
+    bool ok          = true;
+    auto begin       = std::chrono::steady_clock::now();
+
+    while (emitted < cycles) {
+        if (!scenario_.empty()) {
+            while (const ScenarioEvent* event = scenario_.dueAt(sim_time)) {
+                generator_->adjustMotion(event->speed, event->course);
+                if (event->sats >= 0) {
+                    generator_->setSatelliteTarget(static_cast<unsigned>(event->sats));
+                }
+                if (event->interval > 0) {
+                    interval = event->interval;
+                    generator_->setCycleSeconds(event->interval);
+                }
+                if (event->fix >= -1) {
+                    generator_->setFixQuality(event->fix);
+                }
+                if (!std::isnan(event->hdop)) {
+                    generator_->setForcedHdop(event->hdop);
+                }
+                if (event->dropout >= 0) {
+                    generator_->dropConstellation(event->dropout);
+                }
+            }
+        }
+        generator_->generateCycles(1, buf);
+        ++emitted;
+        sim_time += interval;
+        if (buf.size() >= kFlushBytes) {
+            if (!writeAll(fd, buf.data(), buf.size())) {
+                ok = false;
+                break;
+            }
+            bytes += buf.size();
+            buf.clear();
+        }
+    }
+    if (ok && !buf.empty()) {
+        ok = writeAll(fd, buf.data(), buf.size());
+        bytes += buf.size();
+    }
+    if (close(fd) == -1) {
+        ok = false;
+    }
+    if (!ok) {
+        std::cerr << "Error writing log file: " << path << ": " << strerror(errno)
+                  << std::endl;
+        return false;
+    }
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin)
+                         .count();
+    char line[160];
+    snprintf(line, sizeof(line), "Emitted %llu cycle(s), %llu byte(s) to %s in %.2f s (%.1f MB/s)",
+             static_cast<unsigned long long>(emitted),
+             static_cast<unsigned long long>(bytes), path.c_str(), elapsed,
+             elapsed > 0 ? bytes / elapsed / (1024.0 * 1024.0) : 0.0);
+    std::cout << line << std::endl;
+    return true;
+}
+
+void PtyHandler::setSinkRate(SinkId sink, unsigned divisor)
+{
+    sink_shaping_[static_cast<size_t>(sink)].divisor = divisor > 0 ? divisor : 1;
+}
+
+void PtyHandler::setSinkMask(SinkId sink, unsigned mask)
+{
+    sink_shaping_[static_cast<size_t>(sink)].mask = mask;
+}
+
+bool PtyHandler::sinkFromName(const std::string& name, SinkId& sink)
+{
+    if (name == "pipe") {
+        sink = SinkId::Pipe;
+    } else if (name == "serial") {
+        sink = SinkId::Serial;
+    } else if (name == "pty") {
+        sink = SinkId::Pty;
+    } else if (name == "udp") {
+        sink = SinkId::Udp;
+    } else if (name == "tcp") {
+        sink = SinkId::Tcp;
+    } else if (name == "unix") {
+        sink = SinkId::Unix;
+    } else if (name == "shm") {
+        sink = SinkId::Shm;
+    } else if (name == "callback") {
+        sink = SinkId::Callback;
+    } else if (name == "mmap") {
+        sink = SinkId::Mmap;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void PtyHandler::setStartCycle(uint64_t cycle)
+{
+    start_cycle_ = cycle;
+}
+
+void PtyHandler::setRate(double rate)
+{
+    rate_ = rate;
+}
+
+void PtyHandler::setLogPacing(bool pace_log)
+{
+    pace_log_ = pace_log;
+}
+
+void PtyHandler::setFollow(bool follow)
+{
+    follow_ = follow;
+}
+
+void PtyHandler::setRetime(bool retime)
+{
+    retime_log_ = retime;
+}
+
+void PtyHandler::setReplayFilter(std::vector<std::string> types, bool drop)
+{
+    replay_filter_types_ = std::move(types);
+    replay_filter_drop_  = drop;
+}
+
+void PtyHandler::setReplayPrefetch(unsigned mb)
+{
+    replay_prefetch_mb_ = mb;
+}
+
+void PtyHandler::setExtraReplayFiles(std::vector<std::string> paths)
+{
+    extra_files_ = std::move(paths);
+}
+
+void PtyHandler::setLineSpeed(speed_t speed)
+{
+    line_speed_ = speed;
+}
+
+void PtyHandler::setUartPace(unsigned baud)
+{
+    uart_pace_baud_ = baud;
+}
+
+void PtyHandler::setPipeBuffer(size_t bytes)
+{
+    pipe_buffer_bytes_ = bytes;
+}
+
+void PtyHandler::setCheckpoint(const std::string& path)
+{
+    checkpoint_path_ = path;
+    ckpt_buf_        = std::make_unique<GeneratorCheckpoint>();
+}
+
+// Writer-thread checkpoint hook: at most one snapshot per period,
+// taken at a cycle boundary where the generator is quiescent. The copy
+// is a few kilobytes once every few seconds; the disk write happens on
+// the checkpoint thread.
+void PtyHandler::checkpointCycle()
+{
+    if (checkpoint_path_.empty() || ckpt_pending_.load(std::memory_order_acquire)) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (now - last_checkpoint_ < std::chrono::duration<double>(checkpoint_period_)) {
+        return;
+    }
+    last_checkpoint_ = now;
+    generator_->saveState(*ckpt_buf_);
+    ckpt_pending_.store(true, std::memory_order_release);
+}
+
+// Serialize the pending snapshot to <path>.tmp and rename it over
+// <path>. The rename is atomic, so a crash mid-write (or a --resume
+// racing the writer) always finds a complete checkpoint. Runs on the
+// service thread, from the periodic flush task in serviceLoop.
+void PtyHandler::checkpointFlush()
+{
+    std::string tmp = checkpoint_path_ + ".tmp";
+    FILE* out       = fopen(tmp.c_str(), "wb");
+    if (out == nullptr) {
+        std::cerr << "Error opening checkpoint file: " << tmp << std::endl;
+        return;
+    }
+    bool ok = fwrite(ckpt_buf_.get(), sizeof(GeneratorCheckpoint), 1, out) == 1;
+    ok      = fclose(out) == 0 && ok;
+    if (!ok || rename(tmp.c_str(), checkpoint_path_.c_str()) != 0) {
+        std::cerr << "Error writing checkpoint: " << checkpoint_path_ << std::endl;
+    }
+}
+
+void PtyHandler::setMmapOut(const std::string& path)
+{
+    mmap_out_path_ = path;
+}
+
+void PtyHandler::setCycleCallback(CycleCallback cb)
+{
+    cycle_callback_ = std::move(cb);
+}
+
+void PtyHandler::setSelfTest(bool enable)
+{
+    selftest_ = enable;
+}
+
+void PtyHandler::setRawProfile(bool raw)
+{
+    raw_profile_ = raw;
+}
+
+void PtyHandler::setFlushPolicy(FlushMode mode, double value)
+{
+    flush_mode_  = mode;
+    flush_value_ = value;
+}
+
+void PtyHandler::setJitter(JitterDist dist, double amplitude_seconds, uint64_t seed)
+{
+    // One draw per slot, all at startup; the schedulers replay the
+    // table with cycle % size. 8192 slots repeat only after ~2 h at
+    // 1 Hz — far past any consumer timing test — while the table
+    // (64 KB) stays cache-resident.
+    constexpr size_t kTableSize = 8192;
+    std::mt19937_64 rng(seed);
+    jitter_offsets.resize(kTableSize);
+    if (dist == JitterDist::Uniform) {
+        std::uniform_real_distribution<double> draw(-amplitude_seconds, amplitude_seconds);
+        for (double& offset : jitter_offsets) {
+            offset = draw(rng);
+        }
+    } else {
+        // Clamp at 3 sigma so a rare tail draw cannot push a deadline
+        // a whole slot away and read as an overrun storm
+        std::normal_distribution<double> draw(0.0, amplitude_seconds);
+        for (double& offset : jitter_offsets) {
+            offset = std::clamp(draw(rng), -3.0 * amplitude_seconds, 3.0 * amplitude_seconds);
+        }
+    }
+}
+
+bool PtyHandler::jitterFromSpec(const std::string& spec, JitterDist& dist, double& amplitude)
+{
+    size_t colon = spec.find(':');
+    if (colon == std::string::npos) {
+        return false;
+    }
+    std::string name = spec.substr(0, colon);
+    if (name == "uniform") {
+        dist = JitterDist::Uniform;
+    } else if (name == "gauss") {
+        dist = JitterDist::Gauss;
+    } else {
+        return false;
+    }
+    amplitude = std::stod(spec.substr(colon + 1)) / 1e3; // milliseconds on the CLI
+    return amplitude > 0.0;
+}
+
+bool PtyHandler::flushFromName(const std::string& spec, FlushMode& mode, double& value)
+{
+    if (spec == "none") {
+        mode  = FlushMode::None;
+        value = 0.0;
+        return true;
+    }
+    if (spec.compare(0, 6, "every:") == 0) {
+        value = std::stod(spec.substr(6));
+        mode  = FlushMode::EveryN;
+        return value >= 1.0;
+    }
+    if (spec.compare(0, 5, "secs:") == 0) {
+        value = std::stod(spec.substr(5));
+        mode  = FlushMode::Interval;
+        return value > 0.0;
+    }
+    return false;
+}
+
+bool PtyHandler::shouldFlush()
+{
+    switch (flush_mode_) {
+    case FlushMode::None:
+        return false;
+    case FlushMode::EveryN:
+        return ++flush_cycle_count_ % static_cast<uint64_t>(flush_value_) == 0;
+    case FlushMode::Interval: {
+        double now = std::chrono::duration<double>(
+            std::chrono::steady_clock::now().time_since_epoch())
+                         .count();
+        if (now - last_flush_seconds_ >= flush_value_) {
+            last_flush_seconds_ = now;
+            return true;
+        }
+        return false;
+    }
+    }
+    return false;
+}
+
+bool PtyHandler::baudFromValue(unsigned value, speed_t& speed)
+{
+    switch (value) {
+    case 9600: speed = B9600; break;
+    case 19200: speed = B19200; break;
+    case 38400: speed = B38400; break;
+    case 57600: speed = B57600; break;
+    case 115200: speed = B115200; break;
+    case 230400: speed = B230400; break;
+    case 460800: speed = B460800; break;
+    case 921600: speed = B921600; break;
+    case 1000000: speed = B1000000; break;
+    case 1500000: speed = B1500000; break;
+    case 2000000: speed = B2000000; break;
+    case 3000000: speed = B3000000; break;
+    case 4000000: speed = B4000000; break;
+    default: return false;
+    }
+    return true;
+}
+
+bool PtyHandler::backpressureFromName(const std::string& name, BackpressurePolicy& policy)
+{
+    if (name == "drop") {
+        policy = BackpressurePolicy::Drop;
+    } else if (name == "latest") {
+        policy = BackpressurePolicy::Latest;
+    } else if (name == "block") {
+        policy = BackpressurePolicy::Block;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool PtyHandler::queuePolicyFromName(const std::string& name, QueuePolicy& policy)
+{
+    if (name == "oldest") {
+        policy = QueuePolicy::DropOldest;
+    } else if (name == "newest") {
+        policy = QueuePolicy::DropNewest;
+    } else if (name == "latest") {
+        policy = QueuePolicy::Latest;
+    } else {
+        return false;
+    }
+    return true;
 }
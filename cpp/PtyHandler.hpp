@@ -2,13 +2,64 @@
 #ifndef PTY_HANDLER_HPP
 #define PTY_HANDLER_HPP
 
+#include "AsyncLogger.hpp"
+#include "CaptureLog.hpp"
+#include "ScenarioPlan.hpp"
+#include "SinkStats.hpp"
+
 #include <atomic>
+#include <chrono>
 #include <functional>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <termios.h>
 #include <thread>
+#include <utility>
+#include <vector>
 
 // Forward declaration of NmeaGenerator
 class NmeaGenerator;
+struct GeneratorCheckpoint;
+
+class CyclePipeline;
+
+// When the writer drains the output device with fsync (--flush).
+// Pipes and PTYs never need it (the kernel buffer provides ordering);
+// on real tty devices fsync blocks for the full line drain, so it is
+// opt-in rather than per-cycle.
+enum class FlushMode {
+    None, // never fsync (default)
+    EveryN, // fsync once every n cycles
+    Interval // fsync when the configured time has elapsed
+};
+
+// Policy applied when the PTY consumer stops reading and the kernel
+// buffer fills (--backpressure)
+enum class BackpressurePolicy {
+    Drop, // discard the unwritten remainder of the cycle immediately
+    Latest, // additionally skip the cycle entirely if the PTY is not
+            // writable at its start, so the consumer resumes on a clean
+            // cycle boundary with the latest state
+    Block // wait for writability up to one cycle interval, then drop
+};
+
+// What a full pending-cycle queue does with the overflow (--queue).
+// GNSS consumers usually want freshest-fix-wins (Latest); log-style
+// consumers want the backlog kept intact for as long as the bound
+// allows (DropNewest); DropOldest trades the tail of the backlog for
+// recency while still smoothing short stalls.
+enum class QueuePolicy {
+    DropOldest, // evict the head to make room for the incoming cycle
+    DropNewest, // refuse the incoming cycle, keep the queued backlog
+    Latest // coalesce: clear the backlog, only the freshest cycle waits
+};
+
+// Distribution the --jitter deadline offsets are drawn from
+enum class JitterDist {
+    Uniform, // uniform in [-amplitude, +amplitude]
+    Gauss // normal with sigma = amplitude, clamped at 3 sigma
+};
 
 class PtyHandler {
 public:
@@ -26,20 +77,525 @@ public:
     // Signal handler to initiate shutdown
     void signalShutdown();
 
+    // Suppress per-cycle console output (--quiet)
+    void setQuiet(bool quiet);
+
+    // Log only every n-th cycle to the console
+    void setLogSampleEvery(unsigned n);
+
+    // Sampled live console mirror instead of per-cycle records (--preview)
+    void setPreview(double seconds);
+
+    // Select the slow-consumer policy for PTY writes
+    void setBackpressurePolicy(BackpressurePolicy policy);
+
+    // Bounded pending-cycle queue for the PTY sink (--queue): cycles a
+    // stalled consumer refuses are parked and drained in order once it
+    // resumes, instead of being dropped on the spot; the policy decides
+    // who loses when the stall outlives the bound. Takes precedence
+    // over --backpressure for the write path.
+    void setPendingQueue(size_t depth, QueuePolicy policy);
+
+    // Use the io_uring output backend where supported (--io-backend)
+    void setUseUring(bool use_uring);
+
+    // Use vmsplice for the named-pipe sink (--io-backend vmsplice)
+    void setUseVmsplice(bool use_vmsplice);
+
+    // Run generation on its own thread, feeding the writer through a
+    // lock-free SPSC ring (--pipeline)
+    void setUsePipeline(bool use_pipeline);
+
+    // Lockstep double-buffered generation (--overlap): one cycle of
+    // lookahead rather than the ring's four
+    void setUseOverlap(bool use_overlap);
+
+    // Late time stamping (--late-stamp): patch every cycle's hhmmss.ss
+    // fields and checksums immediately before the write, so the wire
+    // carries the emission clock rather than the generation clock
+    void setLateStamp(bool enable);
+
+    // Pin the writer thread to a CPU (--cpu); -1 leaves it unpinned
+    void setCpuAffinity(int cpu);
+
+    // Pin the pipeline's generator thread to a CPU (--gen-cpu); keep it
+    // off the writer's core or the overlap serializes again
+    void setGenCpuAffinity(int cpu);
+
+    // Prebaked cycle corpus for consumer profiling (--prebake): bake
+    // cycles up front, stream them round-robin with normal pacing, and
+    // optionally patch UTC time fields in place per emission
+    void setPrebake(size_t cycles, bool patch_time);
+
+    // SCHED_FIFO priority for writer and generator threads (--rt-prio);
+    // 0 keeps normal scheduling, and the request degrades gracefully
+    // without CAP_SYS_NICE
+    void setRtPriority(int prio);
+
+    // Advertised line speed for the virtual serial port (--baud)
+    void setLineSpeed(speed_t speed);
+
+    // Byte-rate pacing of PTY output at the real line rate
+    // (--uart-pace): bytes trickle out of a token bucket at baud/10
+    // (8N1) instead of one burst per cycle, reproducing the intra-cycle
+    // timing a consumer sees on real hardware. 0 disables pacing.
+    void setUartPace(unsigned baud);
+
+    // Periodic warm-start snapshots of the generator (--checkpoint):
+    // written atomically to path every few seconds, off the hot path
+    void setCheckpoint(const std::string& path);
+
+    // Kernel FIFO capacity for the named-pipe sink (--pipe-buffer):
+    // the default 64 KB absorbs only ~160 ms of dense-sky output, so
+    // consumer GC pauses back the writer up into emission jitter; a
+    // few megabytes rides them out. 0 keeps the kernel default.
+    void setPipeBuffer(size_t bytes);
+
+    // Verified loopback (--selftest): a reader thread opens our own
+    // slave PTY, checks framing and checksums on everything read back
+    // and reports loss, corruption and the verified byte rate
+    void setSelfTest(bool enable);
+
+    // Termios profile applied to the slave PTY (--tty-profile):
+    // "8n1" keeps the historical cooked-input raw-output settings,
+    // "raw" runs cfmakeraw so no input translation happens either
+    void setRawProfile(bool raw);
+
+    // Map a numeric baud rate to its Bxxx constant; returns false for
+    // rates termios cannot express
+    static bool baudFromValue(unsigned value, speed_t& speed);
+
+    // Request the PTY sink in addition to pipe/serial sinks (--pty);
+    // on its own the PTY remains the default sink
+    void setEnablePty(bool enable);
+
+    // UDP sink (--udp host:port): one sendto per cycle, multicast
+    // groups supported, TTL configurable (--udp-ttl). Repeatable: the
+    // first call sets the primary destination, further calls add
+    // fan-out consumers served by one sendmmsg per cycle.
+    void setUdpTarget(const std::string& host, uint16_t port, int ttl);
+
+    // Hardware-paced UDP emission (--udp-txtime): stamp every datagram
+    // with its cycle deadline via SO_TXTIME and let the ETF/fq qdisc or
+    // the NIC release it, taking scheduler jitter off the wire. Falls
+    // back to the hybrid timer when the kernel refuses the option.
+    void setUdpTxtime(bool enable);
+
+    // Listening TCP sink (--tcp [host]:port): accepts any number of
+    // consumers and fans every cycle out to all of them
+    void setTcpBind(const std::string& host, uint16_t port);
+
+    // Unix SOCK_SEQPACKET sink (--unix path): connection semantics with
+    // one atomic message per cycle
+    void setUnixSocket(const std::string& path);
+
+    // Shared-memory ring sink (--shm name): same-host consumers map the
+    // ring read-only for zero-copy cycle hand-off
+    void setShmName(const std::string& name);
+
+    // Memory-mapped ring-file sink (--mmap-out file): offline consumers
+    // map the file read-only and poll at their own pace; the file also
+    // serves as a flight recorder of the last ring's worth of output
+    void setMmapOut(const std::string& path);
+
+    // In-process callback sink: the embedder's function is invoked with
+    // each completed cycle buffer and its sequence number — zero-copy
+    // delivery with no serialization boundary, driven by the same
+    // scheduler/scenario machinery as the byte-stream sinks. The buffer
+    // is only valid for the duration of the call.
+    using CycleCallback = std::function<void(const char* data, size_t len, uint64_t seq)>;
+    void setCycleCallback(CycleCallback cb);
+
+    // Sink identifiers for per-sink shaping
+    enum class SinkId : unsigned { Pipe, Serial, Pty, Udp, Tcp, Unix, Shm, Callback, Mmap, Count };
+
+    // Per-sink shaping in fan-out mode (--sink-rate, --sink-sentences):
+    // a rate divisor (the sink emits every n-th cycle) and a sentence
+    // mask applied by slicing the shared generated cycle along its
+    // CRLF-delimited sentence spans — heterogeneous sinks cost index
+    // filtering, not extra generation passes
+    void setSinkRate(SinkId sink, unsigned divisor);
+    void setSinkMask(SinkId sink, unsigned mask);
+
+    // Parse a sink name ("pipe", "serial", "pty", "udp", "tcp", "unix",
+    // "shm"). Returns false for unknown names.
+    static bool sinkFromName(const std::string& name, SinkId& sink);
+
+    // Fleet mode (--count): run N PTY devices from this one process
+    // instead of N processes. The symlink path acts as a template whose
+    // "%d" expands to the device index. Devices share the process image
+    // and a fixed worker pool; each keeps its own generator clone on a
+    // disjoint RNG stream.
+    void setDeviceCount(unsigned count);
+
+    // Fleet execution backend (--fleet-backend coro): run devices as
+    // C++20 coroutines on a single-threaded epoll reactor instead of
+    // the thread-pool deadline scheduler — no per-device stacks, device
+    // switches are resumes rather than context switches
+    void setFleetCoro(bool coro);
+
+    // Multi-process fan-out (--fork-sinks): the producer generates each
+    // cycle once into an anonymous shared-memory ring and one forked
+    // child per sink emits from it — per-sink crash isolation without
+    // per-sink generation cost
+    void setForkSinks(bool fork_sinks);
+
+    // Pre-forked writer pool (--sink-pool): n workers forked up front
+    // share the anonymous cycle ring, and consumers attach live at a
+    // control socket — the accepted fd is handed to the least-loaded
+    // worker over SCM_RIGHTS, so an attach costs one fd pass instead
+    // of a process spawn, with zero generation or parsing setup
+    void setSinkPool(unsigned workers, const std::string& socket_path);
+
+    // Periodic one-line throughput report (--stats): per-sink cycle,
+    // sentence and byte rates from a background thread; 0 disables it
+    void setStatsInterval(double seconds);
+
+    // Early-warning threshold for the kernel backlog gauges
+    // (--backlog-warn): warn once when the bytes queued toward a
+    // consumer cross this level, re-arming when the sink drains back
+    // below half of it; 0 samples the gauges without warning
+    void setBacklogWarn(size_t bytes);
+
+    // Adaptive rate stepping (--adaptive-rate): interval multipliers
+    // the writer walks down when the sinks report backpressure and
+    // back up when they drain; empty = fixed rate
+    void setAdaptiveRate(std::vector<unsigned> levels);
+
+    // Metrics endpoint (--metrics): an abstract unix socket answering
+    // each connection with one JSON snapshot of the sink counters
+    void setMetricsSocket(const std::string& name);
+
+    // Runtime control endpoint (--control): an abstract unix socket
+    // accepting one-line reconfiguration commands (interval, speed,
+    // course, sats, fix, hdop, sentences). Each command is published
+    // through an atomic pointer swap and applied by the writer at the
+    // next cycle boundary — the hot loop pays one pointer load per
+    // cycle and never locks, so rate and content change with zero
+    // emission gap and no consumer reconnect.
+    void setControlSocket(const std::string& name);
+
+    // Lease endpoint for a resident fleet (--lease, with --count): an
+    // abstract unix socket where the "attach" verb leases a warmed
+    // device in milliseconds. The connection is the lease; closing it
+    // detaches, and the device's generator state is recycled to the
+    // configured baseline before the next attach.
+    void setLeaseSocket(const std::string& name);
+
+    // Timed run (--duration): request the normal clean shutdown after
+    // the given number of seconds, so profiling runs end on a cycle
+    // boundary with all the shutdown reports intact
+    void setDuration(double seconds);
+
+    // Calibration mode (--calibrate): run generate + pipe write flat
+    // out for the given number of seconds and report the achieved
+    // cycle rate, byte rate and p99 cycle time, then exit
+    void setCalibrate(double seconds);
+
+    // Emit the --calibrate report as a single JSON object on stdout
+    // instead of the human-readable block (--calibrate-json), so
+    // benchmark harnesses consume the numbers without scraping text
+    void setCalibrateJson(bool json);
+
+    // Native two-port bridge (--bridge <in>:<out>): the process runs
+    // as the relay the old socat recipe provided — two linked PTYs
+    // with bytes spliced between their masters in-kernel — instead of
+    // generating. An in port naming an existing character device is
+    // opened and forwarded rather than created.
+    void setBridge(const std::string& in_port, const std::string& out_port);
+
+    // Deflate-compress the TCP and unix-socket sinks per cycle
+    // (--compress); consumers inflate frames independently
+    void setCompressSinks(bool enable);
+
+    // Relay mode (--relay host:port): connect to a compressed TCP
+    // sink, inflate each frame and re-emit the plain text on a local
+    // linked PTY. No generator runs.
+    void setRelay(const std::string& host, uint16_t port);
+
+    // 1PPS pulse output (--pps <path>): one byte to the named FIFO at
+    // each top-of-second of the writer's deadline grid
+    void setPps(const std::string& path);
+
+    // Offline corpus generation (--emit-log): batch-generate the given
+    // number of cycles straight into a file with multi-megabyte
+    // buffered writes — disk-bandwidth-limited, no pacing, no sinks.
+    // Honors the configured generator state (seed, mask, motion) and
+    // applies a --scenario timeline on simulated time, so a scripted
+    // corpus lands its phase changes on the same cycles a paced run
+    // would. Returns false on I/O error.
+    bool emitLog(const std::string& path, uint64_t cycles);
+
+    // Scripted run (--scenario): a precompiled timeline of phase
+    // changes the writer loop applies at cycle boundaries; one bound
+    // check per cycle, nothing re-parsed at runtime
+    void setScenario(ScenarioPlan plan);
+
+    // Binary capture (--capture): start recording every emitted cycle
+    // as (monotonic timestamp, length, bytes); the hot path pays one
+    // ring enqueue, a dedicated thread does the file I/O. Returns false
+    // if the capture file cannot be opened.
+    bool openCapture(const std::string& path);
+
+    // O_DIRECT double-buffered capture writing (--capture-direct);
+    // call before openCapture (CaptureLog::setDirect)
+    void setCaptureDirect(bool direct);
+
+    // Cycles emitted back to back per interval (--burst): each sleep is
+    // preceded by one contiguous write of m cycles, exercising consumer
+    // queue handling the way a flushed UART FIFO does
+    void setBurst(unsigned burst);
+
+    // Deterministic emission jitter (--jitter): offset every cycle
+    // deadline by a value from a table drawn once at startup from a
+    // seeded distribution, so two runs with the same spec and seed
+    // pace with bit-identical timing noise — consumers can be A/B
+    // tested against the exact same jitter pattern, and a
+    // timing-sensitivity regression bisects on a fixed workload. The
+    // per-cycle cost is one table load; the RNG never runs after
+    // startup. Offsets that push a deadline past the next slot count
+    // as overruns like any other late cycle.
+    void setJitter(JitterDist dist, double amplitude_seconds, uint64_t seed);
+
+    // Parse a --jitter argument ("uniform:<ms>", "gauss:<ms>").
+    // Returns false if the spec is malformed.
+    static bool jitterFromSpec(const std::string& spec, JitterDist& dist, double& amplitude);
+
+    // First cycle replayed from the log (--start-cycle); an O(1) jump
+    // into the cycle index, wrapping past the end. Only meaningful with
+    // --file, and only for the first pass — rewinds restart at cycle 0.
+    void setStartCycle(uint64_t cycle);
+
+    // Replay rate multiplier (--rate): scales inter-cycle delays, so a
+    // six-hour log replays in minutes at --rate 100. Zero means --rate
+    // max: no pacing at all, cycles go out as fast as the sink accepts.
+    void setRate(double rate);
+
+    // Live follow mode (--follow): at EOF, wait for the log to grow
+    // (inotify, no polling burn) and resume from the previous offset
+    // instead of rewinding — lets one process append while another
+    // replays the tail
+    void setFollow(bool follow);
+
+    // Fresh-timestamp replay (--retime): patch each cycle's hhmmss.ss
+    // fields to the current wall clock as it goes out, repairing the
+    // checksums incrementally, so consumers with freshness checks
+    // accept an archived log without an offline rewrite pass. Pacing
+    // still follows the log's original timestamps.
+    void setRetime(bool retime);
+
+    // Index-time sentence filtering for replay (--only / --drop): the
+    // cycle index records only matching sentences, so the filtered
+    // stream replays with no per-line tests and no preprocessed copy
+    // of the log (ReplayLog::setSentenceFilter)
+    void setReplayFilter(std::vector<std::string> types, bool drop);
+
+    // Replay prefetch window in MB (--prefetch): how far ahead of the
+    // cursor MADV_WILLNEED is kept issued on a mapped log; 0 disables
+    // the prefetch thread
+    void setReplayPrefetch(unsigned mb);
+
+    // Additional logs merged into the --file replay by timestamp
+    // (repeated --file); each source keeps its own index and mapping,
+    // interleaving happens at the cycle level (ReplayMerge)
+    void setExtraReplayFiles(std::vector<std::string> paths);
+
+    // Timestamp-faithful replay pacing (--pace log): sleep the true
+    // inter-cycle delta from the RMC time fields instead of a constant
+    // interval, preserving dropouts and rate transitions. Cycles
+    // without a parsable time fall back to the fixed interval. --rate
+    // applies on top.
+    void setLogPacing(bool pace_log);
+
+    // Select the fsync policy; value is the cycle count (EveryN) or
+    // the period in seconds (Interval)
+    void setFlushPolicy(FlushMode mode, double value);
+
+    // Parse a --flush argument ("none", "every:<n>", "secs:<x>").
+    // Returns false if the spec is malformed.
+    static bool flushFromName(const std::string& spec, FlushMode& mode, double& value);
+
+    // Parse a --backpressure argument ("drop", "latest", "block").
+    // Returns false if the name is unknown.
+    static bool backpressureFromName(const std::string& name, BackpressurePolicy& policy);
+
+    // Parse a --queue policy name ("oldest", "newest", "latest")
+    static bool queuePolicyFromName(const std::string& name, QueuePolicy& policy);
+
 private:
+    // Set the shutdown flag and wake every deadline waiter, so exit
+    // latency is bounded at milliseconds regardless of --interval
+    void requestShutdown();
+
     // Setup methods
     void setupSignalHandler();
     void setupNamedPipe();
     void setupPTY();
 
+    // Grow the kernel FIFO on a freshly attached pipe fd and report
+    // the size actually granted (--pipe-buffer); no-op when unset
+    void applyPipeBuffer(int fd);
+
     // Cleanup resources
     void cleanup();
 
+    // Open one configured PTY master (non-blocking, --baud and
+    // --tty-profile applied to the slave); returns -1 on failure
+    int openPtyMaster(std::string& slave_name);
+
+    // Template-aware PTY open for the fleet pool: the first call per
+    // template builds the termios profile, later calls apply it
+    // verbatim and skip the tcgetattr ioctl
+    int openPtyMasterTpl(std::string& slave_name, struct termios& tty,
+                         bool& have_template);
+
+    // Retry failed symlinks off the start path: each entry is a
+    // (target, link) pair. Generation begins as soon as the PTY exists;
+    // /tmp hygiene is reconciled in the background.
+    void startSymlinkReconciler(std::vector<std::pair<std::string, std::string>> pending);
+
+    // Service thread: every periodic side activity — the --stats tick,
+    // the --checkpoint flush poll, the --duration shutdown — registers
+    // on one DeadlineHeap and waits behind a single timerfd, so the
+    // next periodic activity is a registration, not another thread
+    // with its own sleep loop
+    void serviceLoop();
+
+    // One --stats tick: snapshot the sink counters and print a line of
+    // per-sink deltas since the previous tick
+    void statsTick();
+
+    // One backlog-sampler tick: query the kernel-side buffer fill
+    // toward each consumer (TIOCOUTQ on serial and PTY fds, FIONREAD
+    // on the FIFO) and publish the gauges; runs once per second on the
+    // service thread, never on a writer
+    void backlogTick();
+
+    // Background responder behind --metrics; reads the counters only,
+    // so scrapes cost the writer threads nothing
+    void metricsLoop();
+
+    // Background responder behind --control: parses commands off the
+    // socket and publishes them for the writer's cycle-boundary hook
+    void controlLoop();
+
+    // 1PPS pulse thread behind --pps: paced on the writer scheduler's
+    // epoch with the same hybrid sleep/spin tail
+    void ppsLoop();
+
+    // Unpaced generate + write loop behind --calibrate; runs the real
+    // pipe write path against an internal draining reader
+    void calibrateLoop();
+
+    // Standalone relay loop behind --bridge; owns both ports for its
+    // lifetime
+    void bridgeLoop();
+
+    // Standalone decompressing consumer behind --relay; owns the TCP
+    // connection and the local PTY for its lifetime
+    void relayLoop();
+
     // Writer methods
     void writerPipe();
     void writerSerial();
     void writerPTY();
 
+    // Hot-unplug recovery for the serial sink: POLLERR/POLLHUP on the
+    // fd marks a disconnect, a side thread retries open() with
+    // exponential backoff, and the writer keeps cycling meanwhile
+    // (counting the cycles the dead port missed) so generator state
+    // and sibling sinks survive an adapter replug.
+    static bool serialDisconnected(int fd);
+    void beginSerialReopen();
+    void serialReopenLoop();
+
+    // Fleet writer (--count): owns device setup, the worker pool and
+    // teardown for all N devices
+    void writerFleet();
+
+    // Multi-process fan-out producer (--fork-sinks): publishes cycles
+    // into a fork-shared ring and supervises one child per sink
+    void writerForked();
+
+    // Pre-forked pool producer (--sink-pool): publishes cycles into a
+    // fork-shared ring, accepts consumers at the control socket and
+    // passes each accepted fd to a pool worker over SCM_RIGHTS
+    void writerPool();
+
+    // Writes one replayed cycle; raw is the verbatim mapped span when
+    // the log is CRLF wire format, empty otherwise. Returns false on
+    // unrecoverable sink error.
+    using ReplaySink = std::function<bool(const std::vector<std::string_view>& cycle,
+                                          std::string_view raw)>;
+
+    // The one replay driver behind all --file sinks: opens and indexes
+    // the log, honors --start-cycle, emits cycles through the sink and
+    // paces them (--rate, --pace log). Every replay optimization lands
+    // here once instead of three times.
+    void replayLoop(const char* heading, const ReplaySink& sink);
+
+    // Fan-out writer: one generation pass per cycle, the shared
+    // immutable buffer written to every configured sink
+    void writerMulti();
+
+    // Writer to a UDP destination (unicast or multicast group)
+    void writerUdp();
+
+    // Multi-destination UDP writer: all consumers' transmissions of a
+    // cycle batched into one sendmmsg, every msghdr referencing the one
+    // shared buffer — per-additional-consumer cost is one msghdr entry,
+    // not one syscall
+    void writerUdpFanout();
+
+    // Listening TCP server fanning cycles out to connected consumers
+    void writerTcp();
+
+    // Listening unix SEQPACKET server; one atomic message per cycle
+    void writerUnix();
+
+    // Writer into the shared-memory ring
+    void writerShm();
+
+    // Writer invoking the embedder's in-process callback
+    void writerCallback();
+
+    // Writer into the memory-mapped ring file
+    void writerMmap();
+
+    // Open and connect the UDP socket; -1 on failure
+    int openUdpSocket();
+
+    // Write one replay cycle to the FIFO descriptor, reopening once on
+    // reader disconnect (EPIPE). A non-empty raw span is written
+    // verbatim; otherwise the cycle lines go out via writev. Returns
+    // the (possibly reopened) fd, or -1 on unrecoverable error.
+    int writeCycleToPipeFd(int fd,
+                           const std::vector<std::string_view>& cycle,
+                           std::string_view raw = {});
+
+    // Flush one replay cycle with writev: iovecs point at the mapped
+    // lines plus a shared CRLF constant, so a cycle costs one syscall
+    // and no per-sentence concatenation. Returns false on write error.
+    static bool writeCycleV(int fd, const std::vector<std::string_view>& cycle);
+
+    // Emit a replayed cycle's raw mapped bytes verbatim (the log is
+    // already CRLF wire format): a single iovec, zero per-line work.
+    // Returns false on write error.
+    static bool writeCycleRaw(int fd, std::string_view raw);
+
+    // Apply the flush policy: true when this cycle should fsync
+    bool shouldFlush();
+
+    // Start the writer's pipeline in the configured overlap mode:
+    // free-running SPSC ring (--pipeline), lockstep double buffering
+    // (--overlap), or neither (inline generation)
+    void startPipeline(CyclePipeline& pipeline);
+
+    // Write one generated cycle to the non-blocking PTY, applying the
+    // configured backpressure policy. epfd watches master_fd_ for
+    // EPOLLOUT. Returns false only on a hard write error.
+    bool writePtyCycle(int epfd, const char* data, size_t len);
+
     // Member variables
     std::string pipe_path_;
     std::string serial_port_;
@@ -47,13 +603,271 @@ private:
     double interval_;
     std::atomic<bool> shutdown_event_;
     std::thread writer_thread_;
+    std::thread symlink_thread_; // background symlink reconciler
+    std::thread service_thread_; // DeadlineHeap for the periodic side work
+    std::thread metrics_thread_; // metrics-socket responder (--metrics)
+    std::thread control_thread_; // reconfiguration responder (--control)
+    std::thread pps_thread_; // 1PPS pulse emitter (--pps)
+    std::thread serial_reopen_thread_; // backoff reopen after serial unplug
+    std::atomic<int> serial_fd_ { -1 }; // live serial fd; -1 while reopening
+    uint64_t serial_lost_cycles_ = 0; // cycles missed while disconnected
+    uint64_t serial_reconnects_  = 0;
     int master_fd_;
     std::string slave_name_;
     std::string file_path_; // New member variable
+    std::string bridge_in_; // --bridge in port: link to create, or device to forward
+    std::string bridge_out_; // --bridge out port link
+    bool compress_sinks_ = false; // deflate TCP/unix sink output (--compress)
+    std::string relay_host_; // --relay source host; empty = not relaying
+    uint16_t relay_port_ = 0;
+    std::string pps_path_; // 1PPS pulse FIFO (--pps); empty = off
 
     // Pointer to NmeaGenerator
     NmeaGenerator* generator_;
 
+    // Async console logger; writer threads enqueue, it flushes
+    AsyncLogger logger_;
+
+    // Slow-consumer handling for the PTY writer
+    BackpressurePolicy backpressure_ = BackpressurePolicy::Block;
+
+    // Pending-cycle queue (--queue): a ring of capacity-retaining slots
+    // owned by the writer thread, so no locks and no steady-state
+    // allocation once the slots have grown to cycle size. Empty vector
+    // means the queue is disabled.
+    struct PendingSlot {
+        std::string data;
+        size_t off = 0; // bytes already written from this slot
+    };
+    std::vector<PendingSlot> pending_;
+    size_t pending_head_       = 0;
+    size_t pending_count_      = 0;
+    QueuePolicy queue_policy_  = QueuePolicy::DropOldest;
+    uint64_t q_dropped_oldest_ = 0;
+    uint64_t q_dropped_newest_ = 0;
+    uint64_t q_coalesced_      = 0;
+
+    // Queue-mode write path and its helpers
+    bool writePtyQueued(const char* data, size_t len);
+    void enqueuePending(const char* data, size_t len);
+    int flushPending(); // 1 drained, 0 would block, -1 write error
+
+    // Token-bucket paced PTY write at the --baud byte rate (--uart-pace)
+    bool writePtyPaced(const char* data, size_t len);
+    uint64_t dropped_cycles_         = 0;
+
+    // Opt-in io_uring backend for generate-mode output
+    bool use_uring_ = false;
+
+    // Opt-in vmsplice backend for the named-pipe sink
+    bool use_vmsplice_ = false;
+
+    // Opt-in generation/writing pipeline for generate-mode writers
+    bool use_pipeline_ = false;
+
+    // Opt-in late time stamping for generate-mode writers
+    bool late_stamp_ = false;
+
+    // Opt-in lockstep double buffering when the full pipeline is off
+    bool use_overlap_ = false;
+
+    // Prebaked cycle corpus (--prebake): buffers baked once at startup
+    // and streamed round-robin, optionally with per-emission UTC
+    // time-field patching (--prebake-time)
+    size_t prebake_cycles_ = 0;
+    bool prebake_time_     = false;
+
+    // Thread scheduling knobs; -1 / 0 mean "leave the defaults alone"
+    int cpu_affinity_     = -1;
+    int gen_cpu_affinity_ = -1;
+    int rt_priority_      = 0;
+
+    // PTY requested explicitly alongside other sinks
+    bool force_pty_ = false;
+
+    // UDP destination; empty host means no UDP sink
+    std::string udp_host_;
+    uint16_t udp_port_ = 0;
+    int udp_ttl_       = 1;
+    bool udp_txtime_   = false; // SO_TXTIME deadline stamping (--udp-txtime)
+
+    // Additional --udp destinations beyond the primary; non-empty
+    // switches the UDP writer to the sendmmsg fan-out loop
+    std::vector<std::pair<std::string, uint16_t>> udp_extra_;
+
+    // TCP listener; port 0 means no TCP sink
+    std::string tcp_host_;
+    uint16_t tcp_port_ = 0;
+
+    // Unix SEQPACKET listener path; empty means no unix sink
+    std::string unix_path_;
+
+    // Shared-memory ring name; empty means no shm sink
+    std::string shm_name_;
+
+    // In-process consumer; empty means no callback sink
+    CycleCallback cycle_callback_;
+
+    // Ring-file path; empty means no mmap sink
+    std::string mmap_out_path_;
+
+    // Per-sink emission shaping; divisor 1 and mask 0 mean "everything"
+    // Hot-loop throughput counters, indexed by SinkId; read by the
+    // --stats reporter thread
+    SinkCounters sink_counters_[static_cast<size_t>(SinkId::Count)];
+
+    SinkCounters& counters(SinkId id) { return sink_counters_[static_cast<size_t>(id)]; }
+
+    // Published p99 write latency per sink in nanoseconds, snapshotted
+    // from the writer's local histogram every 64 cycles; 0 = no data.
+    // Read by the --stats and --metrics threads to name the slow sink.
+    std::atomic<int64_t> sink_write_p99_[static_cast<size_t>(SinkId::Count)] = {};
+
+    // Kernel-side backlog gauges, indexed by SinkId: bytes queued
+    // toward the consumer at the last sampler tick, -1 before the
+    // first sample. By the time a write blocks it is too late to see
+    // a slow consumer coming; the once-per-second sample turns the
+    // stall into a trend the stats endpoints show minutes earlier.
+    std::atomic<int> sink_backlog_[static_cast<size_t>(SinkId::Count)];
+
+    // Live FIFO descriptor for the sampler, published at every pipe
+    // attach (applyPipeBuffer) and cleared on a write failure; the
+    // sampler only ever reads it, the writer keeps ownership
+    std::atomic<int> pipe_probe_fd_ { -1 };
+
+    // Early-warning threshold in bytes; 0 = gauges only, no warning.
+    // backlog_warned_ is the per-sink hysteresis latch, touched only
+    // by the service thread.
+    size_t backlog_warn_ = 0;
+    bool backlog_warned_[static_cast<size_t>(SinkId::Count)] = {};
+
+    // Report period in seconds; 0 keeps the reporter off
+    double stats_interval_ = 0.0;
+
+    // Counter snapshot from the previous --stats tick, so each line
+    // reports per-period deltas; touched only by the service thread
+    uint64_t stats_last_[static_cast<size_t>(SinkId::Count)][6] = {};
+
+    // Adaptive-rate interval multipliers, best (full rate) first;
+    // empty keeps the cycle rate fixed
+    std::vector<unsigned> adapt_levels_;
+
+    // Abstract-socket name for the metrics endpoint; empty = off
+    std::string metrics_name_;
+
+    // Abstract-socket name for the control endpoint; empty = off
+    std::string control_name_;
+
+    // Abstract-socket name for the fleet lease endpoint; empty = off
+    std::string lease_name_;
+
+    // Calibration run length in seconds; 0 keeps normal operation
+    double calibrate_seconds_ = 0.0;
+
+    // Emit the calibration report as one JSON line for harnesses
+    bool calibrate_json_ = false;
+
+    // Timed-run length in seconds; 0 means run until SIGINT
+    double run_seconds_ = 0.0;
+
+    // Compiled --scenario timeline; empty = unscripted run
+    ScenarioPlan scenario_;
+
+    // Emitted-cycle capture sink; no-op until openCapture
+    // Warm-start checkpointing (--checkpoint): the writer thread
+    // snapshots the generator at a cycle boundary at most once per
+    // period; the service thread serializes to <path>.tmp and renames
+    // over <path>, so a crash mid-write keeps the previous snapshot
+    std::string checkpoint_path_;
+    double checkpoint_period_ = 5.0;
+    std::chrono::steady_clock::time_point last_checkpoint_;
+    std::unique_ptr<GeneratorCheckpoint> ckpt_buf_;
+    std::atomic<bool> ckpt_pending_ { false };
+    void checkpointCycle();
+    void checkpointFlush();
+
+    // Self-test loopback reader (--selftest)
+    bool selftest_ = false;
+    std::thread selftest_thread_;
+    void selfTestLoop();
+
+    CaptureLog capture_;
+
+    // Capture file path, kept so the pipe writer's tee(2) backend can
+    // reopen the same file for kernel-side duplication
+    std::string capture_path_;
+
+    // Writer-loop hook: record one emitted cycle when capturing
+    void captureCycle(const std::string& cycle)
+    {
+        if (capture_.enabled()) {
+            capture_.append(cycle);
+        }
+    }
+
+    struct SinkShaping {
+        unsigned divisor = 1; // emit every n-th fan-out cycle
+        unsigned mask    = 0; // SentenceId bits; 0 = all types
+    };
+    SinkShaping sink_shaping_[static_cast<size_t>(SinkId::Count)];
+
+    // Number of PTY devices in fleet mode; 1 keeps the classic single
+    // device paths
+    unsigned device_count_ = 1;
+
+    // Run the fleet on the coroutine reactor instead of worker threads
+    bool fleet_coro_ = false;
+
+    // Emit through forked per-sink writer processes
+    bool fork_sinks_ = false;
+
+    // Pre-forked writer pool: worker count and the control-socket path
+    // consumers attach at; 0 workers keeps the mode off
+    unsigned sink_pool_workers_ = 0;
+    std::string sink_pool_path_;
+
+    // Cycles generated and written per interval
+    unsigned burst_ = 1;
+
+    // First replayed cycle in --file mode
+    uint64_t start_cycle_ = 0;
+
+    // Replay pacing multiplier; 1.0 is real time, 0 disables pacing
+    double rate_ = 1.0;
+
+    // Pace replay from the log's own RMC timestamps
+    bool pace_log_ = false;
+
+    // Tail a growing log instead of rewinding at EOF
+    bool follow_ = false;
+
+    // Rewrite replayed time fields to the current wall clock
+    bool retime_log_ = false;
+
+    // Replay sentence filter: types kept (--only) or dropped (--drop)
+    std::vector<std::string> replay_filter_types_;
+    bool replay_filter_drop_ = false;
+
+    // MADV_WILLNEED window ahead of the replay cursor, in MB
+    unsigned replay_prefetch_mb_ = 64;
+
+    // Additional replay logs merged with file_path_ by timestamp
+    std::vector<std::string> extra_files_;
+
+    // PTY line configuration; 9600 8N1 matches the original hardcoded
+    // settings, high-rate rigs raise it so consumers that honor the
+    // advertised speed stop throttling
+    speed_t line_speed_ = B9600;
+    bool raw_profile_   = false;
+    unsigned uart_pace_baud_ = 0; // byte pacing at baud/10 B/s; 0 = off
+    size_t pipe_buffer_bytes_ = 0; // requested FIFO capacity (--pipe-buffer); 0 = kernel default
+
+    // fsync policy state, touched only by the writer thread
+    FlushMode flush_mode_        = FlushMode::None;
+    double flush_value_          = 0.0;
+    uint64_t flush_cycle_count_  = 0;
+    double last_flush_seconds_   = 0.0;
+
     // Static instance pointer for signal handling
     static PtyHandler* instance_;
 
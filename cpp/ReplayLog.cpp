@@ -0,0 +1,1126 @@
+// ReplayLog.cpp
+#include "ReplayLog.hpp"
+
+#include "CaptureLog.hpp"
+#include "HugePages.hpp"
+#include "MemBudget.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+namespace {
+
+// A cycle starts at an RMC sentence from any talker ($GPRMC, $GNRMC,
+// ...). This is the inner loop of every index build, so the matcher is
+// a single pass: the talker bytes are wildcards and only the fixed
+// positions are compared — '$' up front, "RMC" at offset 3. The old
+// version ran find_first_not_of plus up to five full prefix compares
+// over the same six bytes; the memcmp on three fixed bytes compiles to
+// one masked compare. Accepting any talker ID is deliberate: the
+// enumerated list kept growing a constellation behind the archive
+// ($BDRMC logs classified as mid-cycle lines and merged cycles).
+bool isRmcSentence(std::string_view line)
+{
+    size_t i = 0;
+    while (i < line.size() && (line[i] == ' ' || line[i] == '\t')) {
+        ++i;
+    }
+    if (line.size() - i < 6 || line[i] != '$') {
+        return false;
+    }
+    return memcmp(line.data() + i + 3, "RMC", 3) == 0;
+}
+
+// Compiled replay container: fixed header, cycle offset table, cycle
+// time table (RMC seconds-of-day, -1 where unparsable), then the
+// source log's bytes verbatim. Offsets in the table are relative to
+// the payload region. Native-endian, like the shm ring — these files
+// live next to the logs they are compiled from, not on the wire.
+struct NmxHeader {
+    uint32_t magic;   // kNmxMagic
+    uint32_t flags;   // kNmxFlagCrlf: payload is CRLF wire format
+    uint64_t cycle_count;
+    uint64_t payload_offset;
+    uint64_t payload_size;
+};
+
+constexpr uint32_t kNmxMagic    = 0x32584d4e; // "NMX2"
+constexpr uint32_t kNmxFlagCrlf = 1u << 0;
+
+// Sidecar index cache (<log>.idx): the same offset and time tables as
+// the compiled container, but produced automatically on first open and
+// keyed to the source file's size and mtime, so a touched or rotated
+// log invalidates its cache. Offsets here are absolute into the log.
+// The quarantine table (start/length pairs of lines that failed their
+// checksum during the scan) rides along, so a cache hit skips the
+// validation pass too, and the filter table (--only / --drop) follows
+// the same way — each filter writes its own sidecar file, so the
+// tables never describe a filter other than the one in the name.
+struct IdxHeader {
+    uint32_t magic; // kIdxMagic
+    uint32_t flags; // kNmxFlagCrlf
+    uint64_t cycle_count;
+    uint64_t quarantine_count;
+    uint64_t filtered_count;
+    uint64_t source_size;
+    int64_t source_mtime_sec;
+    int64_t source_mtime_nsec;
+};
+
+constexpr uint32_t kIdxMagic = 0x3358494e; // "NIX3"; v2 lacked the filter table
+
+// True when the sentence's address field ends with one of the filter
+// types: "RMC" matches $GPRMC and $GNRMC, "VDM" matches !AIVDM, a
+// full proprietary address like "PSIMT" matches itself. The suffix
+// compare inherits isRmcSentence's wildcard-talker rationale — an
+// enumerated talker list kept falling a constellation behind the
+// archive. Runs only during the index scan, never at emission.
+bool matchesType(std::string_view line, const std::vector<std::string>& types)
+{
+    size_t i = 0;
+    while (i < line.size() && (line[i] == ' ' || line[i] == '\t')) {
+        ++i;
+    }
+    if (i < line.size() && (line[i] == '$' || line[i] == '!')) {
+        ++i;
+    }
+    size_t end = i;
+    while (end < line.size() && line[end] != ',' && line[end] != '*') {
+        ++end;
+    }
+    std::string_view address = line.substr(i, end - i);
+    for (const std::string& t : types) {
+        if (address.size() >= t.size()
+            && memcmp(address.data() + address.size() - t.size(), t.data(), t.size()) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Seconds-of-day from an RMC sentence's HHMMSS.sss field, or -1 when
+// the field is missing or malformed
+double rmcTimeOfDay(std::string_view line)
+{
+    size_t comma = line.find(',');
+    if (comma == std::string_view::npos || line.size() < comma + 7) {
+        return -1.0;
+    }
+    size_t pos = comma + 1;
+    for (size_t i = 0; i < 6; ++i) {
+        if (line[pos + i] < '0' || line[pos + i] > '9') {
+            return -1.0;
+        }
+    }
+    unsigned hh = static_cast<unsigned>((line[pos] - '0') * 10 + (line[pos + 1] - '0'));
+    unsigned mm = static_cast<unsigned>((line[pos + 2] - '0') * 10 + (line[pos + 3] - '0'));
+    unsigned ss = static_cast<unsigned>((line[pos + 4] - '0') * 10 + (line[pos + 5] - '0'));
+    if (hh > 23 || mm > 59 || ss > 60) {
+        return -1.0;
+    }
+    double t = hh * 3600.0 + mm * 60.0 + ss;
+    pos += 6;
+    if (pos < line.size() && line[pos] == '.') {
+        double scale = 0.1;
+        for (++pos; pos < line.size() && line[pos] >= '0' && line[pos] <= '9'; ++pos) {
+            t += (line[pos] - '0') * scale;
+            scale *= 0.1;
+        }
+    }
+    return t;
+}
+
+// XOR of every byte in [p, p + n). The NMEA checksum is a plain byte
+// XOR, which folds: eight bytes accumulate per iteration through a
+// uint64 load and the lanes collapse once at the end, so validating a
+// log during the index scan runs at memory bandwidth instead of a
+// byte-compare per character — on a multi-gigabyte ingest the scalar
+// loop was the difference between disk-bound and CPU-bound.
+unsigned char xorFold(const char* p, size_t n)
+{
+    uint64_t acc = 0;
+    size_t i     = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w;
+        memcpy(&w, p + i, sizeof(w));
+        acc ^= w;
+    }
+    acc ^= acc >> 32;
+    acc ^= acc >> 16;
+    acc ^= acc >> 8;
+    unsigned char sum = static_cast<unsigned char>(acc);
+    for (; i < n; ++i) {
+        sum = static_cast<unsigned char>(sum ^ static_cast<unsigned char>(p[i]));
+    }
+    return sum;
+}
+
+// True when line carries a "$...*hh" frame whose XOR checksum matches
+bool checksumValid(std::string_view line)
+{
+    if (line.size() < 4 || line.front() != '$') {
+        return false;
+    }
+    size_t star = line.rfind('*');
+    if (star == std::string_view::npos || star + 3 != line.size()) {
+        return false;
+    }
+    unsigned sum = xorFold(line.data() + 1, star - 1);
+    unsigned stated = 0;
+    for (size_t i = star + 1; i < line.size(); ++i) {
+        char c = line[i];
+        unsigned digit;
+        if (c >= '0' && c <= '9') {
+            digit = static_cast<unsigned>(c - '0');
+        } else if (c >= 'A' && c <= 'F') {
+            digit = static_cast<unsigned>(c - 'A' + 10);
+        } else if (c >= 'a' && c <= 'f') {
+            digit = static_cast<unsigned>(c - 'a' + 10);
+        } else {
+            return false;
+        }
+        stated = stated * 16 + digit;
+    }
+    return sum == stated;
+}
+
+// Write buf completely, resuming after short writes and EINTR
+bool writeAll(int fd, const void* buf, size_t len)
+{
+    const char* p = static_cast<const char*>(buf);
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        p += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+} // namespace
+
+ReplayLog::~ReplayLog()
+{
+    stopPrefetch();
+    // After gzip inflation data_ points into inflated_, and the file
+    // mapping was already released
+    if (data_ != nullptr && inflated_.empty()) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+    if (fd_ != -1) {
+        close(fd_);
+    }
+    if (inotify_fd_ != -1) {
+        close(inotify_fd_);
+    }
+}
+
+bool ReplayLog::open(const std::string& path)
+{
+    path_ = path;
+    fd_   = ::open(path.c_str(), O_RDONLY);
+    if (fd_ == -1) {
+        std::cerr << "Error opening NMEA log file: " << path << std::endl;
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd_, &st) == -1) {
+        std::cerr << "Error stating NMEA log file: " << path << std::endl;
+        close(fd_);
+        fd_ = -1;
+        return false;
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ == 0) {
+        return true; // nothing to map; nextCycle() reports end of log
+    }
+    void* map = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (map == MAP_FAILED) {
+        std::cerr << "Error mapping NMEA log file: " << path << ": "
+                  << strerror(errno) << std::endl;
+        close(fd_);
+        fd_ = -1;
+        return false;
+    }
+    data_ = static_cast<const char*>(map);
+
+    // Replay walks the log front to back repeatedly; tell the kernel so
+    // readahead works in our favor on the first cold pass, and flag the
+    // window for hugepage collapse — a multi-gigabyte log walked every
+    // rewind is the most TLB-heavy region in the process
+    madvise(map, size_, MADV_SEQUENTIAL);
+    adviseHugePages(map, size_);
+
+    // Compressed archives, detected by magic: gzip is decompressed
+    // into memory in one streaming pass — replay never touches scratch
+    // storage — and then handled exactly like a plain-text log
+    if (size_ >= 2 && static_cast<unsigned char>(data_[0]) == 0x1f
+        && static_cast<unsigned char>(data_[1]) == 0x8b) {
+        if (!inflateGzip(path)) {
+            return false;
+        }
+    } else if (size_ >= 4 && memcmp(data_, "\x28\xb5\x2f\xfd", 4) == 0) {
+        std::cerr << "Error: " << path
+                  << " is zstd-compressed; this build decompresses gzip only. "
+                     "Recompress with gzip or decompress first." << std::endl;
+        return false;
+    }
+
+    if (size_ >= sizeof(NmxHeader)) {
+        uint32_t magic;
+        memcpy(&magic, data_, sizeof(magic));
+        if (magic == kNmxMagic || magic == kCaptureMagic) {
+            if (!filter_types_.empty()) {
+                // Containers carry their offset tables precomputed;
+                // filtering them would put a per-line test back on the
+                // emission path, which is exactly what index-time
+                // filtering exists to avoid
+                std::cerr << "Error: --only/--drop filter text logs at index time; "
+                          << path << " is a binary container. Filter its source log instead."
+                          << std::endl;
+                return false;
+            }
+            return magic == kNmxMagic ? loadCompiled(path) : loadCapture(path);
+        }
+    }
+
+    end_ = size_;
+
+    // A valid sidecar cache makes time-to-first-sentence independent
+    // of log size; otherwise scan once and leave the cache behind for
+    // the next process
+    if (!loadSidecar(st)) {
+        buildIndex();
+        writeSidecar(st);
+        writeQuarantine(path);
+    }
+    if (!quarantined_.empty()) {
+        std::cerr << "Warning: " << quarantined_.size()
+                  << " corrupt sentence(s) in " << path << " quarantined to "
+                  << path << ".quarantine and excluded from replay" << std::endl;
+    }
+    if (!filtered_.empty()) {
+        std::cout << "Replay filter excluded " << filtered_.size()
+                  << " sentence(s) from " << path << std::endl;
+    }
+    return true;
+}
+
+// One line of the report per quarantined sentence, byte offset first so
+// a failing line can be found in the source with dd or a hex editor.
+// Best-effort like the index sidecar: a read-only log directory just
+// means no report.
+void ReplayLog::writeQuarantine(const std::string& path) const
+{
+    if (quarantined_.empty()) {
+        return;
+    }
+    std::string report_path = path + ".quarantine";
+    FILE* out               = fopen(report_path.c_str(), "w");
+    if (out == nullptr) {
+        return;
+    }
+    fprintf(out, "# %zu corrupt sentence(s) in %s, excluded from replay\n",
+            quarantined_.size(), path.c_str());
+    for (const auto& q : quarantined_) {
+        size_t len = q.second;
+        while (len > 0
+               && (data_[q.first + len - 1] == '\n' || data_[q.first + len - 1] == '\r')) {
+            --len;
+        }
+        fprintf(out, "%zu\t%.*s\n", q.first, static_cast<int>(len), data_ + q.first);
+    }
+    fclose(out);
+}
+
+// Each filter owns its sidecar: the filter spec is folded into the
+// cache name, so switching between experiments flips between cached
+// indexes instead of invalidating one shared cache and rescanning.
+std::string ReplayLog::sidecarPath() const
+{
+    std::string p = path_;
+    if (!filter_types_.empty()) {
+        p += filter_drop_ ? ".drop" : ".only";
+        for (const std::string& t : filter_types_) {
+            p += '-';
+            p += t;
+        }
+    }
+    return p + ".idx";
+}
+
+bool ReplayLog::loadSidecar(const struct stat& st)
+{
+    std::string idx_path = sidecarPath();
+    int fd               = ::open(idx_path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+    struct stat ist;
+    if (fstat(fd, &ist) == -1 || static_cast<size_t>(ist.st_size) < sizeof(IdxHeader)) {
+        close(fd);
+        return false;
+    }
+    size_t idx_size = static_cast<size_t>(ist.st_size);
+    void* map       = mmap(nullptr, idx_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+    const char* base = static_cast<const char*>(map);
+
+    IdxHeader hdr;
+    memcpy(&hdr, base, sizeof(hdr));
+    bool ok = hdr.magic == kIdxMagic
+        && hdr.source_size == static_cast<uint64_t>(st.st_size)
+        && hdr.source_mtime_sec == static_cast<int64_t>(st.st_mtim.tv_sec)
+        && hdr.source_mtime_nsec == static_cast<int64_t>(st.st_mtim.tv_nsec)
+        && idx_size
+            == sizeof(IdxHeader)
+                + static_cast<size_t>(hdr.cycle_count) * (sizeof(uint64_t) + sizeof(double))
+                + static_cast<size_t>(hdr.quarantine_count) * 2 * sizeof(uint64_t)
+                + static_cast<size_t>(hdr.filtered_count) * 2 * sizeof(uint64_t);
+    if (ok) {
+        const uint64_t* table = reinterpret_cast<const uint64_t*>(base + sizeof(IdxHeader));
+        const double* times   = reinterpret_cast<const double*>(table + hdr.cycle_count);
+        const uint64_t* quar  = reinterpret_cast<const uint64_t*>(times + hdr.cycle_count);
+        const uint64_t* filt  = quar + hdr.quarantine_count * 2;
+        index_.resize(hdr.cycle_count);
+        for (size_t i = 0; i < index_.size() && ok; ++i) {
+            ok = table[i] < end_ && (i == 0 || table[i] > table[i - 1]);
+            index_[i] = static_cast<size_t>(table[i]);
+        }
+        quarantined_.resize(hdr.quarantine_count);
+        for (size_t i = 0; i < quarantined_.size() && ok; ++i) {
+            size_t start = static_cast<size_t>(quar[2 * i]);
+            size_t len   = static_cast<size_t>(quar[2 * i + 1]);
+            ok = len > 0 && start < end_ && end_ - start >= len
+                && (i == 0 || start >= quarantined_[i - 1].first + quarantined_[i - 1].second);
+            quarantined_[i] = { start, len };
+        }
+        filtered_.resize(hdr.filtered_count);
+        for (size_t i = 0; i < filtered_.size() && ok; ++i) {
+            size_t start = static_cast<size_t>(filt[2 * i]);
+            size_t len   = static_cast<size_t>(filt[2 * i + 1]);
+            ok = len > 0 && start < end_ && end_ - start >= len
+                && (i == 0 || start >= filtered_[i - 1].first + filtered_[i - 1].second);
+            filtered_[i] = { start, len };
+        }
+        if (ok) {
+            times_.assign(times, times + hdr.cycle_count);
+            crlf_ = (hdr.flags & kNmxFlagCrlf) != 0 && !index_.empty();
+        }
+    }
+    munmap(map, idx_size);
+    if (!ok) {
+        index_.clear();
+        times_.clear();
+        quarantined_.clear();
+        filtered_.clear();
+    }
+    return ok;
+}
+
+void ReplayLog::writeSidecar(const struct stat& st) const
+{
+    // Best-effort cache fill: written to a temp name and renamed into
+    // place, so concurrent opens of the same log never observe a
+    // half-written cache. Failure (read-only log directory, ENOSPC)
+    // just means the next open scans again.
+    std::string idx_path = sidecarPath();
+    std::string tmp_path = idx_path + ".tmp." + std::to_string(getpid());
+    int fd               = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+    if (fd == -1) {
+        return;
+    }
+
+    IdxHeader hdr;
+    hdr.magic             = kIdxMagic;
+    hdr.flags             = crlf_ ? kNmxFlagCrlf : 0u;
+    hdr.cycle_count       = index_.size();
+    hdr.quarantine_count  = quarantined_.size();
+    hdr.filtered_count    = filtered_.size();
+    hdr.source_size       = static_cast<uint64_t>(st.st_size);
+    hdr.source_mtime_sec  = static_cast<int64_t>(st.st_mtim.tv_sec);
+    hdr.source_mtime_nsec = static_cast<int64_t>(st.st_mtim.tv_nsec);
+
+    std::vector<uint64_t> table(index_.begin(), index_.end());
+    table.reserve(table.size() + (quarantined_.size() + filtered_.size()) * 2);
+    for (const auto& q : quarantined_) {
+        table.push_back(q.first);
+        table.push_back(q.second);
+    }
+    for (const auto& f : filtered_) {
+        table.push_back(f.first);
+        table.push_back(f.second);
+    }
+    bool ok = writeAll(fd, &hdr, sizeof(hdr))
+        && writeAll(fd, table.data(), index_.size() * sizeof(uint64_t))
+        && writeAll(fd, times_.data(), times_.size() * sizeof(double))
+        && writeAll(fd, table.data() + index_.size(),
+                    (quarantined_.size() + filtered_.size()) * 2 * sizeof(uint64_t));
+    close(fd);
+    if (!ok || rename(tmp_path.c_str(), idx_path.c_str()) != 0) {
+        unlink(tmp_path.c_str());
+    }
+}
+
+bool ReplayLog::inflateGzip(const std::string& path)
+{
+    z_stream zs {};
+    if (inflateInit2(&zs, 15 + 32) != Z_OK) { // +32: gzip or zlib header
+        std::cerr << "Error initializing zlib for: " << path << std::endl;
+        return false;
+    }
+
+    // Feed the mapped archive in bounded slices (avail_in is 32-bit)
+    // and grow the output a chunk at a time. Concatenated gzip members,
+    // the usual shape of rotated log archives, are handled by resetting
+    // the stream at each member boundary.
+    constexpr size_t kOutChunk = 4u << 20;
+    std::vector<char> out;
+    size_t in_pos = 0;
+    int rc        = Z_OK;
+    for (;;) {
+        if (zs.avail_in == 0 && in_pos < size_) {
+            size_t take = std::min(size_ - in_pos, static_cast<size_t>(1u << 30));
+            zs.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(data_ + in_pos));
+            zs.avail_in = static_cast<uInt>(take);
+            in_pos += take;
+        }
+        size_t used = out.size();
+        out.resize(used + kOutChunk);
+        zs.next_out  = reinterpret_cast<Bytef*>(out.data() + used);
+        zs.avail_out = static_cast<uInt>(kOutChunk);
+        rc           = inflate(&zs, Z_NO_FLUSH);
+        out.resize(used + kOutChunk - zs.avail_out);
+        if (rc == Z_STREAM_END) {
+            if (zs.avail_in == 0 && in_pos >= size_) {
+                break;
+            }
+            inflateReset(&zs);
+            continue;
+        }
+        if (rc != Z_OK || (zs.avail_in == 0 && in_pos >= size_ && out.size() == used)) {
+            std::cerr << "Error decompressing: " << path
+                      << (rc == Z_OK ? " (truncated archive)" : "") << std::endl;
+            inflateEnd(&zs);
+            return false;
+        }
+    }
+    inflateEnd(&zs);
+
+    // The decompressed image replaces the file mapping entirely
+    munmap(const_cast<char*>(data_), size_);
+    close(fd_);
+    fd_       = -1;
+    inflated_ = std::move(out);
+    data_     = inflated_.data();
+    size_     = inflated_.size();
+    return true;
+}
+
+// Load a --capture container: the record stream is walked once, the
+// payloads concatenated into a contiguous image (so cycle extents are
+// offset ranges like every other source) and the recorded monotonic
+// timestamps become the cycle time table — --pace log then replays a
+// capture with the timing that was actually emitted, closing the
+// record -> replay loop.
+bool ReplayLog::loadCapture(const std::string& path)
+{
+    std::vector<char> payload;
+    payload.reserve(size_);
+
+    size_t pos = sizeof(CaptureHeader);
+    bool crlf  = true;
+    while (pos < size_) {
+        if (pos + sizeof(CaptureRecordHeader) > size_) {
+            std::cerr << "Warning: truncated record at end of capture: " << path
+                      << std::endl;
+            break;
+        }
+        CaptureRecordHeader rec;
+        memcpy(&rec, data_ + pos, sizeof(rec));
+        pos += sizeof(rec);
+        if (pos + rec.len > size_) {
+            std::cerr << "Warning: truncated record at end of capture: " << path
+                      << std::endl;
+            break;
+        }
+        if (rec.len == 0) {
+            continue;
+        }
+        index_.push_back(payload.size());
+        times_.push_back(static_cast<double>(rec.t_ns) * 1e-9);
+        payload.insert(payload.end(), data_ + pos, data_ + pos + rec.len);
+        crlf = crlf && rec.len >= 2 && data_[pos + rec.len - 2] == '\r'
+            && data_[pos + rec.len - 1] == '\n';
+        pos += rec.len;
+    }
+
+    // The concatenated image replaces the file mapping, like a
+    // decompressed archive
+    munmap(const_cast<char*>(data_), size_);
+    close(fd_);
+    fd_       = -1;
+    inflated_ = std::move(payload);
+    data_     = inflated_.data();
+    size_     = inflated_.size();
+    end_      = size_;
+    crlf_     = crlf && !index_.empty();
+    compiled_ = true;
+    return true;
+}
+
+bool ReplayLog::loadCompiled(const std::string& path)
+{
+    NmxHeader hdr;
+    memcpy(&hdr, data_, sizeof(hdr));
+    size_t table_bytes = static_cast<size_t>(hdr.cycle_count) * (sizeof(uint64_t) + sizeof(double));
+    if (hdr.payload_offset != sizeof(NmxHeader) + table_bytes
+        || hdr.payload_offset + hdr.payload_size != size_) {
+        std::cerr << "Error: corrupt compiled log: " << path << std::endl;
+        return false;
+    }
+    const uint64_t* table = reinterpret_cast<const uint64_t*>(data_ + sizeof(NmxHeader));
+    const double* times   = reinterpret_cast<const double*>(table + hdr.cycle_count);
+    index_.resize(hdr.cycle_count);
+    for (size_t i = 0; i < index_.size(); ++i) {
+        if (table[i] >= hdr.payload_size || (i > 0 && table[i] <= table[i - 1])) {
+            std::cerr << "Error: corrupt compiled log: " << path << std::endl;
+            return false;
+        }
+        index_[i] = static_cast<size_t>(hdr.payload_offset + table[i]);
+    }
+    times_.assign(times, times + hdr.cycle_count);
+    crlf_     = (hdr.flags & kNmxFlagCrlf) != 0 && !index_.empty();
+    end_      = static_cast<size_t>(hdr.payload_offset + hdr.payload_size);
+    compiled_ = true;
+    return true;
+}
+
+bool ReplayLog::compile(const std::string& in_path, const std::string& out_path)
+{
+    ReplayLog log;
+    if (!log.open(in_path)) {
+        return false;
+    }
+    if (log.compiled_) {
+        std::cerr << "Error: " << in_path << " is already a compiled log" << std::endl;
+        return false;
+    }
+
+    int out = ::open(out_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out == -1) {
+        std::cerr << "Error creating compiled log: " << out_path << std::endl;
+        return false;
+    }
+
+    // open() already quarantined checksum failures; their bytes are
+    // dropped from the payload and the cycle offsets re-based past the
+    // holes, so the compiled log replays the scrubbed stream without
+    // carrying the quarantine table along. Quarantined extents never
+    // sit at a cycle start (a bad line starts no cycle), so the merge
+    // below only ever shifts offsets, never lands on one.
+    size_t removed_total = 0;
+    for (const auto& q : log.quarantined_) {
+        removed_total += q.second;
+    }
+
+    NmxHeader hdr;
+    hdr.magic          = kNmxMagic;
+    hdr.flags          = log.crlf_ ? kNmxFlagCrlf : 0u;
+    hdr.cycle_count    = log.index_.size();
+    hdr.payload_offset = sizeof(NmxHeader)
+        + log.index_.size() * (sizeof(uint64_t) + sizeof(double));
+    hdr.payload_size = log.size_ - removed_total;
+
+    std::vector<uint64_t> table;
+    table.reserve(log.index_.size());
+    size_t next_q  = 0;
+    size_t removed = 0;
+    for (size_t off : log.index_) {
+        while (next_q < log.quarantined_.size() && log.quarantined_[next_q].first < off) {
+            removed += log.quarantined_[next_q].second;
+            ++next_q;
+        }
+        table.push_back(off - removed);
+    }
+
+    bool ok = writeAll(out, &hdr, sizeof(hdr))
+        && writeAll(out, table.data(), table.size() * sizeof(uint64_t))
+        && writeAll(out, log.times_.data(), log.times_.size() * sizeof(double));
+    size_t pos = 0;
+    for (const auto& q : log.quarantined_) {
+        ok  = ok && writeAll(out, log.data_ + pos, q.first - pos);
+        pos = q.first + q.second;
+    }
+    ok = ok && writeAll(out, log.data_ + pos, log.size_ - pos);
+    if (!ok) {
+        std::cerr << "Error writing compiled log: " << out_path << std::endl;
+        close(out);
+        return false;
+    }
+    close(out);
+
+    std::cout << "Compiled " << in_path << " -> " << out_path << ": "
+              << log.index_.size() << " cycle(s), " << hdr.payload_size
+              << " payload byte(s)";
+    if (!log.quarantined_.empty()) {
+        std::cout << ", " << log.quarantined_.size() << " corrupt sentence(s) dropped";
+    }
+    std::cout << std::endl;
+    return true;
+}
+
+void ReplayLog::buildIndex()
+{
+    // One classification pass over the log; every later loop and seek
+    // jumps straight to a recorded offset. Lines before the first RMC
+    // sentence form a leading partial cycle, matching what a consumer
+    // of the original stream would have seen.
+    //
+    // The same pass decides whether the log is strictly CRLF-terminated
+    // with no blank lines; when it is, a cycle's raw mapped bytes are
+    // already wire format and sinks can emit them verbatim.
+    //
+    // The scan is memory-bandwidth-bound, so past a size floor it is
+    // sharded across cores: the mapping splits at line starts, each
+    // worker classifies its range into private tables (scanShard), and
+    // the shards are stitched back in byte order (appendShard). The
+    // stitched result is byte-identical to the serial scan — same
+    // boundaries, same quarantine and filter tables — so sidecars and
+    // quarantine reports stay deterministic either way. Worst-case cold
+    // startup on a 40-million-line capture drops from ~8 s of one-core
+    // scanning to roughly the machine's aggregate read bandwidth.
+    crlf_ = true;
+
+    // Below the floor, thread start-up costs more than it saves; the
+    // incremental follow-mode rescans always take the serial path too.
+    constexpr size_t kMinShardBytes = 32u << 20;
+    size_t hw     = std::thread::hardware_concurrency();
+    size_t shards = std::min(hw != 0 ? hw : 1, size_ / kMinShardBytes);
+    if (shards <= 1) {
+        scanIndex(0);
+        if (index_.empty()) {
+            crlf_ = false;
+        }
+        return;
+    }
+
+    // Shard boundaries land on the byte after a '\n', so every worker
+    // sees only whole lines and no line is classified twice. A shard
+    // whose nominal start sits inside one enormous line collapses into
+    // its neighbour.
+    std::vector<size_t> starts;
+    starts.push_back(0);
+    for (size_t k = 1; k < shards; ++k) {
+        size_t raw    = k * (size_ / shards);
+        const void* nl = memchr(data_ + raw - 1, '\n', size_ - (raw - 1));
+        if (nl == nullptr) {
+            break;
+        }
+        size_t adj = static_cast<size_t>(static_cast<const char*>(nl) - data_) + 1;
+        if (adj > starts.back() && adj < size_) {
+            starts.push_back(adj);
+        }
+    }
+
+    std::vector<ScanShard> results(starts.size());
+    std::vector<std::thread> workers;
+    workers.reserve(starts.size());
+    for (size_t k = 0; k < starts.size(); ++k) {
+        size_t end = k + 1 < starts.size() ? starts[k + 1] : size_;
+        workers.emplace_back([this, &starts, &results, k, end] {
+            scanShard(starts[k], end, k == 0, results[k]);
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    bool open    = false;
+    size_t carry = 0;
+    for (const auto& shard : results) {
+        appendShard(shard, open, carry);
+    }
+    finishScan(open, carry);
+    if (index_.empty()) {
+        crlf_ = false;
+    }
+}
+
+void ReplayLog::scanIndex(size_t pos)
+{
+    // Serial wrapper over the shard machinery: one shard spanning
+    // [pos, size_), stitched straight onto the member tables. Starting
+    // with open == false means the empty-cycle pop in appendShard()
+    // never touches a cycle a previous scan completed — follow-mode
+    // rescans resume at a popped boundary, not inside a settled cycle.
+    ScanShard shard;
+    scanShard(pos, size_, index_.empty(), shard);
+    bool open    = false;
+    size_t carry = 0;
+    appendShard(shard, open, carry);
+    finishScan(open, carry);
+}
+
+void ReplayLog::scanShard(size_t pos, size_t end, bool lead, ScanShard& out) const
+{
+    while (pos < end) {
+        const char* start = data_ + pos;
+        const void* nl    = memchr(start, '\n', end - pos);
+        size_t raw_len = nl != nullptr ? static_cast<size_t>(static_cast<const char*>(nl) - start)
+                                       : end - pos;
+        size_t len        = raw_len;
+        size_t line_start = pos;
+        pos += raw_len + (nl != nullptr ? 1 : 0);
+        while (len > 0 && start[len - 1] == '\r') {
+            --len;
+        }
+        if (nl == nullptr || len == 0 || raw_len != len + 1) {
+            out.crlf = false; // unterminated, blank, or bare-LF line
+        }
+        if (len == 0) {
+            continue;
+        }
+        std::string_view line(start, len);
+        if (!checksumValid(line)) {
+            // Corrupt capture lines never reach a consumer: the extent
+            // (terminator included) goes to the quarantine table, the
+            // line starts no cycle, and nextCycle() skips it when the
+            // cycle is split. Validation rides the scan the index build
+            // already pays for, so it is amortized across every later
+            // replay of this log.
+            out.quarantined.emplace_back(line_start, raw_len + (nl != nullptr ? 1 : 0));
+            continue;
+        }
+        bool rmc = isRmcSentence(line);
+        if ((lead && out.index.empty()) || rmc) {
+            out.index.push_back(line_start);
+            out.times.push_back(rmc ? rmcTimeOfDay(line) : -1.0);
+            out.kept.push_back(0);
+        }
+        if (!filter_types_.empty()
+            && matchesType(line, filter_types_) == filter_drop_) {
+            // The boundary above still stands — an RMC keeps marking
+            // its cycle (and carrying its time for pacing and merge)
+            // even when the filter strips it from emission
+            out.filtered.emplace_back(line_start, raw_len + (nl != nullptr ? 1 : 0));
+            continue;
+        }
+        if (out.kept.empty()) {
+            ++out.kept_head;
+        } else {
+            ++out.kept.back();
+        }
+    }
+}
+
+void ReplayLog::appendShard(const ScanShard& shard, bool& open, size_t& carry)
+{
+    // Lines before the shard's first boundary extend the cycle left
+    // open by the previous shard
+    carry += shard.kept_head;
+    for (size_t i = 0; i < shard.index.size(); ++i) {
+        if (open && !filter_types_.empty() && carry == 0) {
+            // Every sentence of the cycle just closed was filtered
+            // out; drop its entry so no indexed cycle is empty —
+            // its bytes fold into the predecessor's extent, where
+            // the filter table already excludes them from the split
+            index_.pop_back();
+            times_.pop_back();
+        }
+        index_.push_back(shard.index[i]);
+        times_.push_back(shard.times[i]);
+        open  = true;
+        carry = shard.kept[i];
+    }
+    if (!shard.crlf) {
+        crlf_ = false;
+    }
+    quarantined_.insert(quarantined_.end(), shard.quarantined.begin(),
+                        shard.quarantined.end());
+    filtered_.insert(filtered_.end(), shard.filtered.begin(), shard.filtered.end());
+}
+
+void ReplayLog::finishScan(bool open, size_t carry)
+{
+    if (open && !filter_types_.empty() && carry == 0) {
+        index_.pop_back();
+        times_.pop_back();
+    }
+    if (!quarantined_.empty() || !filtered_.empty()) {
+        crlf_ = false; // a cycle's raw bytes still contain the excluded lines
+    }
+}
+
+bool ReplayLog::waitForGrowth(const std::atomic<bool>& shutdown)
+{
+    if (compiled_ || !inflated_.empty()) {
+        std::cerr << "Error: cannot follow a compiled or compressed log: " << path_
+                  << std::endl;
+        return false;
+    }
+    if (inotify_fd_ == -1) {
+        inotify_fd_ = inotify_init1(IN_NONBLOCK);
+        if (inotify_fd_ == -1
+            || inotify_add_watch(inotify_fd_, path_.c_str(), IN_MODIFY) == -1) {
+            std::cerr << "Error watching log file: " << path_ << std::endl;
+            return false;
+        }
+    }
+
+    for (;;) {
+        // Check for growth before sleeping: data appended between the
+        // previous check and (re)arming the watch must not be missed
+        struct stat st;
+        if (fstat(fd_, &st) == -1) {
+            std::cerr << "Error stating NMEA log file: " << path_ << std::endl;
+            return false;
+        }
+        if (static_cast<size_t>(st.st_size) > size_) {
+            break;
+        }
+        if (shutdown.load()) {
+            return false;
+        }
+
+        // Event-driven wait; the timeout only bounds shutdown latency
+        struct pollfd pfd = { inotify_fd_, POLLIN, 0 };
+        if (poll(&pfd, 1, 200) > 0) {
+            char buf[4096];
+            while (read(inotify_fd_, buf, sizeof(buf)) > 0) {
+            }
+        }
+    }
+
+    // Remap at the new size and extend the index from the last known
+    // cycle start — its extent may have changed now that more data
+    // follows it. Cached line views point into the old mapping, so
+    // they are dropped and rebuilt on demand.
+    struct stat st;
+    if (fstat(fd_, &st) == -1) {
+        return false;
+    }
+    size_t new_size = static_cast<size_t>(st.st_size);
+    void* map       = mmap(nullptr, new_size, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (map == MAP_FAILED) {
+        std::cerr << "Error remapping NMEA log file: " << path_ << std::endl;
+        return false;
+    }
+    if (data_ != nullptr) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+    data_ = static_cast<const char*>(map);
+    size_ = new_size;
+    end_  = new_size;
+    cycle_lines_.clear();
+    cycle_scratch_.clear();
+    cycle_patches_.clear();
+    raw_ = std::string_view();
+
+    size_t rescan_from = 0;
+    if (!index_.empty()) {
+        rescan_from = index_.back();
+        index_.pop_back();
+        times_.pop_back();
+    }
+    // The rescanned region re-validates and re-filters, so drop its
+    // quarantine and filter entries rather than double-record them
+    while (!quarantined_.empty() && quarantined_.back().first >= rescan_from) {
+        quarantined_.pop_back();
+    }
+    while (!filtered_.empty() && filtered_.back().first >= rescan_from) {
+        filtered_.pop_back();
+    }
+    scanIndex(rescan_from);
+    return true;
+}
+
+bool ReplayLog::quarantined(size_t line_start) const
+{
+    if (quarantined_.empty()) {
+        return false;
+    }
+    auto it = std::lower_bound(
+        quarantined_.begin(), quarantined_.end(), line_start,
+        [](const std::pair<size_t, size_t>& q, size_t off) { return q.first < off; });
+    return it != quarantined_.end() && it->first == line_start;
+}
+
+bool ReplayLog::filteredOut(size_t line_start) const
+{
+    if (filtered_.empty()) {
+        return false;
+    }
+    auto it = std::lower_bound(
+        filtered_.begin(), filtered_.end(), line_start,
+        [](const std::pair<size_t, size_t>& f, size_t off) { return f.first < off; });
+    return it != filtered_.end() && it->first == line_start;
+}
+
+void ReplayLog::startPrefetch(size_t window_bytes)
+{
+    if (window_bytes == 0 || data_ == nullptr || size_ == 0
+        || !inflated_.empty() || prefetch_thread_.joinable()) {
+        return;
+    }
+    prefetch_thread_ = std::thread(&ReplayLog::prefetchLoop, this, window_bytes);
+}
+
+void ReplayLog::stopPrefetch()
+{
+    if (prefetch_thread_.joinable()) {
+        prefetch_stop_.store(true, std::memory_order_release);
+        prefetch_thread_.join();
+    }
+}
+
+// MADV_SEQUENTIAL at map time only widens kernel readahead around the
+// faulting page; on a cold multi-gigabyte log the emission thread
+// still takes the major fault itself every few cycles. This loop runs
+// the faults on a thread nobody is waiting for: it polls the cursor a
+// few times per pacing interval and keeps the advice window issued
+// ahead of it, so by the time the writer reaches a page the read is
+// done or at least in flight. The drop-behind half only runs under
+// --mem-budget — on an unbudgeted looping replay the second pass wants
+// those pages resident, and dropping them would turn every rewind back
+// into a cold pass.
+void ReplayLog::prefetchLoop(size_t window)
+{
+    long page_sz = sysconf(_SC_PAGESIZE);
+    size_t page  = page_sz > 0 ? static_cast<size_t>(page_sz) : 4096;
+    char* base   = const_cast<char*>(data_);
+    bool drop_behind = MemBudget::enabled();
+    size_t ahead_end = 0; // end of the region already advised ahead
+    size_t drop_end  = 0; // end of the region already dropped behind
+    size_t last_cur  = 0;
+    while (!prefetch_stop_.load(std::memory_order_acquire)) {
+        size_t cur = cursor_off_.load(std::memory_order_relaxed) & ~(page - 1);
+        if (cur < last_cur) {
+            // Rewind (or seek backwards): start both windows over
+            ahead_end = 0;
+            drop_end  = 0;
+        }
+        last_cur    = cur;
+        size_t want = std::min(cur + window, size_);
+        if (want > ahead_end) {
+            size_t from = std::max(ahead_end, cur);
+            madvise(base + from, want - from, MADV_WILLNEED);
+            ahead_end = want;
+        }
+        if (drop_behind && cur > window) {
+            size_t keep_from = cur - window;
+            if (keep_from > drop_end) {
+                madvise(base + drop_end, keep_from - drop_end, MADV_DONTNEED);
+                drop_end = keep_from;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+bool ReplayLog::nextCycle(std::vector<std::string_view>& cycle)
+{
+    if (next_cycle_ >= index_.size()) {
+        return false;
+    }
+    if (cycle_lines_.empty()) {
+        cycle_lines_.resize(index_.size());
+        if (retime_) {
+            cycle_scratch_.resize(index_.size());
+            cycle_patches_.resize(index_.size());
+        }
+    }
+    size_t idx = next_cycle_;
+    size_t pos = index_[idx];
+    size_t end = idx + 1 < index_.size() ? index_[idx + 1] : end_;
+    last_time_ = times_[idx];
+    ++next_cycle_;
+    cursor_off_.store(pos, std::memory_order_relaxed);
+
+    const char* base                     = data_;
+    std::vector<std::string_view>& lines = cycle_lines_[idx];
+    if (retime_) {
+        // Fresh timestamps: the mapping is read-only, so the cycle is
+        // copied out once on its first visit and its patch points
+        // recorded; after that every emission is the patch alone — a
+        // fixed-width time overwrite and a two-digit checksum fix per
+        // patched line
+        std::string& scratch = cycle_scratch_[idx];
+        if (scratch.empty()) {
+            scratch.assign(data_ + pos, end - pos);
+            scanTimePatches(scratch, cycle_patches_[idx]);
+            lines.clear(); // cached views must target the scratch copy
+        }
+        patchTimes(scratch, cycle_patches_[idx]);
+        base = scratch.data();
+        end -= pos;
+        pos = 0;
+    }
+    raw_ = std::string_view(base + pos, end - pos);
+
+    // Split the cycle into lines once; every later pass over this
+    // cycle just copies the cached views. Quarantined and filtered-out
+    // lines are looked up by their absolute offset (pos is rebased onto
+    // the scratch copy under --retime) and dropped here, so they never
+    // reach a sink and steady-state replay tests nothing per line.
+    if (lines.empty()) {
+        size_t abs_base = retime_ ? index_[idx] : 0;
+        while (pos < end) {
+            const char* start = base + pos;
+            size_t line_start = abs_base + pos;
+            const void* nl    = memchr(start, '\n', end - pos);
+            size_t len = nl != nullptr ? static_cast<size_t>(static_cast<const char*>(nl) - start)
+                                       : end - pos;
+            pos += len + (nl != nullptr ? 1 : 0);
+            while (len > 0 && start[len - 1] == '\r') {
+                --len;
+            }
+            if (len > 0 && !quarantined(line_start) && !filteredOut(line_start)) {
+                lines.emplace_back(start, len);
+            }
+        }
+    }
+    cycle = lines;
+    return true;
+}
+
+void ReplayLog::seekCycle(uint64_t n)
+{
+    last_time_ = -1.0;
+    if (index_.empty()) {
+        next_cycle_ = 0;
+        return;
+    }
+    next_cycle_ = static_cast<size_t>(n % index_.size());
+}
+
+double ReplayLog::nextCycleDelta() const
+{
+    if (last_time_ < 0.0 || next_cycle_ >= times_.size() || times_[next_cycle_] < 0.0) {
+        return -1.0;
+    }
+    double delta = times_[next_cycle_] - last_time_;
+    if (delta < 0.0) {
+        delta += 86400.0; // midnight wrap
+    }
+    return delta;
+}
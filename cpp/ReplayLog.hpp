@@ -0,0 +1,326 @@
+// ReplayLog.hpp
+#ifndef REPLAY_LOG_HPP
+#define REPLAY_LOG_HPP
+
+#include "TimePatch.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <sys/stat.h>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Memory-mapped replay source for --file mode. The log is mapped once
+// and lines are handed out as string_views over the mapping, so steady-
+// state replay performs no read syscalls and no per-line copies — the
+// getline-based loop re-read the file from disk on every rewind and
+// allocated a fresh string per line, which dominates multi-gigabyte
+// drive-log replays.
+//
+// Cycle boundaries (RMC-led sentence groups) are classified exactly
+// once, in a single scan at open() that records each cycle's start
+// offset. Every later pass, seek (--start-cycle) and the rewind at EOF
+// is an O(1) index jump with no re-classification — on a 40-million-
+// line log the per-pass isRmcSentence() walk alone was seconds of
+// overhead per loop. On logs big enough that even the one scan shows
+// up in startup time, it runs sharded across cores (buildIndex), so a
+// cold open is bounded by memory bandwidth rather than by one core's
+// share of it.
+class ReplayLog {
+public:
+    ReplayLog() = default;
+    ~ReplayLog();
+
+    ReplayLog(const ReplayLog&)            = delete;
+    ReplayLog& operator=(const ReplayLog&) = delete;
+
+    // Map the log read-only and build the cycle index. A compiled .nmx
+    // container (recognized by its magic bytes) skips the scan entirely
+    // and loads the stored offset table, so startup cost is independent
+    // of log size. A gzip-compressed log (also recognized by magic) is
+    // decompressed straight into memory — no temp file, no scratch
+    // disk — and then treated like its plain-text equivalent. Returns
+    // false if the file cannot be opened or mapped; an empty file maps
+    // successfully and simply has no cycles.
+    //
+    // The index scan validates every sentence's checksum as it
+    // classifies (same pass, word-at-a-time XOR, so ingest stays
+    // disk-bound): failing lines are quarantined — written to a
+    // <log>.quarantine report, excluded from the cycle index, and never
+    // handed to a sink — instead of crashing consumers downstream. The
+    // quarantine table persists in the .idx sidecar, so the validation
+    // cost is paid once per log, not once per replay.
+    bool open(const std::string& path);
+
+    // Offline compile step (--compile-log): scan a text log once and
+    // write a binary container holding the cycle offset table and the
+    // raw sentence bytes. Sentences quarantined by the scan are dropped
+    // from the payload, so a compiled log replays the same scrubbed
+    // stream as its source. Returns false on I/O error.
+    static bool compile(const std::string& in_path, const std::string& out_path);
+
+    // Index-time sentence filtering (--only / --drop): sentences whose
+    // type fails the filter are excluded while the cycle index is
+    // built, the same way checksum failures are, so a filtered replay
+    // emits pre-filtered cycles with no per-line tests — stripping AIS
+    // or GSV from a capture no longer needs a preprocessing pass that
+    // rewrites the log. Types match the end of the address field, so
+    // "RMC" covers $GPRMC and $GNRMC alike; drop inverts the match.
+    // Every filter keeps its own sidecar cache (<log>.drop-GSV.idx),
+    // so switching filters selects among cached indexes instead of
+    // invalidating a shared one. Call before open(); text logs only.
+    void setSentenceFilter(std::vector<std::string> types, bool drop)
+    {
+        filter_types_ = std::move(types);
+        filter_drop_  = drop;
+    }
+
+    // Fresh-timestamp replay (--retime): overwrite every hhmmss.ss
+    // time field with the current wall clock as cycles are emitted,
+    // repairing checksums incrementally (TimePatch.hpp). The mapping
+    // is read-only, so each cycle is copied out once on its first
+    // visit and its patch points recorded alongside the cached line
+    // views; every pass after that costs a few dozen byte writes, not
+    // an offline rewrite of the log. The time table is untouched, so
+    // --pace log still follows the original inter-cycle deltas. Call
+    // before the first nextCycle().
+    void setRetime(bool enable) { retime_ = enable; }
+
+    // Fill cycle with views of the next cycle's lines (terminators
+    // stripped, blank lines skipped). Returns false at end of log.
+    // A cycle's lines are split out of the mapping once, on its first
+    // visit, and cached; on a looping replay every pass after the
+    // first copies the cached views and parses nothing.
+    bool nextCycle(std::vector<std::string_view>& cycle);
+
+    // Raw mapped bytes of the cycle most recently returned by
+    // nextCycle(), terminators included
+    std::string_view lastCycleRaw() const { return raw_; }
+
+    // True when every line in the log is CRLF-terminated and non-blank,
+    // so a cycle's raw bytes can be handed to a sink verbatim — no
+    // per-line iovec assembly and no terminator splicing
+    bool crlfTerminated() const { return crlf_; }
+
+    // True inter-cycle delay, in seconds, between the cycle most
+    // recently returned by nextCycle() and the one that follows it,
+    // derived from the RMC HHMMSS.sss fields captured at index-build
+    // time — no hot-path parsing. Handles the midnight wrap. Negative
+    // when either time is unknown (no RMC time, end of log, or right
+    // after a seek or rewind).
+    double nextCycleDelta() const;
+
+    // Jump the cursor to cycle n; values past the end wrap around, so
+    // any --start-cycle is valid on a looping replay
+    void seekCycle(uint64_t n);
+
+    // Follow-mode support (--follow): true when a complete cycle is
+    // waiting at the cursor — a cycle is complete once a later cycle
+    // start proves its extent, so a tail still being appended is never
+    // emitted half-written
+    bool hasCompleteCycle() const
+    {
+        return next_cycle_ + 1 < index_.size();
+    }
+
+    // Block until the source file grows, using an inotify watch rather
+    // than a polling sleep, then extend the mapping and the index
+    // incrementally from the last known cycle start. Returns false on
+    // watch failure or when the shutdown flag is raised. Not supported
+    // for compressed or compiled logs.
+    bool waitForGrowth(const std::atomic<bool>& shutdown);
+
+    // Access-pattern prefetcher for multi-gigabyte mapped logs: a
+    // background thread keeps `window_bytes` of MADV_WILLNEED issued
+    // ahead of the replay cursor, so a cold first pass resolves its
+    // page faults through kernel readahead instead of stalling the
+    // writer thread one 4 KB fault at a time. When --mem-budget is in
+    // force, pages more than a window behind the cursor are dropped
+    // with MADV_DONTNEED, bounding the mapping's resident share.
+    // A no-op for inflated (gzip) logs, which are not file-backed;
+    // callers skip it in follow mode, where growth remaps the file
+    // under the thread. Call after open(); 0 disables.
+    void startPrefetch(size_t window_bytes);
+
+    // Reset the cursor to the first cycle (EOF rewind)
+    void rewind()
+    {
+        next_cycle_ = 0;
+        last_time_  = -1.0;
+    }
+
+    // Cycles found in the log
+    size_t cycleCount() const { return index_.size(); }
+
+    // Seconds-of-day of cycle n from its RMC sentence, captured at
+    // index-build time; -1 where no time could be parsed. The merge
+    // layer (ReplayMerge) keys its k-way heap on these, so multi-log
+    // interleaving never parses a line at emission time.
+    double cycleTime(size_t n) const
+    {
+        return n < times_.size() ? times_[n] : -1.0;
+    }
+
+    // Bytes replay keeps resident once this log is cycling: the mapped
+    // or inflated image, the cycle tables, and the lazily filled
+    // per-cycle caches at their eventual every-cycle-visited size.
+    // --mem-budget charges the replay cache against this figure up
+    // front, so a log that would outgrow the budget is refused at open
+    // instead of OOM-killed a few rewinds in. The line-view estimate
+    // (one 16-byte view per line, lines averaging well over 32 bytes)
+    // rounds up on purpose.
+    size_t residentBytes() const
+    {
+        size_t per_cycle = sizeof(size_t) + sizeof(double)
+            + sizeof(std::vector<std::string_view>) + sizeof(std::string)
+            + sizeof(std::vector<TimePatch>);
+        size_t bytes = size_ + inflated_.capacity()
+            + index_.size() * per_cycle + end_ / 2;
+        if (retime_) {
+            bytes += end_; // scratch copies of every cycle's raw bytes
+        }
+        return bytes;
+    }
+
+private:
+    void buildIndex();
+
+    // Classification scan shared by the initial build and follow-mode
+    // extension; appends cycle starts and times from pos onward
+    void scanIndex(size_t pos);
+
+    // One shard of a classification scan: the tables a worker builds
+    // over its byte range in isolation. kept_head counts lines the
+    // filter kept before the shard's first boundary (they belong to a
+    // cycle opened in an earlier shard) and kept[] counts them per
+    // local cycle, so the stitch in appendShard() can resolve the
+    // all-lines-filtered empty-cycle pop across shard seams.
+    struct ScanShard {
+        std::vector<size_t> index;
+        std::vector<double> times;
+        std::vector<size_t> kept;
+        std::vector<std::pair<size_t, size_t>> quarantined;
+        std::vector<std::pair<size_t, size_t>> filtered;
+        size_t kept_head = 0;
+        bool crlf        = true;
+    };
+
+    // Classify the lines in [pos, end) into out. Stateless with
+    // respect to the member tables, so buildIndex() can run one call
+    // per core over a sharded mapping; pos and end must fall on line
+    // starts. lead marks the shard holding the start of the log, whose
+    // first valid line opens the leading partial cycle even when it is
+    // not an RMC sentence.
+    void scanShard(size_t pos, size_t end, bool lead, ScanShard& out) const;
+
+    // Stitch a shard's tables onto the member tables, in byte order.
+    // open/carry thread the currently unclosed cycle and its kept-line
+    // count between consecutive shards; finishScan() settles both after
+    // the last shard.
+    void appendShard(const ScanShard& shard, bool& open, size_t& carry);
+    void finishScan(bool open, size_t carry);
+
+    // Load the offset table of an already-mapped compiled container
+    bool loadCompiled(const std::string& path);
+
+    // Load a --capture container: concatenates record payloads and
+    // turns the recorded monotonic timestamps into the time table
+    bool loadCapture(const std::string& path);
+
+    // Stream-decompress the mapped gzip archive into inflated_ and
+    // retarget data_/size_ at the decompressed image
+    bool inflateGzip(const std::string& path);
+
+    // Sidecar index cache (sidecarPath()): the offset, time, quarantine
+    // and filter tables keyed by the source's size and mtime, so repeat
+    // opens of the same log skip the classification scan entirely.
+    // loadSidecar returns false when the cache is absent, stale, or
+    // corrupt; writeSidecar is best-effort and stays quiet when the
+    // log's directory is read-only.
+    bool loadSidecar(const struct stat& st);
+    void writeSidecar(const struct stat& st) const;
+
+    // Quarantine report (<log>.quarantine): the offset and text of
+    // every line the index scan rejected, written alongside the log on
+    // a fresh scan. Best-effort like the index sidecar.
+    void writeQuarantine(const std::string& path) const;
+
+    // True when a quarantined line starts at this absolute offset
+    bool quarantined(size_t line_start) const;
+
+    // True when a filtered-out line starts at this absolute offset
+    bool filteredOut(size_t line_start) const;
+
+    // Cache file for this log under the active filter: <log>.idx bare,
+    // <log>.only-RMC-GGA.idx / <log>.drop-GSV.idx filtered
+    std::string sidecarPath() const;
+
+    // Prefetch thread body and shutdown (joined before the mapping is
+    // released)
+    void prefetchLoop(size_t window);
+    void stopPrefetch();
+
+    int fd_           = -1;
+    const char* data_ = nullptr;
+    size_t size_      = 0;
+
+    // Decompressed image of a gzip log; when non-empty, data_ points
+    // here instead of at a file mapping
+    std::vector<char> inflated_;
+
+    // One byte past the last replayable byte: file size for text logs,
+    // end of the payload region for compiled containers
+    size_t end_ = 0;
+
+    // Start offset of every cycle, in log order; built once at open()
+    // for text logs, loaded from the container for compiled ones.
+    // times_ runs parallel: seconds-of-day from each cycle's RMC
+    // sentence, -1 where no time could be parsed.
+    std::vector<size_t> index_;
+    std::vector<double> times_;
+    double last_time_ = -1.0;
+
+    // Extents (absolute start, raw length with terminator) of lines
+    // that failed checksum validation, in log order; excluded from
+    // cycle splits and from compiled payloads
+    std::vector<std::pair<size_t, size_t>> quarantined_;
+
+    // Sentence filter (--only / --drop) and the extents it excluded,
+    // same shape and role as the quarantine table
+    std::vector<std::string> filter_types_;
+    bool filter_drop_ = false;
+    std::vector<std::pair<size_t, size_t>> filtered_;
+
+    // Per-cycle line views, filled lazily on first visit (a cycle
+    // always has at least one line, so empty means "not yet split")
+    std::vector<std::vector<std::string_view>> cycle_lines_;
+
+    // --retime state: per-cycle scratch copies of the raw bytes plus
+    // their time-field patch points, filled lazily like cycle_lines_
+    // (an empty scratch means "not yet built"; a cycle is never empty)
+    std::vector<std::string> cycle_scratch_;
+    std::vector<std::vector<TimePatch>> cycle_patches_;
+    bool retime_ = false;
+    size_t next_cycle_ = 0;
+    std::string_view raw_;
+    bool crlf_     = false;
+    bool compiled_ = false;
+
+    // Follow-mode state: source path for the watch, lazily created
+    // inotify descriptor
+    std::string path_;
+    int inotify_fd_ = -1;
+
+    // Prefetcher state: the emission path publishes the cursor's byte
+    // offset with one relaxed store per cycle; everything else lives
+    // on the prefetch thread
+    std::thread prefetch_thread_;
+    std::atomic<bool> prefetch_stop_ { false };
+    std::atomic<size_t> cursor_off_ { 0 };
+};
+
+#endif // REPLAY_LOG_HPP
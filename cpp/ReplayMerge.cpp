@@ -0,0 +1,212 @@
+// ReplayMerge.cpp
+#include "ReplayMerge.hpp"
+
+namespace {
+
+constexpr double kSecondsPerDay = 86400.0;
+
+} // namespace
+
+bool ReplayMerge::open(const std::vector<std::string>& paths)
+{
+    logs_.clear();
+    keys_.clear();
+    cursors_.clear();
+    for (const std::string& path : paths) {
+        auto log = std::make_unique<ReplayLog>();
+        if (!filter_types_.empty()) {
+            log->setSentenceFilter(filter_types_, filter_drop_);
+        }
+        if (!log->open(path)) {
+            return false;
+        }
+        logs_.push_back(std::move(log));
+    }
+    if (single()) {
+        return true;
+    }
+
+    // Merge keys, computed once per log: seconds-of-day unwrapped into
+    // a monotone axis (a backwards jump of more than half a day is a
+    // midnight wrap, matching nextCycleDelta's rule), then cycles with
+    // no parsed time forward-filled from their predecessor so every
+    // cycle has a key and sorts adjacent to its neighbors. Leading
+    // unknowns inherit the first known key; a log with no times at all
+    // keys as -1 throughout and simply drains first.
+    keys_.resize(logs_.size());
+    for (size_t i = 0; i < logs_.size(); ++i) {
+        ReplayLog& log = *logs_[i];
+        std::vector<double>& keys = keys_[i];
+        keys.resize(log.cycleCount());
+        double offset = 0.0;
+        double prev   = -1.0;
+        for (size_t c = 0; c < keys.size(); ++c) {
+            double t = log.cycleTime(c);
+            if (t < 0.0) {
+                keys[c] = prev;
+                continue;
+            }
+            if (prev >= 0.0 && t + offset < prev - kSecondsPerDay / 2) {
+                offset += kSecondsPerDay;
+            }
+            prev    = t + offset;
+            keys[c] = prev;
+        }
+        // Backward pass for leading unknowns
+        for (size_t c = keys.size(); c-- > 1;) {
+            if (keys[c - 1] < 0.0 && keys[c] >= 0.0) {
+                keys[c - 1] = keys[c];
+            }
+        }
+    }
+    cursors_.assign(logs_.size(), 0);
+    reheap();
+    return true;
+}
+
+void ReplayMerge::setRetime(bool enable)
+{
+    for (auto& log : logs_) {
+        log->setRetime(enable);
+    }
+}
+
+void ReplayMerge::startPrefetch(size_t window_bytes)
+{
+    for (auto& log : logs_) {
+        log->startPrefetch(window_bytes);
+    }
+}
+
+void ReplayMerge::reheap()
+{
+    heap_ = {};
+    for (size_t i = 0; i < logs_.size(); ++i) {
+        if (cursors_[i] < keys_[i].size()) {
+            heap_.emplace(keys_[i][cursors_[i]], i);
+        }
+    }
+}
+
+bool ReplayMerge::nextCycle(std::vector<std::string_view>& cycle)
+{
+    if (single()) {
+        return logs_[0]->nextCycle(cycle);
+    }
+    if (heap_.empty()) {
+        return false;
+    }
+    auto [key, i] = heap_.top();
+    heap_.pop();
+    if (!logs_[i]->nextCycle(cycle)) {
+        return false; // cursors out of sync; cannot happen
+    }
+    last_log_ = i;
+    last_key_ = key;
+    if (++cursors_[i] < keys_[i].size()) {
+        heap_.emplace(keys_[i][cursors_[i]], i);
+    }
+    return true;
+}
+
+std::string_view ReplayMerge::lastCycleRaw() const
+{
+    return logs_[last_log_]->lastCycleRaw();
+}
+
+bool ReplayMerge::crlfTerminated() const
+{
+    for (const auto& log : logs_) {
+        if (!log->crlfTerminated()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double ReplayMerge::nextCycleDelta() const
+{
+    if (single()) {
+        return logs_[0]->nextCycleDelta();
+    }
+    if (heap_.empty() || last_key_ < 0.0 || heap_.top().first < 0.0) {
+        return -1.0;
+    }
+    double delta = heap_.top().first - last_key_;
+    return delta > 0.0 ? delta : 0.0;
+}
+
+void ReplayMerge::seekCycle(uint64_t n)
+{
+    if (single()) {
+        logs_[0]->seekCycle(n);
+        return;
+    }
+    size_t total = cycleCount();
+    if (total > 0) {
+        n %= total;
+    }
+    // Replay the merge decisions against the key arrays alone, then
+    // seek each log once — no cycle is split or copied getting there
+    cursors_.assign(logs_.size(), 0);
+    last_key_ = -1.0;
+    reheap();
+    while (n-- > 0 && !heap_.empty()) {
+        auto [key, i] = heap_.top();
+        heap_.pop();
+        if (++cursors_[i] < keys_[i].size()) {
+            heap_.emplace(keys_[i][cursors_[i]], i);
+        }
+    }
+    for (size_t i = 0; i < logs_.size(); ++i) {
+        // A log the seek exhausted is left alone: ReplayLog's own seek
+        // wraps past the end, but the heap no longer holds the log, so
+        // its cursor is never consulted before the next rewind
+        if (cursors_[i] < keys_[i].size()) {
+            logs_[i]->seekCycle(cursors_[i]);
+        }
+    }
+}
+
+void ReplayMerge::rewind()
+{
+    for (auto& log : logs_) {
+        log->rewind();
+    }
+    if (!single()) {
+        cursors_.assign(logs_.size(), 0);
+        last_key_ = -1.0;
+        reheap();
+    }
+}
+
+size_t ReplayMerge::cycleCount() const
+{
+    size_t total = 0;
+    for (const auto& log : logs_) {
+        total += log->cycleCount();
+    }
+    return total;
+}
+
+bool ReplayMerge::hasCompleteCycle() const
+{
+    return single() && logs_[0]->hasCompleteCycle();
+}
+
+bool ReplayMerge::waitForGrowth(const std::atomic<bool>& shutdown)
+{
+    return single() && logs_[0]->waitForGrowth(shutdown);
+}
+
+size_t ReplayMerge::residentBytes() const
+{
+    size_t total = 0;
+    for (const auto& log : logs_) {
+        total += log->residentBytes();
+    }
+    for (const auto& keys : keys_) {
+        total += keys.capacity() * sizeof(double);
+    }
+    return total;
+}
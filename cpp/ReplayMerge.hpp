@@ -0,0 +1,108 @@
+// ReplayMerge.hpp
+#ifndef REPLAY_MERGE_HPP
+#define REPLAY_MERGE_HPP
+
+#include "ReplayLog.hpp"
+
+#include <atomic>
+#include <memory>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Timestamp-ordered merge of several replay logs (repeated --file):
+// field captures split streams per source — GNSS, IMU, AIS — and the
+// rigs want them back as one interleaved stream. The merge works at
+// the cycle-index level: each log's RMC times are captured once by its
+// index scan, unwrapped across midnight and forward-filled into a
+// monotone key array at open(), and emission pops a k-way min-heap of
+// (next key, log) pairs — no line is parsed or compared at emission
+// time, so interleaving k logs adds one heap pop per cycle to a
+// replay that used to need an offline text-merge pass over the inputs.
+//
+// With a single log every call delegates straight to the underlying
+// ReplayLog, so the classic --file path (including --follow) pays
+// nothing for the layer; follow mode is single-log only.
+class ReplayMerge {
+public:
+    // Open every log and precompute the merge keys. All-or-nothing:
+    // one unopenable log fails the set.
+    bool open(const std::vector<std::string>& paths);
+
+    // Forwarded to every log (see ReplayLog)
+    void setRetime(bool enable);
+    void startPrefetch(size_t window_bytes);
+
+    // Index-time sentence filter, applied to every log in the set so
+    // the merged stream is filtered uniformly; call before open()
+    // (see ReplayLog::setSentenceFilter)
+    void setSentenceFilter(std::vector<std::string> types, bool drop)
+    {
+        filter_types_ = std::move(types);
+        filter_drop_  = drop;
+    }
+
+    // Pop the earliest pending cycle across the set. False once every
+    // log is exhausted.
+    bool nextCycle(std::vector<std::string_view>& cycle);
+
+    // Raw bytes of the cycle most recently returned, from whichever
+    // log supplied it
+    std::string_view lastCycleRaw() const;
+
+    // True only when every log in the set qualifies for verbatim
+    // emission (see ReplayLog::crlfTerminated)
+    bool crlfTerminated() const;
+
+    // Inter-cycle delay in the merged order: next heap key minus the
+    // emitted cycle's key; -1 when either is unknown
+    double nextCycleDelta() const;
+
+    // Jump to cycle n of the merged order (wraps past the end). Walks
+    // the key arrays only — the logs seek once, at the end.
+    void seekCycle(uint64_t n);
+
+    // Rewind every log and rebuild the heap
+    void rewind();
+
+    // Total cycles across the set
+    size_t cycleCount() const;
+
+    // Follow-mode support; single-log sets only
+    bool hasCompleteCycle() const;
+    bool waitForGrowth(const std::atomic<bool>& shutdown);
+
+    // Sum of the logs' resident footprints (--mem-budget accounting)
+    size_t residentBytes() const;
+
+private:
+    // Rebuild the heap from the per-log cursors
+    void reheap();
+
+    bool single() const { return logs_.size() == 1; }
+
+    std::vector<std::unique_ptr<ReplayLog>> logs_;
+
+    // Sentence filter applied to each log as it opens
+    std::vector<std::string> filter_types_;
+    bool filter_drop_ = false;
+
+    // Per-log monotone merge keys: RMC seconds-of-day unwrapped across
+    // midnight and forward-filled over cycles with no parsed time
+    std::vector<std::vector<double>> keys_;
+
+    // Per-log cursor into keys_, mirroring each log's own cursor
+    std::vector<size_t> cursors_;
+
+    // Min-heap of (next key, log); within one log order is inherent,
+    // because a log's next cycle is pushed only after its predecessor
+    // was popped
+    using HeapEntry = std::pair<double, size_t>;
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap_;
+
+    size_t last_log_ = 0; // source of the cycle most recently emitted
+    double last_key_ = -1.0;
+};
+
+#endif // REPLAY_MERGE_HPP
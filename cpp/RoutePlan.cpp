@@ -0,0 +1,146 @@
+// RoutePlan.cpp
+#include "RoutePlan.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
+namespace {
+
+constexpr double kPi          = 3.14159265358979323846;
+constexpr double kEarthNm     = 3440.065; // mean Earth radius in nautical miles
+constexpr int64_t kMinE4PerDeg = 60 * 10000;
+constexpr int64_t kLonHalfMe4  = 180 * kMinE4PerDeg;
+
+std::string_view trimmed(std::string_view s)
+{
+    size_t hash = s.find('#');
+    if (hash != std::string_view::npos) {
+        s = s.substr(0, hash);
+    }
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t' || s.front() == '\r')) {
+        s.remove_prefix(1);
+    }
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r')) {
+        s.remove_suffix(1);
+    }
+    return s;
+}
+
+bool parseDouble(std::string_view s, double& out)
+{
+    std::string token(s);
+    char* end  = nullptr;
+    double val = std::strtod(token.c_str(), &end);
+    if (end == token.c_str() || *end != '\0') {
+        return false;
+    }
+    out = val;
+    return true;
+}
+
+} // namespace
+
+bool RoutePlan::loadFile(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Error opening route file: " << path << std::endl;
+        return false;
+    }
+
+    waypoints_.clear();
+    double last_speed = 10.0;
+    std::string raw;
+    int line_no = 0;
+    while (std::getline(file, raw)) {
+        ++line_no;
+        std::string_view line = trimmed(raw);
+        if (line.empty()) {
+            continue;
+        }
+        size_t c1 = line.find(',');
+        size_t c2 = c1 == std::string_view::npos ? c1 : line.find(',', c1 + 1);
+        Waypoint wp {};
+        bool ok = c1 != std::string_view::npos
+            && parseDouble(trimmed(line.substr(0, c1)), wp.lat_deg)
+            && parseDouble(trimmed(line.substr(
+                               c1 + 1,
+                               (c2 == std::string_view::npos ? line.size() : c2) - c1 - 1)),
+                           wp.lon_deg);
+        if (ok && c2 != std::string_view::npos) {
+            ok = parseDouble(trimmed(line.substr(c2 + 1)), wp.speed_knots)
+                && wp.speed_knots > 0;
+        } else {
+            wp.speed_knots = last_speed;
+        }
+        if (!ok || wp.lat_deg < -90 || wp.lat_deg > 90 || wp.lon_deg < -180
+            || wp.lon_deg > 180) {
+            std::cerr << "Error in route " << path << " line " << line_no << ": " << raw
+                      << std::endl;
+            return false;
+        }
+        last_speed = wp.speed_knots;
+        waypoints_.push_back(wp);
+    }
+    if (waypoints_.size() < 2) {
+        std::cerr << "Error in route " << path << ": need at least two waypoints"
+                  << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void RoutePlan::compile(double cycle_seconds)
+{
+    segments_.clear();
+    segments_.reserve(waypoints_.size());
+    for (size_t i = 0; i < waypoints_.size(); ++i) {
+        const Waypoint& a = waypoints_[i];
+        const Waypoint& b = waypoints_[(i + 1) % waypoints_.size()];
+
+        // Great-circle length (haversine) and initial bearing, in the
+        // only trigonometry the route ever runs
+        double lat1 = a.lat_deg * kPi / 180.0;
+        double lat2 = b.lat_deg * kPi / 180.0;
+        double dlat = lat2 - lat1;
+        double dlon = (b.lon_deg - a.lon_deg) * kPi / 180.0;
+        double h    = std::sin(dlat / 2) * std::sin(dlat / 2)
+            + std::cos(lat1) * std::cos(lat2) * std::sin(dlon / 2) * std::sin(dlon / 2);
+        double dist_nm = 2.0 * kEarthNm * std::asin(std::min(1.0, std::sqrt(h)));
+        double bearing = std::atan2(std::sin(dlon) * std::cos(lat2),
+                                    std::cos(lat1) * std::sin(lat2)
+                                        - std::sin(lat1) * std::cos(lat2) * std::cos(dlon));
+        bearing        = std::fmod(bearing * 180.0 / kPi + 360.0, 360.0);
+
+        double duration = dist_nm / b.speed_knots * 3600.0;
+        uint64_t cycles = static_cast<uint64_t>(
+            std::max(1.0, std::ceil(duration / cycle_seconds)));
+
+        int64_t start_lat = std::llround(a.lat_deg * static_cast<double>(kMinE4PerDeg));
+        int64_t start_lon = std::llround(a.lon_deg * static_cast<double>(kMinE4PerDeg));
+        int64_t end_lat   = std::llround(b.lat_deg * static_cast<double>(kMinE4PerDeg));
+        int64_t end_lon   = std::llround(b.lon_deg * static_cast<double>(kMinE4PerDeg));
+
+        // Step across the antimeridian in the shorter direction; the
+        // per-cycle wrap in the motion model keeps the track in range
+        int64_t span_lon = end_lon - start_lon;
+        if (span_lon > kLonHalfMe4) {
+            span_lon -= 2 * kLonHalfMe4;
+        } else if (span_lon < -kLonHalfMe4) {
+            span_lon += 2 * kLonHalfMe4;
+        }
+
+        RouteSegment seg;
+        seg.step_lat_me4 = (end_lat - start_lat) / static_cast<int64_t>(cycles);
+        seg.step_lon_me4 = span_lon / static_cast<int64_t>(cycles);
+        seg.cycles       = cycles;
+        seg.end_lat_me4  = end_lat;
+        seg.end_lon_me4  = end_lon;
+        seg.speed_knots  = b.speed_knots;
+        seg.course_deg   = bearing;
+        segments_.push_back(seg);
+    }
+}
@@ -0,0 +1,54 @@
+// RoutePlan.hpp
+#ifndef ROUTE_PLAN_HPP
+#define ROUTE_PLAN_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Waypoint route for --route. The file lists one waypoint per line as
+// "lat,lon[,speed_knots]" in decimal degrees (# comments allowed); a
+// missing speed repeats the previous waypoint's, the first defaults to
+// 10 kn. compile() does all the spherical trigonometry once — great-
+// circle distance and initial bearing per leg — and flattens the route
+// into per-cycle fixed-point step vectors, so the motion model's
+// per-cycle work is two integer adds and a countdown; no sin/cos ever
+// runs on the cycle path, which matters at 10 Hz across a --count
+// fleet. Each leg ends by snapping to its waypoint exactly, so the
+// integer-division rounding of the step never accumulates and the same
+// route replays the identical track. The route loops: the last
+// waypoint connects back to the first.
+struct RouteSegment {
+    int64_t step_lat_me4; // per-cycle latitude step, arc-min * 10^4
+    int64_t step_lon_me4; // per-cycle longitude step, arc-min * 10^4
+    uint64_t cycles;      // cycles this leg lasts
+    int64_t end_lat_me4;  // leg endpoint, snapped to exactly
+    int64_t end_lon_me4;
+    double speed_knots; // RMC speed over the leg
+    double course_deg;  // RMC course over the leg (initial bearing)
+};
+
+class RoutePlan {
+public:
+    // Parse the waypoint file; reports the offending line on stderr
+    // and returns false on malformed input or fewer than two waypoints
+    bool loadFile(const std::string& path);
+
+    // Flatten the waypoints into per-cycle segments for the given
+    // cycle interval
+    void compile(double cycle_seconds);
+
+    const std::vector<RouteSegment>& segments() const { return segments_; }
+
+private:
+    struct Waypoint {
+        double lat_deg;
+        double lon_deg;
+        double speed_knots;
+    };
+
+    std::vector<Waypoint> waypoints_;
+    std::vector<RouteSegment> segments_;
+};
+
+#endif // ROUTE_PLAN_HPP
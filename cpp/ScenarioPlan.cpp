@@ -0,0 +1,189 @@
+// ScenarioPlan.cpp
+#include "ScenarioPlan.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string_view>
+
+namespace {
+
+// Strip whitespace and a trailing '#' comment
+std::string_view trimmed(std::string_view s)
+{
+    size_t hash = s.find('#');
+    if (hash != std::string_view::npos) {
+        s = s.substr(0, hash);
+    }
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t' || s.front() == '\r')) {
+        s.remove_prefix(1);
+    }
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r')) {
+        s.remove_suffix(1);
+    }
+    return s;
+}
+
+// strtod with full-token validation; stod would accept trailing junk
+// and throws, neither of which fits a config parser
+bool parseDouble(std::string_view s, double& out)
+{
+    std::string token(s);
+    char* end  = nullptr;
+    double val = std::strtod(token.c_str(), &end);
+    if (end == token.c_str() || *end != '\0') {
+        return false;
+    }
+    out = val;
+    return true;
+}
+
+constexpr ScenarioEvent blankEvent()
+{
+    return ScenarioEvent { -1.0, std::numeric_limits<double>::quiet_NaN(),
+                           std::numeric_limits<double>::quiet_NaN(), -1, 0.0,
+                           -2, std::numeric_limits<double>::quiet_NaN(), -1 };
+}
+
+// Constellation names accepted by the dropout key, in enum order
+constexpr std::string_view constellation_names[] = {
+    "gps", "glonass", "galileo", "beidou", "qzss"
+};
+
+} // namespace
+
+bool ScenarioPlan::loadFile(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Error opening scenario file: " << path << std::endl;
+        return false;
+    }
+
+    events_.clear();
+    ScenarioEvent event = blankEvent();
+    bool in_phase       = false;
+    int line_no         = 0;
+
+    // Finishing a phase table validates it and appends the event
+    auto flush = [&]() {
+        if (!in_phase) {
+            return true;
+        }
+        if (event.at < 0) {
+            std::cerr << "Error in scenario " << path << ": [[phase]] before line "
+                      << line_no << " has no 'at'" << std::endl;
+            return false;
+        }
+        events_.push_back(event);
+        event = blankEvent();
+        return true;
+    };
+
+    std::string raw;
+    while (std::getline(file, raw)) {
+        ++line_no;
+        std::string_view line = trimmed(raw);
+        if (line.empty()) {
+            continue;
+        }
+        if (line == "[[phase]]" || line == "[phase]") {
+            if (!flush()) {
+                return false;
+            }
+            in_phase = true;
+            continue;
+        }
+        size_t eq = line.find('=');
+        if (!in_phase || eq == std::string_view::npos) {
+            std::cerr << "Error in scenario " << path << " line " << line_no << ": "
+                      << raw << std::endl;
+            return false;
+        }
+        std::string_view key = trimmed(line.substr(0, eq));
+        if (key == "dropout") {
+            std::string_view name = trimmed(line.substr(eq + 1));
+            event.dropout         = -1;
+            for (size_t c = 0; c < sizeof(constellation_names) / sizeof(constellation_names[0]);
+                 ++c) {
+                if (name == constellation_names[c]) {
+                    event.dropout = static_cast<int>(c);
+                    break;
+                }
+            }
+            if (event.dropout == -1) {
+                std::cerr << "Error in scenario " << path << " line " << line_no
+                          << ": unknown constellation '" << name << "'" << std::endl;
+                return false;
+            }
+            continue;
+        }
+        double value;
+        if (!parseDouble(trimmed(line.substr(eq + 1)), value)) {
+            std::cerr << "Error in scenario " << path << " line " << line_no
+                      << ": bad value for '" << key << "'" << std::endl;
+            return false;
+        }
+        if (key == "at" && value >= 0) {
+            event.at = value;
+        } else if (key == "speed" && value >= 0) {
+            event.speed = value;
+        } else if (key == "course") {
+            event.course = std::fmod(std::fmod(value, 360.0) + 360.0, 360.0);
+        } else if (key == "sats" && value >= 0) {
+            event.sats = static_cast<int>(value);
+        } else if (key == "interval" && value > 0) {
+            event.interval = value;
+        } else if (key == "fix" && value >= -1 && value <= 8) {
+            event.fix = static_cast<int>(value);
+        } else if (key == "hdop" && (value > 0 || value == -1)) {
+            event.hdop = value;
+        } else {
+            std::cerr << "Error in scenario " << path << " line " << line_no
+                      << ": unknown key or out-of-range value '" << key << "'"
+                      << std::endl;
+            return false;
+        }
+    }
+    if (!flush()) {
+        return false;
+    }
+    if (events_.empty()) {
+        std::cerr << "Error in scenario " << path << ": no [[phase]] entries" << std::endl;
+        return false;
+    }
+
+    // The file may list phases out of order; the timeline must not
+    std::stable_sort(events_.begin(), events_.end(),
+                     [](const ScenarioEvent& a, const ScenarioEvent& b) { return a.at < b.at; });
+    cursor_ = 0;
+    return true;
+}
+
+const ScenarioEvent* ScenarioPlan::due()
+{
+    if (cursor_ >= events_.size()) {
+        return nullptr;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (!started_) {
+        started_ = true;
+        epoch_   = now;
+    }
+    double elapsed = std::chrono::duration<double>(now - epoch_).count();
+    if (elapsed < events_[cursor_].at) {
+        return nullptr;
+    }
+    return &events_[cursor_++];
+}
+
+const ScenarioEvent* ScenarioPlan::dueAt(double t)
+{
+    if (cursor_ >= events_.size() || events_[cursor_].at > t) {
+        return nullptr;
+    }
+    return &events_[cursor_++];
+}
@@ -0,0 +1,74 @@
+// ScenarioPlan.hpp
+#ifndef SCENARIO_PLAN_HPP
+#define SCENARIO_PLAN_HPP
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Compiled scenario timeline for --scenario. The file is parsed exactly
+// once at startup into a flat, time-sorted array of events; the writer
+// loop's per-cycle cost is a single index bound check and, while events
+// remain, one clock read and one double compare — no string lookups, no
+// re-parsing, no per-cycle interpretation. A two-hour scripted scenario
+// therefore runs at the same cycle cost as a fixed-parameter loop.
+//
+// File format (a small TOML subset, one [[phase]] table per event):
+//
+//   # sim.toml
+//   [[phase]]
+//   at = 0.0        # seconds from start (required, ascending)
+//   speed = 12.5    # knots
+//   course = 90.0   # degrees true
+//   sats = 24       # satellite target across constellations
+//   interval = 0.1  # seconds per cycle
+//   fix = 0         # force the GGA fix quality; -1 restores random
+//   hdop = 9.9      # force the dilution fields; -1 restores random
+//   dropout = glonass  # clear that constellation's satellites; the
+//                      # normal churn then reacquires them gradually
+//
+// Omitted keys leave the running value unchanged, so a phase can adjust
+// one knob without restating the rest. The impairment keys (fix, hdop,
+// dropout) make scripted fix losses, DOP spikes and constellation
+// outages one timeline entry each, with no per-sentence conditionals —
+// they fire by mutating generator state once.
+struct ScenarioEvent {
+    double at;       // seconds from the first cycle
+    double speed;    // knots; NaN = unchanged
+    double course;   // degrees true; NaN = unchanged
+    int sats;        // satellite target; -1 = unchanged
+    double interval; // seconds per cycle; 0 = unchanged
+    int fix;         // GGA fix quality; -1 restores random, -2 = unchanged
+    double hdop;     // forced DOP; -1 restores random, NaN = unchanged
+    int dropout;     // constellation index to clear; -1 = unchanged
+};
+
+class ScenarioPlan {
+public:
+    // Parse and compile the scenario file. Reports the offending line
+    // on stderr and returns false on malformed input, an unknown key,
+    // or a phase without an 'at'.
+    bool loadFile(const std::string& path);
+
+    bool empty() const { return events_.size() == 0; }
+
+    // Next event whose time has arrived, or nullptr. Advances the
+    // cursor, so call in a loop to drain events missed during a stall.
+    // The timeline epoch is the first call.
+    const ScenarioEvent* due();
+
+    // Clock-free variant: next event due at simulated time t (seconds
+    // from the first cycle), or nullptr. The offline corpus writer
+    // (--emit-log) advances t by the cycle interval instead of reading
+    // the clock, so a scripted timeline lands on the same cycles it
+    // would in a paced run.
+    const ScenarioEvent* dueAt(double t);
+
+private:
+    std::vector<ScenarioEvent> events_;
+    size_t cursor_ = 0;
+    bool started_  = false;
+    std::chrono::steady_clock::time_point epoch_;
+};
+
+#endif // SCENARIO_PLAN_HPP
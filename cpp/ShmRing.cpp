@@ -0,0 +1,264 @@
+// ShmRing.cpp
+#include "ShmRing.hpp"
+#include "HugePages.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+// Wake every consumer parked on the doorbell word. Raw syscall — glibc
+// exposes no futex wrapper — and failures are ignored: a missed wake
+// only delays a consumer until the next cycle's doorbell.
+void futexWakeAll(std::atomic<uint32_t>* word)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, INT_MAX,
+            nullptr, nullptr, 0);
+}
+
+// Sleep on the doorbell word until it changes from expected, bounded so
+// a consumer re-checks the stop flag even if a wake is missed
+void futexWaitTimeout(std::atomic<uint32_t>* word, uint32_t expected)
+{
+    struct timespec timeout = { 0, 200 * 1000 * 1000 }; // 200 ms
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected,
+            &timeout, nullptr, 0);
+}
+
+} // namespace
+
+ShmRing::~ShmRing()
+{
+    teardown();
+}
+
+bool ShmRing::create(const std::string& name)
+{
+    // Recreate from scratch so a consumer can never observe a stale
+    // ring from a previous run as live data
+    shm_unlink(name.c_str());
+    shm_fd_ = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (shm_fd_ == -1) {
+        std::cerr << "Error creating shared memory " << name << ": "
+                  << strerror(errno) << std::endl;
+        return false;
+    }
+    if (ftruncate(shm_fd_, sizeof(Header)) == -1) {
+        std::cerr << "Error sizing shared memory " << name << ": "
+                  << strerror(errno) << std::endl;
+        close(shm_fd_);
+        shm_fd_ = -1;
+        shm_unlink(name.c_str());
+        return false;
+    }
+    void* map = mmap(nullptr, sizeof(Header), PROT_READ | PROT_WRITE, MAP_SHARED,
+                     shm_fd_, 0);
+    if (map == MAP_FAILED) {
+        std::cerr << "Error mapping shared memory " << name << ": "
+                  << strerror(errno) << std::endl;
+        close(shm_fd_);
+        shm_fd_ = -1;
+        shm_unlink(name.c_str());
+        return false;
+    }
+
+    // Shared mappings cannot take MAP_HUGETLB without a hugetlbfs fd,
+    // but the THP hint still lets the kernel collapse the slot pages
+    adviseHugePages(map, sizeof(Header));
+    header_ = static_cast<Header*>(map);
+    name_   = name;
+    initHeader();
+    return true;
+}
+
+bool ShmRing::createAnonymous()
+{
+    map_len_  = sizeof(Header);
+    void* map = mapHugeBuffer(map_len_, /*shared=*/true);
+    if (map == nullptr) {
+        std::cerr << "Error mapping anonymous shared memory: " << strerror(errno)
+                  << std::endl;
+        map_len_ = sizeof(Header);
+        return false;
+    }
+    header_ = static_cast<Header*>(map);
+    initHeader();
+    return true;
+}
+
+bool ShmRing::createFile(const std::string& path)
+{
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) {
+        std::cerr << "Error creating ring file " << path << ": " << strerror(errno)
+                  << std::endl;
+        return false;
+    }
+    if (ftruncate(fd, sizeof(Header)) == -1) {
+        std::cerr << "Error sizing ring file " << path << ": " << strerror(errno)
+                  << std::endl;
+        close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, sizeof(Header), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        std::cerr << "Error mapping ring file " << path << ": " << strerror(errno)
+                  << std::endl;
+        close(fd);
+        return false;
+    }
+
+    adviseHugePages(map, sizeof(Header));
+
+    // name_ deliberately stays empty: teardown must not shm_unlink a
+    // plain file, and the file outliving the run is the point
+    header_      = static_cast<Header*>(map);
+    shm_fd_      = fd;
+    file_backed_ = true;
+    initHeader();
+    return true;
+}
+
+void ShmRing::initHeader()
+{
+    // The fresh mapping is zero-filled, so slot sequences already read
+    // 0 (never written); publish the geometry, then the magic last so
+    // consumers that check it never race initialization
+    header_->slot_count = kSlots;
+    header_->slot_size  = kSlotSize;
+    header_->head.store(0, std::memory_order_relaxed);
+    header_->doorbell.store(0, std::memory_order_relaxed);
+    header_->stop.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    header_->magic = kMagic;
+}
+
+bool ShmRing::nextCycle(std::string& out)
+{
+    // Wait for a cycle newer than the consumer cursor. The doorbell
+    // ticket is read before the head re-check, so a publish between
+    // check and FUTEX_WAIT changes the word and the wait returns
+    // immediately instead of sleeping through the wake.
+    for (;;) {
+        if (header_->head.load(std::memory_order_acquire) > consumer_seq_) {
+            break;
+        }
+        if (header_->stop.load(std::memory_order_acquire) != 0) {
+            return false;
+        }
+        uint32_t ticket = header_->doorbell.load(std::memory_order_acquire);
+        if (header_->head.load(std::memory_order_acquire) > consumer_seq_) {
+            break;
+        }
+        futexWaitTimeout(&header_->doorbell, ticket);
+    }
+
+    for (;;) {
+        uint64_t head = header_->head.load(std::memory_order_acquire);
+        uint64_t seq  = consumer_seq_ + 1;
+        if (head >= seq + kSlots) {
+            // Lapped while sleeping: resume at the oldest cycle the
+            // ring still holds
+            uint64_t oldest = head - kSlots + 1;
+            lost_ += oldest - seq;
+            seq = oldest;
+        }
+
+        // Seqlock read: copy, then confirm the slot still carries the
+        // sequence we meant to read
+        const Slot& slot = header_->slots[(seq - 1) % kSlots];
+        if (slot.seq.load(std::memory_order_acquire) != seq) {
+            ++lost_;
+            consumer_seq_ = seq;
+            continue;
+        }
+        out.assign(slot.data, slot.len);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) == seq) {
+            consumer_seq_ = seq;
+            return true;
+        }
+        ++lost_;
+        consumer_seq_ = seq;
+    }
+}
+
+void ShmRing::requestStop()
+{
+    if (header_ != nullptr) {
+        header_->stop.store(1, std::memory_order_release);
+        header_->doorbell.fetch_add(1, std::memory_order_release);
+        futexWakeAll(&header_->doorbell);
+    }
+}
+
+void ShmRing::publish(const char* data, size_t len)
+{
+    if (len > kSlotPayload) {
+        len = kSlotPayload;
+        ++truncated_;
+    }
+    uint64_t seq = next_seq_ + 1; // sequences are 1-based; 0 = empty slot
+    Slot& slot   = header_->slots[next_seq_ % kSlots];
+
+    // Seqlock write: mark in progress, copy, publish the new sequence
+    slot.seq.store(~0ULL, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(slot.data, data, len);
+    slot.len = static_cast<uint32_t>(len);
+    slot.seq.store(seq, std::memory_order_release);
+
+    header_->head.store(seq, std::memory_order_release);
+    next_seq_ = seq;
+
+    // File-backed ring: consumers poll at their own pace, so there is
+    // no doorbell to ring — the hot path stays syscall-free, with one
+    // lazy MS_ASYNC writeback every kSyncEvery cycles
+    if (file_backed_) {
+        if ((next_seq_ & (kSyncEvery - 1)) == 0) {
+            msync(header_, sizeof(Header), MS_ASYNC);
+        }
+        return;
+    }
+
+    // Ring the doorbell: bump the futex word and wake sleepers
+    header_->doorbell.fetch_add(1, std::memory_order_release);
+    futexWakeAll(&header_->doorbell);
+}
+
+void ShmRing::teardown()
+{
+    if (header_ != nullptr) {
+        if (file_backed_) {
+            // Leave the header intact: the file doubles as a flight
+            // recorder and must stay readable post-mortem. Set stop for
+            // live pollers and flush the tail once, synchronously.
+            header_->stop.store(1, std::memory_order_release);
+            msync(header_, sizeof(Header), MS_SYNC);
+        } else {
+            // Invalidate before unmapping so consumers still holding
+            // the mapping see a dead ring, not silently frozen data
+            header_->magic = 0;
+            futexWakeAll(&header_->doorbell);
+        }
+        munmap(header_, map_len_);
+        header_  = nullptr;
+        map_len_ = sizeof(Header);
+    }
+    if (shm_fd_ != -1) {
+        close(shm_fd_);
+        shm_fd_ = -1;
+    }
+    if (!name_.empty()) {
+        shm_unlink(name_.c_str());
+        name_.clear();
+    }
+}
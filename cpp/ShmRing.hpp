@@ -0,0 +1,131 @@
+// ShmRing.hpp
+#ifndef SHM_RING_HPP
+#define SHM_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Shared-memory output sink (--shm <name>): a POSIX shm object holding a
+// single-producer ring of sequence-numbered cycle slots. Same-host
+// consumers map it read-only and follow the head counter, so a cycle
+// hand-off is one memcpy on the producer side and zero syscalls on the
+// consumer side — versus a write()+read() round trip (~20 us) through
+// the FIFO. A futex doorbell lets consumers sleep between cycles instead
+// of polling the head.
+//
+// Slot protocol (seqlock per slot): the producer overwrites the slot's
+// sequence word with the in-progress marker, copies the payload, then
+// publishes the cycle's sequence number with release ordering and
+// advances head. A consumer reads the slot for head-1, then re-reads the
+// slot sequence; a mismatch means the producer lapped it mid-read and
+// the copy must be discarded. The producer never waits for consumers —
+// a reader that falls a full ring behind simply loses the overwritten
+// cycles, which is the right policy for a latest-state fusion feed.
+class ShmRing {
+public:
+    ShmRing() = default;
+    ~ShmRing();
+
+    ShmRing(const ShmRing&)            = delete;
+    ShmRing& operator=(const ShmRing&) = delete;
+
+    // Create (or recreate) the shm object and initialize the ring
+    // header. Returns false on shm_open/mmap failure.
+    bool create(const std::string& name);
+
+    // Create the ring in an anonymous shared mapping instead of a named
+    // shm object (--fork-sinks): forked children inherit the mapping,
+    // it never appears in the filesystem, and it vanishes with the last
+    // process holding it.
+    bool createAnonymous();
+
+    // Back the ring with a plain file (--mmap-out) instead of a shm
+    // object: consumers map it read-only and poll at their own pace,
+    // with no pipe coupling to the writer. Publishes skip the futex
+    // doorbell (pollers do not sleep on it) and schedule writeback
+    // lazily, so the steady-state cost is the slot memcpy with no
+    // syscall per cycle. The file survives the run intact — a flight
+    // recorder of the last ring's worth of output for post-mortem.
+    bool createFile(const std::string& path);
+
+    bool ready() const { return header_ != nullptr; }
+
+    // Publish one cycle into the next slot and ring the doorbell.
+    // Payloads beyond the slot capacity are truncated (and counted);
+    // generated cycles are ~1 KB against an 8 KB slot, so truncation
+    // only fires on pathological replay input.
+    void publish(const char* data, size_t len);
+
+    // Cycles published since create()
+    uint64_t published() const { return next_seq_; }
+
+    // Publishes that did not fit a slot and were truncated
+    uint64_t truncated() const { return truncated_; }
+
+    // Consumer side, for processes sharing the mapping: sleep until a
+    // cycle newer than the last one returned is published and copy it
+    // into out. Returns false once the producer requested stop and no
+    // newer cycle remains. A consumer the producer lapped skips ahead
+    // to the oldest still-valid cycle; the skipped count is tracked.
+    bool nextCycle(std::string& out);
+
+    // Producer side: ask consumers to finish once they drain, and wake
+    // every sleeper
+    void requestStop();
+
+    // Cycles this consumer lost to being lapped
+    uint64_t lostCycles() const { return lost_; }
+
+    // The per-slot payload capacity, for callers that size buffers
+    static constexpr size_t kSlotPayload = 8192 - 16;
+
+private:
+    static constexpr uint32_t kMagic = 0x4e52494e; // "NIRN" — NmeaRINg
+    static constexpr uint32_t kSlots = 64; // power of two, ~512 KB total
+    static constexpr size_t kSlotSize = 8192;
+
+    // Mapped layout. Head and doorbell sit on their own cache lines so
+    // consumer polling does not bounce the producer's writes.
+    struct Slot {
+        std::atomic<uint64_t> seq; // 0 = never written, ~0 = in progress
+        uint32_t len;
+        uint32_t pad;
+        char data[kSlotPayload];
+    };
+    struct Header {
+        uint32_t magic;
+        uint32_t slot_count;
+        uint32_t slot_size;
+        uint32_t pad;
+        alignas(64) std::atomic<uint64_t> head; // next sequence to write
+        alignas(64) std::atomic<uint32_t> doorbell; // futex word
+        alignas(64) std::atomic<uint32_t> stop; // producer asks consumers to finish
+        alignas(64) Slot slots[kSlots];
+    };
+
+    // Shared header initialization, after the mapping is in place
+    void initHeader();
+
+    void teardown();
+
+    // One lazy MS_ASYNC msync per this many publishes (file-backed)
+    static constexpr uint64_t kSyncEvery = 256;
+
+    std::string name_;
+    bool file_backed_  = false;
+    int shm_fd_        = -1;
+    Header* header_    = nullptr;
+    // Mapped length; hugepage-backed anonymous rings round up to the
+    // hugepage size, and munmap must be told the full extent
+    size_t map_len_ = sizeof(Header);
+    uint64_t next_seq_  = 0;
+    uint64_t truncated_ = 0;
+
+    // Consumer-side cursor and lap losses (per process after a fork)
+    uint64_t consumer_seq_ = 0;
+    uint64_t lost_         = 0;
+};
+
+#endif // SHM_RING_HPP
@@ -0,0 +1,27 @@
+// SinkStats.cpp
+#include "SinkStats.hpp"
+#include "StartupReport.hpp"
+
+#include <cstring>
+
+void SinkCounters::recordCycle(const char* data, size_t len)
+{
+    uint64_t lines     = 0;
+    const char* cursor = data;
+    const char* end    = data + len;
+    while (cursor < end) {
+        const char* nl = static_cast<const char*>(
+            memchr(cursor, '\n', static_cast<size_t>(end - cursor)));
+        if (nl == nullptr) {
+            break;
+        }
+        ++lines;
+        cursor = nl + 1;
+    }
+    cycles.fetch_add(1, std::memory_order_relaxed);
+    sentences.fetch_add(lines, std::memory_order_relaxed);
+    bytes.fetch_add(len, std::memory_order_relaxed);
+    // Every sink path funnels successful cycles through here, so this
+    // is the one probe that sees the first write regardless of mode
+    StartupReport::mark(StartupReport::FirstWrite);
+}
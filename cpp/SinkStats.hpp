@@ -0,0 +1,32 @@
+// SinkStats.hpp
+#ifndef SINK_STATS_HPP
+#define SINK_STATS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Per-sink throughput counters for the writer hot loops. Relaxed
+// atomics are deliberate: each counter has exactly one incrementing
+// writer and the periodic reporter only reads, so no ordering is
+// needed and the per-cycle cost is a few uncontended adds plus one
+// newline scan — aggregate visibility without a console firehose.
+struct SinkCounters {
+    std::atomic<uint64_t> cycles { 0 };
+    std::atomic<uint64_t> sentences { 0 };
+    std::atomic<uint64_t> bytes { 0 };
+    std::atomic<uint64_t> dropped { 0 };
+    std::atomic<uint64_t> retries { 0 };
+    std::atomic<uint64_t> stalls { 0 };
+
+    // One emitted cycle: counts the buffer's sentences and bytes
+    void recordCycle(const char* data, size_t len);
+
+    void recordDropped() { dropped.fetch_add(1, std::memory_order_relaxed); }
+    void recordRetry() { retries.fetch_add(1, std::memory_order_relaxed); }
+
+    // Sink buffer already full when a cycle arrived (consumer pause)
+    void recordStall() { stalls.fetch_add(1, std::memory_order_relaxed); }
+};
+
+#endif // SINK_STATS_HPP
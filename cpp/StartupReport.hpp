@@ -0,0 +1,77 @@
+// StartupReport.hpp
+#ifndef STARTUP_REPORT_HPP
+#define STARTUP_REPORT_HPP
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+// Time-to-first-sentence breakdown (--startup-report): startup latency
+// is tracked per release — CI spawns thousands of instances — so the
+// phases between exec and the first emitted cycle each record a
+// once-only timestamp against a process-start epoch: argument parse,
+// sink setup, symlink, first generate, first write. A mark is one
+// relaxed load in the steady state (plus a clock read the first time
+// its phase completes), so the probes live in the hot paths
+// permanently; the report prints only when --startup-report enabled
+// it, from whichever sink lands the first cycle. Phases a mode never
+// reaches (no symlink under --pipe, say) report n/a.
+class StartupReport {
+public:
+    enum Phase { Parse, Setup, Symlink, FirstGenerate, FirstWrite, PhaseCount };
+
+    static void enable() { enabled_.store(true, std::memory_order_relaxed); }
+
+    // Record completion of a phase; the first caller wins, later calls
+    // fall out on the initial load
+    static void mark(Phase phase)
+    {
+        std::atomic<int64_t>& slot = marks_[phase];
+        if (slot.load(std::memory_order_relaxed) >= 0) {
+            return;
+        }
+        int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now() - epoch_)
+                         .count();
+        int64_t expected = -1;
+        if (slot.compare_exchange_strong(expected, ns, std::memory_order_relaxed)
+            && phase == FirstWrite && enabled_.load(std::memory_order_relaxed)) {
+            dump();
+        }
+    }
+
+private:
+    static void dump()
+    {
+        static const char* const kNames[PhaseCount] = {
+            "argument parse", "sink setup", "symlink", "first generate",
+            "first write"
+        };
+        std::ios_base::fmtflags saved = std::cout.flags();
+        std::cout << "Startup report (ms since process start):\n";
+        for (int p = 0; p < PhaseCount; ++p) {
+            int64_t ns = marks_[p].load(std::memory_order_relaxed);
+            std::cout << "  " << std::left << std::setw(16) << kNames[p]
+                      << std::right;
+            if (ns < 0) {
+                std::cout << "     n/a\n";
+            } else {
+                std::cout << std::fixed << std::setprecision(2) << std::setw(9)
+                          << ns / 1e6 << '\n';
+            }
+        }
+        std::cout.flags(saved);
+        std::cout << std::flush;
+    }
+
+    // Captured during static initialization, i.e. at exec for
+    // practical purposes
+    inline static const std::chrono::steady_clock::time_point epoch_
+        = std::chrono::steady_clock::now();
+    inline static std::atomic<int64_t> marks_[PhaseCount]
+        = { -1, -1, -1, -1, -1 };
+    inline static std::atomic<bool> enabled_ { false };
+};
+
+#endif // STARTUP_REPORT_HPP
@@ -0,0 +1,139 @@
+// TimePatch.hpp
+#ifndef TIME_PATCH_HPP
+#define TIME_PATCH_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+// In-place wall-clock refresh for already-formatted NMEA buffers,
+// shared by the prebaked corpus (--prebake-time) and fresh-timestamp
+// replay (--retime). A patch point is one 9-byte hhmmss.ss time field
+// plus the offset of its line's two checksum hex digits; scanTimePatches
+// records both once and every refresh after that is a fixed-width
+// overwrite plus an incremental checksum fix — the NMEA checksum is a
+// plain XOR over the payload, so new = old ^ old_field ^ new_field and
+// no line is ever rescanned.
+
+struct TimePatch {
+    uint32_t time_off; // offset of the 9-byte hhmmss.ss field
+    uint32_t csum_off; // offset of the 2 hex digits after '*'
+};
+
+// A 9-byte comma-delimited field shaped dddddd.dd is a UTC time
+// (hhmmss.ss); the other fixed-point fields in our sentences put the
+// decimal point elsewhere, so the shape alone identifies it
+inline bool looksLikeUtcTime(const char* f)
+{
+    for (int i = 0; i < 6; ++i) {
+        if (f[i] < '0' || f[i] > '9')
+            return false;
+    }
+    if (f[6] != '.')
+        return false;
+    return f[7] >= '0' && f[7] <= '9' && f[8] >= '0' && f[8] <= '9';
+}
+
+// Two zero-padded digits, same scheme as the generator's refreshClock
+inline void put2(char* p, int v)
+{
+    p[0] = static_cast<char>('0' + v / 10);
+    p[1] = static_cast<char>('0' + v % 10);
+}
+
+inline uint8_t hexNibble(char c)
+{
+    if (c >= '0' && c <= '9')
+        return static_cast<uint8_t>(c - '0');
+    if (c >= 'A' && c <= 'F')
+        return static_cast<uint8_t>(c - 'A' + 10);
+    return static_cast<uint8_t>(c - 'a' + 10);
+}
+
+// Record one patch point per NMEA line with a time field: the field
+// offset plus the offset of the line's two checksum hex digits. Lines
+// without a checksum are skipped — there is nothing to repair there.
+inline void scanTimePatches(const std::string& buf, std::vector<TimePatch>& patches)
+{
+    size_t pos = 0;
+    while ((pos = buf.find('$', pos)) != std::string::npos) {
+        size_t eol  = buf.find('\n', pos);
+        size_t star = buf.find('*', pos);
+        if (star == std::string::npos || star + 2 >= buf.size()) {
+            break;
+        }
+        if (eol != std::string::npos && star > eol) {
+            pos = eol + 1; // line without a checksum; skip it
+            continue;
+        }
+        size_t field = pos;
+        while (field < star) {
+            size_t comma = buf.find(',', field);
+            size_t end   = (comma == std::string::npos || comma > star)
+                  ? star
+                  : comma;
+            if (end - field == 9 && looksLikeUtcTime(buf.data() + field)) {
+                patches.push_back({ static_cast<uint32_t>(field),
+                                    static_cast<uint32_t>(star + 1) });
+            }
+            if (end == star) {
+                break;
+            }
+            field = end + 1;
+        }
+        pos = (eol == std::string::npos) ? buf.size() : eol + 1;
+    }
+}
+
+// Overwrite every recorded time field with the current wall clock and
+// fix each line's checksum incrementally
+inline void patchTimes(std::string& buf, const std::vector<TimePatch>& patches)
+{
+    if (patches.empty()) {
+        return;
+    }
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    // No gmtime_r: glibc serializes it on the timezone lock, and with
+    // --count fleets every device patches once per cycle. The field
+    // carries no date, so the UTC split is three integer divisions on
+    // seconds-of-day with no library call and no shared state.
+    int secs_of_day = static_cast<int>(ts.tv_sec % 86400);
+    char now[9];
+    put2(now, secs_of_day / 3600);
+    put2(now + 2, (secs_of_day / 60) % 60);
+    put2(now + 4, secs_of_day % 60);
+    now[6] = '.';
+    put2(now + 7, static_cast<int>(ts.tv_nsec / 10000000));
+
+    static const char kHex[] = "0123456789ABCDEF";
+    char* data               = &buf[0];
+    for (const TimePatch& p : patches) {
+        if (memcmp(data + p.time_off, now, 9) == 0) {
+            continue; // same hundredth of a second; nothing moved
+        }
+        uint8_t diff = 0;
+        for (int i = 0; i < 9; ++i) {
+            diff = static_cast<uint8_t>(diff
+                                        ^ static_cast<uint8_t>(data[p.time_off + i])
+                                        ^ static_cast<uint8_t>(now[i]));
+        }
+        memcpy(data + p.time_off, now, 9);
+        // diff can fold to zero for two fields that still differ (XOR
+        // is lossy), so the field compare above, not diff, decides
+        // whether anything moved; a zero diff here just means the
+        // checksum happens to be unchanged
+        if (diff == 0) {
+            continue;
+        }
+        uint8_t old = static_cast<uint8_t>((hexNibble(data[p.csum_off]) << 4)
+                                           | hexNibble(data[p.csum_off + 1]));
+        uint8_t fresh        = static_cast<uint8_t>(old ^ diff);
+        data[p.csum_off]     = kHex[fresh >> 4];
+        data[p.csum_off + 1] = kHex[fresh & 0xF];
+    }
+}
+
+#endif // TIME_PATCH_HPP
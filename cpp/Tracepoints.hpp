@@ -0,0 +1,52 @@
+// Tracepoints.hpp
+#ifndef TRACEPOINTS_HPP
+#define TRACEPOINTS_HPP
+
+#include <cstdint>
+
+// Static tracepoints on the generate and write boundaries, so perf and
+// bpftrace can measure in-process pipeline stages on a production rig
+// without recompiling. When <sys/sdt.h> is available they compile to
+// USDT probes (provider "nmea": gen_start, gen_end, write_start,
+// write_end) — a single nop until a tracer arms them. Without it they
+// fall back to tiny noinline functions with the same names that a
+// uprobe attaches to by symbol; untraced cost is one call/ret.
+// Every probe carries the cycle sequence number, the *_end pair also
+// the byte count.
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define NMEA_HAVE_SDT 1
+#endif
+#endif
+
+#ifdef NMEA_HAVE_SDT
+
+#include <sys/sdt.h>
+
+#define NMEA_TRACE_GEN_START(seq) DTRACE_PROBE1(nmea, gen_start, (seq))
+#define NMEA_TRACE_GEN_END(seq, bytes) DTRACE_PROBE2(nmea, gen_end, (seq), (bytes))
+#define NMEA_TRACE_WRITE_START(seq, bytes) DTRACE_PROBE2(nmea, write_start, (seq), (bytes))
+#define NMEA_TRACE_WRITE_END(seq, bytes) DTRACE_PROBE2(nmea, write_end, (seq), (bytes))
+
+#else
+
+namespace nmea_trace {
+
+// uprobe attach points, e.g.:
+//   perf probe -x ./nmea_simulator nmea_trace::gen_start
+//   bpftrace -e 'uprobe:./nmea_simulator:*gen_end* { @[arg1] = count(); }'
+void gen_start(uint64_t seq);
+void gen_end(uint64_t seq, uint64_t bytes);
+void write_start(uint64_t seq, uint64_t bytes);
+void write_end(uint64_t seq, uint64_t bytes);
+
+} // namespace nmea_trace
+
+#define NMEA_TRACE_GEN_START(seq) nmea_trace::gen_start(seq)
+#define NMEA_TRACE_GEN_END(seq, bytes) nmea_trace::gen_end((seq), (bytes))
+#define NMEA_TRACE_WRITE_START(seq, bytes) nmea_trace::write_start((seq), (bytes))
+#define NMEA_TRACE_WRITE_END(seq, bytes) nmea_trace::write_end((seq), (bytes))
+
+#endif // NMEA_HAVE_SDT
+
+#endif // TRACEPOINTS_HPP
@@ -0,0 +1,233 @@
+// UringWriter.cpp
+#include "UringWriter.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace {
+
+// Raw syscall wrappers; glibc does not export io_uring entry points
+int sys_io_uring_setup(unsigned entries, struct io_uring_params* p)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, p));
+}
+
+int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags)
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int sys_io_uring_register(int fd, unsigned opcode, const void* arg, unsigned nr)
+{
+    return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, nr));
+}
+
+// Ring indices are published by the kernel; pair loads/stores with the
+// matching acquire/release fences
+unsigned loadAcquire(const unsigned* p)
+{
+    return std::atomic_load_explicit(reinterpret_cast<const std::atomic<unsigned>*>(p),
+                                     std::memory_order_acquire);
+}
+
+void storeRelease(unsigned* p, unsigned v)
+{
+    std::atomic_store_explicit(reinterpret_cast<std::atomic<unsigned>*>(p), v,
+                               std::memory_order_release);
+}
+
+} // namespace
+
+UringWriter::~UringWriter()
+{
+    teardown();
+}
+
+bool UringWriter::init(int fd)
+{
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd_ = sys_io_uring_setup(8, &params);
+    if (ring_fd_ == -1) {
+        return false;
+    }
+    target_fd_ = fd;
+
+    sq_bytes_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_bytes_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    single_mmap_ = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap_) {
+        sq_bytes_ = cq_bytes_ = std::max(sq_bytes_, cq_bytes_);
+    }
+
+    sq_ring_ = mmap(nullptr, sq_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                    ring_fd_, IORING_OFF_SQ_RING);
+    if (sq_ring_ == MAP_FAILED) {
+        sq_ring_ = nullptr;
+        teardown();
+        return false;
+    }
+    if (single_mmap_) {
+        cq_ring_ = sq_ring_;
+    } else {
+        cq_ring_ = mmap(nullptr, cq_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring_fd_, IORING_OFF_CQ_RING);
+        if (cq_ring_ == MAP_FAILED) {
+            cq_ring_ = nullptr;
+            teardown();
+            return false;
+        }
+    }
+    sqes_ = mmap(nullptr, params.sq_entries * sizeof(struct io_uring_sqe),
+                 PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+    if (sqes_ == MAP_FAILED) {
+        sqes_ = nullptr;
+        teardown();
+        return false;
+    }
+
+    char* sq = static_cast<char*>(sq_ring_);
+    char* cq = static_cast<char*>(cq_ring_);
+    sq_head_  = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sq_tail_  = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask_  = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    cq_head_  = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail_  = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask_  = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_     = cq + params.cq_off.cqes;
+
+    // Registered double buffer: the kernel pins it once at registration
+    // instead of once per write
+    buffers_ = static_cast<char*>(mmap(nullptr, kSlots * kSlotSize, PROT_READ | PROT_WRITE,
+                                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (buffers_ == MAP_FAILED) {
+        buffers_ = nullptr;
+        teardown();
+        return false;
+    }
+    struct iovec iov[kSlots];
+    for (unsigned i = 0; i < kSlots; ++i) {
+        iov[i].iov_base = buffers_ + i * kSlotSize;
+        iov[i].iov_len  = kSlotSize;
+    }
+    if (sys_io_uring_register(ring_fd_, IORING_REGISTER_BUFFERS, iov, kSlots) == -1) {
+        teardown();
+        return false;
+    }
+    return true;
+}
+
+bool UringWriter::reapCompletions(bool wait)
+{
+    if (wait && *cq_head_ == loadAcquire(cq_tail_)) {
+        if (sys_io_uring_enter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS) == -1 && errno != EINTR) {
+            failed_ = true;
+            return false;
+        }
+    }
+    unsigned head = *cq_head_;
+    unsigned tail = loadAcquire(cq_tail_);
+    while (head != tail) {
+        const struct io_uring_cqe* cqe = reinterpret_cast<const struct io_uring_cqe*>(
+            static_cast<char*>(cqes_) + (head & *cq_mask_) * sizeof(struct io_uring_cqe));
+        in_flight_ &= ~(1u << cqe->user_data);
+        if (cqe->res < 0) {
+            if (cqe->res == -EAGAIN || cqe->res == -EWOULDBLOCK) {
+                // Consumer not reading; that cycle is stale anyway
+                ++dropped_;
+            } else {
+                std::cerr << "io_uring write failed: " << strerror(-cqe->res) << std::endl;
+                failed_ = true;
+            }
+        }
+        ++head;
+    }
+    storeRelease(cq_head_, head);
+    return !failed_;
+}
+
+bool UringWriter::writeCycle(const char* data, size_t len)
+{
+    if (failed_) {
+        return false;
+    }
+    if (len > kSlotSize) {
+        len = kSlotSize; // a default cycle is well under 1 KB
+    }
+
+    // Recycle completed buffers; block only when both are in flight
+    if (!reapCompletions(false)) {
+        return false;
+    }
+    while (in_flight_ == (1u << kSlots) - 1) {
+        if (!reapCompletions(true)) {
+            return false;
+        }
+    }
+    unsigned slot = (in_flight_ & 1u) ? 1u : 0u;
+    std::memcpy(buffers_ + slot * kSlotSize, data, len);
+
+    unsigned tail = *sq_tail_;
+    unsigned index = tail & *sq_mask_;
+    struct io_uring_sqe* sqe = reinterpret_cast<struct io_uring_sqe*>(
+        static_cast<char*>(sqes_) + index * sizeof(struct io_uring_sqe));
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode    = IORING_OP_WRITE_FIXED;
+    sqe->fd        = target_fd_;
+    sqe->addr      = reinterpret_cast<uint64_t>(buffers_ + slot * kSlotSize);
+    sqe->len       = static_cast<uint32_t>(len);
+    sqe->buf_index = static_cast<uint16_t>(slot);
+    sqe->user_data = slot;
+    sq_array_[index] = index;
+    storeRelease(sq_tail_, tail + 1);
+    in_flight_ |= 1u << slot;
+
+    if (sys_io_uring_enter(ring_fd_, 1, 0, 0) == -1) {
+        std::cerr << "io_uring_enter failed: " << strerror(errno) << std::endl;
+        failed_ = true;
+        return false;
+    }
+    return true;
+}
+
+bool UringWriter::drain()
+{
+    while (in_flight_ != 0) {
+        if (!reapCompletions(true)) {
+            return false;
+        }
+    }
+    return !failed_;
+}
+
+void UringWriter::teardown()
+{
+    if (buffers_ != nullptr) {
+        munmap(buffers_, kSlots * kSlotSize);
+        buffers_ = nullptr;
+    }
+    if (sqes_ != nullptr) {
+        munmap(sqes_, 8 * sizeof(struct io_uring_sqe));
+        sqes_ = nullptr;
+    }
+    if (cq_ring_ != nullptr && !single_mmap_) {
+        munmap(cq_ring_, cq_bytes_);
+    }
+    cq_ring_ = nullptr;
+    if (sq_ring_ != nullptr) {
+        munmap(sq_ring_, sq_bytes_);
+        sq_ring_ = nullptr;
+    }
+    if (ring_fd_ != -1) {
+        close(ring_fd_);
+        ring_fd_ = -1;
+    }
+}
@@ -0,0 +1,80 @@
+// UringWriter.hpp
+#ifndef URING_WRITER_HPP
+#define URING_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// Optional io_uring output backend for the generate-mode writers
+// (--io-backend uring). One cycle is one submission-queue entry against
+// a pre-registered buffer, so the steady state costs a single
+// io_uring_enter() with no per-write buffer pinning; completions are
+// reaped lazily to recycle buffers, letting submission of cycle N
+// overlap completion of cycle N-1. Built on the raw syscalls so no
+// liburing dependency is added; init() fails cleanly (and the caller
+// falls back to write()) on kernels without io_uring.
+class UringWriter {
+public:
+    UringWriter() = default;
+    ~UringWriter();
+
+    UringWriter(const UringWriter&)            = delete;
+    UringWriter& operator=(const UringWriter&) = delete;
+
+    // Set up the ring and register the double buffer against fd.
+    // Returns false if the kernel lacks io_uring support.
+    bool init(int fd);
+
+    bool ready() const { return ring_fd_ != -1; }
+
+    // Queue one cycle for writing. Blocks only when both registered
+    // buffers are still in flight. A completion carrying -EAGAIN (full
+    // PTY buffer, consumer not reading) drops that cycle and counts it
+    // rather than stalling. Returns false on a hard write error.
+    bool writeCycle(const char* data, size_t len);
+
+    // Wait for every queued write to complete (shutdown path)
+    bool drain();
+
+    // Cycles whose completion reported a full output buffer
+    uint64_t droppedCycles() const { return dropped_; }
+
+private:
+    static constexpr size_t kSlotSize = 8192;
+    static constexpr unsigned kSlots  = 2;
+
+    // Pop finished completions, freeing their buffer slots; with
+    // wait == true, blocks until at least one completion arrives
+    bool reapCompletions(bool wait);
+
+    void teardown();
+
+    int ring_fd_   = -1;
+    int target_fd_ = -1;
+
+    // mmap'd ring regions
+    void* sq_ring_   = nullptr;
+    void* cq_ring_   = nullptr;
+    void* sqes_      = nullptr;
+    size_t sq_bytes_ = 0;
+    size_t cq_bytes_ = 0;
+    bool single_mmap_ = false;
+
+    // Raw pointers into the rings, resolved from the setup offsets
+    unsigned* sq_head_    = nullptr;
+    unsigned* sq_tail_    = nullptr;
+    unsigned* sq_mask_    = nullptr;
+    unsigned* sq_array_   = nullptr;
+    unsigned* cq_head_    = nullptr;
+    unsigned* cq_tail_    = nullptr;
+    unsigned* cq_mask_    = nullptr;
+    void* cqes_           = nullptr;
+
+    // Registered double buffer and slot occupancy
+    char* buffers_     = nullptr;
+    unsigned in_flight_ = 0; // bitmask over kSlots
+    bool failed_        = false;
+    uint64_t dropped_   = 0;
+};
+
+#endif // URING_WRITER_HPP
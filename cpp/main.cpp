@@ -1,15 +1,234 @@
 // main.cpp
+#include "MemBudget.hpp"
+#include "NmeaGenerator.hpp"
 #include "NmeaSimulator.hpp"
+#include "ReplayLog.hpp"
+#include "RoutePlan.hpp"
+#include "ScenarioPlan.hpp"
+#include "StartupReport.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <poll.h>
 #include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+// Client side of the fleet lease protocol: connect to a daemon started
+// with --count/--lease, send the attach request (plus any control-style
+// "name value" pairs from the command line), print the reply — first
+// line is the leased port path — and hold the connection open. The
+// connection is the lease, so exiting, crashing or being killed all
+// detach cleanly and the daemon recycles the device. Attaching costs a
+// socket round trip, milliseconds against the ~200 ms of a fresh spawn.
+static int runAttachClient(int argc, char* argv[])
+{
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0]
+                  << " attach <lease-name> [<command> <value> ...]\n";
+        return 1;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd == -1) {
+        std::cerr << "Error creating socket: " << strerror(errno) << "\n";
+        return 1;
+    }
+    struct sockaddr_un addr {};
+    addr.sun_family = AF_UNIX;
+    size_t name_len = std::min(strlen(argv[2]), sizeof(addr.sun_path) - 1);
+    memcpy(addr.sun_path + 1, argv[2], name_len);
+    socklen_t addr_len
+        = static_cast<socklen_t>(offsetof(struct sockaddr_un, sun_path) + 1 + name_len);
+    if (connect(fd, reinterpret_cast<struct sockaddr*>(&addr), addr_len) == -1) {
+        std::cerr << "Error connecting to lease endpoint @" << argv[2] << ": "
+                  << strerror(errno) << "\n";
+        close(fd);
+        return 1;
+    }
+
+    std::string request = "attach\n";
+    for (int i = 3; i + 1 < argc; i += 2) {
+        request += std::string(argv[i]) + " " + argv[i + 1] + "\n";
+    }
+    if (write(fd, request.c_str(), request.size()) == -1) {
+        std::cerr << "Error sending attach request: " << strerror(errno) << "\n";
+        close(fd);
+        return 1;
+    }
+
+    char reply[512];
+    ssize_t got = read(fd, reply, sizeof(reply) - 1);
+    if (got <= 0) {
+        std::cerr << "Error: no reply from lease endpoint\n";
+        close(fd);
+        return 1;
+    }
+    reply[got] = '\0';
+    fputs(reply, stdout);
+    fflush(stdout);
+    if (strncmp(reply, "error", 5) == 0) {
+        close(fd);
+        return 1;
+    }
+
+    // Hold the lease: forward stdin lines as live reconfiguration
+    // commands, echo the daemon's acknowledgements, and exit when the
+    // daemon goes away. Stdin EOF (a closed pipe) only stops the
+    // forwarding — the lease survives until this process exits.
+    bool stdin_open = true;
+    for (;;) {
+        struct pollfd pfds[2] = { { fd, POLLIN, 0 },
+                                  { stdin_open ? STDIN_FILENO : -1, POLLIN, 0 } };
+        if (poll(pfds, 2, -1) <= 0) {
+            continue;
+        }
+        if (pfds[0].revents != 0) {
+            got = read(fd, reply, sizeof(reply) - 1);
+            if (got <= 0) {
+                break; // daemon exited; the lease is gone
+            }
+            reply[got] = '\0';
+            fputs(reply, stdout);
+            fflush(stdout);
+        }
+        if (stdin_open && pfds[1].revents != 0) {
+            got = read(STDIN_FILENO, reply, sizeof(reply) - 1);
+            if (got <= 0) {
+                stdin_open = false;
+                continue;
+            }
+            if (write(fd, reply, static_cast<size_t>(got)) == -1) {
+                break;
+            }
+        }
+    }
+    close(fd);
+    return 0;
+}
 
 int main(int argc, char* argv[])
 {
+    // Decouple iostreams from C stdio: console output then buffers
+    // application-side instead of paying a synchronized flush per chain
+    std::ios::sync_with_stdio(false);
+
+    // CLI verbs dispatch before flag parsing; "attach" is a thin lease
+    // client and shares none of the simulator's options
+    if (argc >= 2 && strcmp(argv[1], "attach") == 0) {
+        return runAttachClient(argc, argv);
+    }
+
     std::string pipe_path    = "";
     std::string serial_port  = "";
     std::string file_path    = ""; // New variable for the NMEA log file
+    std::vector<std::string> extra_files; // Additional --file logs, merged by timestamp
     double interval          = 1.0; // Default interval in seconds
     std::string symlink_path = "/tmp/ttySIMULATOR"; // Default symlink path
+    double start_lat         = std::nan(""); // Motion model start point
+    double start_lon         = std::nan("");
+    double speed_knots       = std::nan(""); // Motion model speed/course
+    double course_deg        = std::nan("");
+    unsigned sentence_mask   = kAllSentences; // Enabled sentence types
+    uint64_t seed            = 0; // RNG seed (--seed)
+    bool has_seed            = false;
+    bool quiet               = false; // Suppress per-cycle console output
+    unsigned log_every       = 1; // Log 1-in-N cycles (--log-every)
+    double preview_interval  = 0; // Live-mirror render period (--preview); 0 = off
+    BackpressurePolicy backpressure = BackpressurePolicy::Block; // PTY slow-consumer policy
+    unsigned queue_depth     = 0; // Pending-cycle queue depth (--queue); 0 = off
+    QueuePolicy queue_policy = QueuePolicy::DropOldest; // Full-queue policy (--queue)
+    bool use_uring           = false; // io_uring output backend (--io-backend)
+    bool use_vmsplice        = false; // vmsplice pipe backend (--io-backend)
+    bool use_pipeline        = false; // generation/writing pipeline (--pipeline)
+    bool use_overlap         = false; // double-buffered generation (--overlap)
+    bool late_stamp          = false; // patch time fields at emission (--late-stamp)
+    unsigned prebake_cycles  = 0; // Prebaked cycle corpus size (--prebake); 0 = off
+    bool prebake_time        = false; // Patch UTC times per emission (--prebake-time)
+    int cpu_affinity         = -1; // Writer thread CPU pin (--cpu)
+    int gen_cpu_affinity     = -1; // Generator thread CPU pin (--gen-cpu)
+    int rt_priority          = 0; // SCHED_FIFO priority (--rt-prio)
+    speed_t line_speed       = B9600; // Advertised PTY line speed (--baud)
+    unsigned baud_value      = 9600; // Numeric --baud for byte pacing
+    bool uart_pace           = false; // Trickle bytes at the line rate (--uart-pace)
+    size_t pipe_buffer       = 0; // Kernel FIFO capacity (--pipe-buffer); 0 = default
+    bool raw_profile         = false; // Termios profile (--tty-profile raw)
+    FlushMode flush_mode     = FlushMode::None; // fsync policy (--flush)
+    double flush_value       = 0.0;
+    bool enable_pty          = false; // PTY sink alongside pipe/serial (--pty)
+    std::string udp_host     = ""; // UDP destination (--udp host:port)
+    uint16_t udp_port        = 0;
+    std::vector<std::pair<std::string, uint16_t>> udp_extras; // additional --udp fan-out targets
+    int udp_ttl              = 1; // Multicast/unicast TTL (--udp-ttl)
+    bool udp_txtime          = false; // SO_TXTIME deadline stamping (--udp-txtime)
+    std::string tcp_host     = ""; // TCP listen address (--tcp [host]:port)
+    uint16_t tcp_port        = 0;
+    std::string unix_path    = ""; // Unix SEQPACKET socket path (--unix)
+    std::string shm_name     = ""; // Shared-memory ring name (--shm)
+    std::string mmap_out_path; // Memory-mapped ring file (--mmap-out)
+    uint64_t start_cycle     = 0; // First replayed cycle (--start-cycle)
+    std::string compile_in   = ""; // Offline log compile (--compile-log / --transcode)
+    std::string compile_out  = "";
+    std::string emit_log_path; // Offline corpus generation (--emit-log)
+    uint64_t emit_cycles     = 0; // Cycle count for --emit-log (--cycles)
+    double rate              = 1.0; // Replay rate multiplier (--rate); 0 = max
+    bool has_rate            = false;
+    bool pace_log            = false; // Timestamp-faithful pacing (--pace log)
+    bool follow              = false; // Tail a growing log (--follow)
+    bool retime              = false; // Fresh wall-clock time fields (--retime)
+    std::vector<std::string> replay_filter; // Replay sentence filter (--only / --drop)
+    bool replay_filter_drop  = false;
+    long prefetch_mb         = -1; // Replay prefetch window in MB (--prefetch); -1 = default
+    unsigned device_count    = 1; // Simulated devices in one process (--count)
+    bool fleet_coro          = false; // Coroutine fleet backend (--fleet-backend)
+    bool fork_sinks          = false; // Forked per-sink writer processes (--fork-sinks)
+    unsigned pool_workers    = 0; // Pre-forked writer pool size (--sink-pool); 0 = off
+    std::string pool_socket; // Control socket consumers attach at (--sink-pool)
+    bool selftest            = false; // Verified PTY loopback benchmark (--selftest)
+    unsigned burst           = 1; // Cycles emitted back to back per interval (--burst)
+    std::string jitter_spec; // Deterministic deadline jitter (--jitter); empty = off
+    unsigned sat_target      = 0; // Dense-sky stress target (--sats); 0 = defaults
+    unsigned gsv_suppress    = 0; // Unchanged-GSV omission period (--gsv-suppress); 0 = off
+    bool fixed_width         = false; // Space-padded fixed field offsets (--fixed-width)
+    std::string tag_source   = ""; // NMEA 4.10 TAG block source name (--tag); empty = off
+    unsigned vessel_count    = 0; // AIS vessel population (--vessels); 0 = default
+    unsigned ubx_pvt_div     = 1; // UBX NAV-PVT divisor (--ubx-rate pvt:<n>)
+    unsigned ubx_sat_div     = 5; // UBX NAV-SAT divisor (--ubx-rate sat:<n>)
+    bool has_ubx_rate        = false;
+    double imu_rate          = 0; // NFIMU rate in Hz (--imu-rate); 0 = with the cycle
+    std::string capture_path; // Binary emitted-stream capture (--capture)
+    bool capture_direct      = false; // O_DIRECT capture writing (--capture-direct)
+    unsigned long mem_budget_mb = 0; // RSS budget in MB (--mem-budget); 0 = unlimited
+    std::string bridge_in; // Native PTY bridge in port (--bridge <in>:<out>)
+    std::string bridge_out; // Native PTY bridge out port
+    bool compress_sinks = false; // Deflate the TCP/unix sinks (--compress)
+    std::string pps_path; // 1PPS pulse FIFO (--pps); empty = off
+    double time_scale = 1.0; // Simulation clock acceleration (--time-scale)
+    std::string relay_host; // Compressed-stream relay source (--relay); empty = off
+    uint16_t relay_port = 0;
+    std::vector<std::string> plugin_paths; // Custom sentence plugins (--plugin)
+    std::string almanac_path; // YUMA almanac for GPS geometry (--almanac)
+    std::string checkpoint_path; // Warm-start snapshot target (--checkpoint)
+    std::string resume_path; // Checkpoint to resume from (--resume)
+    double stats_interval    = 0; // Throughput report period (--stats); 0 = off
+    long backlog_warn        = 0; // Sink backlog warning threshold in bytes (--backlog-warn)
+    std::vector<unsigned> adapt_levels; // Rate-step multipliers (--adaptive-rate); empty = fixed
+    std::string metrics_name; // Abstract metrics socket (--metrics); empty = off
+    std::string control_name; // Abstract control socket (--control); empty = off
+    std::string lease_name; // Abstract fleet lease socket (--lease); empty = off
+    double calibrate_seconds = 0; // Calibration run length (--calibrate); 0 = off
+    bool calibrate_json      = false; // JSON calibration report (--calibrate-json)
+    std::string scenario_path; // Scripted-run timeline file (--scenario)
+    std::string route_path; // Waypoint route file (--route)
+    double duration_seconds  = 0; // Timed-run length (--duration); 0 = until SIGINT
+    // Per-sink fan-out shaping (--sink-rate, --sink-sentences)
+    std::vector<std::pair<PtyHandler::SinkId, unsigned>> sink_rates;
+    std::vector<std::pair<PtyHandler::SinkId, unsigned>> sink_masks;
+    bool has_link            = false; // --link given explicitly
 
     // Simple command-line argument parsing
     for (int i = 1; i < argc; ++i) {
@@ -19,32 +238,1156 @@ int main(int argc, char* argv[])
         } else if ((arg == "-s" || arg == "--serial") && i + 1 < argc) {
             serial_port = argv[++i];
         } else if ((arg == "-f" || arg == "--file") && i + 1 < argc) { // New option
-            file_path = argv[++i];
+            // Repeated --file merges the logs into one timestamp-
+            // ordered stream (per-source field captures)
+            if (file_path.empty()) {
+                file_path = argv[++i];
+            } else {
+                extra_files.push_back(argv[++i]);
+            }
         } else if ((arg == "-i" || arg == "--interval") && i + 1 < argc) {
             interval = std::stod(argv[++i]);
+        } else if (arg == "--time-scale" && i + 1 < argc) {
+            time_scale = std::stod(argv[++i]);
+            if (time_scale <= 0) {
+                std::cerr << "Error: --time-scale expects a positive factor\n";
+                return 1;
+            }
         } else if ((arg == "-l" || arg == "--link") && i + 1 < argc) {
             symlink_path = argv[++i];
+            has_link     = true;
+        } else if (arg == "--count" && i + 1 < argc) {
+            device_count = static_cast<unsigned>(std::stoul(argv[++i]));
+            if (device_count == 0) {
+                std::cerr << "Error: --count expects a positive device count\n";
+                return 1;
+            }
+        } else if ((arg == "--sink-rate" || arg == "--sink-sentences") && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t colon      = value.find(':');
+            PtyHandler::SinkId sink;
+            if (colon == std::string::npos || colon + 1 >= value.size()
+                || !PtyHandler::sinkFromName(value.substr(0, colon), sink)) {
+                std::cerr << "Error: " << arg
+                          << " expects <pipe|serial|pty|udp|tcp|unix|shm>:<value>\n";
+                return 1;
+            }
+            if (arg == "--sink-rate") {
+                unsigned divisor = static_cast<unsigned>(std::stoul(value.substr(colon + 1)));
+                if (divisor == 0) {
+                    std::cerr << "Error: --sink-rate expects a positive divisor\n";
+                    return 1;
+                }
+                sink_rates.emplace_back(sink, divisor);
+            } else {
+                unsigned mask = NmeaGenerator::sentenceMaskFromList(value.substr(colon + 1));
+                if (mask == 0) {
+                    std::cerr << "Error: unknown sentence name in --sink-sentences list\n";
+                    return 1;
+                }
+                sink_masks.emplace_back(sink, mask);
+            }
+        } else if (arg == "--metrics" && i + 1 < argc) {
+            metrics_name = argv[++i];
+            if (metrics_name.empty()) {
+                std::cerr << "Error: --metrics expects a socket name\n";
+                return 1;
+            }
+        } else if (arg == "--control" && i + 1 < argc) {
+            control_name = argv[++i];
+            if (control_name.empty()) {
+                std::cerr << "Error: --control expects a socket name\n";
+                return 1;
+            }
+        } else if (arg == "--lease" && i + 1 < argc) {
+            lease_name = argv[++i];
+            if (lease_name.empty()) {
+                std::cerr << "Error: --lease expects a socket name\n";
+                return 1;
+            }
+        } else if (arg == "--adaptive-rate" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t pos        = 0;
+            while (pos <= value.size()) {
+                size_t comma        = value.find(',', pos);
+                std::string field   = value.substr(
+                    pos, comma == std::string::npos ? std::string::npos : comma - pos);
+                unsigned multiplier = field.empty()
+                    ? 0
+                    : static_cast<unsigned>(std::stoul(field));
+                bool bad = adapt_levels.empty() ? multiplier != 1
+                                                : multiplier <= adapt_levels.back();
+                if (bad) {
+                    std::cerr << "Error: --adaptive-rate expects ascending interval "
+                                 "multipliers starting at 1, e.g. 1,2,4\n";
+                    return 1;
+                }
+                adapt_levels.push_back(multiplier);
+                if (comma == std::string::npos) {
+                    break;
+                }
+                pos = comma + 1;
+            }
+        } else if (arg == "--stats" && i + 1 < argc) {
+            stats_interval = std::stod(argv[++i]);
+            if (stats_interval <= 0) {
+                std::cerr << "Error: --stats expects a positive period in seconds\n";
+                return 1;
+            }
+        } else if (arg == "--backlog-warn" && i + 1 < argc) {
+            backlog_warn = std::stol(argv[++i]);
+            if (backlog_warn <= 0) {
+                std::cerr << "Error: --backlog-warn expects a threshold in bytes\n";
+                return 1;
+            }
+        } else if (arg == "--duration" && i + 1 < argc) {
+            duration_seconds = std::stod(argv[++i]);
+            if (duration_seconds <= 0) {
+                std::cerr << "Error: --duration expects a positive run length in seconds\n";
+                return 1;
+            }
+        } else if (arg == "--calibrate" && i + 1 < argc) {
+            calibrate_seconds = std::stod(argv[++i]);
+            if (calibrate_seconds <= 0) {
+                std::cerr << "Error: --calibrate expects a positive duration in seconds\n";
+                return 1;
+            }
+        } else if (arg == "--calibrate-json") {
+            calibrate_json = true;
+        } else if (arg == "--scenario" && i + 1 < argc) {
+            scenario_path = argv[++i];
+            if (scenario_path.empty()) {
+                std::cerr << "Error: --scenario expects a file path\n";
+                return 1;
+            }
+        } else if (arg == "--route" && i + 1 < argc) {
+            route_path = argv[++i];
+            if (route_path.empty()) {
+                std::cerr << "Error: --route expects a file path\n";
+                return 1;
+            }
+        } else if (arg == "--burst" && i + 1 < argc) {
+            burst = static_cast<unsigned>(std::stoul(argv[++i]));
+            if (burst == 0) {
+                std::cerr << "Error: --burst expects a positive cycle count\n";
+                return 1;
+            }
+        } else if (arg == "--jitter" && i + 1 < argc) {
+            jitter_spec = argv[++i];
+        } else if (arg == "--fork-sinks") {
+            fork_sinks = true;
+        } else if (arg == "--sink-pool" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t colon      = value.find(':');
+            if (colon == std::string::npos || colon == 0 || colon + 1 >= value.size()) {
+                std::cerr << "Error: --sink-pool expects <workers>:<socket-path>, e.g. "
+                             "--sink-pool 4:/tmp/nmea-attach.sock\n";
+                return 1;
+            }
+            pool_workers = static_cast<unsigned>(std::stoul(value.substr(0, colon)));
+            pool_socket  = value.substr(colon + 1);
+            if (pool_workers == 0) {
+                std::cerr << "Error: --sink-pool expects a positive worker count\n";
+                return 1;
+            }
+        } else if (arg == "--fleet-backend" && i + 1 < argc) {
+            std::string backend = argv[++i];
+            if (backend == "coro") {
+                fleet_coro = true;
+            } else if (backend != "wheel") {
+                std::cerr << "Error: --fleet-backend expects wheel or coro\n";
+                return 1;
+            }
+        } else if (arg == "--start" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t comma      = value.find(',');
+            if (comma == std::string::npos) {
+                std::cerr << "Error: --start expects <lat>,<lon>\n";
+                return 1;
+            }
+            start_lat = std::stod(value.substr(0, comma));
+            start_lon = std::stod(value.substr(comma + 1));
+        } else if (arg == "--speed" && i + 1 < argc) {
+            speed_knots = std::stod(argv[++i]);
+        } else if (arg == "--course" && i + 1 < argc) {
+            course_deg = std::stod(argv[++i]);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed     = std::stoull(argv[++i]);
+            has_seed = true;
+        } else if (arg == "--sats" && i + 1 < argc) {
+            sat_target = static_cast<unsigned>(std::stoul(argv[++i]));
+            if (sat_target == 0) {
+                std::cerr << "Error: --sats expects a positive satellite count\n";
+                return 1;
+            }
+        } else if (arg == "--tag" && i + 1 < argc) {
+            tag_source = argv[++i];
+            if (tag_source.empty() || tag_source.size() > 12
+                || tag_source.find_first_of(",*\\$!") != std::string::npos) {
+                std::cerr << "Error: --tag expects a short source name (max 12 chars, "
+                             "no ',', '*' or '\\')\n";
+                return 1;
+            }
+        } else if (arg == "--fixed-width") {
+            fixed_width = true;
+        } else if (arg == "--gsv-suppress" && i + 1 < argc) {
+            gsv_suppress = static_cast<unsigned>(std::stoul(argv[++i]));
+            if (gsv_suppress < 2) {
+                std::cerr << "Error: --gsv-suppress expects a cycle count >= 2\n";
+                return 1;
+            }
+        } else if (arg == "--capture" && i + 1 < argc) {
+            capture_path = argv[++i];
+            if (capture_path.empty()) {
+                std::cerr << "Error: --capture expects a file path\n";
+                return 1;
+            }
+        } else if (arg == "--capture-direct") {
+            capture_direct = true;
+        } else if (arg == "--checkpoint" && i + 1 < argc) {
+            checkpoint_path = argv[++i];
+            if (checkpoint_path.empty()) {
+                std::cerr << "Error: --checkpoint expects a file path\n";
+                return 1;
+            }
+        } else if (arg == "--resume" && i + 1 < argc) {
+            resume_path = argv[++i];
+            if (resume_path.empty()) {
+                std::cerr << "Error: --resume expects a checkpoint path\n";
+                return 1;
+            }
+        } else if (arg == "--imu-rate" && i + 1 < argc) {
+            imu_rate = std::stod(argv[++i]);
+            if (imu_rate <= 0) {
+                std::cerr << "Error: --imu-rate expects a positive rate in Hz\n";
+                return 1;
+            }
+        } else if (arg == "--ubx-rate" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t colon      = value.find(':');
+            unsigned divisor  = 0;
+            if (colon != std::string::npos && colon + 1 < value.size()) {
+                divisor = static_cast<unsigned>(std::stoul(value.substr(colon + 1)));
+            }
+            std::string msg = colon == std::string::npos ? value : value.substr(0, colon);
+            if (divisor == 0 || (msg != "pvt" && msg != "sat")) {
+                std::cerr << "Error: --ubx-rate expects pvt:<n> or sat:<n>\n";
+                return 1;
+            }
+            (msg == "pvt" ? ubx_pvt_div : ubx_sat_div) = divisor;
+            has_ubx_rate = true;
+        } else if (arg == "--vessels" && i + 1 < argc) {
+            vessel_count = static_cast<unsigned>(std::stoul(argv[++i]));
+            if (vessel_count == 0) {
+                std::cerr << "Error: --vessels expects a positive vessel count\n";
+                return 1;
+            }
+        } else if (arg == "--sentences" && i + 1 < argc) {
+            sentence_mask = NmeaGenerator::sentenceMaskFromList(argv[++i]);
+            if (sentence_mask == 0) {
+                std::cerr << "Error: unknown sentence name in --sentences list\n";
+                return 1;
+            }
+        } else if (arg == "--backpressure" && i + 1 < argc) {
+            if (!PtyHandler::backpressureFromName(argv[++i], backpressure)) {
+                std::cerr << "Error: --backpressure expects drop, latest or block\n";
+                return 1;
+            }
+        } else if (arg == "--queue" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t colon      = value.find(':');
+            if (colon == std::string::npos || colon == 0 || colon + 1 >= value.size()) {
+                std::cerr << "Error: --queue expects <depth>:<policy>\n";
+                return 1;
+            }
+            queue_depth = static_cast<unsigned>(std::stoul(value.substr(0, colon)));
+            if (queue_depth == 0
+                || !PtyHandler::queuePolicyFromName(value.substr(colon + 1), queue_policy)) {
+                std::cerr << "Error: --queue expects a positive depth and a policy of "
+                             "oldest, newest or latest\n";
+                return 1;
+            }
+        } else if (arg == "--baud" && i + 1 < argc) {
+            unsigned value = static_cast<unsigned>(std::stoul(argv[++i]));
+            if (!PtyHandler::baudFromValue(value, line_speed)) {
+                std::cerr << "Error: unsupported --baud rate " << value << "\n";
+                return 1;
+            }
+            baud_value = value;
+        } else if (arg == "--uart-pace") {
+            uart_pace = true;
+        } else if (arg == "--pipe-buffer" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t mult       = 1;
+            if (!value.empty() && (value.back() == 'K' || value.back() == 'k')) {
+                mult = 1024;
+                value.pop_back();
+            } else if (!value.empty() && (value.back() == 'M' || value.back() == 'm')) {
+                mult = 1024 * 1024;
+                value.pop_back();
+            }
+            pipe_buffer = value.empty() ? 0 : std::stoul(value) * mult;
+            if (pipe_buffer == 0) {
+                std::cerr << "Error: --pipe-buffer expects a size like 256K or 4M\n";
+                return 1;
+            }
+        } else if (arg == "--tty-profile" && i + 1 < argc) {
+            std::string profile = argv[++i];
+            if (profile == "raw") {
+                raw_profile = true;
+            } else if (profile != "8n1") {
+                std::cerr << "Error: --tty-profile expects 8n1 or raw\n";
+                return 1;
+            }
+        } else if (arg == "--udp" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t colon      = value.rfind(':');
+            if (colon == std::string::npos || colon == 0 || colon + 1 >= value.size()) {
+                std::cerr << "Error: --udp expects <host>:<port>\n";
+                return 1;
+            }
+            if (udp_host.empty()) {
+                udp_host = value.substr(0, colon);
+                udp_port = static_cast<uint16_t>(std::stoul(value.substr(colon + 1)));
+            } else {
+                // Further destinations fan out via one sendmmsg per cycle
+                udp_extras.emplace_back(
+                    value.substr(0, colon),
+                    static_cast<uint16_t>(std::stoul(value.substr(colon + 1))));
+            }
+        } else if (arg == "--tcp" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t colon      = value.rfind(':');
+            if (colon == std::string::npos || colon + 1 >= value.size()) {
+                std::cerr << "Error: --tcp expects [host]:<port>\n";
+                return 1;
+            }
+            tcp_host = value.substr(0, colon);
+            tcp_port = static_cast<uint16_t>(std::stoul(value.substr(colon + 1)));
+        } else if (arg == "--udp-ttl" && i + 1 < argc) {
+            udp_ttl = std::stoi(argv[++i]);
+        } else if (arg == "--udp-txtime") {
+            udp_txtime = true;
+        } else if (arg == "--unix" && i + 1 < argc) {
+            unix_path = argv[++i];
+        } else if (arg == "--shm" && i + 1 < argc) {
+            shm_name = argv[++i];
+        } else if (arg == "--mmap-out" && i + 1 < argc) {
+            mmap_out_path = argv[++i];
+        } else if (arg == "--start-cycle" && i + 1 < argc) {
+            start_cycle = std::stoull(argv[++i]);
+        } else if ((arg == "--compile-log" || arg == "--transcode") && i + 2 < argc) {
+            compile_in  = argv[++i];
+            compile_out = argv[++i];
+        } else if (arg == "--emit-log" && i + 1 < argc) {
+            emit_log_path = argv[++i];
+        } else if (arg == "--cycles" && i + 1 < argc) {
+            emit_cycles = std::stoull(argv[++i]);
+            if (emit_cycles == 0) {
+                std::cerr << "Error: --cycles expects a cycle count >= 1\n";
+                return 1;
+            }
+        } else if (arg == "--rate" && i + 1 < argc) {
+            std::string value = argv[++i];
+            if (value == "max") {
+                rate = 0.0;
+            } else {
+                rate = std::stod(value);
+                if (rate <= 0.0) {
+                    std::cerr << "Error: --rate expects a positive multiplier or max\n";
+                    return 1;
+                }
+            }
+            has_rate = true;
+        } else if (arg == "--pace" && i + 1 < argc) {
+            std::string mode = argv[++i];
+            if (mode == "log") {
+                pace_log = true;
+            } else if (mode != "interval") {
+                std::cerr << "Error: --pace expects interval or log\n";
+                return 1;
+            }
+        } else if (arg == "--pipeline") {
+            use_pipeline = true;
+        } else if (arg == "--overlap") {
+            use_overlap = true;
+        } else if (arg == "--late-stamp") {
+            late_stamp = true;
+        } else if (arg == "--prebake" && i + 1 < argc) {
+            prebake_cycles = static_cast<unsigned>(std::stoul(argv[++i]));
+            if (prebake_cycles == 0) {
+                std::cerr << "Error: --prebake expects a cycle count >= 1\n";
+                return 1;
+            }
+        } else if (arg == "--prebake-time") {
+            prebake_time = true;
+        } else if (arg == "--cpu" && i + 1 < argc) {
+            cpu_affinity = std::stoi(argv[++i]);
+        } else if (arg == "--gen-cpu" && i + 1 < argc) {
+            gen_cpu_affinity = std::stoi(argv[++i]);
+        } else if (arg == "--rt-prio" && i + 1 < argc) {
+            rt_priority = std::stoi(argv[++i]);
+            if (rt_priority < 1 || rt_priority > 99) {
+                std::cerr << "Error: --rt-prio expects a SCHED_FIFO priority 1..99\n";
+                return 1;
+            }
+        } else if (arg == "--follow") {
+            follow = true;
+        } else if (arg == "--retime") {
+            retime = true;
+        } else if ((arg == "--only" || arg == "--drop") && i + 1 < argc) {
+            if (!replay_filter.empty()) {
+                std::cerr << "Error: --only and --drop are mutually exclusive "
+                             "and given at most once\n";
+                return 1;
+            }
+            replay_filter_drop = arg == "--drop";
+            std::string list   = argv[++i];
+            size_t pos         = 0;
+            while (pos <= list.size()) {
+                size_t comma = list.find(',', pos);
+                if (comma == std::string::npos) {
+                    comma = list.size();
+                }
+                if (comma > pos) {
+                    replay_filter.push_back(list.substr(pos, comma - pos));
+                }
+                pos = comma + 1;
+            }
+            if (replay_filter.empty()) {
+                std::cerr << "Error: " << arg
+                          << " expects a comma-separated sentence type list\n";
+                return 1;
+            }
+        } else if (arg == "--prefetch" && i + 1 < argc) {
+            prefetch_mb = std::stol(argv[++i]);
+            if (prefetch_mb < 0) {
+                std::cerr << "Error: --prefetch expects a window size in MB (0 disables)\n";
+                return 1;
+            }
+        } else if (arg == "--pty") {
+            enable_pty = true;
+        } else if (arg == "--flush" && i + 1 < argc) {
+            if (!PtyHandler::flushFromName(argv[++i], flush_mode, flush_value)) {
+                std::cerr << "Error: --flush expects none, every:<n> or secs:<x>\n";
+                return 1;
+            }
+        } else if (arg == "--io-backend" && i + 1 < argc) {
+            std::string backend = argv[++i];
+            if (backend == "uring") {
+                use_uring = true;
+            } else if (backend == "vmsplice") {
+                use_vmsplice = true;
+            } else if (backend != "write") {
+                std::cerr << "Error: --io-backend expects write, uring or vmsplice\n";
+                return 1;
+            }
+        } else if (arg == "--plugin" && i + 1 < argc) {
+            plugin_paths.push_back(argv[++i]);
+        } else if (arg == "--almanac" && i + 1 < argc) {
+            almanac_path = argv[++i];
+        } else if (arg == "--selftest") {
+            selftest = true;
+        } else if (arg == "--startup-report") {
+            StartupReport::enable();
+        } else if (arg == "--bridge" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t colon      = value.find(':');
+            if (colon == std::string::npos || colon == 0 || colon + 1 >= value.size()) {
+                std::cerr << "Error: --bridge expects <in-port>:<out-port>, e.g. "
+                             "/tmp/gps_input:/tmp/gps_output\n";
+                return 1;
+            }
+            bridge_in  = value.substr(0, colon);
+            bridge_out = value.substr(colon + 1);
+        } else if (arg == "--compress") {
+            compress_sinks = true;
+        } else if (arg == "--pps" && i + 1 < argc) {
+            pps_path = argv[++i];
+        } else if (arg == "--relay" && i + 1 < argc) {
+            std::string value = argv[++i];
+            size_t colon      = value.rfind(':');
+            if (colon == std::string::npos || colon == 0 || colon + 1 >= value.size()) {
+                std::cerr << "Error: --relay expects <host>:<port>\n";
+                return 1;
+            }
+            relay_host = value.substr(0, colon);
+            relay_port = static_cast<uint16_t>(std::stoul(value.substr(colon + 1)));
+        } else if (arg == "--mem-budget" && i + 1 < argc) {
+            mem_budget_mb = std::stoul(argv[++i]);
+            if (mem_budget_mb == 0) {
+                std::cerr << "Error: --mem-budget expects a positive size in MB\n";
+                return 1;
+            }
+        } else if (arg == "-q" || arg == "--quiet") {
+            quiet = true;
+        } else if (arg == "--log-every" && i + 1 < argc) {
+            log_every = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--preview" && i + 1 < argc) {
+            preview_interval = std::stod(argv[++i]);
+            if (preview_interval <= 0) {
+                std::cerr << "Error: --preview expects a positive period in seconds\n";
+                return 1;
+            }
         } else if (arg == "-h" || arg == "--help") {
             std::cout << "Usage: " << argv[0] << " [options]\n"
                       << "Options:\n"
                       << "  -p, --pipe <path>       Specify named pipe path\n"
+                      << "  --pipe-buffer <size>    Kernel FIFO capacity for the pipe sink, e.g. 256K or 4M\n"
+                      << "                          (default: kernel 64K); absorbs consumer pauses\n"
                       << "  -s, --serial <port>     Specify serial port\n"
-                      << "  -f, --file <path>       Specify NMEA log file path\n" // Help for new option
+                      << "  -f, --file <path>       Specify NMEA log file path; repeat to merge several\n" // Help for new option
+                      << "                          logs into one timestamp-ordered replay stream\n"
                       << "  -i, --interval <sec>    Specify interval between sentences (default: 1.0)\n"
+                      << "  --time-scale <x>        Accelerate the reported UTC clock by factor x (24-hour\n"
+                      << "                          scenarios in 24 minutes at 60) while cycle pacing stays\n"
+                      << "                          at the real-time --interval\n"
                       << "  -l, --link <symlink>    Specify symbolic link path for PTY (default: /tmp/ttySIMULATOR)\n"
+                      << "  --count <n>             Simulate n PTY devices in this one process; --link\n"
+                      << "                          becomes a template whose %d expands to the device\n"
+                      << "                          index (default template: /tmp/ttyGPS%d)\n"
+                      << "  --fleet-backend <b>     Fleet execution: wheel (worker threads) or coro\n"
+                      << "                          (coroutines on one epoll reactor) (default: wheel)\n"
+                      << "  --start <lat>,<lon>     Motion model start point in decimal degrees (default: random)\n"
+                      << "  --speed <knots>         Motion model speed over ground (default: random)\n"
+                      << "  --course <deg>          Motion model initial course (default: random)\n"
+                      << "  --sentences <list>      Comma-separated sentence types to emit, e.g. RMC,GGA (default: all;\n"
+                      << "                          PSIMT adds a $PSIMT,<seq>,<mono_ns>,<bytes> throughput trailer)\n"
+                      << "  --sats <n>              Dense-sky stress: target n satellites split across the\n"
+                      << "                          constellations (default: realistic counts, ~20-50)\n"
+                      << "  --gsv-suppress <m>      Omit unchanged GSV blocks, re-emitting every m-th cycle\n"
+                      << "  --fixed-width           Space-pad numeric fields to fixed widths so consumers\n"
+                      << "                          can parse by offset instead of scanning for commas\n"
+                      << "  --tag <source>          Prefix sentences with an NMEA 4.10 TAG block\n"
+                      << "                          (\\s:<source>,c:<unixtime>*hh\\) for downstream multiplexers\n"
+                      << "  --vessels <n>           AIS traffic density: n simulated vessels reporting\n"
+                      << "                          !AIVDM when AIS is in --sentences (default: 24)\n"
+                      << "  --ubx-rate <msg>:<n>    Emit the UBX binary message (pvt or sat) every n-th\n"
+                      << "                          cycle when UBX is in --sentences (defaults: pvt:1, sat:5)\n"
+                      << "  --imu-rate <hz>         Emit NFIMU at hz (e.g. 200) while the other sentences\n"
+                      << "                          keep the --interval rate, from one scheduler\n"
+                      << "  --capture <path>        Record every emitted cycle with its monotonic timestamp\n"
+                      << "                          to a binary file that --file replays directly\n"
+                      << "  --capture-direct        Write the capture through O_DIRECT double buffering,\n"
+                      << "                          bypassing the page cache so capture writeback cannot\n"
+                      << "                          perturb emission timing (needs a fresh capture file)\n"
+                      << "  --plugin <path.so>      Load a custom sentence plugin (repeatable); see\n"
+                      << "                          NmeaPlugin.h for the C ABI it must export\n"
+                      << "  --almanac <file>        Drive GPS geometry from a YUMA almanac: real PRNs and\n"
+                      << "                          rise/set tracks precomputed into lookup tables, at\n"
+                      << "                          table-interpolation cost per cycle\n"
+                      << "  --checkpoint <path>     Snapshot the generator state to path every few seconds\n"
+                      << "                          (atomic rename, off the hot path) for --resume\n"
+                      << "  --resume <ckpt>         Resume a run from a --checkpoint snapshot at the exact\n"
+                      << "                          cycle it stopped, RNG stream included\n"
+                      << "  --seed <n>              Seed the RNG for a reproducible workload (default: random)\n"
+                      << "  --backpressure <p>      PTY slow-consumer policy: drop, latest or block (default: block)\n"
+                      << "  --queue <n>:<p>         Park up to n cycles for a stalled PTY consumer and drain\n"
+                      << "                          them in order when it resumes; when full, policy p evicts\n"
+                      << "                          the oldest, refuses the newest, or coalesces to the latest\n"
+                      << "                          cycle (overrides --backpressure on the write path)\n"
+                      << "  --baud <rate>           Advertised PTY line speed, 9600..4000000 (default: 9600)\n"
+                      << "  --uart-pace             Trickle PTY bytes at the --baud line rate (token bucket,\n"
+                      << "                          1 ms quanta) instead of one burst per cycle\n"
+                      << "  --tty-profile <p>       Slave PTY termios profile: 8n1 or raw (default: 8n1)\n"
+                      << "  --udp <host>:<port>     Send cycles as UDP datagrams (multicast groups supported;\n"
+                      << "                          repeatable — extra destinations batch into one sendmmsg)\n"
+                      << "  --udp-ttl <n>           TTL for UDP output (default: 1)\n"
+                      << "  --udp-txtime            Stamp UDP datagrams with SO_TXTIME so the ETF/fq qdisc\n"
+                      << "                          releases them at their cycle deadline (hardware pacing)\n"
+                      << "  --tcp [host]:<port>     Listen for TCP consumers and fan cycles out to all\n"
+                      << "  --unix <path>           Listen on a unix SEQPACKET socket; one message per cycle\n"
+                      << "  --shm <name>            Publish cycles to a shared-memory ring (zero-copy consumers)\n"
+                      << "  --mmap-out <file>       Write cycles into a memory-mapped ring file consumers map\n"
+                      << "                          read-only and poll at their own pace (flight recorder)\n"
+                      << "  --fork-sinks            One writer process per sink, fed from a shared ring\n"
+                      << "  --sink-pool <n>:<sock>  Pre-fork n writer workers sharing the cycle ring; each\n"
+                      << "                          consumer connecting at the unix socket is adopted by a\n"
+                      << "                          worker (SCM_RIGHTS fd pass, no per-attach setup)\n"
+                      << "                          (generate once, per-sink crash isolation)\n"
+                      << "  --stats <sec>           Print a one-line per-sink throughput report every sec\n"
+                      << "                          seconds (cycles, sentences, KB/s, drops, retries)\n"
+                      << "  --backlog-warn <bytes>  Warn when the kernel buffer toward a consumer holds\n"
+                      << "                          this many unread bytes (sampled at 1 Hz; the gauges\n"
+                      << "                          also feed --stats and --metrics)\n"
+                      << "  --adaptive-rate <list>  Step the cycle interval along the given multipliers\n"
+                      << "                          (e.g. 1,2,4) when sinks report backpressure, and back\n"
+                      << "                          up once they drain (throttling consumers degrade\n"
+                      << "                          gracefully instead of dropping randomly)\n"
+                      << "  --metrics <name>        Answer stats queries on abstract unix socket <name>\n"
+                      << "  --control <name>        Accept live reconfiguration commands (interval, speed,\n"
+                      << "                          course, sats, fix, hdop, sentences) on abstract unix\n"
+                      << "                          socket <name>; applied at the next cycle, no restart\n"
+                      << "                          with a JSON counter snapshot (Prometheus scraping)\n"
+                      << "  --lease <name>          With --count: lease endpoint on abstract socket <name>;\n"
+                      << "                          'nmea_simulator attach <name>' leases a warmed device\n"
+                      << "                          and the device recycles when the client disconnects\n"
+                      << "  --duration <sec>        Exit cleanly after sec seconds (profiling runs end on a\n"
+                      << "                          cycle boundary instead of mid-write on SIGINT)\n"
+                      << "  --selftest              Read our own PTY back on a side thread, verify framing\n"
+                      << "                          and checksums, and report loss and the verified rate\n"
+                      << "  --startup-report        Print a phase-by-phase startup timing breakdown (parse,\n"
+                      << "                          sink setup, symlink, first generate, first write)\n"
+                      << "  --bridge <in>:<out>     Run as a two-port PTY relay: create both linked ports\n"
+                      << "                          and splice bytes between them in-process (<in> may\n"
+                      << "                          name an existing device to forward instead)\n"
+                      << "  --compress              Deflate the --tcp/--unix sinks per cycle (independent\n"
+                      << "                          frames, so consumers can attach mid-stream); pair the\n"
+                      << "                          TCP side with --relay on the receiving host\n"
+                      << "  --relay <host>:<port>   Run as a decompressing consumer: connect to a --compress\n"
+                      << "                          TCP sink, inflate each frame and re-emit plain NMEA on\n"
+                      << "                          the local --link PTY\n"
+                      << "  --pps <path>            Emit a 1PPS pulse: one byte to FIFO <path> at each top-\n"
+                      << "                          of-second of the writer's deadline grid, so pulse-to-\n"
+                      << "                          sentence alignment is bounded by timer accuracy\n"
+                      << "  --mem-budget <MB>       Cap the pools (replay cache, prebaked corpus, capture\n"
+                      << "                          ring): over-budget configurations are refused at startup\n"
+                      << "                          and peak RSS is reported at exit\n"
+                      << "  --calibrate <sec>       Run generate + write unpaced for sec seconds and report\n"
+                      << "                          cycles/sec, MB/s and p99 cycle time, then exit\n"
+                      << "  --calibrate-json        Emit the --calibrate report as one JSON object\n"
+                      << "  --scenario <file>       Scripted run: apply the file's [[phase]] timeline (speed,\n"
+                      << "                          course, sats, interval changes) at the listed times\n"
+                      << "  --route <file>          Follow a waypoint route (lat,lon[,speed] per line) on\n"
+                      << "                          great-circle legs instead of the random drift\n"
+                      << "  --burst <m>             Emit m cycles back to back each interval in one write\n"
+                      << "                          (UART FIFO flush patterns, or a cheap throughput mode)\n"
+                      << "  --jitter <dist>         Offset cycle deadlines by seeded noise, uniform:<ms> or\n"
+                      << "                          gauss:<ms> — the same pattern every run (--seed varies it)\n"
+                      << "  --sink-rate <s>:<n>     Fan-out: the named sink emits every n-th cycle only\n"
+                      << "  --sink-sentences <s>:<list>  Fan-out: sentence types the named sink receives\n"
+                      << "  --start-cycle <n>       Begin --file replay at cycle n (wraps past the end)\n"
+                      << "  --compile-log <in> <out> Compile a text log into a binary replay container and exit\n"
+                      << "  --transcode <in> <out>  Alias of --compile-log\n"
+                      << "  --emit-log <path>       Batch-generate --cycles cycles straight to a file at disk\n"
+                      << "                          bandwidth (seeded, scenario-aware) and exit\n"
+                      << "  --cycles <n>            Cycle count for --emit-log\n"
+                      << "  --rate <x|max>          Replay rate multiplier; max disables pacing entirely\n"
+                      << "  --pace <mode>           Replay pacing: interval (fixed) or log (RMC timestamps)\n"
+                      << "  --follow                Tail a growing log at EOF instead of rewinding\n"
+                      << "  --retime                Patch replayed time fields to the current wall clock\n"
+                      << "                          (checksums repaired in place; pacing is unaffected)\n"
+                      << "  --prefetch <MB>         Replay readahead window: MADV_WILLNEED issued this far\n"
+                      << "                          ahead of the cursor (default: 64; 0 disables)\n"
+                      << "  --only <list>           Replay only these sentence types, e.g. RMC,GGA; filtered\n"
+                      << "                          at index build, so emission tests nothing per line\n"
+                      << "  --drop <list>           Replay everything except these types, e.g. GSV,VDM;\n"
+                      << "                          each filter keeps its own cached .idx sidecar\n"
+                      << "  --pty                   Add the PTY sink alongside --pipe/--serial (fan-out)\n"
+                      << "  --flush <policy>        Serial fsync policy: none, every:<n> or secs:<x> (default: none)\n"
+                      << "  --io-backend <b>        Output backend: write, uring or vmsplice (default: write)\n"
+                      << "  --pipeline              Generate on a separate thread, overlapping compute with I/O\n"
+                      << "  --overlap               Double-buffered generation: one cycle of lookahead only\n"
+                      << "  --late-stamp            Patch UTC time fields and checksums at emission, not\n"
+                      << "                          generation, so the wire carries the write-time clock\n"
+                      << "  --prebake <n>           Bake n cycles up front and stream them round-robin\n"
+                      << "  --prebake-time          Patch UTC time fields in place on each prebaked emission\n"
+                      << "  --cpu <n>               Pin the writer thread to CPU n\n"
+                      << "  --gen-cpu <n>           Pin the pipeline generator thread to CPU n\n"
+                      << "  --rt-prio <n>           SCHED_FIFO priority 1..99 (degrades without CAP_SYS_NICE)\n"
+                      << "  -q, --quiet             Suppress per-cycle console output\n"
+                      << "  --log-every <n>         Log only every n-th cycle to the console (default: 1)\n"
+                      << "  --preview <sec>         Render a live snapshot of the latest cycle every sec\n"
+                      << "                          seconds instead of dumping every cycle\n"
                       << "  -h, --help              Show this help message\n";
             return 0;
         }
     }
+    StartupReport::mark(StartupReport::Parse);
+
+    // Arm the ledger before any pool reserves; a refused reservation
+    // surfaces as that pool's startup failure
+    if (mem_budget_mb > 0) {
+        MemBudget::setBudget(mem_budget_mb * 1024ull * 1024ull);
+    }
+
+    // Offline mode: compile a text log into the binary replay container
+    // and exit; CI pipelines run this once per log, then every replay
+    // job starts without a scan
+    if (!compile_in.empty()) {
+        return ReplayLog::compile(compile_in, compile_out) ? 0 : 1;
+    }
+
+    // Corpus generation (--emit-log) runs the configured generator, so
+    // it is validated here but executed after the setters below
+    if (!emit_log_path.empty() || emit_cycles > 0) {
+        if (emit_log_path.empty() || emit_cycles == 0) {
+            std::cerr << "Error: --emit-log and --cycles go together, e.g. "
+                         "--emit-log corpus.log --cycles 100000.\n";
+            return 1;
+        }
+        if (!file_path.empty()) {
+            std::cerr << "Error: --emit-log only applies to generation, not --file replay.\n";
+            return 1;
+        }
+    }
+
+    // Bridge mode is a standalone relay: no generator, no other sinks
+    if (!bridge_out.empty()) {
+        if (!file_path.empty() || !pipe_path.empty() || !serial_port.empty()
+            || !udp_host.empty() || tcp_port != 0 || !unix_path.empty()
+            || !shm_name.empty() || enable_pty || device_count > 1) {
+            std::cerr << "Error: --bridge runs a standalone relay; do not combine it "
+                         "with --file or other sinks.\n";
+            return 1;
+        }
+    }
+
+    // Relay mode is likewise standalone: no generator, no other sinks
+    if (!relay_host.empty()) {
+        if (!file_path.empty() || !pipe_path.empty() || !serial_port.empty()
+            || !udp_host.empty() || tcp_port != 0 || !unix_path.empty()
+            || !shm_name.empty() || enable_pty || device_count > 1
+            || !bridge_out.empty()) {
+            std::cerr << "Error: --relay runs a standalone consumer; do not combine it "
+                         "with --file or other sinks.\n";
+            return 1;
+        }
+    }
+
+    if (compress_sinks && tcp_port == 0 && unix_path.empty()) {
+        std::cerr << "Error: --compress applies to the --tcp and --unix sinks.\n";
+        return 1;
+    }
 
     // Validate that either generator or file is specified, but not both
-    if (!file_path.empty() && (!pipe_path.empty() || !serial_port.empty())) {
-        std::cerr << "Error: When using --file, do not specify --pipe or --serial options.\n";
+    if (!file_path.empty()
+        && (!pipe_path.empty() || !serial_port.empty() || !udp_host.empty() || tcp_port != 0
+            || !unix_path.empty() || !shm_name.empty())) {
+        std::cerr << "Error: When using --file, do not specify --pipe, --serial, --udp, --tcp, --unix or --shm options.\n";
         return 1;
     }
 
+    // Fleet mode drives PTY devices only, and needs a link template so
+    // the N symlinks get distinct names
+    if (device_count > 1) {
+        if (!file_path.empty() || !pipe_path.empty() || !serial_port.empty()
+            || !udp_host.empty() || tcp_port != 0 || !unix_path.empty() || !shm_name.empty()
+            || enable_pty) {
+            std::cerr << "Error: --count only applies to plain PTY generation; do not combine "
+                         "it with --file or other sinks.\n";
+            return 1;
+        }
+        if (!has_link) {
+            symlink_path = "/tmp/ttyGPS%d";
+        } else if (symlink_path.find("%d") == std::string::npos) {
+            std::cerr << "Error: with --count, --link must contain %d for the device index.\n";
+            return 1;
+        }
+    }
+
+    // Independent IMU rate: retime the cycle to the IMU pitch and
+    // divide everything except NFIMU back down to the --interval rate,
+    // so both streams come from the one scheduler
+    unsigned imu_oversample = 0;
+    if (imu_rate > 0) {
+        if (!(sentence_mask & SENTENCE_NFIMU)) {
+            std::cerr << "Error: --imu-rate requires NFIMU in the --sentences list\n";
+            return 1;
+        }
+        imu_oversample = static_cast<unsigned>(
+            std::max(1.0, std::round(imu_rate * interval)));
+        interval = 1.0 / imu_rate;
+    }
+
     // Initialize the simulator with the provided arguments
     NmeaSimulator simulator(pipe_path, serial_port, file_path, interval, symlink_path);
+    simulator.configureMotion(start_lat, start_lon, speed_knots, course_deg);
+    simulator.setSentenceMask(sentence_mask);
+    if (sat_target > 0) {
+        simulator.setSatelliteTarget(sat_target);
+    }
+    if (gsv_suppress > 0) {
+        simulator.setGsvSuppress(gsv_suppress);
+    }
+    if (fixed_width) {
+        simulator.setFixedWidth(true);
+    }
+    if (!tag_source.empty()) {
+        simulator.setTagSource(tag_source);
+    }
+    if (vessel_count > 0) {
+        simulator.setVesselCount(vessel_count);
+    }
+    if (has_ubx_rate) {
+        simulator.setUbxRates(ubx_pvt_div, ubx_sat_div);
+    }
+    if (imu_oversample > 0) {
+        simulator.setImuOversample(imu_oversample);
+    }
+    if (has_seed) {
+        simulator.setSeed(seed);
+    }
+    if (time_scale != 1.0) {
+        if (!file_path.empty()) {
+            std::cerr << "Error: --time-scale only applies to generation, not --file replay.\n";
+            return 1;
+        }
+        simulator.setTimeScale(time_scale);
+    }
+    if (preview_interval > 0 && quiet) {
+        std::cerr << "Error: --preview does not combine with --quiet.\n";
+        return 1;
+    }
+    simulator.setQuiet(quiet);
+    simulator.setLogSampleEvery(log_every);
+    if (preview_interval > 0) {
+        simulator.setPreview(preview_interval);
+    }
+    simulator.setBackpressurePolicy(backpressure);
+    if (queue_depth > 0) {
+        simulator.setPendingQueue(queue_depth, queue_policy);
+    }
+    simulator.setUseUring(use_uring);
+    simulator.setUseVmsplice(use_vmsplice);
+    simulator.setUsePipeline(use_pipeline);
+    simulator.setUseOverlap(use_overlap);
+    simulator.setLateStamp(late_stamp);
+    if (prebake_time && prebake_cycles == 0) {
+        std::cerr << "Error: --prebake-time only applies with --prebake.\n";
+        return 1;
+    }
+    if (prebake_cycles > 0) {
+        // A baked corpus is fixed at startup: replay has its own
+        // buffers and scenario phase changes would never show up
+        if (!file_path.empty() || !scenario_path.empty()) {
+            std::cerr << "Error: --prebake does not combine with --file or --scenario.\n";
+            return 1;
+        }
+        simulator.setPrebake(prebake_cycles, prebake_time);
+    }
+    simulator.setCpuAffinity(cpu_affinity);
+    simulator.setGenCpuAffinity(gen_cpu_affinity);
+    simulator.setRtPriority(rt_priority);
+    simulator.setLineSpeed(line_speed);
+    simulator.setRawProfile(raw_profile);
+    simulator.setFlushPolicy(flush_mode, flush_value);
+    simulator.setEnablePty(enable_pty);
+    if (udp_txtime && udp_host.empty()) {
+        std::cerr << "Error: --udp-txtime only applies with --udp.\n";
+        return 1;
+    }
+    if (!udp_host.empty()) {
+        simulator.setUdpTarget(udp_host, udp_port, udp_ttl);
+        for (const auto& extra : udp_extras) {
+            simulator.setUdpTarget(extra.first, extra.second, udp_ttl);
+        }
+        simulator.setUdpTxtime(udp_txtime);
+    }
+    if (tcp_port != 0) {
+        simulator.setTcpBind(tcp_host, tcp_port);
+    }
+    if (!unix_path.empty()) {
+        simulator.setUnixSocket(unix_path);
+    }
+    if (!shm_name.empty()) {
+        simulator.setShmName(shm_name);
+    }
+    if (!mmap_out_path.empty()) {
+        simulator.setMmapOut(mmap_out_path);
+    }
+    if (device_count > 1) {
+        simulator.setDeviceCount(device_count);
+    }
+    if (fleet_coro) {
+        if (device_count <= 1) {
+            std::cerr << "Error: --fleet-backend only applies with --count.\n";
+            return 1;
+        }
+        simulator.setFleetCoro(true);
+    }
+    if (!lease_name.empty()) {
+        if (device_count <= 1) {
+            std::cerr << "Error: --lease only applies with --count; the pool is the fleet.\n";
+            return 1;
+        }
+        if (fleet_coro) {
+            std::cerr << "Error: --lease requires the wheel fleet backend.\n";
+            return 1;
+        }
+        simulator.setLeaseSocket(lease_name);
+    }
+    for (const auto& rate_entry : sink_rates) {
+        simulator.setSinkRate(rate_entry.first, rate_entry.second);
+    }
+    for (const auto& mask_entry : sink_masks) {
+        simulator.setSinkMask(mask_entry.first, mask_entry.second);
+    }
+    if (fork_sinks) {
+        bool any_sink = !pipe_path.empty() || !serial_port.empty() || !udp_host.empty()
+            || tcp_port != 0 || !unix_path.empty() || !shm_name.empty() || enable_pty;
+        if (!file_path.empty() || device_count > 1 || !any_sink) {
+            std::cerr << "Error: --fork-sinks needs at least one sink option and does not "
+                         "combine with --file or --count.\n";
+            return 1;
+        }
+        simulator.setForkSinks(true);
+    }
+    if (pool_workers > 0) {
+        // The pool is its own emission mode: sinks come from consumers
+        // attaching at runtime, not from the command line
+        if (!file_path.empty() || device_count > 1 || fork_sinks) {
+            std::cerr << "Error: --sink-pool does not combine with --file, --count or "
+                         "--fork-sinks.\n";
+            return 1;
+        }
+        simulator.setSinkPool(pool_workers, pool_socket);
+    }
+    if (selftest) {
+        // The loopback reader opens the slave side of our own PTY, so
+        // only the default single-device PTY sink qualifies
+        if (!pipe_path.empty() || !serial_port.empty() || !udp_host.empty() || tcp_port != 0
+            || !unix_path.empty() || !shm_name.empty() || device_count > 1 || fork_sinks) {
+            std::cerr << "Error: --selftest only applies to the default PTY sink.\n";
+            return 1;
+        }
+        simulator.setSelfTest(true);
+    }
+    if (stats_interval > 0) {
+        simulator.setStatsInterval(stats_interval);
+    }
+    if (backlog_warn > 0) {
+        simulator.setBacklogWarn(static_cast<size_t>(backlog_warn));
+    }
+    if (!adapt_levels.empty()) {
+        if (!file_path.empty()) {
+            std::cerr << "Error: --adaptive-rate does not combine with --file.\n";
+            return 1;
+        }
+        simulator.setAdaptiveRate(adapt_levels);
+    }
+    if (!metrics_name.empty()) {
+        simulator.setMetricsSocket(metrics_name);
+    }
+    if (!control_name.empty()) {
+        // Commands mutate the generator, which replay never runs
+        if (!file_path.empty()) {
+            std::cerr << "Error: --control only applies to generation, not --file replay.\n";
+            return 1;
+        }
+        simulator.setControlSocket(control_name);
+    }
+    if (calibrate_seconds > 0) {
+        if (!file_path.empty()) {
+            std::cerr << "Error: --calibrate measures the generation path; it cannot be "
+                         "combined with --file"
+                      << std::endl;
+            return 1;
+        }
+        simulator.setCalibrate(calibrate_seconds);
+    }
+    if (calibrate_json) {
+        if (calibrate_seconds <= 0) {
+            std::cerr << "Error: --calibrate-json only applies with --calibrate.\n";
+            return 1;
+        }
+        simulator.setCalibrateJson(true);
+    }
+    if (duration_seconds > 0) {
+        simulator.setDuration(duration_seconds);
+    }
+    if (!bridge_out.empty()) {
+        simulator.setBridge(bridge_in, bridge_out);
+    }
+    if (compress_sinks) {
+        simulator.setCompressSinks(true);
+    }
+    if (!relay_host.empty()) {
+        simulator.setRelay(relay_host, relay_port);
+    }
+    if (!pps_path.empty()) {
+        simulator.setPps(pps_path);
+    }
+    if (!scenario_path.empty()) {
+        // Phase changes are applied at cycle boundaries on the writer
+        // thread; replay, threaded generation and fleet clones have no
+        // such safe point
+        if (!file_path.empty() || use_pipeline || use_overlap || device_count > 1) {
+            std::cerr << "Error: --scenario does not combine with --file, --pipeline, "
+                         "--overlap or --count.\n";
+            return 1;
+        }
+        ScenarioPlan plan;
+        if (!plan.loadFile(scenario_path)) {
+            return 1;
+        }
+        simulator.setScenario(std::move(plan));
+    }
+    if (!route_path.empty()) {
+        // Route legs are compiled against the startup interval; replay
+        // has no motion model and a scenario's rate changes would
+        // silently stretch the track
+        if (!file_path.empty() || !scenario_path.empty()) {
+            std::cerr << "Error: --route does not combine with --file or --scenario.\n";
+            return 1;
+        }
+        RoutePlan route;
+        if (!route.loadFile(route_path)) {
+            return 1;
+        }
+        route.compile(interval);
+        simulator.setRoute(route.segments());
+    }
+    if (pipe_buffer > 0) {
+        if (pipe_path.empty()) {
+            std::cerr << "Error: --pipe-buffer only applies with --pipe.\n";
+            return 1;
+        }
+        simulator.setPipeBuffer(pipe_buffer);
+    }
+    if (uart_pace) {
+        // The pacer owns the PTY write path; a completion-based backend
+        // would burst whole cycles past it
+        if (use_uring) {
+            std::cerr << "Error: --uart-pace does not combine with --io-backend uring.\n";
+            return 1;
+        }
+        simulator.setUartPace(baud_value);
+    }
+    for (const auto& plugin_path : plugin_paths) {
+        // Plugin sentences join the generation pass, so replay has
+        // nothing for them to append to
+        if (!file_path.empty()) {
+            std::cerr << "Error: --plugin only applies to generation, not --file replay.\n";
+            return 1;
+        }
+        if (!simulator.loadPlugin(plugin_path)) {
+            return 1;
+        }
+    }
+    if (!almanac_path.empty()) {
+        if (!file_path.empty()) {
+            std::cerr << "Error: --almanac only applies to generation, not --file replay.\n";
+            return 1;
+        }
+        if (!simulator.loadAlmanac(almanac_path)) {
+            return 1;
+        }
+    }
+    if (!checkpoint_path.empty()) {
+        // The checkpoint hook sits on the single-generator writer
+        // loops; fleet devices each run their own generator clone
+        if (!file_path.empty() || device_count > 1) {
+            std::cerr << "Error: --checkpoint only applies to single-device generation.\n";
+            return 1;
+        }
+        simulator.setCheckpoint(checkpoint_path);
+    }
+    if (!resume_path.empty()) {
+        if (!file_path.empty()) {
+            std::cerr << "Error: --resume only applies to generation, not --file replay.\n";
+            return 1;
+        }
+        GeneratorCheckpoint ckpt;
+        FILE* in = fopen(resume_path.c_str(), "rb");
+        bool ok  = in != nullptr && fread(&ckpt, sizeof(ckpt), 1, in) == 1;
+        if (in != nullptr) {
+            fclose(in);
+        }
+        if (!ok || !simulator.resumeFrom(ckpt)) {
+            std::cerr << "Error: could not load checkpoint: " << resume_path << "\n";
+            return 1;
+        }
+        std::cout << "Resumed from checkpoint at cycle " << ckpt.cycle << "." << std::endl;
+    }
+    if (!capture_path.empty()) {
+        // The capture hook sits on the generation writer loops; a
+        // replay already has its log
+        if (!file_path.empty()) {
+            std::cerr << "Error: --capture only applies to generation, not --file replay.\n";
+            return 1;
+        }
+        if (capture_direct) {
+            simulator.setCaptureDirect(true);
+        }
+        if (!simulator.openCapture(capture_path)) {
+            return 1;
+        }
+    } else if (capture_direct) {
+        std::cerr << "Error: --capture-direct requires --capture.\n";
+        return 1;
+    }
+    if (burst > 1) {
+        if (!file_path.empty()) {
+            std::cerr << "Error: --burst only applies to generation; --file replays the "
+                         "log's own cycle structure.\n";
+            return 1;
+        }
+        simulator.setBurst(burst);
+    }
+    if (!jitter_spec.empty()) {
+        JitterDist jitter_dist;
+        double jitter_amp = 0.0;
+        if (!PtyHandler::jitterFromSpec(jitter_spec, jitter_dist, jitter_amp)) {
+            std::cerr << "Error: --jitter expects uniform:<ms> or gauss:<ms>\n";
+            return 1;
+        }
+        // Unseeded runs still get a fixed pattern: reproducibility is
+        // the point, so only an explicit --seed changes the draw
+        simulator.setJitter(jitter_dist, jitter_amp, has_seed ? seed : 1);
+    }
+    if (start_cycle != 0) {
+        if (file_path.empty()) {
+            std::cerr << "Error: --start-cycle only applies to --file replay.\n";
+            return 1;
+        }
+        simulator.setStartCycle(start_cycle);
+    }
+    if (has_rate) {
+        if (file_path.empty()) {
+            std::cerr << "Error: --rate only applies to --file replay.\n";
+            return 1;
+        }
+        simulator.setRate(rate);
+    }
+    if (pace_log) {
+        if (file_path.empty()) {
+            std::cerr << "Error: --pace only applies to --file replay.\n";
+            return 1;
+        }
+        simulator.setLogPacing(true);
+    }
+    if (follow) {
+        if (file_path.empty()) {
+            std::cerr << "Error: --follow only applies to --file replay.\n";
+            return 1;
+        }
+        simulator.setFollow(true);
+    }
+    if (!extra_files.empty()) {
+        if (follow) {
+            std::cerr << "Error: --follow replays a single --file log.\n";
+            return 1;
+        }
+        simulator.setExtraReplayFiles(extra_files);
+    }
+    if (retime) {
+        if (file_path.empty()) {
+            std::cerr << "Error: --retime only applies to --file replay.\n";
+            return 1;
+        }
+        simulator.setRetime(true);
+    }
+    if (!replay_filter.empty()) {
+        if (file_path.empty()) {
+            std::cerr << "Error: --only/--drop only apply to --file replay.\n";
+            return 1;
+        }
+        simulator.setReplayFilter(replay_filter, replay_filter_drop);
+    }
+    if (prefetch_mb >= 0) {
+        if (file_path.empty()) {
+            std::cerr << "Error: --prefetch only applies to --file replay.\n";
+            return 1;
+        }
+        simulator.setReplayPrefetch(static_cast<unsigned>(prefetch_mb));
+    }
+    // Offline mode: generate the corpus with the fully configured
+    // generator and exit without starting any sink
+    if (!emit_log_path.empty()) {
+        return simulator.emitLog(emit_log_path, emit_cycles) ? 0 : 1;
+    }
+
     simulator.start();
 
     return 0;
@@ -1,4 +1,4 @@
 #!/bin/bash
-socat -dd pty,raw,echo=0,link=/tmp/gps_input pty,raw,echo=0,link=/tmp/gps_output &
+build/nmea_simulator --bridge /tmp/gps_input:/tmp/gps_output &
 sleep 1
 build/nmea_simulator --serial /tmp/gps_input
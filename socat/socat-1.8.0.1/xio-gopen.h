@@ -1,10 +0,0 @@
-/* source: xio-gopen.h */
-/* Copyright Gerhard Rieger and contributors (see file CHANGES) */
-/* Published under the GNU General Public License V.2, see file COPYING */
-
-#ifndef __xio_gopen_h_included
-#define __xio_gopen_h_included 1
-
-extern const struct addrdesc xioaddr_gopen;
-
-#endif /* !defined(__xio_gopen_h_included) */
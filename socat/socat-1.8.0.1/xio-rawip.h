@@ -1,21 +0,0 @@
-/* source: xio-rawip.h */
-/* Copyright Gerhard Rieger and contributors (see file CHANGES) */
-/* Published under the GNU General Public License V.2, see file COPYING */
-
-#ifndef __xio_rawip_h_included
-#define __xio_rawip_h_included 1
-
-extern const struct addrdesc xioaddr_rawip_sendto;
-extern const struct addrdesc xioaddr_rawip_datagram;
-extern const struct addrdesc xioaddr_rawip_recvfrom;
-extern const struct addrdesc xioaddr_rawip_recv;
-extern const struct addrdesc xioaddr_rawip4_sendto;
-extern const struct addrdesc xioaddr_rawip4_datagram;
-extern const struct addrdesc xioaddr_rawip4_recvfrom;
-extern const struct addrdesc xioaddr_rawip4_recv;
-extern const struct addrdesc xioaddr_rawip6_sendto;
-extern const struct addrdesc xioaddr_rawip6_datagram;
-extern const struct addrdesc xioaddr_rawip6_recvfrom;
-extern const struct addrdesc xioaddr_rawip6_recv;
-
-#endif /* !defined(__xio_rawip_h_included) */
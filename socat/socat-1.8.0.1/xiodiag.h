@@ -1,11 +0,0 @@
-/* source: xiodiag.h */
-/* Copyright Gerhard Rieger and contributors (see file CHANGES) */
-/* Published under the GNU General Public License V.2, see file COPYING */
-
-#ifndef __xiodiag_h_included
-#define __xiodiag_h_included 1
-
-extern const char *ddirection[];
-extern const char *filetypenames[];
-
-#endif /* !defined(__xiodiag_h_included) */
@@ -1,56 +0,0 @@
-/* source: xiomodes.h */
-/* Copyright Gerhard Rieger and contributors (see file CHANGES) */
-/* Published under the GNU General Public License V.2, see file COPYING */
-
-#ifndef __xiomodes_h_included
-#define __xiomodes_h_included 1
-
-#include "xiolayer.h"
-#include "xio-process.h"
-#include "xio-fd.h"
-#include "xio-fdnum.h"
-#include "xio-stdio.h"
-#include "xio-named.h"
-#include "xio-file.h"
-#include "xio-creat.h"
-#include "xio-gopen.h"
-#include "xio-pipe.h"
-#include "xio-socketpair.h"
-#if _WITH_SOCKET
-#include "xio-socket.h"
-#include "xio-listen.h"
-#include "xio-unix.h"
-#include "xio-rawip.h"
-#include "xio-interface.h"
-#include "xio-ip.h"
-#if WITH_IP4
-#include "xio-ip4.h"
-#endif /* WITH_IP4 */
-#include "xio-ip6.h"
-#include "xio-ipapp.h"
-#include "xio-tcp.h"
-#include "xio-udp.h"
-#include "xio-sctp.h"
-#include "xio-dccp.h"
-#include "xio-udplite.h"
-#include "xio-socks.h"
-#include "xio-socks5.h"
-#include "xio-proxy.h"
-#include "xio-vsock.h"
-#endif /* _WITH_SOCKET */
-#include "xio-namespaces.h"
-#include "xio-posixmq.h"
-#include "xio-progcall.h"
-#include "xio-exec.h"
-#include "xio-system.h"
-#include "xio-shell.h"
-#include "xio-termios.h"
-#include "xio-readline.h"
-#include "xio-pty.h"
-#include "xio-openssl.h"
-#include "xio-tcpwrap.h"
-#include "xio-fs.h"
-#include "xio-tun.h"
-#include "xio-streams.h"
-
-#endif /* !defined(__xiomodes_h_included) */